@@ -0,0 +1,143 @@
+#ifndef __CRCR_ASYNC_FILE_HPP__
+#define __CRCR_ASYNC_FILE_HPP__
+
+#include <IoRing.hpp>
+#include <NonCopyable.hpp>
+#include <cstddef>
+#include <string>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief File read and written asynchronously through a cr::IoRing
+ *
+ * read() and write() only prepare the operations in the ring :
+ * call IoRing::submit() to start them, and get their results
+ * from IoRing::waitCompletions(). Several files can share the
+ * same ring.
+ */
+class AsyncFile : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Opening modes
+	 */
+	enum Mode
+	{
+		Read,       /**< existing file, read only */
+		Write,      /**< file created or truncated, write only */
+		ReadWrite   /**< file created if needed, read and write */
+	};
+
+	/**
+	 * \brief Construct a closed file
+	 *
+	 * \param ring Ring running the operations (must outlive the file)
+	 */
+	explicit AsyncFile(IoRing& ring);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Close the file ; its operations must be completed first.
+	 */
+	~AsyncFile();
+
+	/**
+	 * \brief Open a file
+	 *
+	 * An error message is written to std::cerr on failure.
+	 *
+	 * \param filename Path of the file
+	 * \param mode     Opening mode
+	 * \param direct   Bypass the page cache (O_DIRECT) : the buffers,
+	 *                 sizes and offsets must then be aligned on 4096
+	 *
+	 * \return True if the file was open
+	 */
+	bool open(const std::string& filename, Mode mode = Read, bool direct = false);
+
+	/**
+	 * \brief Close the file
+	 */
+	void close();
+
+	/**
+	 * \brief Tell whether the file is open
+	 */
+	bool isOpen() const;
+
+	/**
+	 * \brief Get the current size of the file
+	 *
+	 * \return Size in bytes, 0 if the file is closed
+	 */
+	Uint64 getSize() const;
+
+	/**
+	 * \brief Get the descriptor of the file
+	 *
+	 * \return File descriptor, -1 if the file is closed
+	 */
+	int getDescriptor() const;
+
+	/**
+	 * \brief Prepare a read
+	 *
+	 * \param buffer   Receives the bytes (must stay valid until completion)
+	 * \param size     Number of bytes to read
+	 * \param offset   Position in the file
+	 * \param userData Value identifying the completion
+	 *
+	 * \return False if the file is closed or the ring is full
+	 */
+	bool read(void* buffer, std::size_t size, Uint64 offset, Uint64 userData);
+
+	/**
+	 * \brief Prepare a write
+	 *
+	 * \param buffer   Bytes to write (must stay valid until completion)
+	 * \param size     Number of bytes to write
+	 * \param offset   Position in the file
+	 * \param userData Value identifying the completion
+	 *
+	 * \return False if the file is closed or the ring is full
+	 */
+	bool write(const void* buffer, std::size_t size, Uint64 offset, Uint64 userData);
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	IoRing& m_ring;  /**< ring running the operations */
+	int     m_file;  /**< file descriptor, -1 if closed */
+};
+
+} // namespace cr
+
+#endif // __CRCR_ASYNC_FILE_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::IoRing ring;
+ * cr::AsyncFile file(ring);
+ * file.open("data.bin");
+ *
+ * file.read(header, sizeof(header), 0, HeaderRead);
+ * file.read(index, indexSize, indexOffset, IndexRead);
+ * ring.submit();
+ *
+ * cr::IoCompletion completion;
+ * while (ring.getPendingCount() > 0 && ring.waitCompletions(&completion, 1))
+ *     handle(completion.userData, completion.result);
+ * \endcode
+ */
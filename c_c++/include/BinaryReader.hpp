@@ -0,0 +1,137 @@
+#ifndef __CRCR_BINARY_READER_HPP__
+#define __CRCR_BINARY_READER_HPP__
+
+#include <Config.hpp>
+#include <String.hpp>
+#include <Utf8View.hpp>
+#include <Time.hpp>
+#include <cstddef>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Decode values written by cr::BinaryWriter
+ *
+ * The reader doesn't copy its input : strings can be read as
+ * cr::Utf8View pointing into it, so that only the strings
+ * actually used are decoded. The input must then outlive
+ * the views.
+ *
+ * Reading past the end or a malformed varint makes the reader
+ * invalid : all the following reads fail, so that a sequence
+ * of reads can be checked once at the end.
+ */
+class BinaryReader
+{
+public:
+
+	/**
+	 * \brief Construct a reader on encoded bytes
+	 *
+	 * \param data Pointer to the first byte
+	 * \param size Number of bytes
+	 */
+	BinaryReader(const char* data, std::size_t size);
+
+	/**
+	 * \brief Read an unsigned integer
+	 *
+	 * \param value Receives the integer
+	 *
+	 * \return True on success
+	 */
+	bool readUint(Uint64& value);
+
+	/**
+	 * \brief Read a signed integer
+	 *
+	 * \param value Receives the integer
+	 *
+	 * \return True on success
+	 */
+	bool readInt(Int64& value);
+
+	/**
+	 * \brief Read a string as a view on the input, without copy
+	 *
+	 * The bytes are not checked : see Utf8View::isValid().
+	 *
+	 * \param text Receives the UTF-8 bytes of the string
+	 *
+	 * \return True on success
+	 */
+	bool readUtf8(Utf8View& text);
+
+	/**
+	 * \brief Read a string and decode it
+	 *
+	 * Each malformed or truncated UTF-8 sequence is decoded as
+	 * U+FFFD, the bytes after it are kept (see StringBuilder::appendUtf8).
+	 *
+	 * \param str Receives the string
+	 *
+	 * \return True on success
+	 */
+	bool readString(String& str);
+
+	/**
+	 * \brief Read a time value
+	 *
+	 * \param time Receives the time
+	 *
+	 * \return True on success
+	 */
+	bool readTime(Time& time);
+
+	/**
+	 * \brief Tell whether all the reads succeeded so far
+	 */
+	bool isValid() const;
+
+	/**
+	 * \brief Tell whether all the input was read
+	 */
+	bool endOfData() const;
+
+	/**
+	 * \brief Get the number of bytes read
+	 */
+	std::size_t getPosition() const;
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	const char* m_data;     /**< first byte of the input */
+	std::size_t m_size;     /**< number of bytes of the input */
+	std::size_t m_position; /**< next byte to read */
+	bool        m_isValid;  /**< did all the reads succeed? */
+};
+
+} // namespace cr
+
+#endif // __CRCR_BINARY_READER_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::BinaryReader reader(message, size);
+ *
+ * cr::Uint64 count = 0;
+ * reader.readUint(count);
+ * for (cr::Uint64 i = 0; i < count && reader.isValid(); ++i)
+ * {
+ *     cr::Utf8View name;
+ *     cr::Time duration;
+ *     if (reader.readUtf8(name) && reader.readTime(duration))
+ *         index(name, duration);
+ * }
+ * \endcode
+ */
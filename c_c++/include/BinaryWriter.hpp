@@ -0,0 +1,131 @@
+#ifndef __CRCR_BINARY_WRITER_HPP__
+#define __CRCR_BINARY_WRITER_HPP__
+
+#include <Config.hpp>
+#include <StringView.hpp>
+#include <Utf8View.hpp>
+#include <Time.hpp>
+#include <cstddef>
+#include <vector>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Encode values in a compact binary format
+ *
+ * The format, read back by cr::BinaryReader, is :
+ * \li unsigned integers : varint (7 bits per byte, low bits
+ *     first, high bit set on all bytes but the last)
+ * \li signed integers : zig-zag mapped to unsigned, then varint,
+ *     so that small negative numbers stay short
+ * \li strings : varint number of bytes, then the UTF-8 bytes
+ * \li times : signed number of microseconds
+ *
+ * There is no tag nor padding : the reader must know the
+ * sequence of types written.
+ */
+class BinaryWriter
+{
+public:
+
+	/**
+	 * \brief Construct an empty writer
+	 *
+	 * \param capacity Number of bytes to reserve
+	 */
+	explicit BinaryWriter(std::size_t capacity = 0);
+
+	/**
+	 * \brief Write an unsigned integer
+	 *
+	 * \param value Integer, 1 byte below 128 up to 10 bytes
+	 */
+	BinaryWriter& writeUint(Uint64 value);
+
+	/**
+	 * \brief Write a signed integer
+	 *
+	 * \param value Integer, 1 byte between -64 and 63 up to 10 bytes
+	 */
+	BinaryWriter& writeInt(Int64 value);
+
+	/**
+	 * \brief Write a string, encoded in UTF-8
+	 *
+	 * Invalid code points are written as U+FFFD.
+	 *
+	 * \param str String to write
+	 */
+	BinaryWriter& writeString(StringView str);
+
+	/**
+	 * \brief Write UTF-8 bytes as a string, without decoding them
+	 *
+	 * \param text UTF-8 bytes
+	 */
+	BinaryWriter& writeUtf8(Utf8View text);
+
+	/**
+	 * \brief Write a time value
+	 *
+	 * \param time Time, at the microsecond precision
+	 */
+	BinaryWriter& writeTime(Time time);
+
+	/**
+	 * \brief Get the encoded bytes
+	 *
+	 * The pointer is invalidated by the next write.
+	 *
+	 * \return Pointer to the first byte, NULL if nothing was written
+	 */
+	const char* getData() const;
+
+	/**
+	 * \brief Get the number of encoded bytes
+	 */
+	std::size_t getSize() const;
+
+	/**
+	 * \brief Remove all the encoded bytes, keeping the memory
+	 */
+	void clear();
+
+private:
+
+	/**
+	 * \brief Grow the buffer
+	 *
+	 * \param size Number of bytes to add
+	 *
+	 * \return Pointer to the added bytes
+	 */
+	char* grow(std::size_t size);
+
+	/**
+	 * \brief Member data
+	 */
+	std::vector<char> m_data;  /**< encoded bytes */
+};
+
+} // namespace cr
+
+#endif // __CRCR_BINARY_WRITER_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::BinaryWriter writer;
+ * writer.writeUint(records.size());
+ * for (std::size_t i = 0; i < records.size(); ++i)
+ *     writer.writeString(records[i].name).writeTime(records[i].duration);
+ *
+ * socket.send(writer.getData(), writer.getSize());
+ * \endcode
+ */
@@ -0,0 +1,163 @@
+#ifndef __CRCR_CASE_MAPPING_HPP__
+#define __CRCR_CASE_MAPPING_HPP__
+
+#include <String.hpp>
+#include <StringView.hpp>
+#include <UnicodeTables.hpp>
+#include <cstddef>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ *
+ * Unicode case conversion and case-insensitive comparison.
+ *
+ * All the functions use the simple (one to one) case mappings
+ * of the Unicode character database, so that the converted
+ * string always has the same number of characters as the
+ * source. The mappings are looked up in compact two-level
+ * tables (see tools/gen_unicode_tables.py); ASCII characters
+ * never touch the tables, and the string conversions handle
+ * four ASCII characters at a time when SSE2 is available.
+ */
+namespace cr
+{
+
+/**
+ * \brief Convert a character to lowercase
+ *
+ * \param codepoint Character to convert
+ *
+ * \return Lowercase mapping of \a codepoint, or \a codepoint if it has none
+ *
+ * \see toUpper, caseFold
+ */
+Uint32 toLower(Uint32 codepoint);
+
+/**
+ * \brief Convert a character to uppercase
+ *
+ * \param codepoint Character to convert
+ *
+ * \return Uppercase mapping of \a codepoint, or \a codepoint if it has none
+ *
+ * \see toLower, caseFold
+ */
+Uint32 toUpper(Uint32 codepoint);
+
+/**
+ * \brief Fold the case of a character
+ *
+ * Case folding maps characters that differ only by case to
+ * the same character; it is meant for comparisons rather than
+ * for display (e.g. the final sigma folds to the small sigma).
+ *
+ * \param codepoint Character to fold
+ *
+ * \return Case folding of \a codepoint
+ *
+ * \see toLower, toUpper
+ */
+Uint32 caseFold(Uint32 codepoint);
+
+/**
+ * \brief Convert a string to lowercase
+ *
+ * \param str String to convert
+ *
+ * \return Lowercase copy of \a str
+ */
+String toLower(StringView str);
+
+/**
+ * \brief Convert a string to uppercase
+ *
+ * \param str String to convert
+ *
+ * \return Uppercase copy of \a str
+ */
+String toUpper(StringView str);
+
+/**
+ * \brief Fold the case of a string
+ *
+ * \param str String to fold
+ *
+ * \return Case folded copy of \a str
+ */
+String caseFold(StringView str);
+
+/**
+ * \brief Compare two strings, ignoring case differences
+ *
+ * The characters are compared after case folding, without
+ * creating any folded copy of the strings.
+ *
+ * \param left  Left operand
+ * \param right Right operand
+ *
+ * \return Negative, zero or positive value if \a left is respectively
+ *         lower than, equal to or greater than \a right
+ */
+int caseInsensitiveCompare(StringView left, StringView right);
+
+/**
+ * \brief Hash a string, ignoring case differences
+ *
+ * Strings which compare equal with caseInsensitiveCompare
+ * have the same hash (64-bit FNV-1a of the folded characters).
+ *
+ * \param str String to hash
+ *
+ * \return Hash value
+ */
+std::size_t caseInsensitiveHash(StringView str);
+
+/**
+ * \brief Case-insensitive ordering, for std::map and std::set keys
+ */
+struct CaseInsensitiveLess
+{
+	bool operator()(StringView left, StringView right) const;
+};
+
+/**
+ * \brief Case-insensitive equality, for std::unordered_map keys
+ */
+struct CaseInsensitiveEqual
+{
+	bool operator()(StringView left, StringView right) const;
+};
+
+/**
+ * \brief Case-insensitive hash, for std::unordered_map keys
+ */
+struct CaseInsensitiveHash
+{
+	std::size_t operator()(StringView str) const;
+};
+
+#include <CaseMapping.inl>
+
+} // namespace cr
+
+#endif // __CRCR_CASE_MAPPING_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::String s("Hello World");
+ *
+ * cr::String lower = cr::toLower(s);   // "hello world"
+ * cr::String upper = cr::toUpper(s);   // "HELLO WORLD"
+ *
+ * if (cr::caseInsensitiveCompare(s, lower) == 0)
+ *     ...
+ *
+ * std::map<cr::String, int, cr::CaseInsensitiveLess> headers;
+ * std::unordered_map<cr::String, int,
+ *                    cr::CaseInsensitiveHash,
+ *                    cr::CaseInsensitiveEqual> index;
+ * \endcode
+ */
@@ -0,0 +1,38 @@
+inline Uint32 toLower(Uint32 codepoint)
+{
+    if (codepoint < 0x80)
+        return codepoint - 'A' < 26 ? codepoint + 32 : codepoint;
+
+    return codepoint + priv::getCaseRecord(codepoint).lower;
+}
+
+inline Uint32 toUpper(Uint32 codepoint)
+{
+    if (codepoint < 0x80)
+        return codepoint - 'a' < 26 ? codepoint - 32 : codepoint;
+
+    return codepoint + priv::getCaseRecord(codepoint).upper;
+}
+
+inline Uint32 caseFold(Uint32 codepoint)
+{
+    if (codepoint < 0x80)
+        return codepoint - 'A' < 26 ? codepoint + 32 : codepoint;
+
+    return codepoint + priv::getCaseRecord(codepoint).fold;
+}
+
+inline bool CaseInsensitiveLess::operator()(StringView left, StringView right) const
+{
+    return caseInsensitiveCompare(left, right) < 0;
+}
+
+inline bool CaseInsensitiveEqual::operator()(StringView left, StringView right) const
+{
+    return left.getSize() == right.getSize() && caseInsensitiveCompare(left, right) == 0;
+}
+
+inline std::size_t CaseInsensitiveHash::operator()(StringView str) const
+{
+    return caseInsensitiveHash(str);
+}
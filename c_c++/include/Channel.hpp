@@ -0,0 +1,438 @@
+#ifndef __CRCR_CHANNEL_HPP__
+#define __CRCR_CHANNEL_HPP__
+
+#include <Config.hpp>
+#include <Lock.hpp>
+#include <MpmcQueue.hpp>
+#include <Mutex.hpp>
+#include <NonCopyable.hpp>
+#include <Time.hpp>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+class Select;
+
+namespace priv
+{
+	/**
+	 * \brief Thread blocked in a send, a receive or a select
+	 *
+	 * The state is the futex of the thread. A rendezvous partner
+	 * claims the waiter (Claimed) to complete one of its operations
+	 * itself ; the other channels only wake it up (Notified). While
+	 * the waiter tries its operations (Busy), it can't be claimed :
+	 * it is told to try again instead (BusyNotified).
+	 */
+	struct ChannelWaiter
+	{
+		enum State
+		{
+			Waiting,       /**< sleeping, or about to */
+			Notified,      /**< woken up by a channel change */
+			Claimed,       /**< an operation was completed by a partner */
+			Busy,          /**< trying the operations */
+			BusyNotified   /**< trying, and a channel changed meanwhile */
+		};
+
+		ChannelWaiter() : state(Busy), selected(0) {}
+
+		std::atomic<Int32> state;     /**< futex : one of State */
+		std::size_t        selected;  /**< case completed by the partner, valid when Claimed */
+	};
+
+	/**
+	 * \brief Registration of a waiter in a channel
+	 */
+	struct ChannelNode
+	{
+		ChannelWaiter* waiter;    /**< thread waiting */
+		void*          value;     /**< value to send, or receiving the value */
+		std::size_t    index;     /**< case of the select */
+		ChannelNode*   previous;  /**< previous node of the list */
+		ChannelNode*   next;      /**< next node of the list */
+		bool           isLinked;  /**< is the node in the list? */
+	};
+
+	/**
+	 * \brief Part of a channel not depending on the type of its values
+	 *
+	 * The values go through a lock-free queue ; the mutex only
+	 * protects the lists of the threads blocked on the channel,
+	 * and the hand-off of a rendezvous.
+	 */
+	class ChannelBase : NonCopyable
+	{
+	public:
+		/**
+		 * \brief Result of an attempt
+		 */
+		enum Status
+		{
+			Done,        /**< the value was sent or received */
+			Closed,      /**< the channel is closed (and empty, for a receive) */
+			WouldBlock   /**< the channel is full, or empty */
+		};
+
+		typedef Status (*Attempt)(ChannelBase& channel, void* value, ChannelWaiter* self);
+
+		/**
+		 * \brief Operation of a select
+		 */
+		struct Case
+		{
+			ChannelBase* channel;  /**< channel of the operation */
+			void*        value;    /**< value to send, or receiving the value */
+			bool         isSend;   /**< send or receive? */
+			Attempt      attempt;  /**< tries the operation without blocking */
+		};
+
+		/**
+		 * \brief Complete the first possible operation, waiting for one if needed
+		 *
+		 * \param cases    Operations
+		 * \param count    Number of operations
+		 * \param timeout  Maximum time to wait (negative : forever, zero : don't wait)
+		 * \param isClosed Tells whether the operation completed because its channel is closed
+		 *
+		 * \return Index of the operation completed, count if none before the timeout
+		 */
+		static std::size_t select(const Case* cases, std::size_t count, Time timeout, bool& isClosed);
+
+		bool close();
+		bool isClosed() const;
+
+	protected:
+		ChannelBase();
+		~ChannelBase();
+
+		/**
+		 * \brief Enter a send, unless the channel is closed
+		 */
+		bool beginSend();
+
+		/**
+		 * \brief Leave a send
+		 */
+		void endSend();
+
+		/**
+		 * \brief Wake up the receivers after a send, if any
+		 */
+		void notifyReceivers();
+
+		/**
+		 * \brief Wake up the senders after a receive, if any
+		 */
+		void notifySenders();
+
+		/**
+		 * \brief Hand a value to a waiting receiver (rendezvous)
+		 *
+		 * \param self  Waiter of the calling thread, NULL if none
+		 * \param value Value to send
+		 * \param move  Moves a value to another
+		 */
+		Status handOff(ChannelWaiter* self, void* value, void (*move)(void* from, void* to));
+
+		/**
+		 * \brief Take the value of a waiting sender (rendezvous)
+		 *
+		 * \param self  Waiter of the calling thread, NULL if none
+		 * \param value Receives the value
+		 * \param move  Moves a value to another
+		 */
+		Status takeOver(ChannelWaiter* self, void* value, void (*move)(void* from, void* to));
+
+		/**
+		 * \brief Check for the end of a closed channel, the values being gone
+		 */
+		bool isClosedForReceive() const;
+
+	private:
+		struct List
+		{
+			List() : first(NULL), last(NULL), mayHaveWaiters(0) {}
+
+			ChannelNode*       first;           /**< first node */
+			ChannelNode*       last;            /**< last node */
+			std::atomic<Int32> mayHaveWaiters;  /**< cleared by the thread waking them up */
+		};
+
+		/**
+		 * \brief Wake up the waiters of a list
+		 */
+		void wakeUp(List& list);
+
+		void link(List& list, ChannelNode* node);
+		static void unlink(List& list, ChannelNode* node);
+		static void notifyAll(List& list);
+		static Status claim(List& list, ChannelWaiter* self, void* value, void (*move)(void* from, void* to), bool isSender);
+
+		/**
+		 * \brief Member data
+		 */
+		std::atomic<Int32> m_sendState;     /**< closing flag (1), and 2 per send in progress */
+		std::atomic<bool>  m_isClosed;      /**< closed, and the sends in progress are done */
+		Mutex              m_mutex;         /**< protects the lists */
+		List               m_senders;       /**< threads waiting to send */
+		List               m_receivers;     /**< threads waiting to receive */
+	};
+}
+
+/**
+ * \brief Go-style channel : a queue carrying values between threads
+ *
+ * There are three kinds of channels, chosen by the capacity :
+ * \li bounded : send() blocks while the channel is full, slowing
+ *     down the producers which go faster than the consumers
+ * \li unbounded (Channel::Unbounded) : send() never blocks
+ * \li rendezvous (0) : send() blocks until a receiver takes the value
+ *
+ * The values of bounded and unbounded channels go through a
+ * lock-free cr::MpmcQueue : while a send or a receive doesn't have
+ * to wait, it takes no mutex and makes no system call. A mutex is
+ * only taken to block a thread, to wake it up, to hand a value
+ * over in a rendezvous, and by an unbounded channel for the
+ * values which don't fit in its queue.
+ *
+ * After close(), sends fail and receives get the values left,
+ * then fail. Use cr::Select to wait on several channels at once.
+ */
+template <typename T>
+class Channel : private priv::ChannelBase
+{
+public:
+
+	/**
+	 * \brief Capacity of an unbounded channel
+	 */
+	static const std::size_t Unbounded = static_cast<std::size_t>(-1);
+
+	/**
+	 * \brief Construct an open channel
+	 *
+	 * \param capacity Number of values a bounded channel holds
+	 *                 (rounded to a power of two), 0 for a rendezvous
+	 *                 channel, Unbounded for no limit
+	 */
+	explicit Channel(std::size_t capacity);
+
+	/**
+	 * \brief Send a value, waiting for room if needed
+	 *
+	 * \param value Value to send
+	 *
+	 * \return False if the channel is closed
+	 */
+	bool send(T value);
+
+	/**
+	 * \brief Send a value, unless it would have to wait
+	 *
+	 * \param value Value to send (moved only on success)
+	 *
+	 * \return False if the channel is full or closed
+	 */
+	bool trySend(T& value);
+
+	/**
+	 * \brief Send a value, waiting at most a given time
+	 *
+	 * \param value   Value to send (moved only on success)
+	 * \param timeout Maximum time to wait
+	 *
+	 * \return False if the time ran out or the channel is closed
+	 */
+	bool sendFor(T& value, Time timeout);
+
+	/**
+	 * \brief Receive a value, waiting for one if needed
+	 *
+	 * \param value Receives the value
+	 *
+	 * \return False if the channel is closed and empty
+	 */
+	bool receive(T& value);
+
+	/**
+	 * \brief Receive a value, unless it would have to wait
+	 *
+	 * \param value Receives the value
+	 *
+	 * \return False if the channel is empty
+	 */
+	bool tryReceive(T& value);
+
+	/**
+	 * \brief Receive a value, waiting at most a given time
+	 *
+	 * \param value   Receives the value
+	 * \param timeout Maximum time to wait
+	 *
+	 * \return False if the time ran out, or the channel is closed and empty
+	 */
+	bool receiveFor(T& value, Time timeout);
+
+	/**
+	 * \brief Close the channel
+	 *
+	 * The threads blocked in a send or a receive are woken up.
+	 *
+	 * \return False if the channel was already closed
+	 */
+	bool close();
+
+	/**
+	 * \brief Tell whether the channel is closed
+	 */
+	bool isClosed() const;
+
+private:
+
+	friend class Select;
+
+	Status attemptSend(T& value, priv::ChannelWaiter* self);
+	Status attemptReceive(T& value, priv::ChannelWaiter* self);
+
+	static Status sendCase(priv::ChannelBase& channel, void* value, priv::ChannelWaiter* self);
+	static Status receiveCase(priv::ChannelBase& channel, void* value, priv::ChannelWaiter* self);
+	static void move(void* from, void* to);
+
+	bool wait(bool isSend, T& value, Time timeout);
+
+	/**
+	 * \brief Member data
+	 */
+	std::size_t              m_capacity;       /**< as given to the constructor */
+	MpmcQueue<T>             m_queue;          /**< values of bounded and unbounded channels */
+	std::atomic<std::size_t> m_overflowCount;  /**< number of values in m_overflow */
+	std::deque<T>            m_overflow;       /**< values of an unbounded channel not fitting in m_queue */
+	Mutex                    m_overflowMutex;  /**< protects m_overflow */
+};
+
+/**
+ * \brief Wait for the first of several channel operations
+ *
+ * The operations are added once, then wait() completes exactly
+ * one of them : the first possible, or the first one to become
+ * possible. When several are possible, one is picked at random,
+ * so that a busy channel doesn't starve the others.
+ *
+ * The select can be waited on again, in a loop : the operations
+ * stay registered, with the same values.
+ */
+class Select : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Result of tryWait() and waitFor() when no operation completed
+	 */
+	static const std::size_t None = static_cast<std::size_t>(-1);
+
+	/**
+	 * \brief Construct a select without operations
+	 */
+	Select();
+
+	/**
+	 * \brief Add a send
+	 *
+	 * \param channel Channel to send to
+	 * \param value   Value to send (moved when the send completes ; must outlive the select)
+	 *
+	 * \return Index of the operation
+	 */
+	template <typename T>
+	std::size_t addSend(Channel<T>& channel, T& value);
+
+	/**
+	 * \brief Add a receive
+	 *
+	 * \param channel Channel to receive from
+	 * \param value   Receives the value (must outlive the select)
+	 *
+	 * \return Index of the operation
+	 */
+	template <typename T>
+	std::size_t addReceive(Channel<T>& channel, T& value);
+
+	/**
+	 * \brief Complete one operation, waiting as long as needed
+	 *
+	 * \return Index of the operation completed
+	 */
+	std::size_t wait();
+
+	/**
+	 * \brief Complete one operation, waiting at most a given time
+	 *
+	 * \param timeout Maximum time to wait
+	 *
+	 * \return Index of the operation completed, None if the time ran out
+	 */
+	std::size_t waitFor(Time timeout);
+
+	/**
+	 * \brief Complete one operation, unless all of them would have to wait
+	 *
+	 * \return Index of the operation completed, None if none was possible
+	 */
+	std::size_t tryWait();
+
+	/**
+	 * \brief Tell whether the last operation completed because its channel is closed
+	 *
+	 * A send to a closed channel, or a receive from a closed and
+	 * empty channel, completes at once without value.
+	 */
+	bool isClosed() const;
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	std::vector<priv::ChannelBase::Case> m_cases;     /**< operations */
+	bool                                 m_isClosed;  /**< result of the last wait */
+};
+
+#include <Channel.inl>
+
+} // namespace cr
+
+#endif // __CRCR_CHANNEL_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::Channel<Job> jobs(64);       // producers wait when 64 jobs are pending
+ * cr::Channel<Result> results(cr::Channel<Result>::Unbounded);
+ * cr::Channel<int> quit(0);
+ *
+ * // workers
+ * Job job;
+ * while (jobs.receive(job))        // until jobs is closed and empty
+ *     results.send(run(job));
+ *
+ * // collector
+ * Result result;
+ * int signal;
+ * cr::Select select;
+ * select.addReceive(results, result);
+ * select.addReceive(quit, signal);
+ * while (select.waitFor(cr::seconds(1)) == 0)
+ *     store(result);
+ * \endcode
+ */
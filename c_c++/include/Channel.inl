@@ -0,0 +1,253 @@
+inline bool priv::ChannelBase::beginSend()
+{
+    if (m_sendState.fetch_add(2, std::memory_order_acquire) & 1)
+    {
+        m_sendState.fetch_sub(2, std::memory_order_release);
+        return false;
+    }
+
+    return true;
+}
+
+inline void priv::ChannelBase::endSend()
+{
+    m_sendState.fetch_sub(2, std::memory_order_release);
+}
+
+inline void priv::ChannelBase::notifyReceivers()
+{
+    /*
+     * Pairs with the fence of select() : either the waiter sees
+     * the value, or this thread sees the waiter
+     */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_receivers.mayHaveWaiters.load(std::memory_order_relaxed) == 0)
+        return;
+
+    /*
+     * Only the first thread to see the waiters wakes them up
+     */
+    if (m_receivers.mayHaveWaiters.exchange(0, std::memory_order_relaxed) != 0)
+        wakeUp(m_receivers);
+}
+
+inline void priv::ChannelBase::notifySenders()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_senders.mayHaveWaiters.load(std::memory_order_relaxed) == 0)
+        return;
+
+    if (m_senders.mayHaveWaiters.exchange(0, std::memory_order_relaxed) != 0)
+        wakeUp(m_senders);
+}
+
+inline bool priv::ChannelBase::isClosedForReceive() const
+{
+    return m_isClosed.load(std::memory_order_acquire);
+}
+
+template <typename T>
+Channel<T>::Channel(std::size_t capacity) :
+    m_capacity     (capacity),
+    m_queue        (capacity == 0 ? 2 : capacity == Unbounded ? 1024 : capacity),
+    m_overflowCount(0)
+{
+}
+
+template <typename T>
+bool Channel<T>::send(T value)
+{
+    Status status = attemptSend(value, NULL);
+    if (status != WouldBlock)
+        return status == Done;
+
+    return wait(true, value, microseconds(-1));
+}
+
+template <typename T>
+bool Channel<T>::trySend(T& value)
+{
+    return attemptSend(value, NULL) == Done;
+}
+
+template <typename T>
+bool Channel<T>::sendFor(T& value, Time timeout)
+{
+    Status status = attemptSend(value, NULL);
+    if (status != WouldBlock)
+        return status == Done;
+
+    return wait(true, value, timeout < Time::Zero ? Time::Zero : timeout);
+}
+
+template <typename T>
+bool Channel<T>::receive(T& value)
+{
+    Status status = attemptReceive(value, NULL);
+    if (status != WouldBlock)
+        return status == Done;
+
+    return wait(false, value, microseconds(-1));
+}
+
+template <typename T>
+bool Channel<T>::tryReceive(T& value)
+{
+    return attemptReceive(value, NULL) == Done;
+}
+
+template <typename T>
+bool Channel<T>::receiveFor(T& value, Time timeout)
+{
+    Status status = attemptReceive(value, NULL);
+    if (status != WouldBlock)
+        return status == Done;
+
+    return wait(false, value, timeout < Time::Zero ? Time::Zero : timeout);
+}
+
+template <typename T>
+bool Channel<T>::close()
+{
+    return priv::ChannelBase::close();
+}
+
+template <typename T>
+bool Channel<T>::isClosed() const
+{
+    return priv::ChannelBase::isClosed();
+}
+
+template <typename T>
+priv::ChannelBase::Status Channel<T>::attemptSend(T& value, priv::ChannelWaiter* self)
+{
+    if (m_capacity == 0)
+        return handOff(self, &value, &Channel::move);
+
+    if (!beginSend())
+        return Closed;
+
+    bool isSent = false;
+    if (m_overflowCount.load(std::memory_order_acquire) == 0)
+        isSent = m_queue.tryPush(std::move(value));
+
+    if (!isSent && m_capacity == Unbounded)
+    {
+        /*
+         * The queue is full, or older values wait in the overflow :
+         * they must come out first
+         */
+        Lock lock(m_overflowMutex);
+        m_overflow.push_back(std::move(value));
+        m_overflowCount.fetch_add(1, std::memory_order_release);
+        isSent = true;
+    }
+
+    endSend();
+    if (!isSent)
+        return WouldBlock;
+
+    notifyReceivers();
+    return Done;
+}
+
+template <typename T>
+priv::ChannelBase::Status Channel<T>::attemptReceive(T& value, priv::ChannelWaiter* self)
+{
+    if (m_capacity == 0)
+        return takeOver(self, &value, &Channel::move);
+
+    bool isClosing = isClosedForReceive();
+
+    if (m_queue.tryPop(value))
+    {
+        if (m_capacity != Unbounded)
+            notifySenders();
+        return Done;
+    }
+
+    if (m_overflowCount.load(std::memory_order_acquire) > 0)
+    {
+        Lock lock(m_overflowMutex);
+
+        if (!m_overflow.empty())
+        {
+            value = std::move(m_overflow.front());
+            m_overflow.pop_front();
+            m_overflowCount.fetch_sub(1, std::memory_order_release);
+
+            /*
+             * Move what fits back to the queue, for the next receives
+             */
+            while (!m_overflow.empty() && m_queue.tryPush(std::move(m_overflow.front())))
+            {
+                m_overflow.pop_front();
+                m_overflowCount.fetch_sub(1, std::memory_order_release);
+            }
+
+            return Done;
+        }
+    }
+
+    /*
+     * Closed before the queue was found empty : no value can come anymore
+     */
+    return isClosing ? Closed : WouldBlock;
+}
+
+template <typename T>
+priv::ChannelBase::Status Channel<T>::sendCase(priv::ChannelBase& channel, void* value, priv::ChannelWaiter* self)
+{
+    return static_cast<Channel&>(channel).attemptSend(*static_cast<T*>(value), self);
+}
+
+template <typename T>
+priv::ChannelBase::Status Channel<T>::receiveCase(priv::ChannelBase& channel, void* value, priv::ChannelWaiter* self)
+{
+    return static_cast<Channel&>(channel).attemptReceive(*static_cast<T*>(value), self);
+}
+
+template <typename T>
+void Channel<T>::move(void* from, void* to)
+{
+    *static_cast<T*>(to) = std::move(*static_cast<T*>(from));
+}
+
+template <typename T>
+bool Channel<T>::wait(bool isSend, T& value, Time timeout)
+{
+    Case operation;
+    operation.channel = this;
+    operation.value = &value;
+    operation.isSend = isSend;
+    operation.attempt = isSend ? &Channel::sendCase : &Channel::receiveCase;
+
+    bool isClosed = false;
+    return select(&operation, 1, timeout, isClosed) == 0 && !isClosed;
+}
+
+template <typename T>
+std::size_t Select::addSend(Channel<T>& channel, T& value)
+{
+    priv::ChannelBase::Case operation;
+    operation.channel = &channel;
+    operation.value = &value;
+    operation.isSend = true;
+    operation.attempt = &Channel<T>::sendCase;
+
+    m_cases.push_back(operation);
+    return m_cases.size() - 1;
+}
+
+template <typename T>
+std::size_t Select::addReceive(Channel<T>& channel, T& value)
+{
+    priv::ChannelBase::Case operation;
+    operation.channel = &channel;
+    operation.value = &value;
+    operation.isSend = false;
+    operation.attempt = &Channel<T>::receiveCase;
+
+    m_cases.push_back(operation);
+    return m_cases.size() - 1;
+}
@@ -0,0 +1,269 @@
+#ifndef __CRCR_COLLATOR_HPP__
+#define __CRCR_COLLATOR_HPP__
+
+#include <String.hpp>
+#include <StringView.hpp>
+#include <NonCopyable.hpp>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Binary sort key : two keys compare like their strings
+ *        when compared byte by byte (memcmp, operator <)
+ */
+typedef std::basic_string<Uint8> SortKey;
+
+class CollationKeyCache;
+
+/**
+ * \brief Language-independent ordering of strings for display
+ *
+ * cr::Collator implements the Unicode Collation Algorithm
+ * (UTS #10) with the Default Unicode Collation Element Table
+ * (DUCET) : "a" < "B" < "é" < "f", punctuation and accents
+ * only matter when the letters are equal, etc. This is the
+ * root ordering of the locales, without language-specific
+ * tailorings.
+ *
+ * Comparing two strings this way is costly (normalization,
+ * table lookups, several passes), so the strings are rather
+ * turned into binary sort keys once : keys compare with a
+ * plain memcmp. sort() does this, and can keep the keys in a
+ * cr::CollationKeyCache so that sorting the same strings again
+ * doesn't compute them again.
+ *
+ * The tables are generated from the DUCET by
+ * tools/gen_unicode_tables.py. A collator holds no other
+ * state than its settings : it can be shared between threads.
+ */
+class Collator
+{
+public:
+
+	/**
+	 * \brief Number of levels of differences taken into account
+	 */
+	enum Strength
+	{
+		Primary    = 1,  /**< base letters only */
+		Secondary  = 2,  /**< and accents */
+		Tertiary   = 3,  /**< and case, variants */
+		Quaternary = 4   /**< and punctuation, when it is shifted (same as Tertiary otherwise) */
+	};
+
+	/**
+	 * \brief Handling of the variable characters (spaces, punctuation, symbols)
+	 */
+	enum Alternate
+	{
+		NonIgnorable,  /**< compared like letters */
+		Shifted        /**< ignored on the first three levels ("de luge" = "deluge") */
+	};
+
+	/**
+	 * \brief Construct a collator
+	 *
+	 * \param strength  Number of levels to compare
+	 * \param alternate Handling of the variable characters
+	 */
+	explicit Collator(Strength strength = Tertiary, Alternate alternate = NonIgnorable);
+
+	/**
+	 * \brief Compute the sort key of a string
+	 *
+	 * \param str String to convert
+	 *
+	 * \return Sort key of \a str
+	 */
+	SortKey getSortKey(StringView str) const;
+
+	/**
+	 * \brief Compute the sort key of a string into an existing key
+	 *
+	 * The key keeps its capacity, so that a loop can reuse it.
+	 *
+	 * \param str String to convert
+	 * \param key Receives the sort key of \a str
+	 */
+	void getSortKey(StringView str, SortKey& key) const;
+
+	/**
+	 * \brief Compare two strings
+	 *
+	 * To compare many times, compute the sort keys instead.
+	 *
+	 * \param left  First string
+	 * \param right Second string
+	 *
+	 * \return Negative, zero or positive value if \a left is respectively
+	 *         ordered before, equal to or after \a right
+	 */
+	int compare(StringView left, StringView right) const;
+
+	/**
+	 * \brief Sort strings in collation order
+	 *
+	 * The sort key of each string is computed once. Strings with
+	 * equal keys are ordered by code point, so that the result
+	 * doesn't depend on the initial order.
+	 *
+	 * \param strings Strings to sort
+	 */
+	void sort(std::vector<String>& strings) const;
+
+	/**
+	 * \brief Sort strings in collation order, with cached sort keys
+	 *
+	 * The keys found in \a cache are reused, the missing ones
+	 * are computed and added to it.
+	 *
+	 * \param strings Strings to sort
+	 * \param cache   Sort keys of previous sorts
+	 */
+	void sort(std::vector<String>& strings, CollationKeyCache& cache) const;
+
+	/**
+	 * \brief Get the strength of the collator
+	 *
+	 * \return Number of levels compared
+	 */
+	Strength getStrength() const;
+
+	/**
+	 * \brief Get the handling of the variable characters
+	 *
+	 * \return Handling of the variable characters
+	 */
+	Alternate getAlternate() const;
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	Strength  m_strength;   /**< number of levels */
+	Alternate m_alternate;  /**< variable characters handling */
+};
+
+namespace priv
+{
+	/**
+	 * \brief Hash of the code points of a string (FNV-1a)
+	 */
+	struct StringHash
+	{
+		std::size_t operator()(const String& str) const;
+	};
+}
+
+/**
+ * \brief Sort keys of strings, kept between sorts
+ *
+ * A cache only holds keys of one collator settings : using
+ * it with another collator empties it. When \a capacity keys
+ * are stored, the cache is emptied before adding new ones, so
+ * that the memory it uses stays bounded.
+ */
+class CollationKeyCache : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Construct an empty cache
+	 *
+	 * \param capacity Maximum number of keys (0 for no limit)
+	 */
+	explicit CollationKeyCache(std::size_t capacity = 0);
+
+	/**
+	 * \brief Get the sort key of a string, computing it if needed
+	 *
+	 * The returned reference is valid until the next call
+	 * which adds a key, or until clear().
+	 *
+	 * \param collator Collator of the key
+	 * \param str      String to look up
+	 *
+	 * \return Sort key of \a str
+	 */
+	const SortKey& getSortKey(const Collator& collator, const String& str);
+
+	/**
+	 * \brief Find the sort key of a string without computing it
+	 *
+	 * \param collator Collator of the key
+	 * \param str      String to look up
+	 *
+	 * \return Pointer to the sort key, NULL if it is not in the cache
+	 */
+	const SortKey* findSortKey(const Collator& collator, const String& str);
+
+	/**
+	 * \brief Add the sort key of a string
+	 *
+	 * \param collator Collator of the key
+	 * \param str      String of the key
+	 * \param key      Sort key of \a str, moved into the cache
+	 */
+	void insert(const Collator& collator, const String& str, SortKey&& key);
+
+	/**
+	 * \brief Remove all the keys
+	 */
+	void clear();
+
+	/**
+	 * \brief Get the number of keys in the cache
+	 *
+	 * \return Number of keys
+	 */
+	std::size_t getSize() const;
+
+private:
+
+	typedef std::unordered_map<String, SortKey, priv::StringHash> KeyMap;
+
+	/**
+	 * \brief Forget the keys if they were computed with other settings
+	 */
+	void select(const Collator& collator);
+
+	/**
+	 * \brief Member data
+	 */
+	KeyMap              m_keys;       /**< sort key of each string */
+	std::size_t         m_capacity;   /**< maximum number of keys, 0 for no limit */
+	Collator::Strength  m_strength;   /**< settings of the cached keys */
+	Collator::Alternate m_alternate;  /**< settings of the cached keys */
+};
+
+} // namespace cr
+
+#endif // __CRCR_COLLATOR_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::Collator collator;
+ *
+ * std::vector<cr::String> names = ...;
+ * collator.sort(names);
+ *
+ * // keys reused from one sort to the next
+ * cr::CollationKeyCache cache(100000);
+ * collator.sort(names, cache);
+ *
+ * // keys stored next to the records, compared with memcmp
+ * cr::SortKey key = collator.getSortKey(name);
+ * \endcode
+ */
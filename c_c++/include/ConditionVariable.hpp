@@ -0,0 +1,162 @@
+#ifndef __CRCR_CONDITION_VARIABLE_HPP__
+#define __CRCR_CONDITION_VARIABLE_HPP__
+
+#include <Clock.hpp>
+#include <Config.hpp>
+#include <Lock.hpp>
+#include <Mutex.hpp>
+#include <NonCopyable.hpp>
+#include <Time.hpp>
+#include <atomic>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+class StopToken;
+
+/**
+ * \brief Lets threads sleep until a shared state protected by a cr::Mutex changes
+ *
+ * A waiting thread unlocks the mutex and sleeps atomically : a
+ * notification made after the state was changed under the mutex
+ * can't be missed. notifyAll() wakes up a single thread and moves
+ * the others to the futex of the mutex, so that they are woken
+ * one at a time as it is released, instead of all rushing to it.
+ *
+ * All the threads waiting at the same time must use the same mutex.
+ * As with any condition variable, wake-ups can be spurious : the
+ * waits with a predicate check it in a loop.
+ *
+ * The waits taking a cr::StopToken are defined with it, in
+ * StopToken.hpp.
+ */
+class ConditionVariable : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Default constructor
+	 */
+	ConditionVariable();
+
+	/**
+	 * \brief Wait for a notification
+	 *
+	 * \param lock Lock on the mutex protecting the state (locked)
+	 */
+	void wait(Lock& lock);
+
+	/**
+	 * \brief Wait until a predicate is true
+	 *
+	 * \param lock      Lock on the mutex protecting the state (locked)
+	 * \param predicate Function returning true when the wait is over
+	 */
+	template <typename P>
+	void wait(Lock& lock, P predicate);
+
+	/**
+	 * \brief Wait until a predicate is true or a stop is requested
+	 *
+	 * \param lock      Lock on the mutex protecting the state (locked)
+	 * \param token     Token interrupting the wait
+	 * \param predicate Function returning true when the wait is over
+	 *
+	 * \return Result of \a predicate : false if the wait was interrupted
+	 */
+	template <typename P>
+	bool wait(Lock& lock, const StopToken& token, P predicate);
+
+	/**
+	 * \brief Wait for a notification, at most a given time
+	 *
+	 * \param lock    Lock on the mutex protecting the state (locked)
+	 * \param timeout Maximum time to wait
+	 *
+	 * \return False if the timeout expired
+	 */
+	bool waitFor(Lock& lock, Time timeout);
+
+	/**
+	 * \brief Wait until a predicate is true, at most a given time
+	 *
+	 * \param lock      Lock on the mutex protecting the state (locked)
+	 * \param timeout   Maximum time to wait
+	 * \param predicate Function returning true when the wait is over
+	 *
+	 * \return Result of \a predicate : false if the timeout expired
+	 */
+	template <typename P>
+	bool waitFor(Lock& lock, Time timeout, P predicate);
+
+	/**
+	 * \brief Wait until a predicate is true or a stop is requested, at most a given time
+	 *
+	 * \param lock      Lock on the mutex protecting the state (locked)
+	 * \param token     Token interrupting the wait
+	 * \param timeout   Maximum time to wait
+	 * \param predicate Function returning true when the wait is over
+	 *
+	 * \return Result of \a predicate : false if the wait was interrupted or timed out
+	 */
+	template <typename P>
+	bool waitFor(Lock& lock, const StopToken& token, Time timeout, P predicate);
+
+	/**
+	 * \brief Wake up one waiting thread
+	 *
+	 * Cheap when no thread waits : no system call is made.
+	 */
+	void notifyOne();
+
+	/**
+	 * \brief Wake up all the waiting threads
+	 */
+	void notifyAll();
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	std::atomic<Int32>  m_sequence;  /**< futex : changed by each notification */
+	std::atomic<Int32>  m_waiters;   /**< number of waiting threads */
+	std::atomic<Mutex*> m_mutex;     /**< mutex of the waiting threads */
+};
+
+#include <ConditionVariable.inl>
+
+} // namespace cr
+
+#endif // __CRCR_CONDITION_VARIABLE_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::Mutex mutex;
+ * cr::ConditionVariable notEmpty;
+ * std::deque<Job> jobs;
+ *
+ * void consumer()
+ * {
+ *     cr::Lock lock(mutex);
+ *     notEmpty.wait(lock, [&]() { return !jobs.empty(); });
+ *     Job job = jobs.front();
+ *     jobs.pop_front();
+ * }
+ *
+ * void producer(const Job& job)
+ * {
+ *     {
+ *         cr::Lock lock(mutex);
+ *         jobs.push_back(job);
+ *     }
+ *     notEmpty.notifyOne();
+ * }
+ * \endcode
+ */
@@ -0,0 +1,21 @@
+template <typename P>
+void ConditionVariable::wait(Lock& lock, P predicate)
+{
+    while (!predicate())
+        wait(lock);
+}
+
+template <typename P>
+bool ConditionVariable::waitFor(Lock& lock, Time timeout, P predicate)
+{
+    Clock clock;
+
+    while (!predicate())
+    {
+        Time remaining = timeout - clock.getElapsedTime();
+        if (remaining <= Time::Zero || !waitFor(lock, remaining))
+            return predicate();
+    }
+
+    return true;
+}
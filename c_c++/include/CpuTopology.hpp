@@ -0,0 +1,94 @@
+#ifndef __CRCR_CPU_TOPOLOGY_HPP__
+#define __CRCR_CPU_TOPOLOGY_HPP__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Description of a logical CPU
+ */
+struct CpuInfo
+{
+	unsigned int id;        /**< number of the CPU, as used in affinity masks */
+	unsigned int core;      /**< physical core, within the package */
+	unsigned int package;   /**< physical package (socket) */
+	unsigned int node;      /**< NUMA node */
+	bool         isolated;  /**< excluded from the kernel scheduler (isolcpus) */
+};
+
+/**
+ * \brief Give access to the topology of the CPUs
+ *
+ * The information comes from /sys/devices/system/cpu. Where it
+ * is not available, every online CPU is reported as a core of
+ * its own, in package and node 0.
+ */
+class CpuTopology
+{
+public:
+
+	/**
+	 * \brief Get the online CPUs
+	 *
+	 * \return CPUs, sorted by id
+	 */
+	static std::vector<CpuInfo> getCpus();
+
+	/**
+	 * \brief Get the number of physical cores
+	 *
+	 * Hyper-threads of a same core count once.
+	 */
+	static std::size_t getCoreCount();
+
+	/**
+	 * \brief Get the CPUs isolated from the kernel scheduler
+	 *
+	 * These are the usual targets of latency-critical threads.
+	 */
+	static std::vector<unsigned int> getIsolatedCpus();
+
+	/**
+	 * \brief Get the CPU running the calling thread
+	 *
+	 * \return CPU id, 0 if unknown
+	 */
+	static unsigned int getCurrentCpu();
+
+	/**
+	 * \brief Parse a kernel CPU list, such as "0-3,8,10-11"
+	 *
+	 * \param list CPU list
+	 *
+	 * \return CPU ids, sorted ; empty if the list is malformed
+	 */
+	static std::vector<unsigned int> parseList(const std::string& list);
+};
+
+} // namespace cr
+
+#endif // __CRCR_CPU_TOPOLOGY_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * // one worker per physical core, on its first hyper-thread
+ * std::vector<cr::CpuInfo> cpus = cr::CpuTopology::getCpus();
+ * std::set<std::pair<unsigned int, unsigned int> > used;
+ *
+ * for (std::size_t i = 0; i < cpus.size(); ++i)
+ * {
+ *     if (used.insert(std::make_pair(cpus[i].package, cpus[i].core)).second)
+ *         startWorker(cpus[i].id);
+ * }
+ * \endcode
+ */
@@ -0,0 +1,70 @@
+#ifndef __CRCR_FUTEX_IMPL_HPP__
+#define __CRCR_FUTEX_IMPL_HPP__
+
+#include <Config.hpp>
+#include <Time.hpp>
+#include <atomic>
+
+
+namespace cr
+{
+
+namespace priv
+{
+
+/**
+ * \brief Sleep while a futex holds a value
+ *
+ * \param address Futex
+ * \param value   Value expected : returns at once if it changed
+ *
+ * Spurious wake-ups are possible : the caller checks its state again.
+ */
+void futexWait(std::atomic<Int32>* address, Int32 value);
+
+/**
+ * \brief Same as futexWait(), with a timeout
+ *
+ * \return False if the timeout expired
+ */
+bool futexWait(std::atomic<Int32>* address, Int32 value, Time timeout);
+
+/**
+ * \brief Wake up threads sleeping on a futex
+ *
+ * \param address Futex
+ * \param count   Maximum number of threads to wake up
+ */
+void futexWake(std::atomic<Int32>* address, int count);
+
+/**
+ * \brief Wake up one thread, and move the others to another futex
+ *
+ * \param address  Futex the threads sleep on
+ * \param expected Value of \a address : nothing is done if it changed
+ * \param target   Futex receiving the other threads
+ *
+ * \return False if \a address doesn't hold \a expected
+ */
+bool futexRequeue(std::atomic<Int32>* address, Int32 expected, std::atomic<Int32>* target);
+
+/**
+ * \brief Tell whether spinning can help, the lock owner running on another CPU
+ */
+bool isMultiCore();
+
+/**
+ * \brief Hint for the CPU in a spin loop
+ */
+inline void cpuRelax()
+{
+#if defined(__i386__) || defined(__x86_64__)
+	__builtin_ia32_pause();
+#endif
+}
+
+} // namespace priv
+
+} // namespace cr
+
+#endif // __CRCR_FUTEX_IMPL_HPP__
@@ -0,0 +1,463 @@
+#ifndef __CRCR_FUTURE_HPP__
+#define __CRCR_FUTURE_HPP__
+
+#include <Config.hpp>
+#include <NonCopyable.hpp>
+#include <Time.hpp>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+template <typename T> class Future;
+template <typename T> class Promise;
+
+namespace priv
+{
+	/**
+	 * \brief Value stored for a Future<void>
+	 */
+	struct Unit
+	{
+	};
+
+	template <typename T>
+	struct FutureStored
+	{
+		typedef T Type;
+	};
+
+	template <>
+	struct FutureStored<void>
+	{
+		typedef Unit Type;
+	};
+
+	/**
+	 * \brief Function run once a shared state is complete
+	 */
+	struct FutureCallback
+	{
+		virtual ~FutureCallback() {}
+		virtual void run() = 0;
+	};
+
+	/**
+	 * \brief Part of the shared state of a future not depending on its type
+	 *
+	 * The progress is a set of flags changed atomically : the
+	 * result and the continuation can be given in any order, by
+	 * any threads, the last of the two running the continuation.
+	 * The flags are also the futex of the threads waiting.
+	 */
+	class FutureStateBase : NonCopyable
+	{
+	public:
+		enum Flag
+		{
+			Claimed      = 1,  /**< a result is being stored */
+			Complete     = 2,  /**< the result is stored */
+			Continuation = 4,  /**< the continuation is stored */
+			Waiting      = 8   /**< threads are blocked in wait() */
+		};
+
+		FutureStateBase();
+
+		void addReference();
+		void removeReference();
+
+		bool isReady() const;
+		void wait();
+		bool waitFor(Time timeout);
+
+		/**
+		 * \brief Give the continuation, run now if complete (takes ownership)
+		 */
+		void setCallback(FutureCallback* callback);
+
+		/**
+		 * \brief Reserve the right to give the result, throw if already done
+		 */
+		void claim();
+
+		/**
+		 * \brief Tell whether the result was claimed
+		 */
+		bool isClaimed() const;
+
+		/**
+		 * \brief Publish the result : wake up the waiters, run the continuation
+		 *
+		 * The caller (the promise) keeps a reference during the call.
+		 */
+		void complete();
+
+		/**
+		 * \brief Store a failure and publish it (after claim())
+		 */
+		void setException(std::exception_ptr exception);
+
+		/**
+		 * \brief Get the failure, NULL if none
+		 */
+		const std::exception_ptr& getException() const;
+
+	protected:
+		virtual ~FutureStateBase();
+
+	private:
+		std::atomic<Int32>       m_flags;       /**< futex : combination of Flag */
+		std::atomic<std::size_t> m_references;  /**< number of owners */
+		FutureCallback*          m_callback;    /**< continuation, valid with the Continuation flag */
+		std::exception_ptr       m_exception;   /**< failure, valid with the Complete flag */
+	};
+
+	/**
+	 * \brief Shared state of a future
+	 */
+	template <typename T>
+	class FutureState : public FutureStateBase
+	{
+	public:
+		typedef typename FutureStored<T>::Type Stored;
+
+		FutureState() : m_hasValue(false) {}
+
+		template <typename... A>
+		void emplace(A&&... arguments);
+
+		Stored& getValue() { return *reinterpret_cast<Stored*>(&m_storage); }
+
+	private:
+		virtual ~FutureState();
+
+		typename std::aligned_storage<sizeof(Stored), alignof(Stored)>::type m_storage;   /**< the value */
+		bool                                                                 m_hasValue;  /**< is m_storage constructed? */
+	};
+
+	template <typename F, typename T>
+	struct ContinuationResult
+	{
+		typedef typename std::result_of<F(T)>::type Type;
+	};
+
+	template <typename F>
+	struct ContinuationResult<F, void>
+	{
+		typedef typename std::result_of<F()>::type Type;
+	};
+
+	template <typename T>
+	struct WhenAllResult
+	{
+		typedef std::vector<T> Type;
+	};
+
+	template <>
+	struct WhenAllResult<void>
+	{
+		typedef void Type;
+	};
+
+	template <typename T>
+	struct WhenAnyResult
+	{
+		typedef std::pair<std::size_t, T> Type;
+	};
+
+	template <>
+	struct WhenAnyResult<void>
+	{
+		typedef std::size_t Type;
+	};
+}
+
+/**
+ * \brief Executor running the functions right away, in the calling thread
+ *
+ * Continuations given to Future::then() without executor run this
+ * way : by the thread which completes the future, or by the thread
+ * calling then() if the future is already complete.
+ */
+struct InlineExecutor
+{
+	template <typename F>
+	bool execute(F&& function)
+	{
+		function();
+		return true;
+	}
+};
+
+/**
+ * \brief Handle on a result available later
+ *
+ * A future is the reading side of a cr::Promise : get() waits
+ * for the value given to the promise, or throws the exception
+ * given to it. Instead of waiting, then() chains a function run
+ * with the value once it is available, which gives another future.
+ *
+ * Unlike std::future, the shared state has no mutex : setting
+ * the result and attaching the continuation are lock-free, and
+ * only the threads actually blocked in wait() reach the kernel.
+ *
+ * A future is move-only ; get() and then() consume it (isValid()
+ * is false afterwards).
+ */
+template <typename T>
+class Future
+{
+public:
+
+	/**
+	 * \brief Construct an invalid future
+	 */
+	Future();
+
+	/**
+	 * \brief Move constructor
+	 */
+	Future(Future&& other);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Doesn't wait : the result is simply dropped.
+	 */
+	~Future();
+
+	/**
+	 * \brief Move assignment operator
+	 */
+	Future& operator =(Future&& other);
+
+	/**
+	 * \brief Tell whether the future has a shared state
+	 */
+	bool isValid() const;
+
+	/**
+	 * \brief Tell whether the result is available
+	 */
+	bool isReady() const;
+
+	/**
+	 * \brief Wait until the result is available
+	 */
+	void wait() const;
+
+	/**
+	 * \brief Wait until the result is available, at most a given time
+	 *
+	 * \param timeout Maximum time to wait
+	 *
+	 * \return True if the result is available
+	 */
+	bool waitFor(Time timeout) const;
+
+	/**
+	 * \brief Wait for the result and get it
+	 *
+	 * Throws the exception given to the promise, or
+	 * std::future_error if the promise was destroyed unsatisfied
+	 * or the future is invalid.
+	 *
+	 * \return The value, moved out of the shared state
+	 */
+	T get();
+
+	/**
+	 * \brief Chain a function run with the value
+	 *
+	 * The function is called with the value (moved), or without
+	 * argument for a Future<void>, by the thread completing this
+	 * future. If this future fails, the function is not called and
+	 * the returned future fails with the same exception ; an
+	 * exception thrown by the function fails the returned future.
+	 *
+	 * \param function Continuation
+	 *
+	 * \return Future of the result of \a function
+	 */
+	template <typename F>
+	Future<typename priv::ContinuationResult<typename std::decay<F>::type, T>::Type> then(F&& function);
+
+	/**
+	 * \brief Chain a function run by an executor
+	 *
+	 * Same as then(function), the function being run by
+	 * executor.execute() : a cr::ThreadPool, a cr::InlineExecutor,
+	 * or any class with a bool execute(F&&) member. If the
+	 * executor refuses the function (a pool shut down...), the
+	 * returned future fails with std::future_error.
+	 *
+	 * \param executor Executor running the continuation (must outlive it)
+	 * \param function Continuation
+	 *
+	 * \return Future of the result of \a function
+	 */
+	template <typename E, typename F>
+	Future<typename priv::ContinuationResult<typename std::decay<F>::type, T>::Type> then(E& executor, F&& function);
+
+private:
+
+	template <typename U> friend class Future;
+	template <typename U> friend class Promise;
+	template <typename U> friend Future<typename priv::WhenAllResult<U>::Type> whenAll(std::vector<Future<U> >);
+	template <typename U> friend Future<typename priv::WhenAnyResult<U>::Type> whenAny(std::vector<Future<U> >);
+
+	explicit Future(priv::FutureState<T>* state);
+
+	Future(const Future&);
+	Future& operator =(const Future&);
+
+	/**
+	 * \brief Member data
+	 */
+	priv::FutureState<T>* m_state;  /**< shared state, NULL if invalid */
+};
+
+/**
+ * \brief Writing side of a cr::Future
+ *
+ * The result is given once, by setValue() or setException(),
+ * from any thread. A promise destroyed without result fails its
+ * future with std::future_error (broken_promise).
+ */
+template <typename T>
+class Promise
+{
+public:
+
+	/**
+	 * \brief Construct a promise with a new shared state
+	 */
+	Promise();
+
+	/**
+	 * \brief Move constructor
+	 */
+	Promise(Promise&& other);
+
+	/**
+	 * \brief Destructor
+	 */
+	~Promise();
+
+	/**
+	 * \brief Move assignment operator
+	 */
+	Promise& operator =(Promise&& other);
+
+	/**
+	 * \brief Get the future of the promise
+	 *
+	 * Can be called once, std::future_error is thrown otherwise.
+	 */
+	Future<T> getFuture();
+
+	/**
+	 * \brief Give the value
+	 *
+	 * The continuation of the future, if any, runs in this call.
+	 * Throws std::future_error if the result was already given.
+	 *
+	 * \param arguments Arguments of the constructor of the value
+	 *                  (none for a Promise<void>)
+	 */
+	template <typename... A>
+	void setValue(A&&... arguments);
+
+	/**
+	 * \brief Give a failure
+	 *
+	 * \param exception Exception thrown by Future::get()
+	 */
+	void setException(std::exception_ptr exception);
+
+private:
+
+	Promise(const Promise&);
+	Promise& operator =(const Promise&);
+
+	/**
+	 * \brief Member data
+	 */
+	priv::FutureState<T>* m_state;              /**< shared state, NULL if moved from */
+	bool                  m_isFutureRetrieved;  /**< was getFuture() called? */
+};
+
+/**
+ * \brief Run a function on an executor, and get the future of its result
+ *
+ * \param executor Executor running the function (a cr::ThreadPool...)
+ * \param function Callable without argument
+ *
+ * \return Future of the result of \a function
+ */
+template <typename E, typename F>
+Future<typename std::result_of<typename std::decay<F>::type()>::type> async(E& executor, F&& function);
+
+/**
+ * \brief Get a future completed when all the given ones are
+ *
+ * The result holds the values, in the order of the futures ;
+ * if some of them fail, the result fails with the exception of
+ * the first one to fail (after all are complete).
+ *
+ * \param futures Futures to wait for (consumed)
+ *
+ * \return Future of the values (a Future<void> for futures of void)
+ */
+template <typename T>
+Future<typename priv::WhenAllResult<T>::Type> whenAll(std::vector<Future<T> > futures);
+
+/**
+ * \brief Get a future completed when the first of the given ones is
+ *
+ * The result is the index of the first future complete, and its
+ * value (only the index for futures of void) ; if that future
+ * failed, the result fails with its exception.
+ *
+ * \param futures Futures to wait for (consumed, not empty)
+ *
+ * \return Future of the index and the value
+ */
+template <typename T>
+Future<typename priv::WhenAnyResult<T>::Type> whenAny(std::vector<Future<T> > futures);
+
+#include <Future.inl>
+
+} // namespace cr
+
+#endif // __CRCR_FUTURE_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::ThreadPool pool(4);
+ *
+ * cr::Future<Image> image = cr::async(pool, [&]() { return load(path); });
+ * cr::Future<Size> size = image.then(pool, [](Image image) { return scale(image).getSize(); })
+ *                              .then([](Size size) { return size * 2; });
+ *
+ * std::vector<cr::Future<int> > counts;
+ * for (std::size_t i = 0; i < files.size(); ++i)
+ *     counts.push_back(cr::async(pool, [&files, i]() { return countLines(files[i]); }));
+ * std::vector<int> lines = cr::whenAll(std::move(counts)).get();
+ * \endcode
+ */
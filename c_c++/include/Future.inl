@@ -0,0 +1,602 @@
+namespace priv
+{
+    template <typename T>
+    template <typename... A>
+    void FutureState<T>::emplace(A&&... arguments)
+    {
+        new (&m_storage) Stored(std::forward<A>(arguments)...);
+        m_hasValue = true;
+    }
+
+    template <typename T>
+    FutureState<T>::~FutureState()
+    {
+        if (m_hasValue)
+            getValue().~Stored();
+    }
+
+    /*
+     * Drop the reference of an owner
+     */
+    struct FutureRelease
+    {
+        void operator()(FutureStateBase* state) const { state->removeReference(); }
+    };
+
+    /*
+     * Give the result of a function to a promise
+     */
+    template <typename R>
+    struct PromiseSetter
+    {
+        template <typename F, typename... A>
+        static void call(Promise<R>& promise, F& function, A&&... arguments)
+        {
+            promise.setValue(function(std::forward<A>(arguments)...));
+        }
+    };
+
+    template <>
+    struct PromiseSetter<void>
+    {
+        template <typename F, typename... A>
+        static void call(Promise<void>& promise, F& function, A&&... arguments)
+        {
+            function(std::forward<A>(arguments)...);
+            promise.setValue();
+        }
+    };
+
+    /*
+     * Take the value out of a shared state
+     */
+    template <typename T>
+    struct FutureAccess
+    {
+        static T take(FutureState<T>& state)
+        {
+            return std::move(state.getValue());
+        }
+
+        template <typename R, typename F>
+        static void forward(Promise<R>& promise, F& function, FutureState<T>& state)
+        {
+            PromiseSetter<R>::call(promise, function, std::move(state.getValue()));
+        }
+    };
+
+    template <>
+    struct FutureAccess<void>
+    {
+        static void take(FutureState<void>&)
+        {
+        }
+
+        template <typename R, typename F>
+        static void forward(Promise<R>& promise, F& function, FutureState<void>&)
+        {
+            PromiseSetter<R>::call(promise, function);
+        }
+    };
+
+    /*
+     * Function run by an executor, without argument
+     */
+    template <typename R, typename F>
+    struct AsyncTask
+    {
+        template <typename G>
+        AsyncTask(G&& function, Promise<R>&& promise) :
+            m_function(std::forward<G>(function)),
+            m_promise (std::move(promise))
+        {
+        }
+
+        void operator()()
+        {
+            try
+            {
+                PromiseSetter<R>::call(m_promise, m_function);
+            }
+            catch (...)
+            {
+                m_promise.setException(std::current_exception());
+            }
+        }
+
+        F          m_function;
+        Promise<R> m_promise;
+    };
+
+    /*
+     * Continuation run by an executor, with the value of a future
+     */
+    template <typename T, typename R, typename F>
+    struct ContinuationTask
+    {
+        template <typename G>
+        ContinuationTask(FutureState<T>* state, G&& function, Promise<R>&& promise) :
+            m_state   (state),
+            m_function(std::forward<G>(function)),
+            m_promise (std::move(promise))
+        {
+        }
+
+        ContinuationTask(ContinuationTask&& other) :
+            m_state   (other.m_state),
+            m_function(std::move(other.m_function)),
+            m_promise (std::move(other.m_promise))
+        {
+            other.m_state = NULL;
+        }
+
+        ~ContinuationTask()
+        {
+            if (m_state)
+                m_state->removeReference();
+        }
+
+        void operator()()
+        {
+            if (m_state->getException())
+            {
+                m_promise.setException(m_state->getException());
+                return;
+            }
+
+            try
+            {
+                FutureAccess<T>::forward(m_promise, m_function, *m_state);
+            }
+            catch (...)
+            {
+                m_promise.setException(std::current_exception());
+            }
+        }
+
+        FutureState<T>* m_state;     /* owned reference */
+        F               m_function;
+        Promise<R>      m_promise;
+    };
+
+    /*
+     * Callback of a future, handing the continuation to its executor
+     */
+    template <typename T, typename R, typename E, typename F>
+    struct Continuation : FutureCallback
+    {
+        Continuation(E& executor, ContinuationTask<T, R, F>&& task) :
+            m_executor(&executor),
+            m_task    (std::move(task))
+        {
+        }
+
+        virtual void run() { m_executor->execute(std::move(m_task)); }
+
+        E*                        m_executor;
+        ContinuationTask<T, R, F> m_task;
+    };
+
+    /*
+     * Shared progress of whenAll() ; owns the states
+     */
+    template <typename T>
+    struct WhenAllContext
+    {
+        typedef typename WhenAllResult<T>::Type Result;
+
+        explicit WhenAllContext(std::size_t count) :
+            m_remaining(count),
+            m_hasFailed(false)
+        {
+            m_states.reserve(count);
+        }
+
+        ~WhenAllContext()
+        {
+            for (std::size_t i = 0; i < m_states.size(); ++i)
+                m_states[i]->removeReference();
+        }
+
+        void finish();
+
+        std::vector<FutureState<T>*> m_states;
+        std::atomic<std::size_t>     m_remaining;
+        std::atomic<bool>            m_hasFailed;
+        std::exception_ptr           m_exception;  /* written by the first failure only */
+        Promise<Result>              m_promise;
+    };
+
+    template <typename T>
+    void WhenAllContext<T>::finish()
+    {
+        if (m_hasFailed.load(std::memory_order_acquire))
+        {
+            m_promise.setException(m_exception);
+            return;
+        }
+
+        std::vector<T> values;
+        try
+        {
+            values.reserve(m_states.size());
+            for (std::size_t i = 0; i < m_states.size(); ++i)
+                values.push_back(std::move(m_states[i]->getValue()));
+        }
+        catch (...)
+        {
+            m_promise.setException(std::current_exception());
+            return;
+        }
+
+        m_promise.setValue(std::move(values));
+    }
+
+    template <>
+    inline void WhenAllContext<void>::finish()
+    {
+        if (m_hasFailed.load(std::memory_order_acquire))
+            m_promise.setException(m_exception);
+        else
+            m_promise.setValue();
+    }
+
+    template <typename T>
+    struct WhenAllCallback : FutureCallback
+    {
+        WhenAllCallback(const std::shared_ptr<WhenAllContext<T> >& context, FutureState<T>* state) :
+            m_context(context),
+            m_state  (state)
+        {
+        }
+
+        virtual void run()
+        {
+            if (m_state->getException() && !m_context->m_hasFailed.exchange(true, std::memory_order_relaxed))
+                m_context->m_exception = m_state->getException();
+
+            if (m_context->m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                m_context->finish();
+        }
+
+        std::shared_ptr<WhenAllContext<T> > m_context;
+        FutureState<T>*                     m_state;
+    };
+
+    /*
+     * Shared progress of whenAny() ; owns the states
+     */
+    template <typename T>
+    struct WhenAnyContext
+    {
+        typedef typename WhenAnyResult<T>::Type Result;
+
+        WhenAnyContext() :
+            m_isDone(false)
+        {
+        }
+
+        ~WhenAnyContext()
+        {
+            for (std::size_t i = 0; i < m_states.size(); ++i)
+                m_states[i]->removeReference();
+        }
+
+        void finish(std::size_t index)
+        {
+            m_promise.setValue(index, std::move(m_states[index]->getValue()));
+        }
+
+        std::vector<FutureState<T>*> m_states;
+        std::atomic<bool>            m_isDone;
+        Promise<Result>              m_promise;
+    };
+
+    template <>
+    inline void WhenAnyContext<void>::finish(std::size_t index)
+    {
+        m_promise.setValue(index);
+    }
+
+    template <typename T>
+    struct WhenAnyCallback : FutureCallback
+    {
+        WhenAnyCallback(const std::shared_ptr<WhenAnyContext<T> >& context, std::size_t index) :
+            m_context(context),
+            m_index  (index)
+        {
+        }
+
+        virtual void run()
+        {
+            if (m_context->m_isDone.exchange(true, std::memory_order_relaxed))
+                return;
+
+            const std::exception_ptr& exception = m_context->m_states[m_index]->getException();
+            if (exception)
+                m_context->m_promise.setException(exception);
+            else
+                m_context->finish(m_index);
+        }
+
+        std::shared_ptr<WhenAnyContext<T> > m_context;
+        std::size_t                         m_index;
+    };
+} // namespace priv
+
+
+template <typename T>
+Future<T>::Future() :
+    m_state(NULL)
+{
+}
+
+template <typename T>
+Future<T>::Future(priv::FutureState<T>* state) :
+    m_state(state)
+{
+}
+
+template <typename T>
+Future<T>::Future(Future&& other) :
+    m_state(other.m_state)
+{
+    other.m_state = NULL;
+}
+
+template <typename T>
+Future<T>::~Future()
+{
+    if (m_state)
+        m_state->removeReference();
+}
+
+template <typename T>
+Future<T>& Future<T>::operator =(Future&& other)
+{
+    std::swap(m_state, other.m_state);
+    return *this;
+}
+
+template <typename T>
+bool Future<T>::isValid() const
+{
+    return m_state != NULL;
+}
+
+template <typename T>
+bool Future<T>::isReady() const
+{
+    return m_state && m_state->isReady();
+}
+
+template <typename T>
+void Future<T>::wait() const
+{
+    if (!m_state)
+        throw std::future_error(std::future_errc::no_state);
+
+    m_state->wait();
+}
+
+template <typename T>
+bool Future<T>::waitFor(Time timeout) const
+{
+    if (!m_state)
+        throw std::future_error(std::future_errc::no_state);
+
+    return m_state->waitFor(timeout);
+}
+
+template <typename T>
+T Future<T>::get()
+{
+    if (!m_state)
+        throw std::future_error(std::future_errc::no_state);
+
+    std::unique_ptr<priv::FutureState<T>, priv::FutureRelease> state(m_state);
+    m_state = NULL;
+
+    state->wait();
+    if (state->getException())
+        std::rethrow_exception(state->getException());
+
+    return priv::FutureAccess<T>::take(*state);
+}
+
+template <typename T>
+template <typename F>
+Future<typename priv::ContinuationResult<typename std::decay<F>::type, T>::Type> Future<T>::then(F&& function)
+{
+    static InlineExecutor executor;
+    return then(executor, std::forward<F>(function));
+}
+
+template <typename T>
+template <typename E, typename F>
+Future<typename priv::ContinuationResult<typename std::decay<F>::type, T>::Type> Future<T>::then(E& executor, F&& function)
+{
+    typedef typename std::decay<F>::type Function;
+    typedef typename priv::ContinuationResult<Function, T>::Type Result;
+
+    if (!m_state)
+        throw std::future_error(std::future_errc::no_state);
+
+    Promise<Result> promise;
+    Future<Result> result = promise.getFuture();
+
+    /*
+     * The reference of this future goes to the continuation
+     */
+    priv::FutureState<T>* state = m_state;
+    m_state = NULL;
+
+    priv::ContinuationTask<T, Result, Function> task(state, std::forward<F>(function), std::move(promise));
+    state->setCallback(new priv::Continuation<T, Result, E, Function>(executor, std::move(task)));
+
+    return result;
+}
+
+
+template <typename T>
+Promise<T>::Promise() :
+    m_state            (new priv::FutureState<T>),
+    m_isFutureRetrieved(false)
+{
+}
+
+template <typename T>
+Promise<T>::Promise(Promise&& other) :
+    m_state            (other.m_state),
+    m_isFutureRetrieved(other.m_isFutureRetrieved)
+{
+    other.m_state = NULL;
+}
+
+template <typename T>
+Promise<T>::~Promise()
+{
+    if (!m_state)
+        return;
+
+    if (!m_state->isClaimed())
+    {
+        m_state->claim();
+        m_state->setException(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+    }
+
+    m_state->removeReference();
+}
+
+template <typename T>
+Promise<T>& Promise<T>::operator =(Promise&& other)
+{
+    std::swap(m_state, other.m_state);
+    std::swap(m_isFutureRetrieved, other.m_isFutureRetrieved);
+    return *this;
+}
+
+template <typename T>
+Future<T> Promise<T>::getFuture()
+{
+    if (!m_state)
+        throw std::future_error(std::future_errc::no_state);
+    if (m_isFutureRetrieved)
+        throw std::future_error(std::future_errc::future_already_retrieved);
+
+    m_isFutureRetrieved = true;
+    m_state->addReference();
+
+    return Future<T>(m_state);
+}
+
+template <typename T>
+template <typename... A>
+void Promise<T>::setValue(A&&... arguments)
+{
+    if (!m_state)
+        throw std::future_error(std::future_errc::no_state);
+
+    m_state->claim();
+
+    try
+    {
+        m_state->emplace(std::forward<A>(arguments)...);
+    }
+    catch (...)
+    {
+        m_state->setException(std::current_exception());
+        return;
+    }
+
+    m_state->complete();
+}
+
+template <typename T>
+void Promise<T>::setException(std::exception_ptr exception)
+{
+    if (!m_state)
+        throw std::future_error(std::future_errc::no_state);
+
+    m_state->claim();
+    m_state->setException(exception);
+}
+
+
+template <typename E, typename F>
+Future<typename std::result_of<typename std::decay<F>::type()>::type> async(E& executor, F&& function)
+{
+    typedef typename std::decay<F>::type Function;
+    typedef typename std::result_of<Function()>::type Result;
+
+    Promise<Result> promise;
+    Future<Result> result = promise.getFuture();
+
+    /*
+     * A refused task is destroyed with its promise : broken promise
+     */
+    executor.execute(priv::AsyncTask<Result, Function>(std::forward<F>(function), std::move(promise)));
+
+    return result;
+}
+
+template <typename T>
+Future<typename priv::WhenAllResult<T>::Type> whenAll(std::vector<Future<T> > futures)
+{
+    for (std::size_t i = 0; i < futures.size(); ++i)
+    {
+        if (!futures[i].m_state)
+            throw std::future_error(std::future_errc::no_state);
+    }
+
+    std::shared_ptr<priv::WhenAllContext<T> > context = std::make_shared<priv::WhenAllContext<T> >(futures.size());
+    Future<typename priv::WhenAllResult<T>::Type> result = context->m_promise.getFuture();
+
+    /*
+     * All the states are in the context before the first
+     * callback, which may run right away
+     */
+    for (std::size_t i = 0; i < futures.size(); ++i)
+    {
+        context->m_states.push_back(futures[i].m_state);
+        futures[i].m_state = NULL;
+    }
+
+    if (context->m_states.empty())
+        context->finish();
+
+    for (std::size_t i = 0; i < context->m_states.size(); ++i)
+        context->m_states[i]->setCallback(new priv::WhenAllCallback<T>(context, context->m_states[i]));
+
+    return result;
+}
+
+template <typename T>
+Future<typename priv::WhenAnyResult<T>::Type> whenAny(std::vector<Future<T> > futures)
+{
+    for (std::size_t i = 0; i < futures.size(); ++i)
+    {
+        if (!futures[i].m_state)
+            throw std::future_error(std::future_errc::no_state);
+    }
+
+    std::shared_ptr<priv::WhenAnyContext<T> > context = std::make_shared<priv::WhenAnyContext<T> >();
+    Future<typename priv::WhenAnyResult<T>::Type> result = context->m_promise.getFuture();
+
+    if (futures.empty())
+    {
+        context->m_promise.setException(std::make_exception_ptr(std::invalid_argument("whenAny() without futures")));
+        return result;
+    }
+
+    for (std::size_t i = 0; i < futures.size(); ++i)
+    {
+        context->m_states.push_back(futures[i].m_state);
+        futures[i].m_state = NULL;
+    }
+
+    for (std::size_t i = 0; i < context->m_states.size(); ++i)
+        context->m_states[i]->setCallback(new priv::WhenAnyCallback<T>(context, i));
+
+    return result;
+}
@@ -0,0 +1,215 @@
+#ifndef __CRCR_IO_RING_HPP__
+#define __CRCR_IO_RING_HPP__
+
+#include <Config.hpp>
+#include <NonCopyable.hpp>
+#include <cstddef>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+namespace priv
+{
+	class IoRingImpl;
+}
+
+/**
+ * \brief Result of an asynchronous operation
+ */
+struct IoCompletion
+{
+	Uint64 userData;  /**< value given when the operation was prepared */
+	Int64  result;    /**< number of bytes transferred, or -errno on failure */
+};
+
+/**
+ * \brief Engine of asynchronous file reads and writes
+ *
+ * Operations are first prepared (queued in the ring), then
+ * submitted in a batch by submit() : a single system call for
+ * many operations. Each one completes later, in any order, and
+ * its completion is identified by the user data given when it
+ * was prepared.
+ *
+ * On Linux 5.6 and later the ring is an io_uring shared with the
+ * kernel (the read and write operations it uses appeared in 5.6).
+ * Where io_uring is not available (older kernels, blocked by a
+ * sandbox), the operations are run with pread/pwrite by a
+ * few worker threads : the interface and the results are the
+ * same, only the cost differs.
+ *
+ * Preparing and submitting can be done from several threads, as
+ * well as waiting for completions : typically a pool of
+ * cr::Thread workers loops on waitCompletions(), sleeping while
+ * the ring is idle, until shutdown() is called.
+ */
+class IoRing : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Implementation of the ring
+	 */
+	enum Backend
+	{
+		Auto,     /**< io_uring if available, worker threads otherwise */
+		Uring,    /**< io_uring only */
+		Threads   /**< worker threads */
+	};
+
+	/**
+	 * \brief Create a ring
+	 *
+	 * Check isValid() to know whether it succeeded (only
+	 * Backend Uring can fail).
+	 *
+	 * \param depth   Maximum number of operations in flight
+	 * \param backend Implementation of the ring
+	 */
+	explicit IoRing(std::size_t depth = 256, Backend backend = Auto);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * The operations in flight must be completed first, and no
+	 * thread may be waiting for completions anymore (see shutdown()).
+	 */
+	~IoRing();
+
+	/**
+	 * \brief Tell whether the ring can be used
+	 */
+	bool isValid() const;
+
+	/**
+	 * \brief Get the implementation of the ring
+	 *
+	 * \return Uring or Threads
+	 */
+	Backend getBackend() const;
+
+	/**
+	 * \brief Prepare a read at a given offset of a file
+	 *
+	 * \param descriptor File descriptor
+	 * \param buffer     Receives the bytes read (must stay valid until completion)
+	 * \param size       Number of bytes to read
+	 * \param offset     Position in the file
+	 * \param userData   Value identifying the completion
+	 *
+	 * \return False if the ring is full : submit and wait for completions first
+	 */
+	bool prepareRead(int descriptor, void* buffer, std::size_t size, Uint64 offset, Uint64 userData);
+
+	/**
+	 * \brief Prepare a write at a given offset of a file
+	 *
+	 * \param descriptor File descriptor
+	 * \param buffer     Bytes to write (must stay valid until completion)
+	 * \param size       Number of bytes to write
+	 * \param offset     Position in the file
+	 * \param userData   Value identifying the completion
+	 *
+	 * \return False if the ring is full : submit and wait for completions first
+	 */
+	bool prepareWrite(int descriptor, const void* buffer, std::size_t size, Uint64 offset, Uint64 userData);
+
+	/**
+	 * \brief Prepare an operation which does nothing
+	 *
+	 * Its completion is typically used to wake up the threads
+	 * waiting for completions, to stop them.
+	 *
+	 * \param userData Value identifying the completion
+	 *
+	 * \return False if the ring is full
+	 */
+	bool prepareNop(Uint64 userData);
+
+	/**
+	 * \brief Start the prepared operations
+	 *
+	 * \return Number of operations submitted
+	 */
+	std::size_t submit();
+
+	/**
+	 * \brief Wait for completed operations
+	 *
+	 * While no operation is in flight, sleep until operations are
+	 * submitted by another thread, or until shutdown(). Prepared
+	 * operations are not in flight before submit() : use
+	 * pollCompletions() not to wait.
+	 *
+	 * \param completions Receives the completions
+	 * \param maximum     Maximum number of completions to return
+	 * \param minimum     Number of completions to wait for (at most \a maximum)
+	 *
+	 * \return Number of completions written to \a completions, 0 after shutdown()
+	 *         once nothing is in flight
+	 */
+	std::size_t waitCompletions(IoCompletion* completions, std::size_t maximum, std::size_t minimum = 1);
+
+	/**
+	 * \brief Get the completed operations without waiting
+	 *
+	 * \param completions Receives the completions
+	 * \param maximum     Maximum number of completions to return
+	 *
+	 * \return Number of completions written to \a completions
+	 */
+	std::size_t pollCompletions(IoCompletion* completions, std::size_t maximum);
+
+	/**
+	 * \brief Get the number of operations prepared or submitted, not completed yet
+	 */
+	std::size_t getPendingCount() const;
+
+	/**
+	 * \brief Stop waiting for new submissions
+	 *
+	 * Wake up the threads sleeping in waitCompletions() while the
+	 * ring is idle : from now on, it returns 0 instead of waiting
+	 * when nothing is in flight, so that the workers looping on it
+	 * can stop. The operations in flight are still waited for.
+	 */
+	void shutdown();
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	priv::IoRingImpl* m_impl;  /**< io_uring or worker threads */
+};
+
+} // namespace cr
+
+#endif // __CRCR_IO_RING_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::IoRing ring(64);
+ *
+ * // read 64 blocks at once
+ * for (int i = 0; i < 64; ++i)
+ *     ring.prepareRead(fd, blocks[i], 4096, offsets[i], i);
+ * ring.submit();
+ *
+ * cr::IoCompletion completions[64];
+ * std::size_t done = 0;
+ * while (done < 64)
+ *     done += ring.waitCompletions(completions + done, 64 - done);
+ *
+ * // or : workers handling the completions of other threads
+ * cr::IoCompletion completion;
+ * while (ring.waitCompletions(&completion, 1) == 1)   // until ring.shutdown()
+ *     handle(completion);
+ * \endcode
+ */
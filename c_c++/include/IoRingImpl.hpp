@@ -0,0 +1,153 @@
+#ifndef __CRCR_IO_RING_IMPL_HPP__
+#define __CRCR_IO_RING_IMPL_HPP__
+
+#include <ConditionVariable.hpp>
+#include <IoRing.hpp>
+#include <Mutex.hpp>
+#include <NonCopyable.hpp>
+#include <Thread.hpp>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+namespace priv
+{
+
+/**
+ * \brief Operation prepared in a ring
+ */
+struct IoOperation
+{
+	enum Type
+	{
+		Read,
+		Write,
+		Nop
+	};
+
+	Type        type;        /**< what to do */
+	int         descriptor;  /**< file descriptor */
+	void*       buffer;      /**< bytes read or written */
+	std::size_t size;        /**< number of bytes */
+	Uint64      offset;      /**< position in the file */
+	Uint64      userData;    /**< value identifying the completion */
+};
+
+/**
+ * \brief Interface of the implementations of cr::IoRing
+ */
+class IoRingImpl : NonCopyable
+{
+public:
+	virtual ~IoRingImpl() {}
+
+	virtual IoRing::Backend getBackend() const = 0;
+	virtual bool prepare(const IoOperation& operation) = 0;
+	virtual std::size_t submit() = 0;
+	virtual std::size_t waitCompletions(IoCompletion* completions, std::size_t maximum, std::size_t minimum) = 0;
+	virtual std::size_t getPendingCount() const = 0;
+	virtual void shutdown() = 0;
+};
+
+/**
+ * \brief Linux io_uring implementation, through the raw system calls
+ */
+class UringImpl : public IoRingImpl
+{
+public:
+	/**
+	 * \brief Create a ring
+	 *
+	 * \return New ring, NULL if io_uring is not available
+	 */
+	static UringImpl* create(std::size_t depth);
+
+	virtual ~UringImpl();
+
+	virtual IoRing::Backend getBackend() const;
+	virtual bool prepare(const IoOperation& operation);
+	virtual std::size_t submit();
+	virtual std::size_t waitCompletions(IoCompletion* completions, std::size_t maximum, std::size_t minimum);
+	virtual std::size_t getPendingCount() const;
+	virtual void shutdown();
+
+private:
+	UringImpl();
+
+	int                      m_ring;           /**< io_uring descriptor */
+	unsigned int             m_entries;        /**< size of the submission queue */
+	void*                    m_sqMemory;       /**< submission ring mapping */
+	std::size_t              m_sqMemorySize;   /**< size of the submission ring mapping */
+	void*                    m_cqMemory;       /**< completion ring mapping (may be m_sqMemory) */
+	std::size_t              m_cqMemorySize;   /**< size of the completion ring mapping */
+	io_uring_sqe*            m_sqes;           /**< submission queue entries */
+	unsigned int*            m_sqHead;         /**< first entry not consumed by the kernel */
+	unsigned int*            m_sqTail;         /**< entry following the last submitted one */
+	unsigned int             m_sqMask;         /**< index mask of the submission queue */
+	unsigned int*            m_sqArray;        /**< indices of the entries to submit */
+	unsigned int*            m_cqHead;         /**< first completion not consumed */
+	unsigned int*            m_cqTail;         /**< completion following the last one */
+	unsigned int             m_cqMask;         /**< index mask of the completion queue */
+	io_uring_cqe*            m_cqes;           /**< completion queue entries */
+	unsigned int             m_preparedTail;   /**< entry following the last prepared one */
+	std::atomic<std::size_t> m_prepared;       /**< number of operations prepared */
+	std::atomic<std::size_t> m_submitted;      /**< number of operations submitted */
+	std::atomic<std::size_t> m_completed;      /**< number of completions consumed */
+	std::atomic<Int32>       m_submitEvent;    /**< futex : changed at each submission and at shutdown */
+	std::atomic<bool>        m_isShutdown;     /**< stop waiting for submissions? */
+	Mutex                    m_submitMutex;    /**< protects the submission side */
+	Mutex                    m_completeMutex;  /**< protects the completion side */
+};
+
+/**
+ * \brief Portable implementation : worker threads running pread/pwrite
+ */
+class ThreadedIoImpl : public IoRingImpl
+{
+public:
+	explicit ThreadedIoImpl(std::size_t depth);
+
+	virtual ~ThreadedIoImpl();
+
+	virtual IoRing::Backend getBackend() const;
+	virtual bool prepare(const IoOperation& operation);
+	virtual std::size_t submit();
+	virtual std::size_t waitCompletions(IoCompletion* completions, std::size_t maximum, std::size_t minimum);
+	virtual std::size_t getPendingCount() const;
+	virtual void shutdown();
+
+private:
+	/**
+	 * \brief Entry point of the worker threads
+	 */
+	void work();
+
+	std::size_t               m_depth;      /**< maximum number of pending operations */
+	std::size_t               m_pending;    /**< operations prepared and not consumed */
+	std::size_t               m_running;    /**< operations taken by a worker, not completed */
+	bool                      m_isStopped;  /**< are the workers asked to stop? */
+	bool                      m_isShutdown; /**< stop waiting for submissions? */
+	std::deque<IoOperation>   m_prepared;   /**< operations not submitted yet */
+	std::deque<IoOperation>   m_queue;      /**< operations submitted, not started */
+	std::deque<IoCompletion>  m_completed;  /**< completions not consumed */
+	std::vector<Thread*>      m_workers;    /**< worker threads */
+	mutable Mutex             m_mutex;      /**< protects all the above */
+	ConditionVariable         m_workReady;  /**< signaled when operations are submitted */
+	ConditionVariable         m_workDone;   /**< signaled when operations complete, and at shutdown */
+};
+
+} // namespace priv
+
+} // namespace cr
+
+#endif // __CRCR_IO_RING_IMPL_HPP__
@@ -0,0 +1,91 @@
+#ifndef __CRCR_LOCK_HPP__
+#define __CRCR_LOCK_HPP__
+
+#include <NonCopyable.hpp>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+class Mutex;
+class ConditionVariable;
+
+/**
+ * \brief Automatic wrapper for locking and unlocking mutexes
+ *
+ * The mutex is locked by the constructor and unlocked by the
+ * destructor, so that it is released even when an exception is
+ * thrown. It can also be unlocked and locked again in between.
+ */
+class Lock : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Construct the lock with a target mutex
+	 *
+	 * The mutex passed to cr::Lock is automatically locked.
+	 *
+	 * \param mutex Mutex to lock
+	 */
+	explicit Lock(Mutex& mutex);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * The destructor of cr::Lock automatically unlocks its mutex,
+	 * if it is locked.
+	 */
+	~Lock();
+
+	/**
+	 * \brief Lock the mutex again, after unlock()
+	 */
+	void lock();
+
+	/**
+	 * \brief Unlock the mutex before the end of the scope
+	 */
+	void unlock();
+
+	/**
+	 * \brief Tell whether the mutex is locked by this lock
+	 */
+	bool isLocked() const;
+
+private:
+
+	friend class ConditionVariable;
+
+	/**
+	 * \brief Member data
+	 */
+	Mutex& m_mutex;     /**< Mutex to lock / unlock */
+	bool   m_isLocked;  /**< is the mutex locked by this lock? */
+};
+
+} // namespace cr
+
+#endif // __CRCR_LOCK_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::Mutex mutex;
+ *
+ * void function()
+ * {
+ *     cr::Lock lock(mutex); // mutex is now locked
+ *
+ *     functionThatMayThrowAnException(); // mutex is unlocked if this function throws
+ *
+ *     if (someCondition)
+ *         return; // mutex is unlocked
+ *
+ * } // mutex is unlocked
+ * \endcode
+ */
@@ -0,0 +1,185 @@
+#ifndef __CRCR_MAPPED_FILE_HPP__
+#define __CRCR_MAPPED_FILE_HPP__
+
+#include <NonCopyable.hpp>
+#include <String.hpp>
+#include <Utf8View.hpp>
+#include <cstddef>
+#include <string>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Read-only file mapped in memory
+ *
+ * The content of the file is accessed in place (mmap) : nothing
+ * is read until the pages are touched, and the pages are shared
+ * with the system page cache instead of being copied into a
+ * buffer. The kernel is told how the file will be read, so that
+ * it can read ahead of a sequential scan.
+ *
+ * getView() exposes the content as UTF-8 without any copy ;
+ * toString() decodes it into a cr::String in a single pass.
+ */
+class MappedFile : NonCopyable
+{
+public:
+
+	/**
+	 * \brief How the content will be accessed (madvise hints)
+	 */
+	enum AccessPattern
+	{
+		Normal,      /**< no particular order */
+		Sequential,  /**< read once from start to end : aggressive read-ahead, and the whole file is prefetched */
+		Random       /**< scattered accesses : no read-ahead */
+	};
+
+	/**
+	 * \brief Default constructor
+	 *
+	 * create a closed file
+	 */
+	MappedFile();
+
+	/**
+	 * \brief Open and map a file
+	 *
+	 * Check isOpen() to know whether it succeeded.
+	 *
+	 * \param filename Path of the file
+	 * \param pattern  Expected access pattern
+	 */
+	explicit MappedFile(const std::string& filename, AccessPattern pattern = Sequential);
+
+	/**
+	 * \brief Move constructor
+	 *
+	 * \param source Instance to move from, left closed
+	 */
+	MappedFile(MappedFile&& source);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Unmap the file
+	 */
+	~MappedFile();
+
+	/**
+	 * \brief Move assignment
+	 *
+	 * \param source Instance to move from, left closed
+	 *
+	 * \return Reference to self
+	 */
+	MappedFile& operator = (MappedFile&& source);
+
+	/**
+	 * \brief Open and map a file
+	 *
+	 * The file previously mapped, if any, is closed first.
+	 * An error message is written to std::cerr on failure.
+	 *
+	 * \param filename Path of the file
+	 * \param pattern  Expected access pattern
+	 *
+	 * \return True if the file was mapped
+	 */
+	bool open(const std::string& filename, AccessPattern pattern = Sequential);
+
+	/**
+	 * \brief Unmap the file
+	 */
+	void close();
+
+	/**
+	 * \brief Tell whether a file is mapped
+	 */
+	bool isOpen() const;
+
+	/**
+	 * \brief Change the expected access pattern
+	 *
+	 * \param pattern Expected access pattern
+	 */
+	void advise(AccessPattern pattern);
+
+	/**
+	 * \brief Ask the kernel to read a part of the file in advance
+	 *
+	 * The call doesn't wait for the pages to be read.
+	 *
+	 * \param offset Position of the first byte
+	 * \param size   Number of bytes
+	 */
+	void prefetch(std::size_t offset, std::size_t size);
+
+	/**
+	 * \brief Get a pointer to the content of the file
+	 *
+	 * \return Pointer to the first byte, NULL if the file is closed or empty
+	 */
+	const char* getData() const;
+
+	/**
+	 * \brief Get the size of the file
+	 *
+	 * \return Number of bytes, 0 if the file is closed
+	 */
+	std::size_t getSize() const;
+
+	/**
+	 * \brief Get the content of the file as UTF-8
+	 *
+	 * The view is valid as long as the file stays mapped.
+	 *
+	 * \return View on the whole file
+	 */
+	Utf8View getView() const;
+
+	/**
+	 * \brief Decode the content of the file into a cr::String
+	 *
+	 * The content is read as UTF-8 ; a leading byte order mark
+	 * is not part of the text and is skipped.
+	 *
+	 * \return Decoded content
+	 */
+	String toString() const;
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	void*       m_data;    /**< address of the mapping, NULL if none */
+	std::size_t m_size;    /**< size of the file */
+	bool        m_isOpen;  /**< is a file (possibly empty) open? */
+};
+
+} // namespace cr
+
+#endif // __CRCR_MAPPED_FILE_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::MappedFile file("corpus.txt");
+ * if (!file.isOpen())
+ *     return false;
+ *
+ * // scan the bytes in place
+ * cr::Utf8View view = file.getView();
+ * std::size_t lines = std::count(view.begin(), view.end(), '\n');
+ *
+ * // or decode the whole file
+ * cr::String text = file.toString();
+ * \endcode
+ */
@@ -0,0 +1,253 @@
+#ifndef __CRCR_MPMC_QUEUE_HPP__
+#define __CRCR_MPMC_QUEUE_HPP__
+
+#include <Config.hpp>
+#include <FutexImpl.hpp>
+#include <NonCopyable.hpp>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Bounded lock-free queue, for any number of producers and consumers
+ *
+ * The elements are stored in a ring of slots, each one with a
+ * sequence number telling whether it is free or full for the
+ * current lap (Dmitry Vyukov's algorithm). A push or a pop is
+ * one compare-and-swap on the position, and the threads working
+ * on different slots never write the same cache line : the slots
+ * are padded to 64 bytes, and the positions are on lines of
+ * their own.
+ *
+ * The try functions never block. push() and pop() spin a little,
+ * then sleep on a futex until the queue changes ; the threads
+ * which don't have to wait make no system call.
+ *
+ * The elements are handed in FIFO order (each producer's pushes
+ * are popped in the order they were made).
+ */
+template <typename T>
+class MpmcQueue : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Construct an empty queue
+	 *
+	 * \param capacity Maximum number of elements, rounded to a power of two
+	 */
+	explicit MpmcQueue(std::size_t capacity);
+
+	/**
+	 * \brief Destructor, destroy the elements left
+	 */
+	~MpmcQueue();
+
+	/**
+	 * \brief Add an element, unless the queue is full
+	 *
+	 * \param value Element to add (moved only on success)
+	 *
+	 * \return False if the queue is full
+	 */
+	bool tryPush(T&& value);
+
+	/**
+	 * \brief Add a copy of an element, unless the queue is full
+	 *
+	 * \param value Element to add
+	 *
+	 * \return False if the queue is full
+	 */
+	bool tryPush(const T& value);
+
+	/**
+	 * \brief Remove the oldest element, unless the queue is empty
+	 *
+	 * \param value Receives the element
+	 *
+	 * \return False if the queue is empty
+	 */
+	bool tryPop(T& value);
+
+	/**
+	 * \brief Add an element, waiting for room if the queue is full
+	 *
+	 * \param value Element to add
+	 */
+	void push(T value);
+
+	/**
+	 * \brief Remove the oldest element, waiting for one if the queue is empty
+	 *
+	 * \param value Receives the element
+	 */
+	void pop(T& value);
+
+	/**
+	 * \brief Add several elements at once, as many as there is room for
+	 *
+	 * The elements taken are consecutive in the queue : another
+	 * producer can't insert its own between them. The whole batch
+	 * costs a single compare-and-swap.
+	 *
+	 * \param values Elements to add (the ones added are moved)
+	 * \param count  Number of elements
+	 *
+	 * \return Number of elements added, from the first one
+	 */
+	std::size_t tryPushBatch(T* values, std::size_t count);
+
+	/**
+	 * \brief Remove several elements at once, as many as available
+	 *
+	 * \param values  Receives the elements
+	 * \param maximum Maximum number of elements to remove
+	 *
+	 * \return Number of elements removed
+	 */
+	std::size_t tryPopBatch(T* values, std::size_t maximum);
+
+	/**
+	 * \brief Add several elements, waiting for room until all are added
+	 *
+	 * \param values Elements to add (moved)
+	 * \param count  Number of elements
+	 */
+	void pushBatch(T* values, std::size_t count);
+
+	/**
+	 * \brief Remove several elements, waiting until at least one is available
+	 *
+	 * \param values  Receives the elements
+	 * \param maximum Maximum number of elements to remove (not 0)
+	 *
+	 * \return Number of elements removed
+	 */
+	std::size_t popBatch(T* values, std::size_t maximum);
+
+	/**
+	 * \brief Get the approximate number of elements
+	 *
+	 * The result may already be wrong when the function returns.
+	 */
+	std::size_t getSize() const;
+
+	/**
+	 * \brief Get the maximum number of elements
+	 */
+	std::size_t getCapacity() const;
+
+private:
+
+	/**
+	 * \brief Element and its sequence number
+	 *
+	 * The sequence is the position of the next push for which the
+	 * slot is free, or that position + 1 once the element is stored.
+	 */
+	struct Slot
+	{
+		std::atomic<std::size_t>                                     sequence;  /**< state of the slot for the current lap */
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type   storage;   /**< the element */
+
+		T* get() { return reinterpret_cast<T*>(&storage); }
+	};
+
+	/**
+	 * \brief Distance between two slots : whole cache lines
+	 */
+	static const std::size_t SlotStride = (sizeof(Slot) + 63) / 64 * 64;
+
+	/**
+	 * \brief Get the slot of a position
+	 */
+	Slot& getSlot(std::size_t position) const;
+
+	/**
+	 * \brief Claim consecutive free slots for pushing
+	 *
+	 * \param count Maximum number of slots
+	 *
+	 * \return Number of slots claimed, from \a position
+	 */
+	std::size_t claimPush(std::size_t& position, std::size_t count);
+
+	/**
+	 * \brief Claim consecutive full slots for popping
+	 *
+	 * \param count Maximum number of slots
+	 *
+	 * \return Number of slots claimed, from \a position
+	 */
+	std::size_t claimPop(std::size_t& position, std::size_t count);
+
+	/**
+	 * \brief Wake up the threads waiting for a change, if any
+	 */
+	static void notify(std::atomic<Int32>& isWaiting, std::atomic<Int32>& event);
+
+	/**
+	 * \brief Spin, then sleep until a change
+	 *
+	 * \param attempt Function trying the operation, returning true on success
+	 */
+	template <typename F>
+	static void waitUntil(std::atomic<Int32>& isWaiting, std::atomic<Int32>& event, F attempt);
+
+	/**
+	 * \brief Member data
+	 *
+	 * The producers write m_pushPosition, the consumers m_popPosition :
+	 * each one has its own cache line
+	 */
+	char*                    m_slots;                                /**< ring of slots, SlotStride bytes each */
+	std::size_t              m_mask;                                 /**< capacity - 1 */
+	char                     m_padding1[64];                         /**< keeps the positions away from the above */
+	std::atomic<std::size_t> m_pushPosition;                         /**< position of the next push */
+	char                     m_padding2[64 - sizeof(std::size_t)];   /**< keeps m_pushPosition alone on its cache line */
+	std::atomic<std::size_t> m_popPosition;                          /**< position of the next pop */
+	char                     m_padding3[64 - sizeof(std::size_t)];   /**< keeps m_popPosition alone on its cache line */
+	std::atomic<Int32>       m_isPushWaiting;                        /**< may producers be sleeping? */
+	std::atomic<Int32>       m_pushEvent;                            /**< futex : changed when an element is popped */
+	std::atomic<Int32>       m_isPopWaiting;                         /**< may consumers be sleeping? */
+	std::atomic<Int32>       m_popEvent;                             /**< futex : changed when an element is pushed */
+};
+
+#include <MpmcQueue.inl>
+
+} // namespace cr
+
+#endif // __CRCR_MPMC_QUEUE_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::MpmcQueue<Job*> queue(1024);
+ *
+ * // producers
+ * queue.push(new Job(request));
+ *
+ * // consumers
+ * Job* jobs[16];
+ * for (;;)
+ * {
+ *     std::size_t count = queue.popBatch(jobs, 16);
+ *     for (std::size_t i = 0; i < count; ++i)
+ *         run(jobs[i]);
+ * }
+ * \endcode
+ */
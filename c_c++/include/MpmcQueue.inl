@@ -0,0 +1,344 @@
+template <typename T>
+MpmcQueue<T>::MpmcQueue(std::size_t capacity) :
+    m_slots        (NULL),
+    m_mask         (0),
+    m_pushPosition (0),
+    m_popPosition  (0),
+    m_isPushWaiting(0),
+    m_pushEvent    (0),
+    m_isPopWaiting (0),
+    m_popEvent     (0)
+{
+    std::size_t size = 2;
+    while (size < capacity)
+        size *= 2;
+
+    void* memory = NULL;
+    if (posix_memalign(&memory, 64, size * SlotStride) != 0)
+    {
+        std::cerr << "Failed to allocate the slots of the queue" << std::endl;
+        throw std::bad_alloc();
+    }
+
+    m_slots = static_cast<char*>(memory);
+    m_mask = size - 1;
+
+    for (std::size_t i = 0; i < size; ++i)
+        new (&getSlot(i).sequence) std::atomic<std::size_t>(i);
+}
+
+template <typename T>
+MpmcQueue<T>::~MpmcQueue()
+{
+    std::size_t end = m_pushPosition.load(std::memory_order_relaxed);
+    for (std::size_t i = m_popPosition.load(std::memory_order_relaxed); i != end; ++i)
+        getSlot(i).get()->~T();
+
+    std::free(m_slots);
+}
+
+template <typename T>
+bool MpmcQueue<T>::tryPush(T&& value)
+{
+    std::size_t position;
+    if (claimPush(position, 1) == 0)
+        return false;
+
+    Slot& slot = getSlot(position);
+    new (slot.get()) T(std::move(value));
+    slot.sequence.store(position + 1, std::memory_order_release);
+
+    notify(m_isPopWaiting, m_popEvent);
+    return true;
+}
+
+template <typename T>
+bool MpmcQueue<T>::tryPush(const T& value)
+{
+    std::size_t position;
+    if (claimPush(position, 1) == 0)
+        return false;
+
+    Slot& slot = getSlot(position);
+    new (slot.get()) T(value);
+    slot.sequence.store(position + 1, std::memory_order_release);
+
+    notify(m_isPopWaiting, m_popEvent);
+    return true;
+}
+
+template <typename T>
+bool MpmcQueue<T>::tryPop(T& value)
+{
+    std::size_t position;
+    if (claimPop(position, 1) == 0)
+        return false;
+
+    Slot& slot = getSlot(position);
+    value = std::move(*slot.get());
+    slot.get()->~T();
+    slot.sequence.store(position + m_mask + 1, std::memory_order_release);
+
+    notify(m_isPushWaiting, m_pushEvent);
+    return true;
+}
+
+template <typename T>
+void MpmcQueue<T>::push(T value)
+{
+    if (tryPush(std::move(value)))
+        return;
+
+    waitUntil(m_isPushWaiting, m_pushEvent, [&]() { return tryPush(std::move(value)); });
+}
+
+template <typename T>
+void MpmcQueue<T>::pop(T& value)
+{
+    if (tryPop(value))
+        return;
+
+    waitUntil(m_isPopWaiting, m_popEvent, [&]() { return tryPop(value); });
+}
+
+template <typename T>
+std::size_t MpmcQueue<T>::tryPushBatch(T* values, std::size_t count)
+{
+    std::size_t position;
+    std::size_t claimed = claimPush(position, count);
+
+    for (std::size_t i = 0; i < claimed; ++i)
+    {
+        Slot& slot = getSlot(position + i);
+        new (slot.get()) T(std::move(values[i]));
+        slot.sequence.store(position + i + 1, std::memory_order_release);
+    }
+
+    if (claimed > 0)
+        notify(m_isPopWaiting, m_popEvent);
+
+    return claimed;
+}
+
+template <typename T>
+std::size_t MpmcQueue<T>::tryPopBatch(T* values, std::size_t maximum)
+{
+    std::size_t position;
+    std::size_t claimed = claimPop(position, maximum);
+
+    for (std::size_t i = 0; i < claimed; ++i)
+    {
+        Slot& slot = getSlot(position + i);
+        values[i] = std::move(*slot.get());
+        slot.get()->~T();
+        slot.sequence.store(position + i + m_mask + 1, std::memory_order_release);
+    }
+
+    if (claimed > 0)
+        notify(m_isPushWaiting, m_pushEvent);
+
+    return claimed;
+}
+
+template <typename T>
+void MpmcQueue<T>::pushBatch(T* values, std::size_t count)
+{
+    std::size_t pushed = tryPushBatch(values, count);
+
+    while (pushed < count)
+    {
+        waitUntil(m_isPushWaiting, m_pushEvent, [&]()
+        {
+            std::size_t added = tryPushBatch(values + pushed, count - pushed);
+            pushed += added;
+            return added > 0;
+        });
+    }
+}
+
+template <typename T>
+std::size_t MpmcQueue<T>::popBatch(T* values, std::size_t maximum)
+{
+    std::size_t popped = tryPopBatch(values, maximum);
+    if (popped > 0)
+        return popped;
+
+    waitUntil(m_isPopWaiting, m_popEvent, [&]()
+    {
+        popped = tryPopBatch(values, maximum);
+        return popped > 0;
+    });
+
+    return popped;
+}
+
+template <typename T>
+std::size_t MpmcQueue<T>::getSize() const
+{
+    std::size_t pop = m_popPosition.load(std::memory_order_relaxed);
+    std::size_t push = m_pushPosition.load(std::memory_order_relaxed);
+
+    std::ptrdiff_t size = static_cast<std::ptrdiff_t>(push - pop);
+    if (size < 0)
+        return 0;
+
+    return static_cast<std::size_t>(size) > m_mask + 1 ? m_mask + 1 : static_cast<std::size_t>(size);
+}
+
+template <typename T>
+std::size_t MpmcQueue<T>::getCapacity() const
+{
+    return m_mask + 1;
+}
+
+template <typename T>
+typename MpmcQueue<T>::Slot& MpmcQueue<T>::getSlot(std::size_t position) const
+{
+    return *reinterpret_cast<Slot*>(m_slots + (position & m_mask) * SlotStride);
+}
+
+template <typename T>
+std::size_t MpmcQueue<T>::claimPush(std::size_t& position, std::size_t count)
+{
+    position = m_pushPosition.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        /*
+         * Count the free slots following the position : nobody else
+         * can fill them while m_pushPosition doesn't move
+         */
+        std::size_t available = 0;
+        while (available < count && available <= m_mask)
+        {
+            std::size_t expected = position + available;
+            std::size_t sequence = getSlot(expected).sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - expected);
+
+            if (difference != 0)
+            {
+                /*
+                 * Full if the first slot still holds the element
+                 * of the previous lap
+                 */
+                if (available == 0 && difference < 0)
+                    return 0;
+                break;
+            }
+
+            ++available;
+        }
+
+        if (available == 0)
+        {
+            /*
+             * Another producer took the slot : catch up
+             */
+            position = m_pushPosition.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (m_pushPosition.compare_exchange_weak(position, position + available, std::memory_order_relaxed))
+            return available;
+    }
+}
+
+template <typename T>
+std::size_t MpmcQueue<T>::claimPop(std::size_t& position, std::size_t count)
+{
+    position = m_popPosition.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        /*
+         * Count the full slots following the position
+         */
+        std::size_t available = 0;
+        while (available < count && available <= m_mask)
+        {
+            std::size_t expected = position + available + 1;
+            std::size_t sequence = getSlot(position + available).sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - expected);
+
+            if (difference != 0)
+            {
+                /*
+                 * Empty if the first slot wasn't filled for this lap yet
+                 */
+                if (available == 0 && difference < 0)
+                    return 0;
+                break;
+            }
+
+            ++available;
+        }
+
+        if (available == 0)
+        {
+            /*
+             * Another consumer took the slot : catch up
+             */
+            position = m_popPosition.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (m_popPosition.compare_exchange_weak(position, position + available, std::memory_order_relaxed))
+            return available;
+    }
+}
+
+template <typename T>
+void MpmcQueue<T>::notify(std::atomic<Int32>& isWaiting, std::atomic<Int32>& event)
+{
+    /*
+     * Pairs with the fence in waitUntil() : either the sleeper
+     * sees the change, or this thread sees the sleeper
+     */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (isWaiting.load(std::memory_order_relaxed) == 0)
+        return;
+
+    /*
+     * Only the first thread to see the sleepers wakes them up :
+     * the next ones return above until a thread sleeps again
+     */
+    if (isWaiting.exchange(0, std::memory_order_relaxed) == 0)
+        return;
+
+    event.fetch_add(1, std::memory_order_release);
+    priv::futexWake(&event, INT_MAX);
+}
+
+template <typename T>
+template <typename F>
+void MpmcQueue<T>::waitUntil(std::atomic<Int32>& isWaiting, std::atomic<Int32>& event, F attempt)
+{
+    if (priv::isMultiCore())
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            priv::cpuRelax();
+            if (attempt())
+                return;
+        }
+    }
+
+    for (;;)
+    {
+        /*
+         * Read the event before raising the flag : a notifier clearing
+         * a flag raised earlier changes the event after this read, so
+         * the futex doesn't sleep on a value already notified
+         */
+        Int32 value = event.load(std::memory_order_acquire);
+        isWaiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (attempt())
+            return;
+
+        priv::futexWait(&event, value);
+        if (attempt())
+            return;
+    }
+}
@@ -0,0 +1,122 @@
+#ifndef __CRCR_MUTEX_HPP__
+#define __CRCR_MUTEX_HPP__
+
+#include <Config.hpp>
+#include <NonCopyable.hpp>
+#include <atomic>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+class ConditionVariable;
+
+/**
+ * \brief Blocks concurrent access to shared resources from multiple threads
+ *
+ * The mutex is a single futex word : locking and unlocking
+ * without contention are one inlined atomic instruction each, and the
+ * kernel is only called when threads actually have to sleep.
+ * Before sleeping, a thread spins for a while on multi-core
+ * machines, the owner being likely to release the mutex soon ;
+ * the length of the spin adapts to how long the recent spins
+ * needed to succeed.
+ *
+ * Unlike sf::Mutex, this mutex is not recursive : a thread
+ * locking it twice blocks forever.
+ */
+class Mutex : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Default constructor
+	 */
+	Mutex();
+
+	/**
+	 * \brief Lock the mutex
+	 *
+	 * If the mutex is already locked in another thread,
+	 * this call will block the execution until the mutex
+	 * is released.
+	 *
+	 * \see unlock
+	 */
+	void lock();
+
+	/**
+	 * \brief Lock the mutex if it is free
+	 *
+	 * \return True if the mutex was locked, false if it is already locked
+	 */
+	bool tryLock();
+
+	/**
+	 * \brief Unlock the mutex
+	 *
+	 * \see lock
+	 */
+	void unlock();
+
+private:
+
+	friend class ConditionVariable;
+
+	/**
+	 * \brief Lock with contention : spin, then sleep
+	 */
+	void lockSlow();
+
+	/**
+	 * \brief Wake up a sleeping thread, after unlocking
+	 */
+	void wakeOne();
+
+	/**
+	 * \brief Lock, leaving the mutex marked as contended
+	 *
+	 * Used by the threads woken by a condition variable, which
+	 * may have moved other sleepers onto the mutex.
+	 */
+	void lockContended();
+
+	/**
+	 * \brief Member data
+	 */
+	std::atomic<Int32> m_state;  /**< futex : 0 free, 1 locked, 2 locked with sleepers */
+	std::atomic<Int32> m_spins;  /**< average number of iterations of the successful spins */
+};
+
+#include <Mutex.inl>
+
+} // namespace cr
+
+#endif // __CRCR_MUTEX_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::Mutex mutex;
+ *
+ * void thread1()
+ * {
+ *     mutex.lock(); // this call will block the thread if the mutex is already locked by thread2
+ *     for (int i = 0; i < 10; ++i)
+ *         std::cout << "I'm thread1" << std::endl;
+ *     mutex.unlock(); // if thread2 was waiting, it will now be unblocked
+ * }
+ *
+ * void thread2()
+ * {
+ *     mutex.lock(); // this call will block the thread if the mutex is already locked by thread1
+ *     for (int i = 0; i < 10; ++i)
+ *         std::cout << "I'm thread2" << std::endl;
+ *     mutex.unlock(); // if thread1 was waiting, it will now be unblocked
+ * }
+ * \endcode
+ */
@@ -0,0 +1,18 @@
+inline void Mutex::lock()
+{
+    Int32 state = 0;
+    if (!m_state.compare_exchange_strong(state, 1, std::memory_order_acquire, std::memory_order_relaxed))
+        lockSlow();
+}
+
+inline bool Mutex::tryLock()
+{
+    Int32 state = 0;
+    return m_state.compare_exchange_strong(state, 1, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+inline void Mutex::unlock()
+{
+    if (m_state.exchange(0, std::memory_order_release) == 2)
+        wakeOne();
+}
@@ -0,0 +1,94 @@
+#ifndef __CRCR_NORMALIZATION_HPP__
+#define __CRCR_NORMALIZATION_HPP__
+
+#include <String.hpp>
+#include <StringView.hpp>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ *
+ * Unicode normalization (UAX #15).
+ *
+ * The decompositions, compositions and combining classes come
+ * from compact tables generated from the Unicode character
+ * database (see tools/gen_unicode_tables.py); Hangul syllables
+ * are handled algorithmically.
+ *
+ * Most text is already normalized, so every function first runs
+ * the quick check algorithm: characters below U+0300 (U+00A0 for
+ * the compatibility forms) are skipped four at a time when SSE2
+ * is available, and a string that passes the check is returned
+ * as is, without decomposing anything.
+ */
+namespace cr
+{
+
+/**
+ * \brief Unicode normalization forms
+ */
+enum NormalizationForm
+{
+	NFC,   /**< canonical decomposition, followed by canonical composition */
+	NFD,   /**< canonical decomposition */
+	NFKC,  /**< compatibility decomposition, followed by canonical composition */
+	NFKD   /**< compatibility decomposition */
+};
+
+/**
+ * \brief Check whether a string is normalized
+ *
+ * The quick check answers most of the time; when it can't
+ * (possible compositions in NFC or NFKC), the string is
+ * normalized and compared with the original.
+ *
+ * \param str  String to check
+ * \param form Normalization form
+ *
+ * \return True if \a str is already in the normalization form \a form
+ */
+bool isNormalized(StringView str, NormalizationForm form);
+
+/**
+ * \brief Normalize a string
+ *
+ * \param str  String to normalize
+ * \param form Normalization form
+ *
+ * \return Copy of \a str in the normalization form \a form
+ *
+ * \see normalizeInPlace
+ */
+String normalize(StringView str, NormalizationForm form);
+
+/**
+ * \brief Normalize a string in place
+ *
+ * The string is left untouched (and nothing is allocated)
+ * when it is already normalized.
+ *
+ * \param str  String to normalize
+ * \param form Normalization form
+ *
+ * \return True if \a str was modified
+ *
+ * \see normalize
+ */
+bool normalizeInPlace(String& str, NormalizationForm form);
+
+} // namespace cr
+
+#endif // __CRCR_NORMALIZATION_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::String name = readFileName();
+ *
+ * // compare file names regardless of how the accents were typed
+ * cr::normalizeInPlace(name, cr::NFC);
+ *
+ * cr::String key = cr::normalize(name, cr::NFKD);
+ * \endcode
+ */
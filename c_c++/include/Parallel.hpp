@@ -0,0 +1,193 @@
+#ifndef __CRCR_PARALLEL_HPP__
+#define __CRCR_PARALLEL_HPP__
+
+#include <TaskScheduler.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Get the scheduler shared by the parallel algorithms
+ *
+ * Created on first use, with one worker per core. The algorithms
+ * called without a scheduler run there : the workers are started
+ * once, not at each call.
+ */
+TaskScheduler& getDefaultScheduler();
+
+/**
+ * \brief Call a function for each index of a range, in parallel
+ *
+ * The range is split in halves recursively down to the grain
+ * size, and the halves are spawned on the scheduler : idle workers
+ * steal the largest pieces left. The grain size is picked from the
+ * size of the range and the number of workers (about 8 pieces per
+ * worker), so that the load stays balanced even when the calls
+ * don't all take the same time. Small ranges, and schedulers with
+ * a single worker, are run by the calling thread.
+ *
+ * The function is called from several threads at once. It can
+ * itself call parallel algorithms.
+ *
+ * \param first    First index, integer or random-access iterator
+ * \param last     Index past the last one
+ * \param function Callable taking an index
+ */
+template <typename Index, typename F>
+void parallelFor(Index first, Index last, F function);
+
+/**
+ * \brief Call a function for each index of a range, in parallel, on a given scheduler
+ *
+ * \param scheduler Scheduler running the tasks
+ * \param first     First index, integer or random-access iterator
+ * \param last      Index past the last one
+ * \param function  Callable taking an index
+ */
+template <typename Index, typename F>
+void parallelFor(TaskScheduler& scheduler, Index first, Index last, F function);
+
+/**
+ * \brief Combine the elements of a range, in parallel
+ *
+ * Each piece of the range is reduced from the identity, then the
+ * results of the pieces are reduced in order : the operation must
+ * be associative, it doesn't have to be commutative.
+ *
+ * \param first    Random-access iterator to the first element
+ * \param last     Iterator past the last element
+ * \param identity Neutral value of the operation (0 for a sum)
+ * \param reduce   Callable combining two values
+ *
+ * \return The elements combined, identity for an empty range
+ */
+template <typename Iterator, typename T, typename Reduce>
+T parallelReduce(Iterator first, Iterator last, T identity, Reduce reduce);
+
+/**
+ * \brief Combine the elements of a range, in parallel, on a given scheduler
+ */
+template <typename Iterator, typename T, typename Reduce>
+T parallelReduce(TaskScheduler& scheduler, Iterator first, Iterator last, T identity, Reduce reduce);
+
+/**
+ * \brief Combine a value computed for each index of a range, in parallel
+ *
+ * \param first     First index, integer or random-access iterator
+ * \param last      Index past the last one
+ * \param identity  Neutral value of the operation
+ * \param reduce    Callable combining two values
+ * \param transform Callable computing the value of an index
+ *
+ * \return The values combined, identity for an empty range
+ */
+template <typename Index, typename T, typename Reduce, typename Transform>
+T parallelReduce(Index first, Index last, T identity, Reduce reduce, Transform transform);
+
+/**
+ * \brief Combine a value computed for each index of a range, in parallel, on a given scheduler
+ */
+template <typename Index, typename T, typename Reduce, typename Transform>
+T parallelReduce(TaskScheduler& scheduler, Index first, Index last, T identity, Reduce reduce, Transform transform);
+
+/**
+ * \brief Compute the inclusive prefix combinations of a range, in parallel
+ *
+ * Element i of the result is the combination of the elements 0
+ * to i. The range is cut into blocks, one pass reduces each
+ * block, the calling thread combines the results of the blocks,
+ * and a second pass scans each block from its offset : the
+ * operation is applied about twice per element, against once for
+ * the serial scan, which pays off from 3 workers on.
+ *
+ * \param first     Random-access iterator to the first element
+ * \param last      Iterator past the last element
+ * \param result    Random-access iterator receiving the results (can be first)
+ * \param identity  Neutral value of the operation
+ * \param operation Associative callable combining two values
+ */
+template <typename Iterator, typename OutputIterator, typename T, typename Operation>
+void parallelScan(Iterator first, Iterator last, OutputIterator result, T identity, Operation operation);
+
+/**
+ * \brief Compute the inclusive prefix combinations of a range, in parallel, on a given scheduler
+ */
+template <typename Iterator, typename OutputIterator, typename T, typename Operation>
+void parallelScan(TaskScheduler& scheduler, Iterator first, Iterator last, OutputIterator result, T identity, Operation operation);
+
+/**
+ * \brief Sort a range in ascending order, in parallel
+ *
+ * Merge sort : the pieces are sorted by std::sort, then merged
+ * two by two. A merge is itself split in parallel (the middle of
+ * the larger half is searched in the other one), so that the
+ * last merges don't leave the workers idle. The elements are
+ * moved between the range and a buffer of the same size.
+ *
+ * The sort is not stable. The elements must be default
+ * constructible and movable.
+ *
+ * \param first Random-access iterator to the first element
+ * \param last  Iterator past the last element
+ */
+template <typename Iterator>
+void parallelSort(Iterator first, Iterator last);
+
+/**
+ * \brief Sort a range with a comparison function, in parallel
+ *
+ * \param first   Random-access iterator to the first element
+ * \param last    Iterator past the last element
+ * \param compare Callable telling whether an element goes before another
+ */
+template <typename Iterator, typename Compare>
+void parallelSort(Iterator first, Iterator last, Compare compare);
+
+/**
+ * \brief Sort a range in ascending order, in parallel, on a given scheduler
+ */
+template <typename Iterator>
+void parallelSort(TaskScheduler& scheduler, Iterator first, Iterator last);
+
+/**
+ * \brief Sort a range with a comparison function, in parallel, on a given scheduler
+ */
+template <typename Iterator, typename Compare>
+void parallelSort(TaskScheduler& scheduler, Iterator first, Iterator last, Compare compare);
+
+#include <Parallel.inl>
+
+} // namespace cr
+
+#endif // __CRCR_PARALLEL_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * std::vector<float> pixels(width * height);
+ * cr::parallelFor(std::size_t(0), pixels.size(), [&](std::size_t i) {
+ *     pixels[i] = shade(i % width, i / width);
+ * });
+ *
+ * double total = cr::parallelReduce(pixels.begin(), pixels.end(), 0.0,
+ *                                   [](double a, double b) { return a + b; });
+ *
+ * cr::parallelScan(sizes.begin(), sizes.end(), offsets.begin(), std::size_t(0),
+ *                  [](std::size_t a, std::size_t b) { return a + b; });
+ *
+ * cr::parallelSort(records.begin(), records.end(),
+ *                  [](const Record& a, const Record& b) { return a.key < b.key; });
+ * \endcode
+ */
@@ -0,0 +1,318 @@
+namespace priv
+{
+    /*
+     * Pieces per worker : enough for the stealing to even out
+     * the load, few enough for the spawns to stay negligible
+     */
+    const std::size_t ParallelPiecesPerThread = 8;
+
+    inline std::size_t getGrainSize(std::size_t count, std::size_t threadCount, std::size_t minimum)
+    {
+        std::size_t grain = count / (threadCount * ParallelPiecesPerThread);
+        return grain < minimum ? minimum : grain;
+    }
+
+    /*
+     * Index (integer or iterator) a number of positions further
+     */
+    template <typename Index>
+    inline Index offsetIndex(Index index, std::size_t offset)
+    {
+        return index + static_cast<decltype(index - index)>(offset);
+    }
+
+    template <typename Iterator>
+    struct Dereference
+    {
+        auto operator()(Iterator iterator) const -> decltype(*iterator) { return *iterator; }
+    };
+
+    template <typename Index, typename F>
+    void parallelForRange(TaskScheduler& scheduler, Index first, std::size_t count, std::size_t grain, F& function)
+    {
+        /*
+         * Spawn the second half and keep splitting the first one :
+         * the largest pieces are the first ones stolen
+         */
+        TaskGroup group(scheduler);
+        while (count > grain)
+        {
+            std::size_t half = count / 2;
+            Index middle = offsetIndex(first, half);
+            std::size_t rest = count - half;
+            group.spawn([&scheduler, middle, rest, grain, &function]() { parallelForRange(scheduler, middle, rest, grain, function); });
+            count = half;
+        }
+
+        for (Index index = first, end = offsetIndex(first, count); index != end; ++index)
+            function(index);
+
+        group.sync();
+    }
+
+    template <typename Index, typename T, typename Reduce, typename Transform>
+    T parallelReduceRange(TaskScheduler& scheduler, Index first, std::size_t count, std::size_t grain, const T& identity, Reduce& reduce, Transform& transform)
+    {
+        if (count <= grain)
+        {
+            T value = identity;
+            for (Index index = first, end = offsetIndex(first, count); index != end; ++index)
+                value = reduce(std::move(value), transform(index));
+            return value;
+        }
+
+        std::size_t half = count / 2;
+        T right = identity;
+        TaskGroup group(scheduler);
+        group.spawn([&]() { right = parallelReduceRange(scheduler, offsetIndex(first, half), count - half, grain, identity, reduce, transform); });
+        T left = parallelReduceRange(scheduler, first, half, grain, identity, reduce, transform);
+        group.sync();
+
+        return reduce(std::move(left), std::move(right));
+    }
+
+    template <typename Source, typename Destination, typename Compare>
+    void mergeRange(TaskScheduler& scheduler, Source first1, Source last1, Source first2, Source last2, Destination result, std::size_t grain, Compare& compare)
+    {
+        std::size_t count1 = static_cast<std::size_t>(last1 - first1);
+        std::size_t count2 = static_cast<std::size_t>(last2 - first2);
+
+        if (count1 + count2 <= grain)
+        {
+            std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+                       std::make_move_iterator(first2), std::make_move_iterator(last2),
+                       result, compare);
+            return;
+        }
+
+        /*
+         * Cut the larger half in its middle, and the other one where
+         * that element goes : both lower parts merge before both upper ones
+         */
+        Source middle1;
+        Source middle2;
+        if (count1 >= count2)
+        {
+            middle1 = offsetIndex(first1, count1 / 2);
+            middle2 = std::lower_bound(first2, last2, *middle1, compare);
+        }
+        else
+        {
+            middle2 = offsetIndex(first2, count2 / 2);
+            middle1 = std::upper_bound(first1, last1, *middle2, compare);
+        }
+        Destination middle = offsetIndex(result, static_cast<std::size_t>((middle1 - first1) + (middle2 - first2)));
+
+        TaskGroup group(scheduler);
+        group.spawn([&]() { mergeRange(scheduler, middle1, last1, middle2, last2, middle, grain, compare); });
+        mergeRange(scheduler, first1, middle1, first2, middle2, result, grain, compare);
+        group.sync();
+    }
+
+    /*
+     * Sort [begin, end) of the data, leaving the result in the
+     * buffer when toBuffer is set : the halves are sorted into
+     * the other array, then merged into the wanted one
+     */
+    template <typename Iterator, typename Value, typename Compare>
+    void sortRange(TaskScheduler& scheduler, Iterator data, Value* buffer, std::size_t begin, std::size_t end, bool toBuffer, std::size_t grain, Compare& compare)
+    {
+        Iterator first = offsetIndex(data, begin);
+        Iterator last = offsetIndex(data, end);
+
+        if (end - begin <= grain)
+        {
+            std::sort(first, last, compare);
+            if (toBuffer)
+                std::move(first, last, buffer + begin);
+            return;
+        }
+
+        std::size_t middle = begin + (end - begin) / 2;
+        {
+            TaskGroup group(scheduler);
+            group.spawn([&]() { sortRange(scheduler, data, buffer, begin, middle, !toBuffer, grain, compare); });
+            sortRange(scheduler, data, buffer, middle, end, !toBuffer, grain, compare);
+            group.sync();
+        }
+
+        if (toBuffer)
+            mergeRange(scheduler, first, offsetIndex(data, middle), offsetIndex(data, middle), last, buffer + begin, grain, compare);
+        else
+            mergeRange(scheduler, buffer + begin, buffer + middle, buffer + middle, buffer + end, first, grain, compare);
+    }
+
+    /*
+     * Smallest piece worth a task for the sort : below, std::sort
+     * is faster than the merges and the spawns
+     */
+    const std::size_t MinimumSortGrain = 2048;
+
+} // namespace priv
+
+template <typename Index, typename F>
+void parallelFor(Index first, Index last, F function)
+{
+    parallelFor(getDefaultScheduler(), first, last, function);
+}
+
+template <typename Index, typename F>
+void parallelFor(TaskScheduler& scheduler, Index first, Index last, F function)
+{
+    if (!(first < last))
+        return;
+
+    std::size_t count = static_cast<std::size_t>(last - first);
+    std::size_t threadCount = scheduler.getThreadCount();
+    std::size_t grain = priv::getGrainSize(count, threadCount, 1);
+
+    if (threadCount == 1 || count <= grain)
+    {
+        for (Index index = first; index != last; ++index)
+            function(index);
+        return;
+    }
+
+    scheduler.run([&]() { priv::parallelForRange(scheduler, first, count, grain, function); });
+}
+
+template <typename Iterator, typename T, typename Reduce>
+T parallelReduce(Iterator first, Iterator last, T identity, Reduce reduce)
+{
+    return parallelReduce(getDefaultScheduler(), first, last, identity, reduce, priv::Dereference<Iterator>());
+}
+
+template <typename Iterator, typename T, typename Reduce>
+T parallelReduce(TaskScheduler& scheduler, Iterator first, Iterator last, T identity, Reduce reduce)
+{
+    return parallelReduce(scheduler, first, last, identity, reduce, priv::Dereference<Iterator>());
+}
+
+template <typename Index, typename T, typename Reduce, typename Transform>
+T parallelReduce(Index first, Index last, T identity, Reduce reduce, Transform transform)
+{
+    return parallelReduce(getDefaultScheduler(), first, last, identity, reduce, transform);
+}
+
+template <typename Index, typename T, typename Reduce, typename Transform>
+T parallelReduce(TaskScheduler& scheduler, Index first, Index last, T identity, Reduce reduce, Transform transform)
+{
+    if (!(first < last))
+        return identity;
+
+    std::size_t count = static_cast<std::size_t>(last - first);
+    std::size_t threadCount = scheduler.getThreadCount();
+    std::size_t grain = threadCount == 1 ? count : priv::getGrainSize(count, threadCount, 1);
+
+    if (count <= grain)
+        return priv::parallelReduceRange(scheduler, first, count, grain, identity, reduce, transform);
+
+    T result = identity;
+    scheduler.run([&]() { result = priv::parallelReduceRange(scheduler, first, count, grain, identity, reduce, transform); });
+
+    return result;
+}
+
+template <typename Iterator, typename OutputIterator, typename T, typename Operation>
+void parallelScan(Iterator first, Iterator last, OutputIterator result, T identity, Operation operation)
+{
+    parallelScan(getDefaultScheduler(), first, last, result, identity, operation);
+}
+
+template <typename Iterator, typename OutputIterator, typename T, typename Operation>
+void parallelScan(TaskScheduler& scheduler, Iterator first, Iterator last, OutputIterator result, T identity, Operation operation)
+{
+    if (!(first < last))
+        return;
+
+    std::size_t count = static_cast<std::size_t>(last - first);
+    std::size_t threadCount = scheduler.getThreadCount();
+    std::size_t grain = threadCount == 1 ? count : priv::getGrainSize(count, threadCount, 1);
+    std::size_t blockCount = (count + grain - 1) / grain;
+
+    /*
+     * Scan block b from sums[b], writing the results if asked
+     */
+    std::vector<T> sums(blockCount, identity);
+    auto scanBlock = [&](std::size_t block, bool isWriting) -> T
+    {
+        std::size_t begin = block * grain;
+        std::size_t size = std::min(grain, count - begin);
+        Iterator input = priv::offsetIndex(first, begin);
+        OutputIterator output = priv::offsetIndex(result, begin);
+
+        T value = sums[block];
+        for (std::size_t i = 0; i < size; ++i, ++input, ++output)
+        {
+            value = operation(std::move(value), *input);
+            if (isWriting)
+                *output = value;
+        }
+        return value;
+    };
+
+    if (blockCount == 1)
+    {
+        scanBlock(0, true);
+        return;
+    }
+
+    auto reduceBlock = [&](std::size_t block) { sums[block] = scanBlock(block, false); };
+    auto writeBlock = [&](std::size_t block) { scanBlock(block, true); };
+
+    scheduler.run([&]() { priv::parallelForRange(scheduler, std::size_t(0), blockCount, 1, reduceBlock); });
+
+    /*
+     * Offset of each block : the combination of all the blocks before it
+     */
+    T total = identity;
+    for (std::size_t block = 0; block < blockCount; ++block)
+    {
+        T next = operation(total, sums[block]);
+        sums[block] = std::move(total);
+        total = std::move(next);
+    }
+
+    scheduler.run([&]() { priv::parallelForRange(scheduler, std::size_t(0), blockCount, 1, writeBlock); });
+}
+
+template <typename Iterator>
+void parallelSort(Iterator first, Iterator last)
+{
+    parallelSort(getDefaultScheduler(), first, last);
+}
+
+template <typename Iterator, typename Compare>
+void parallelSort(Iterator first, Iterator last, Compare compare)
+{
+    parallelSort(getDefaultScheduler(), first, last, compare);
+}
+
+template <typename Iterator>
+void parallelSort(TaskScheduler& scheduler, Iterator first, Iterator last)
+{
+    typedef typename std::iterator_traits<Iterator>::value_type Value;
+    parallelSort(scheduler, first, last, std::less<Value>());
+}
+
+template <typename Iterator, typename Compare>
+void parallelSort(TaskScheduler& scheduler, Iterator first, Iterator last, Compare compare)
+{
+    typedef typename std::iterator_traits<Iterator>::value_type Value;
+
+    if (!(first < last))
+        return;
+
+    std::size_t count = static_cast<std::size_t>(last - first);
+    std::size_t threadCount = scheduler.getThreadCount();
+    std::size_t grain = priv::getGrainSize(count, threadCount, priv::MinimumSortGrain);
+
+    if (threadCount == 1 || count <= grain)
+    {
+        std::sort(first, last, compare);
+        return;
+    }
+
+    std::unique_ptr<Value[]> buffer(new Value[count]);
+    scheduler.run([&]() { priv::sortRange(scheduler, first, buffer.get(), 0, count, false, grain, compare); });
+}
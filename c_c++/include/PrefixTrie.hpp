@@ -0,0 +1,228 @@
+#ifndef __CRCR_PREFIX_TRIE_HPP__
+#define __CRCR_PREFIX_TRIE_HPP__
+
+#include <String.hpp>
+#include <StringView.hpp>
+#include <NonCopyable.hpp>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <string>
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+namespace priv
+{
+	template <typename T> struct TrieNode;
+
+	/**
+	 * \brief UTF-8 encoded form of a trie key
+	 *
+	 * Keys up to 64 characters are encoded in a local buffer,
+	 * so that lookups don't allocate.
+	 */
+	class TrieKey : NonCopyable
+	{
+	public:
+		explicit TrieKey(StringView key);
+		~TrieKey();
+
+		const Uint8* getData() const { return m_data; }
+		std::size_t  getSize() const { return m_size; }
+
+		/**
+		 * \brief Count the characters of a UTF-8 byte range
+		 */
+		static std::size_t countCharacters(const Uint8* begin, const Uint8* end);
+
+	private:
+		Uint8       m_local[256];  /**< storage for short keys */
+		Uint8*      m_data;        /**< encoded key */
+		std::size_t m_size;        /**< number of bytes in the encoded key */
+	};
+}
+
+/**
+ * \brief Compressed prefix tree mapping strings to values
+ *
+ * cr::PrefixTrie is an adaptive radix tree (ART, Leis et al.):
+ * keys are stored as UTF-8 bytes, which preserves the code point
+ * order, and each inner node uses the smallest of four layouts
+ * able to hold its children (4, 16, 48 or 256 slots). Chains of
+ * nodes with a single child are collapsed into a prefix stored
+ * right after the node, in the same allocation.
+ *
+ * It supports exact lookups, enumeration of all the keys starting
+ * with a prefix (in key order), and longest-prefix lookups, which
+ * cost one walk down the tree instead of a search per candidate
+ * length.
+ *
+ * Lookups never modify the tree: any number of threads may call
+ * the const functions concurrently. Modifications (insert, erase,
+ * clear) need exclusive access, like for the standard containers.
+ */
+template <typename T>
+class PrefixTrie : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Memory and shape statistics
+	 */
+	struct Stats
+	{
+		std::size_t keyCount;      /**< number of keys */
+		std::size_t node4Count;    /**< number of nodes with up to 4 children */
+		std::size_t node16Count;   /**< number of nodes with up to 16 children */
+		std::size_t node48Count;   /**< number of nodes with up to 48 children */
+		std::size_t node256Count;  /**< number of nodes with up to 256 children */
+		std::size_t prefixBytes;   /**< bytes of compressed paths */
+		std::size_t maxDepth;      /**< number of nodes on the longest path */
+		std::size_t memoryUsage;   /**< bytes allocated by the trie, values included */
+	};
+
+	/**
+	 * \brief Default constructor
+	 *
+	 * create an empty trie
+	 */
+	PrefixTrie();
+
+	/**
+	 * \brief Destructor
+	 */
+	~PrefixTrie();
+
+	/**
+	 * \brief Insert a key, or replace the value of an existing key
+	 *
+	 * \param key   Key to insert
+	 * \param value Value associated to the key
+	 *
+	 * \return True if the key was inserted, false if its value was replaced
+	 */
+	bool insert(StringView key, const T& value);
+
+	/**
+	 * \brief Remove a key
+	 *
+	 * \param key Key to remove
+	 *
+	 * \return True if the key was found and removed
+	 */
+	bool erase(StringView key);
+
+	/**
+	 * \brief Remove all the keys
+	 */
+	void clear();
+
+	/**
+	 * \brief Find the value associated to a key
+	 *
+	 * \param key Key to look for
+	 *
+	 * \return Pointer to the value, or NULL if the key is not in the trie
+	 */
+	T* find(StringView key);
+
+	/**
+	 * \brief Find the value associated to a key
+	 *
+	 * \param key Key to look for
+	 *
+	 * \return Pointer to the value, or NULL if the key is not in the trie
+	 */
+	const T* find(StringView key) const;
+
+	/**
+	 * \brief Find the longest key which is a prefix of \a key
+	 *
+	 * \param key    Key to match
+	 * \param length If not NULL, receives the number of characters of the
+	 *               matching key
+	 *
+	 * \return Pointer to the value of the longest matching key, or NULL
+	 *         if no key of the trie is a prefix of \a key
+	 */
+	const T* findLongestPrefix(StringView key, std::size_t* length = NULL) const;
+
+	/**
+	 * \brief Visit all the keys starting with a prefix, in key order
+	 *
+	 * The visitor is called as visitor(StringView key, const T& value);
+	 * the key view is only valid during the call.
+	 *
+	 * \param prefix  Prefix of the keys to visit (an empty prefix visits all the keys)
+	 * \param visitor Function or functor to call for each key
+	 *
+	 * \return Number of keys visited
+	 */
+	template <typename F>
+	std::size_t forEachWithPrefix(StringView prefix, F visitor) const;
+
+	/**
+	 * \brief Get the number of keys
+	 *
+	 * \return Number of keys in the trie
+	 */
+	std::size_t getSize() const;
+
+	/**
+	 * \brief Check whether the trie is empty or not
+	 *
+	 * \return True if the trie contains no key
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * \brief Compute memory and shape statistics
+	 *
+	 * This function walks the whole trie.
+	 *
+	 * \return Statistics of the trie
+	 */
+	Stats getStats() const;
+
+private:
+
+	typedef priv::TrieNode<T> Node;
+
+	/**
+	 * \brief Member data
+	 */
+	Node*       m_root;  /**< root node, NULL if the trie is empty */
+	std::size_t m_size;  /**< number of keys */
+};
+
+#include <PrefixTrie.inl>
+
+} // namespace cr
+
+#endif // __CRCR_PREFIX_TRIE_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::PrefixTrie<int> routes;
+ *
+ * routes.insert(cr::String("/api/"), 1);
+ * routes.insert(cr::String("/api/users/"), 2);
+ *
+ * std::size_t length;
+ * const int * route = routes.findLongestPrefix(cr::String("/api/users/42"), &length);
+ * // *route == 2, length == 11
+ *
+ * routes.forEachWithPrefix(cr::String("/api/"), visitor);
+ * \endcode
+ */
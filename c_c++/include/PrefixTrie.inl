@@ -0,0 +1,830 @@
+namespace priv
+{
+    /*
+     * Common header of the four node layouts.
+     * The compressed path (prefix) is stored right after the
+     * node, in the same allocation.
+     */
+    template <typename T>
+    struct TrieNode
+    {
+        enum Type
+        {
+            Node4,
+            Node16,
+            Node48,
+            Node256
+        };
+
+        Uint8   type;            /* layout of the node */
+        Uint16  count;           /* number of children */
+        Uint32  prefixLength;    /* bytes of compressed path */
+        Uint32  prefixCapacity;  /* bytes allocated for the compressed path */
+        T*      value;           /* value of the key ending at this node, if any */
+    };
+
+    template <typename T>
+    struct TrieNode4 : TrieNode<T>
+    {
+        Uint8        keys[4];      /* sorted */
+        TrieNode<T>* children[4];
+    };
+
+    template <typename T>
+    struct TrieNode16 : TrieNode<T>
+    {
+        Uint8        keys[16];     /* sorted */
+        TrieNode<T>* children[16];
+    };
+
+    template <typename T>
+    struct TrieNode48 : TrieNode<T>
+    {
+        Uint8        index[256];   /* slot + 1 of each byte, 0 if absent */
+        TrieNode<T>* children[48];
+    };
+
+    template <typename T>
+    struct TrieNode256 : TrieNode<T>
+    {
+        TrieNode<T>* children[256];
+    };
+
+    /*
+     * Node management, shared by all the PrefixTrie<T> functions
+     */
+    template <typename T>
+    struct TrieOps
+    {
+        typedef TrieNode<T>    Node;
+        typedef TrieNode4<T>   Node4;
+        typedef TrieNode16<T>  Node16;
+        typedef TrieNode48<T>  Node48;
+        typedef TrieNode256<T> Node256;
+
+        static std::size_t nodeSize(Uint8 type)
+        {
+            switch (type)
+            {
+                case Node::Node4:  return sizeof(Node4);
+                case Node::Node16: return sizeof(Node16);
+                case Node::Node48: return sizeof(Node48);
+                default:           return sizeof(Node256);
+            }
+        }
+
+        static Uint8* prefix(Node* node)
+        {
+            return reinterpret_cast<Uint8*>(node) + nodeSize(node->type);
+        }
+
+        static const Uint8* prefix(const Node* node)
+        {
+            return reinterpret_cast<const Uint8*>(node) + nodeSize(node->type);
+        }
+
+        /*
+         * Allocate a node and its compressed path in one block
+         */
+        static Node* create(Uint8 type, const Uint8* path, std::size_t length)
+        {
+            std::size_t size = nodeSize(type);
+            void* memory = ::operator new(size + length);
+            std::memset(memory, 0, size);
+
+            Node* node = static_cast<Node*>(memory);
+            node->type = type;
+            node->prefixLength = static_cast<Uint32>(length);
+            node->prefixCapacity = static_cast<Uint32>(length);
+
+            if (length)
+                std::memcpy(prefix(node), path, length);
+
+            return node;
+        }
+
+        static void destroy(Node* node)
+        {
+            delete node->value;
+            ::operator delete(node);
+        }
+
+        /*
+         * Destroy a node and all its descendants
+         */
+        static void destroyTree(Node* node)
+        {
+            if (!node)
+                return;
+
+            Node* children[256];
+            std::size_t count = collect(node, NULL, children);
+
+            for (std::size_t i = 0; i < count; ++i)
+                destroyTree(children[i]);
+
+            destroy(node);
+        }
+
+        /*
+         * Address of the child slot for \a byte, or NULL
+         */
+        static Node** findChild(Node* node, Uint8 byte)
+        {
+            switch (node->type)
+            {
+                case Node::Node4:
+                {
+                    Node4* n = static_cast<Node4*>(node);
+                    for (Uint16 i = 0; i < n->count; ++i)
+                    {
+                        if (n->keys[i] == byte)
+                            return &n->children[i];
+                    }
+                    return NULL;
+                }
+
+                case Node::Node16:
+                {
+                    Node16* n = static_cast<Node16*>(node);
+                #if defined(__SSE2__)
+                    /*
+                     * Compare the 16 keys at once
+                     */
+                    __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n->keys));
+                    __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)), keys);
+                    int mask = _mm_movemask_epi8(cmp) & ((1 << n->count) - 1);
+                    return mask ? &n->children[__builtin_ctz(mask)] : NULL;
+                #else
+                    for (Uint16 i = 0; i < n->count; ++i)
+                    {
+                        if (n->keys[i] == byte)
+                            return &n->children[i];
+                    }
+                    return NULL;
+                #endif
+                }
+
+                case Node::Node48:
+                {
+                    Node48* n = static_cast<Node48*>(node);
+                    return n->index[byte] ? &n->children[n->index[byte] - 1] : NULL;
+                }
+
+                default:
+                {
+                    Node256* n = static_cast<Node256*>(node);
+                    return n->children[byte] ? &n->children[byte] : NULL;
+                }
+            }
+        }
+
+        static const Node* findChild(const Node* node, Uint8 byte)
+        {
+            Node** child = findChild(const_cast<Node*>(node), byte);
+            return child ? *child : NULL;
+        }
+
+        /*
+         * Gather the children (and their bytes if \a bytes is not NULL)
+         * in byte order
+         */
+        static std::size_t collect(const Node* node, Uint8* bytes, Node** children)
+        {
+            std::size_t count = 0;
+
+            switch (node->type)
+            {
+                case Node::Node4:
+                case Node::Node16:
+                {
+                    const Uint8* keys = node->type == Node::Node4 ? static_cast<const Node4*>(node)->keys
+                                                                  : static_cast<const Node16*>(node)->keys;
+                    Node* const* slots = node->type == Node::Node4 ? static_cast<const Node4*>(node)->children
+                                                                   : static_cast<const Node16*>(node)->children;
+                    for (; count < node->count; ++count)
+                    {
+                        if (bytes)
+                            bytes[count] = keys[count];
+                        children[count] = slots[count];
+                    }
+                    break;
+                }
+
+                case Node::Node48:
+                {
+                    const Node48* n = static_cast<const Node48*>(node);
+                    for (int byte = 0; byte < 256; ++byte)
+                    {
+                        if (n->index[byte])
+                        {
+                            if (bytes)
+                                bytes[count] = static_cast<Uint8>(byte);
+                            children[count++] = n->children[n->index[byte] - 1];
+                        }
+                    }
+                    break;
+                }
+
+                default:
+                {
+                    const Node256* n = static_cast<const Node256*>(node);
+                    for (int byte = 0; byte < 256; ++byte)
+                    {
+                        if (n->children[byte])
+                        {
+                            if (bytes)
+                                bytes[count] = static_cast<Uint8>(byte);
+                            children[count++] = n->children[byte];
+                        }
+                    }
+                    break;
+                }
+            }
+
+            return count;
+        }
+
+        static std::size_t capacity(Uint8 type)
+        {
+            switch (type)
+            {
+                case Node::Node4:  return 4;
+                case Node::Node16: return 16;
+                case Node::Node48: return 48;
+                default:           return 256;
+            }
+        }
+
+        /*
+         * Add a child to a node which has room for it
+         */
+        static void insertChild(Node* node, Uint8 byte, Node* child)
+        {
+            switch (node->type)
+            {
+                case Node::Node4:
+                case Node::Node16:
+                {
+                    Uint8* keys = node->type == Node::Node4 ? static_cast<Node4*>(node)->keys
+                                                            : static_cast<Node16*>(node)->keys;
+                    Node** slots = node->type == Node::Node4 ? static_cast<Node4*>(node)->children
+                                                             : static_cast<Node16*>(node)->children;
+
+                    /*
+                     * Keep the keys sorted
+                     */
+                    Uint16 position = 0;
+                    while (position < node->count && keys[position] < byte)
+                        ++position;
+
+                    std::memmove(keys + position + 1, keys + position, node->count - position);
+                    std::memmove(slots + position + 1, slots + position, (node->count - position) * sizeof(Node*));
+                    keys[position] = byte;
+                    slots[position] = child;
+                    break;
+                }
+
+                case Node::Node48:
+                {
+                    Node48* n = static_cast<Node48*>(node);
+                    Uint8 slot = 0;
+                    while (n->children[slot])
+                        ++slot;
+
+                    n->children[slot] = child;
+                    n->index[byte] = slot + 1;
+                    break;
+                }
+
+                default:
+                {
+                    static_cast<Node256*>(node)->children[byte] = child;
+                    break;
+                }
+            }
+
+            ++node->count;
+        }
+
+        /*
+         * Copy a node into a new layout (to grow or shrink it)
+         */
+        static Node* relayout(Node* node, Uint8 type)
+        {
+            Uint8 bytes[256];
+            Node* children[256];
+            std::size_t count = collect(node, bytes, children);
+
+            Node* copy = create(type, prefix(node), node->prefixLength);
+            copy->value = node->value;
+
+            for (std::size_t i = 0; i < count; ++i)
+                insertChild(copy, bytes[i], children[i]);
+
+            ::operator delete(node);
+            return copy;
+        }
+
+        /*
+         * Add a child, growing the node if it is full
+         */
+        static void addChild(Node** ref, Uint8 byte, Node* child)
+        {
+            Node* node = *ref;
+
+            if (node->count == capacity(node->type))
+            {
+                node = relayout(node, node->type + 1);
+                *ref = node;
+            }
+
+            insertChild(node, byte, child);
+        }
+
+        /*
+         * Remove a child, shrinking the node when it becomes sparse
+         */
+        static void removeChild(Node** ref, Uint8 byte)
+        {
+            Node* node = *ref;
+
+            switch (node->type)
+            {
+                case Node::Node4:
+                case Node::Node16:
+                {
+                    Uint8* keys = node->type == Node::Node4 ? static_cast<Node4*>(node)->keys
+                                                            : static_cast<Node16*>(node)->keys;
+                    Node** slots = node->type == Node::Node4 ? static_cast<Node4*>(node)->children
+                                                             : static_cast<Node16*>(node)->children;
+
+                    Uint16 position = 0;
+                    while (keys[position] != byte)
+                        ++position;
+
+                    std::memmove(keys + position, keys + position + 1, node->count - position - 1);
+                    std::memmove(slots + position, slots + position + 1, (node->count - position - 1) * sizeof(Node*));
+                    break;
+                }
+
+                case Node::Node48:
+                {
+                    Node48* n = static_cast<Node48*>(node);
+                    n->children[n->index[byte] - 1] = NULL;
+                    n->index[byte] = 0;
+                    break;
+                }
+
+                default:
+                {
+                    static_cast<Node256*>(node)->children[byte] = NULL;
+                    break;
+                }
+            }
+
+            --node->count;
+
+            /*
+             * Shrink with some hysteresis, to avoid flapping between layouts
+             */
+            if ((node->type == Node::Node256 && node->count <= 36) ||
+                (node->type == Node::Node48  && node->count <= 12) ||
+                (node->type == Node::Node16  && node->count <= 3))
+            {
+                *ref = relayout(node, node->type - 1);
+            }
+        }
+
+        /*
+         * Set the compressed path of a node, reallocating it if needed
+         */
+        static Node* setPrefix(Node* node, const Uint8* path, std::size_t length)
+        {
+            if (length > node->prefixCapacity)
+            {
+                std::size_t size = nodeSize(node->type);
+                void* memory = ::operator new(size + length);
+                std::memcpy(memory, node, size);
+                ::operator delete(node);
+
+                node = static_cast<Node*>(memory);
+                node->prefixCapacity = static_cast<Uint32>(length);
+            }
+
+            std::memmove(prefix(node), path, length);
+            node->prefixLength = static_cast<Uint32>(length);
+
+            return node;
+        }
+
+        /*
+         * Number of leading bytes shared by the compressed path and the key
+         */
+        static std::size_t matchPrefix(const Node* node, const Uint8* key, std::size_t length)
+        {
+            const Uint8* path = prefix(node);
+            std::size_t limit = node->prefixLength < length ? node->prefixLength : length;
+            std::size_t i = 0;
+
+            while (i < limit && path[i] == key[i])
+                ++i;
+
+            return i;
+        }
+
+        /*
+         * Depth-first walk of a sub-tree, in key order
+         */
+        template <typename F>
+        static std::size_t visit(const Node* node, std::basic_string<Uint8>& path,
+                                 std::basic_string<Uint32>& key, F& visitor)
+        {
+            std::size_t visited = 0;
+            std::size_t length = path.size();
+            path.append(prefix(node), node->prefixLength);
+
+            if (node->value)
+            {
+                key.clear();
+                Utf8::toUtf32(path.begin(), path.end(), std::back_inserter(key));
+                visitor(StringView(key.data(), key.size()), *node->value);
+                ++visited;
+            }
+
+            Uint8 bytes[256];
+            Node* children[256];
+            std::size_t count = collect(node, bytes, children);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                path.push_back(bytes[i]);
+                visited += visit(children[i], path, key, visitor);
+                path.erase(path.size() - 1);
+            }
+
+            path.resize(length);
+            return visited;
+        }
+
+        static void gather(const Node* node, std::size_t depth, typename PrefixTrie<T>::Stats& stats)
+        {
+            switch (node->type)
+            {
+                case Node::Node4:  ++stats.node4Count;   break;
+                case Node::Node16: ++stats.node16Count;  break;
+                case Node::Node48: ++stats.node48Count;  break;
+                default:           ++stats.node256Count; break;
+            }
+
+            stats.prefixBytes += node->prefixLength;
+            stats.memoryUsage += nodeSize(node->type) + node->prefixCapacity;
+
+            if (node->value)
+            {
+                ++stats.keyCount;
+                stats.memoryUsage += sizeof(T);
+            }
+
+            if (depth > stats.maxDepth)
+                stats.maxDepth = depth;
+
+            Node* children[256];
+            std::size_t count = collect(node, NULL, children);
+
+            for (std::size_t i = 0; i < count; ++i)
+                gather(children[i], depth + 1, stats);
+        }
+    };
+
+} // namespace priv
+
+template <typename T>
+PrefixTrie<T>::PrefixTrie() :
+    m_root(NULL),
+    m_size(0)
+{
+}
+
+template <typename T>
+PrefixTrie<T>::~PrefixTrie()
+{
+    clear();
+}
+
+template <typename T>
+bool PrefixTrie<T>::insert(StringView key, const T& value)
+{
+    typedef priv::TrieOps<T> Ops;
+
+    priv::TrieKey bytes(key);
+    const Uint8* data = bytes.getData();
+    std::size_t length = bytes.getSize();
+    std::size_t depth = 0;
+
+    Node** ref = &m_root;
+
+    for (;;)
+    {
+        Node* node = *ref;
+
+        /*
+         * Empty slot : a single node holds the rest of the key
+         */
+        if (!node)
+        {
+            node = Ops::create(Node::Node4, data + depth, length - depth);
+            node->value = new T(value);
+            *ref = node;
+            ++m_size;
+            return true;
+        }
+
+        std::size_t matched = Ops::matchPrefix(node, data + depth, length - depth);
+
+        /*
+         * The key diverges (or ends) inside the compressed path :
+         * split it with a new parent holding the common part
+         */
+        if (matched < node->prefixLength)
+        {
+            Node* parent = Ops::create(Node::Node4, Ops::prefix(node), matched);
+            Uint8 byte = Ops::prefix(node)[matched];
+
+            node = Ops::setPrefix(node, Ops::prefix(node) + matched + 1, node->prefixLength - matched - 1);
+            Ops::insertChild(parent, byte, node);
+
+            if (depth + matched == length)
+            {
+                parent->value = new T(value);
+            }
+            else
+            {
+                Node* leaf = Ops::create(Node::Node4, data + depth + matched + 1, length - depth - matched - 1);
+                leaf->value = new T(value);
+                Ops::insertChild(parent, data[depth + matched], leaf);
+            }
+
+            *ref = parent;
+            ++m_size;
+            return true;
+        }
+
+        depth += matched;
+
+        if (depth == length)
+        {
+            if (node->value)
+            {
+                *node->value = value;
+                return false;
+            }
+
+            node->value = new T(value);
+            ++m_size;
+            return true;
+        }
+
+        Node** child = Ops::findChild(node, data[depth]);
+        if (!child)
+        {
+            Node* leaf = Ops::create(Node::Node4, data + depth + 1, length - depth - 1);
+            leaf->value = new T(value);
+            Ops::addChild(ref, data[depth], leaf);
+            ++m_size;
+            return true;
+        }
+
+        ref = child;
+        ++depth;
+    }
+}
+
+template <typename T>
+bool PrefixTrie<T>::erase(StringView key)
+{
+    typedef priv::TrieOps<T> Ops;
+
+    priv::TrieKey bytes(key);
+    const Uint8* data = bytes.getData();
+    std::size_t length = bytes.getSize();
+    std::size_t depth = 0;
+
+    Node** parentRef = NULL;
+    Node** ref = &m_root;
+    Uint8 byte = 0;
+
+    /*
+     * Find the node holding the key
+     */
+    for (;;)
+    {
+        Node* node = *ref;
+        if (!node)
+            return false;
+
+        if (Ops::matchPrefix(node, data + depth, length - depth) < node->prefixLength)
+            return false;
+
+        depth += node->prefixLength;
+        if (depth == length)
+            break;
+
+        Node** child = Ops::findChild(node, data[depth]);
+        if (!child)
+            return false;
+
+        parentRef = ref;
+        ref = child;
+        byte = data[depth];
+        ++depth;
+    }
+
+    Node* node = *ref;
+    if (!node->value)
+        return false;
+
+    delete node->value;
+    node->value = NULL;
+    --m_size;
+
+    /*
+     * A node without value nor children is removed, a node left
+     * with a single child and no value is merged with that child
+     */
+    if (node->count == 0)
+    {
+        ::operator delete(node);
+
+        if (!parentRef)
+        {
+            *ref = NULL;
+            return true;
+        }
+
+        Ops::removeChild(parentRef, byte);
+        ref = parentRef;
+        node = *ref;
+    }
+
+    if (node->count == 1 && !node->value)
+    {
+        Uint8 childByte;
+        Node* child;
+        Ops::collect(node, &childByte, &child);
+
+        std::basic_string<Uint8> path(Ops::prefix(node), node->prefixLength);
+        path.push_back(childByte);
+        path.append(Ops::prefix(child), child->prefixLength);
+
+        *ref = Ops::setPrefix(child, path.data(), path.size());
+        ::operator delete(node);
+    }
+
+    return true;
+}
+
+template <typename T>
+void PrefixTrie<T>::clear()
+{
+    priv::TrieOps<T>::destroyTree(m_root);
+    m_root = NULL;
+    m_size = 0;
+}
+
+template <typename T>
+T* PrefixTrie<T>::find(StringView key)
+{
+    return const_cast<T*>(static_cast<const PrefixTrie<T>*>(this)->find(key));
+}
+
+template <typename T>
+const T* PrefixTrie<T>::find(StringView key) const
+{
+    typedef priv::TrieOps<T> Ops;
+
+    priv::TrieKey bytes(key);
+    const Uint8* data = bytes.getData();
+    std::size_t length = bytes.getSize();
+    std::size_t depth = 0;
+
+    const Node* node = m_root;
+
+    while (node)
+    {
+        if (node->prefixLength > length - depth ||
+            std::memcmp(Ops::prefix(node), data + depth, node->prefixLength) != 0)
+            return NULL;
+
+        depth += node->prefixLength;
+        if (depth == length)
+            return node->value;
+
+        node = Ops::findChild(node, data[depth++]);
+    }
+
+    return NULL;
+}
+
+template <typename T>
+const T* PrefixTrie<T>::findLongestPrefix(StringView key, std::size_t* length) const
+{
+    typedef priv::TrieOps<T> Ops;
+
+    priv::TrieKey bytes(key);
+    const Uint8* data = bytes.getData();
+    std::size_t size = bytes.getSize();
+    std::size_t depth = 0;
+
+    const Node* node = m_root;
+    const T* best = NULL;
+    std::size_t bestDepth = 0;
+
+    while (node)
+    {
+        if (node->prefixLength > size - depth ||
+            std::memcmp(Ops::prefix(node), data + depth, node->prefixLength) != 0)
+            break;
+
+        depth += node->prefixLength;
+        if (node->value)
+        {
+            best = node->value;
+            bestDepth = depth;
+        }
+
+        if (depth == size)
+            break;
+
+        node = Ops::findChild(node, data[depth++]);
+    }
+
+    if (best && length)
+        *length = priv::TrieKey::countCharacters(data, data + bestDepth);
+
+    return best;
+}
+
+template <typename T>
+template <typename F>
+std::size_t PrefixTrie<T>::forEachWithPrefix(StringView prefix, F visitor) const
+{
+    typedef priv::TrieOps<T> Ops;
+
+    priv::TrieKey bytes(prefix);
+    const Uint8* data = bytes.getData();
+    std::size_t length = bytes.getSize();
+    std::size_t depth = 0;
+
+    const Node* node = m_root;
+
+    /*
+     * Go down to the first node whose keys all start with the prefix
+     */
+    while (node)
+    {
+        std::size_t matched = Ops::matchPrefix(node, data + depth, length - depth);
+
+        if (depth + matched == length)
+            break;
+
+        if (matched < node->prefixLength)
+            return 0;
+
+        depth += matched;
+        node = Ops::findChild(node, data[depth++]);
+    }
+
+    if (!node)
+        return 0;
+
+    std::basic_string<Uint8> path(data, depth);
+    std::basic_string<Uint32> key;
+
+    return Ops::visit(node, path, key, visitor);
+}
+
+template <typename T>
+std::size_t PrefixTrie<T>::getSize() const
+{
+    return m_size;
+}
+
+template <typename T>
+bool PrefixTrie<T>::isEmpty() const
+{
+    return m_size == 0;
+}
+
+template <typename T>
+typename PrefixTrie<T>::Stats PrefixTrie<T>::getStats() const
+{
+    Stats stats;
+    std::memset(&stats, 0, sizeof(stats));
+    stats.memoryUsage = sizeof(*this);
+
+    if (m_root)
+        priv::TrieOps<T>::gather(m_root, 1, stats);
+
+    return stats;
+}
@@ -0,0 +1,197 @@
+#ifndef __CRCR_READ_WRITE_LOCK_HPP__
+#define __CRCR_READ_WRITE_LOCK_HPP__
+
+#include <Config.hpp>
+#include <Mutex.hpp>
+#include <NonCopyable.hpp>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+namespace priv
+{
+	/**
+	 * \brief Counter of the readers of a CPU, alone on its cache line
+	 */
+	struct ReaderSlot
+	{
+		std::atomic<Int32> readers;                     /**< threads holding the lock for reading */
+		char               padding[64 - sizeof(Int32)];  /**< keeps the other slots away */
+	};
+
+	/**
+	 * \brief Get the CPU a thread first read from
+	 */
+	unsigned int getReaderCpu();
+}
+
+/**
+ * \brief Lock shared by readers, exclusive for writers
+ *
+ * Made for data read all the time and rarely written (a
+ * configuration, a routing table). A reader only increments
+ * and decrements the counter of its CPU : readers running on
+ * different cores never write to the same cache line, and the
+ * read throughput grows with the number of cores instead of
+ * collapsing on a single shared counter.
+ *
+ * A writer is exclusive : it stops new readers, waits until the
+ * counters of all the CPUs are zero, then runs alone. Writers
+ * have priority, so that a stream of readers can't starve them ;
+ * the price is a write lock scanning every slot.
+ *
+ * A thread keeps the slot of the CPU it first read from. The lock
+ * is not recursive : a reader taking it again while a writer
+ * waits blocks forever.
+ */
+class ReadWriteLock : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Default constructor
+	 */
+	ReadWriteLock();
+
+	/**
+	 * \brief Destructor
+	 */
+	~ReadWriteLock();
+
+	/**
+	 * \brief Lock for reading, waiting for the writer if any
+	 */
+	void lockShared();
+
+	/**
+	 * \brief Lock for reading if no writer holds or waits for the lock
+	 *
+	 * \return True if the lock was taken
+	 */
+	bool tryLockShared();
+
+	/**
+	 * \brief Release a read lock
+	 */
+	void unlockShared();
+
+	/**
+	 * \brief Lock for writing, waiting for the readers and the other writers
+	 */
+	void lock();
+
+	/**
+	 * \brief Release the write lock
+	 */
+	void unlock();
+
+private:
+
+	/**
+	 * \brief Get the slot of the calling thread
+	 */
+	priv::ReaderSlot& getSlot();
+
+	/**
+	 * \brief Wait for the writer, then lock for reading
+	 */
+	void lockSharedSlow();
+
+	/**
+	 * \brief Tell the waiting writer that a reader left
+	 */
+	void notifyWriter();
+
+	/**
+	 * \brief Member data
+	 */
+	priv::ReaderSlot*  m_slots;      /**< one counter per CPU, aligned on cache lines */
+	void*              m_memory;     /**< allocation holding m_slots */
+	std::size_t        m_mask;       /**< number of slots - 1 */
+	std::atomic<Int32> m_writer;     /**< futex : 0 no writer, 1 writer, 2 writer with sleeping readers */
+	std::atomic<Int32> m_drained;    /**< futex : changed when a reader leaves while a writer waits */
+	Mutex              m_writeLock;  /**< serializes the writers */
+};
+
+/**
+ * \brief Scoped read lock on a cr::ReadWriteLock
+ */
+class ReadLock : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Lock \a lock for reading
+	 */
+	explicit ReadLock(ReadWriteLock& lock);
+
+	/**
+	 * \brief Destructor, release the lock
+	 */
+	~ReadLock();
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	ReadWriteLock& m_lock;  /**< lock held for reading */
+};
+
+/**
+ * \brief Scoped write lock on a cr::ReadWriteLock
+ */
+class WriteLock : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Lock \a lock for writing
+	 */
+	explicit WriteLock(ReadWriteLock& lock);
+
+	/**
+	 * \brief Destructor, release the lock
+	 */
+	~WriteLock();
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	ReadWriteLock& m_lock;  /**< lock held for writing */
+};
+
+#include <ReadWriteLock.inl>
+
+} // namespace cr
+
+#endif // __CRCR_READ_WRITE_LOCK_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::ReadWriteLock routesLock;
+ * RoutingTable routes;
+ *
+ * Route lookup(const Address& address)   // every thread, all the time
+ * {
+ *     cr::ReadLock lock(routesLock);
+ *     return routes.find(address);
+ * }
+ *
+ * void reload(const RoutingTable& table) // once in a while
+ * {
+ *     cr::WriteLock lock(routesLock);
+ *     routes = table;
+ * }
+ * \endcode
+ */
@@ -0,0 +1,38 @@
+inline priv::ReaderSlot& ReadWriteLock::getSlot()
+{
+    static thread_local unsigned int cpu = priv::getReaderCpu();
+    return m_slots[cpu & m_mask];
+}
+
+inline void ReadWriteLock::lockShared()
+{
+    if (!tryLockShared())
+        lockSharedSlow();
+}
+
+inline bool ReadWriteLock::tryLockShared()
+{
+    priv::ReaderSlot& slot = getSlot();
+
+    /*
+     * Announce the read, then check for a writer : the writer
+     * does the opposite, so one of them always sees the other
+     */
+    slot.readers.fetch_add(1, std::memory_order_seq_cst);
+    if (m_writer.load(std::memory_order_seq_cst) == 0)
+        return true;
+
+    unlockShared();
+    return false;
+}
+
+inline void ReadWriteLock::unlockShared()
+{
+    getSlot().readers.fetch_sub(1, std::memory_order_seq_cst);
+
+    /*
+     * A writer waits for the counters to drop to zero
+     */
+    if (m_writer.load(std::memory_order_seq_cst) != 0)
+        notifyWriter();
+}
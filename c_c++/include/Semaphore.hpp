@@ -0,0 +1,95 @@
+#ifndef __CRCR_SEMAPHORE_HPP__
+#define __CRCR_SEMAPHORE_HPP__
+
+#include <Config.hpp>
+#include <NonCopyable.hpp>
+#include <Time.hpp>
+#include <atomic>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Counter of available resources, which threads wait for
+ *
+ * wait() takes a unit, sleeping while there is none ; post()
+ * gives units back and wakes up the sleeping threads. Both are a
+ * single atomic instruction when no thread has to sleep. Like
+ * cr::Mutex, a waiting thread spins for a short while before
+ * sleeping on multi-core machines.
+ */
+class Semaphore : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Constructor
+	 *
+	 * \param count Initial number of units
+	 */
+	explicit Semaphore(unsigned int count = 0);
+
+	/**
+	 * \brief Take a unit, waiting for one if needed
+	 */
+	void wait();
+
+	/**
+	 * \brief Take a unit if one is available
+	 *
+	 * \return False if there was none
+	 */
+	bool tryWait();
+
+	/**
+	 * \brief Take a unit, waiting at most a given time
+	 *
+	 * \param timeout Maximum time to wait
+	 *
+	 * \return False if the timeout expired
+	 */
+	bool waitFor(Time timeout);
+
+	/**
+	 * \brief Give units back
+	 *
+	 * \param count Number of units
+	 */
+	void post(unsigned int count = 1);
+
+	/**
+	 * \brief Get the number of available units
+	 */
+	unsigned int getCount() const;
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	std::atomic<Int32> m_count;    /**< futex : available units */
+	std::atomic<Int32> m_waiters;  /**< number of sleeping threads */
+};
+
+} // namespace cr
+
+#endif // __CRCR_SEMAPHORE_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::Semaphore connections(16); // at most 16 requests at once
+ *
+ * void request()
+ * {
+ *     connections.wait();
+ *     send();
+ *     connections.post();
+ * }
+ * \endcode
+ */
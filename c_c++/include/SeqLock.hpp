@@ -0,0 +1,129 @@
+#ifndef __CRCR_SEQ_LOCK_HPP__
+#define __CRCR_SEQ_LOCK_HPP__
+
+#include <Config.hpp>
+#include <FutexImpl.hpp>
+#include <NonCopyable.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Small value read without writing to shared memory
+ *
+ * The value is guarded by a sequence number, odd while a writer
+ * is copying it : a reader copies the value and checks that the
+ * sequence didn't change meanwhile, or copies again. Readers
+ * never write, so they don't slow each other down, and never
+ * block the writer ; they only retry when they overlap a write.
+ *
+ * Made for small plain values read very often (a timestamp, a
+ * few counters, a snapshot of statistics) : T must be trivially
+ * copyable, and a copy of it must be short since readers repeat
+ * it when they race with a writer. Writers are serialized by
+ * spinning on the sequence, so they should be rare.
+ */
+template <typename T>
+class SeqLock : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Constructor
+	 *
+	 * \param value Initial value
+	 */
+	explicit SeqLock(const T& value = T());
+
+	/**
+	 * \brief Get a consistent copy of the value
+	 */
+	T load() const;
+
+	/**
+	 * \brief Replace the value
+	 */
+	void store(const T& value);
+
+	/**
+	 * \brief Change the value through a function
+	 *
+	 * \param function Called with a reference on a copy of the
+	 *                 value, which is then stored
+	 */
+	template <typename F>
+	void update(F function);
+
+	/**
+	 * \brief Get the sequence number
+	 *
+	 * Increased by 2 by each write : comparing two sequence numbers
+	 * tells whether the value changed.
+	 */
+	Uint64 getSequence() const;
+
+private:
+
+	static const std::size_t WordCount = (sizeof(T) + sizeof(Uint64) - 1) / sizeof(Uint64);
+
+	/**
+	 * \brief Start a write : make the sequence odd
+	 *
+	 * \return Sequence before the write
+	 */
+	Uint64 beginWrite();
+
+	/**
+	 * \brief Copy the value to the words and end the write
+	 */
+	void endWrite(const T& value, Uint64 sequence);
+
+	/**
+	 * \brief Member data
+	 *
+	 * The value is copied word by word with relaxed atomic
+	 * accesses, which makes the overlapping copies well defined.
+	 */
+	std::atomic<Uint64> m_sequence;          /**< odd while a write is in progress */
+	std::atomic<Uint64> m_words[WordCount];  /**< bytes of the value */
+};
+
+#include <SeqLock.inl>
+
+} // namespace cr
+
+#endif // __CRCR_SEQ_LOCK_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * struct Quote
+ * {
+ *     double bid;
+ *     double ask;
+ *     cr::Int64 time;
+ * };
+ *
+ * cr::SeqLock<Quote> lastQuote;
+ *
+ * void onMarketData(const Quote& quote)  // one feed thread
+ * {
+ *     lastQuote.store(quote);
+ * }
+ *
+ * double getSpread()                     // any number of threads
+ * {
+ *     Quote quote = lastQuote.load();
+ *     return quote.ask - quote.bid;
+ * }
+ * \endcode
+ */
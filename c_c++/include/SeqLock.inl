@@ -0,0 +1,101 @@
+template <typename T>
+SeqLock<T>::SeqLock(const T& value) :
+    m_sequence(0)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "cr::SeqLock needs a trivially copyable type");
+
+    endWrite(value, 0);
+}
+
+template <typename T>
+T SeqLock<T>::load() const
+{
+    Uint64 words[WordCount];
+
+    for (;;)
+    {
+        Uint64 sequence = m_sequence.load(std::memory_order_acquire);
+        if (sequence & 1)
+        {
+            priv::cpuRelax();
+            continue;
+        }
+
+        for (std::size_t i = 0; i < WordCount; ++i)
+            words[i] = m_words[i].load(std::memory_order_relaxed);
+
+        /*
+         * The copy is done before reading the sequence again
+         */
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) == sequence)
+            break;
+    }
+
+    T value;
+    std::memcpy(&value, words, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void SeqLock<T>::store(const T& value)
+{
+    endWrite(value, beginWrite());
+}
+
+template <typename T>
+template <typename F>
+void SeqLock<T>::update(F function)
+{
+    Uint64 sequence = beginWrite();
+
+    Uint64 words[WordCount];
+    for (std::size_t i = 0; i < WordCount; ++i)
+        words[i] = m_words[i].load(std::memory_order_relaxed);
+
+    T value;
+    std::memcpy(&value, words, sizeof(T));
+    function(value);
+
+    endWrite(value, sequence);
+}
+
+template <typename T>
+Uint64 SeqLock<T>::getSequence() const
+{
+    return m_sequence.load(std::memory_order_acquire) & ~Uint64(1);
+}
+
+template <typename T>
+Uint64 SeqLock<T>::beginWrite()
+{
+    Uint64 sequence = m_sequence.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        if (!(sequence & 1) && m_sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+            break;
+
+        priv::cpuRelax();
+        sequence = m_sequence.load(std::memory_order_relaxed);
+    }
+
+    /*
+     * The odd sequence is visible before any word changes
+     */
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return sequence;
+}
+
+template <typename T>
+void SeqLock<T>::endWrite(const T& value, Uint64 sequence)
+{
+    Uint64 words[WordCount] = {};
+    std::memcpy(words, &value, sizeof(T));
+
+    for (std::size_t i = 0; i < WordCount; ++i)
+        m_words[i].store(words[i], std::memory_order_relaxed);
+
+    m_sequence.store(sequence + 2, std::memory_order_release);
+}
@@ -0,0 +1,170 @@
+#ifndef __CRCR_SPSC_QUEUE_HPP__
+#define __CRCR_SPSC_QUEUE_HPP__
+
+#include <Config.hpp>
+#include <NonCopyable.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Bounded wait-free queue, for exactly one producer and one consumer
+ *
+ * The producer only writes the tail, the consumer only the head,
+ * each on its own cache line : no compare-and-swap, no lock, and
+ * no operation ever waits for the other thread.
+ *
+ * Each side keeps a copy of the other side's index, and reads the
+ * shared one only when its copy says the queue is full (producer)
+ * or empty (consumer). While the queue is neither, the cache line
+ * of the other side is not touched at all.
+ *
+ * The batch functions move many elements for a single store of
+ * the index, which is what makes the difference at high rates.
+ */
+template <typename T>
+class SpscQueue : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Construct an empty queue
+	 *
+	 * \param capacity Maximum number of elements, rounded to a power of two
+	 */
+	explicit SpscQueue(std::size_t capacity);
+
+	/**
+	 * \brief Destructor, destroy the elements left
+	 */
+	~SpscQueue();
+
+	/**
+	 * \brief Add an element, unless the queue is full (producer only)
+	 *
+	 * \param value Element to add (moved only on success)
+	 *
+	 * \return False if the queue is full
+	 */
+	bool tryPush(T&& value);
+
+	/**
+	 * \brief Add a copy of an element, unless the queue is full (producer only)
+	 *
+	 * \param value Element to add
+	 *
+	 * \return False if the queue is full
+	 */
+	bool tryPush(const T& value);
+
+	/**
+	 * \brief Remove the oldest element, unless the queue is empty (consumer only)
+	 *
+	 * \param value Receives the element
+	 *
+	 * \return False if the queue is empty
+	 */
+	bool tryPop(T& value);
+
+	/**
+	 * \brief Add several elements, as many as there is room for (producer only)
+	 *
+	 * The elements are published together, by a single store.
+	 *
+	 * \param values Elements to add (the ones added are moved)
+	 * \param count  Number of elements
+	 *
+	 * \return Number of elements added, from the first one
+	 */
+	std::size_t tryPushBatch(T* values, std::size_t count);
+
+	/**
+	 * \brief Remove several elements, as many as available (consumer only)
+	 *
+	 * \param values  Receives the elements
+	 * \param maximum Maximum number of elements to remove
+	 *
+	 * \return Number of elements removed
+	 */
+	std::size_t tryPopBatch(T* values, std::size_t maximum);
+
+	/**
+	 * \brief Get the approximate number of elements
+	 */
+	std::size_t getSize() const;
+
+	/**
+	 * \brief Get the maximum number of elements
+	 */
+	std::size_t getCapacity() const;
+
+private:
+
+	typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+
+	/**
+	 * \brief Get the element at a position
+	 */
+	T* getElement(std::size_t position) const;
+
+	/**
+	 * \brief Get the number of free slots, from the producer side
+	 */
+	std::size_t getFreeCount(std::size_t tail, std::size_t wanted);
+
+	/**
+	 * \brief Get the number of elements, from the consumer side
+	 */
+	std::size_t getFullCount(std::size_t head, std::size_t wanted);
+
+	/**
+	 * \brief Member data
+	 *
+	 * Producer data, consumer data and shared constants are
+	 * on separate cache lines
+	 */
+	Storage*                 m_elements;                                /**< ring of elements */
+	std::size_t              m_mask;                                    /**< capacity - 1 */
+	char                     m_padding1[64];                            /**< keeps the producer data away from the above */
+	std::atomic<std::size_t> m_tail;                                    /**< position of the next push, written by the producer */
+	std::size_t              m_cachedHead;                              /**< last head seen by the producer */
+	char                     m_padding2[64 - 2 * sizeof(std::size_t)];  /**< keeps the producer data alone on its cache line */
+	std::atomic<std::size_t> m_head;                                    /**< position of the next pop, written by the consumer */
+	std::size_t              m_cachedTail;                              /**< last tail seen by the consumer */
+	char                     m_padding3[64 - 2 * sizeof(std::size_t)];  /**< keeps the consumer data alone on its cache line */
+};
+
+#include <SpscQueue.inl>
+
+} // namespace cr
+
+#endif // __CRCR_SPSC_QUEUE_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::SpscQueue<Packet> queue(4096);
+ *
+ * // the producer thread
+ * while (!queue.tryPush(std::move(packet)))
+ *     backOff();
+ *
+ * // the consumer thread
+ * Packet packets[32];
+ * std::size_t count = queue.tryPopBatch(packets, 32);
+ * for (std::size_t i = 0; i < count; ++i)
+ *     handle(packets[i]);
+ * \endcode
+ */
@@ -0,0 +1,161 @@
+template <typename T>
+SpscQueue<T>::SpscQueue(std::size_t capacity) :
+    m_elements  (NULL),
+    m_mask      (0),
+    m_tail      (0),
+    m_cachedHead(0),
+    m_head      (0),
+    m_cachedTail(0)
+{
+    std::size_t size = 2;
+    while (size < capacity)
+        size *= 2;
+
+    void* memory = NULL;
+    if (posix_memalign(&memory, 64, size * sizeof(Storage)) != 0)
+    {
+        std::cerr << "Failed to allocate the elements of the queue" << std::endl;
+        throw std::bad_alloc();
+    }
+
+    m_elements = static_cast<Storage*>(memory);
+    m_mask = size - 1;
+}
+
+template <typename T>
+SpscQueue<T>::~SpscQueue()
+{
+    std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    for (std::size_t i = m_head.load(std::memory_order_relaxed); i != tail; ++i)
+        getElement(i)->~T();
+
+    std::free(m_elements);
+}
+
+template <typename T>
+bool SpscQueue<T>::tryPush(T&& value)
+{
+    std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (getFreeCount(tail, 1) == 0)
+        return false;
+
+    new (getElement(tail)) T(std::move(value));
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T>
+bool SpscQueue<T>::tryPush(const T& value)
+{
+    std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (getFreeCount(tail, 1) == 0)
+        return false;
+
+    new (getElement(tail)) T(value);
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T>
+bool SpscQueue<T>::tryPop(T& value)
+{
+    std::size_t head = m_head.load(std::memory_order_relaxed);
+    if (getFullCount(head, 1) == 0)
+        return false;
+
+    T* element = getElement(head);
+    value = std::move(*element);
+    element->~T();
+    m_head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T>
+std::size_t SpscQueue<T>::tryPushBatch(T* values, std::size_t count)
+{
+    std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    std::size_t free = getFreeCount(tail, count);
+    if (count > free)
+        count = free;
+
+    for (std::size_t i = 0; i < count; ++i)
+        new (getElement(tail + i)) T(std::move(values[i]));
+
+    if (count > 0)
+        m_tail.store(tail + count, std::memory_order_release);
+
+    return count;
+}
+
+template <typename T>
+std::size_t SpscQueue<T>::tryPopBatch(T* values, std::size_t maximum)
+{
+    std::size_t head = m_head.load(std::memory_order_relaxed);
+    std::size_t full = getFullCount(head, maximum);
+    if (maximum > full)
+        maximum = full;
+
+    for (std::size_t i = 0; i < maximum; ++i)
+    {
+        T* element = getElement(head + i);
+        values[i] = std::move(*element);
+        element->~T();
+    }
+
+    if (maximum > 0)
+        m_head.store(head + maximum, std::memory_order_release);
+
+    return maximum;
+}
+
+template <typename T>
+std::size_t SpscQueue<T>::getSize() const
+{
+    std::size_t head = m_head.load(std::memory_order_relaxed);
+    std::size_t tail = m_tail.load(std::memory_order_relaxed);
+
+    return tail - head > m_mask + 1 ? 0 : tail - head;
+}
+
+template <typename T>
+std::size_t SpscQueue<T>::getCapacity() const
+{
+    return m_mask + 1;
+}
+
+template <typename T>
+T* SpscQueue<T>::getElement(std::size_t position) const
+{
+    return reinterpret_cast<T*>(&m_elements[position & m_mask]);
+}
+
+template <typename T>
+std::size_t SpscQueue<T>::getFreeCount(std::size_t tail, std::size_t wanted)
+{
+    std::size_t free = m_mask + 1 - (tail - m_cachedHead);
+    if (free >= wanted)
+        return free;
+
+    /*
+     * Not enough room according to the copy : read the real head
+     */
+    m_cachedHead = m_head.load(std::memory_order_acquire);
+    return m_mask + 1 - (tail - m_cachedHead);
+}
+
+template <typename T>
+std::size_t SpscQueue<T>::getFullCount(std::size_t head, std::size_t wanted)
+{
+    std::size_t full = m_cachedTail - head;
+    if (full >= wanted)
+        return full;
+
+    /*
+     * Not enough elements according to the copy : read the real tail
+     */
+    m_cachedTail = m_tail.load(std::memory_order_acquire);
+    return m_cachedTail - head;
+}
@@ -0,0 +1,172 @@
+#ifndef __CRCR_SPSC_RECORD_QUEUE_HPP__
+#define __CRCR_SPSC_RECORD_QUEUE_HPP__
+
+#include <Config.hpp>
+#include <NonCopyable.hpp>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Wait-free queue of variable-sized byte records, for one producer and one consumer
+ *
+ * The records are written and read in place, in a ring of bytes :
+ * the producer gets the memory of a record with allocate(), fills
+ * it, and makes it visible with publish() ; the consumer reads it
+ * where it is with read(), and gives the memory back with release().
+ * Nothing is copied, and several records can be published or
+ * released at once.
+ *
+ * A record is preceded by an 8-byte header and its memory is 8-byte
+ * aligned. A record which doesn't fit before the end of the ring is
+ * put at its beginning, the end being skipped.
+ *
+ * As with cr::SpscQueue, each side keeps a copy of the other one's
+ * position and only reads the shared one when it runs out of room
+ * or records.
+ */
+class SpscRecordQueue : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Construct an empty queue
+	 *
+	 * \param capacity Size of the ring in bytes, rounded to a power of two
+	 */
+	explicit SpscRecordQueue(std::size_t capacity);
+
+	/**
+	 * \brief Destructor
+	 */
+	~SpscRecordQueue();
+
+	/**
+	 * \brief Reserve the memory of a record (producer only)
+	 *
+	 * The record is not visible to the consumer until publish().
+	 *
+	 * \param size Size of the record in bytes (at most getMaximumSize())
+	 *
+	 * \return Memory of the record, NULL if there is not enough room
+	 */
+	void* allocate(std::size_t size);
+
+	/**
+	 * \brief Make the allocated records visible to the consumer (producer only)
+	 */
+	void publish();
+
+	/**
+	 * \brief Copy a record and publish it (producer only)
+	 *
+	 * \param data Bytes of the record
+	 * \param size Size of the record in bytes
+	 *
+	 * \return False if there is not enough room
+	 */
+	bool write(const void* data, std::size_t size);
+
+	/**
+	 * \brief Get the next published record (consumer only)
+	 *
+	 * The memory stays valid until release().
+	 *
+	 * \param size Receives the size of the record in bytes
+	 *
+	 * \return Memory of the record, NULL if there is none
+	 */
+	const void* read(std::size_t& size);
+
+	/**
+	 * \brief Give back the memory of the records read (consumer only)
+	 */
+	void release();
+
+	/**
+	 * \brief Get the size of the largest record
+	 *
+	 * A record of that size always fits once the queue is empty.
+	 */
+	std::size_t getMaximumSize() const;
+
+private:
+
+	/**
+	 * \brief Header of a record
+	 */
+	struct Header
+	{
+		Uint32 size;     /**< bytes of the record, Padding for the skipped end of the ring */
+		Uint32 unused;   /**< keeps the records 8-byte aligned */
+	};
+
+	/**
+	 * \brief Size written in the header marking the skipped end of the ring
+	 */
+	static const Uint32 Padding = 0xffffffff;
+
+	/**
+	 * \brief Make room for a record, reading the consumer position if needed
+	 */
+	bool reserve(Uint64 needed);
+
+	/**
+	 * \brief Get the header at a position
+	 */
+	Header* getHeader(Uint64 position) const;
+
+	/**
+	 * \brief Member data
+	 *
+	 * Producer data, consumer data and shared constants are
+	 * on separate cache lines
+	 */
+	char*               m_buffer;                             /**< ring of bytes */
+	Uint64              m_capacity;                           /**< size of the ring */
+	char                m_padding1[64];                       /**< keeps the producer data away from the above */
+	std::atomic<Uint64> m_tail;                               /**< end of the published records */
+	Uint64              m_allocated;                          /**< end of the allocated records */
+	Uint64              m_cachedHead;                         /**< last head seen by the producer */
+	char                m_padding2[64 - 3 * sizeof(Uint64)];  /**< keeps the producer data alone on its cache line */
+	std::atomic<Uint64> m_head;                               /**< end of the released records */
+	Uint64              m_read;                               /**< end of the records read */
+	Uint64              m_cachedTail;                         /**< last tail seen by the consumer */
+	char                m_padding3[64 - 3 * sizeof(Uint64)];  /**< keeps the consumer data alone on its cache line */
+};
+
+#include <SpscRecordQueue.inl>
+
+} // namespace cr
+
+#endif // __CRCR_SPSC_RECORD_QUEUE_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::SpscRecordQueue queue(1 << 20);
+ *
+ * // the producer thread
+ * for (std::size_t i = 0; i < count; ++i)
+ * {
+ *     Message* message = static_cast<Message*>(queue.allocate(sizeof(Message) + events[i].size));
+ *     if (!message)
+ *         break;
+ *     encode(events[i], message);
+ * }
+ * queue.publish();
+ *
+ * // the consumer thread
+ * std::size_t size;
+ * while (const void* record = queue.read(size))
+ *     decode(static_cast<const Message*>(record), size);
+ * queue.release();
+ * \endcode
+ */
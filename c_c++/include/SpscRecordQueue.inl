@@ -0,0 +1,74 @@
+inline void* SpscRecordQueue::allocate(std::size_t size)
+{
+    Uint64 total = (sizeof(Header) + size + 7) & ~static_cast<Uint64>(7);
+    Uint64 offset = m_allocated & (m_capacity - 1);
+
+    /*
+     * Not enough room before the end of the ring : skip it
+     */
+    Uint64 skipped = offset + total > m_capacity ? m_capacity - offset : 0;
+
+    if (total > m_capacity / 2 || !reserve(skipped + total))
+        return NULL;
+
+    if (skipped > 0)
+    {
+        getHeader(m_allocated)->size = Padding;
+        m_allocated += skipped;
+    }
+
+    Header* header = getHeader(m_allocated);
+    header->size = static_cast<Uint32>(size);
+    m_allocated += total;
+
+    return header + 1;
+}
+
+inline void SpscRecordQueue::publish()
+{
+    m_tail.store(m_allocated, std::memory_order_release);
+}
+
+inline const void* SpscRecordQueue::read(std::size_t& size)
+{
+    if (m_read == m_cachedTail)
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        if (m_read == m_cachedTail)
+            return NULL;
+    }
+
+    Header* header = getHeader(m_read);
+    if (header->size == Padding)
+    {
+        /*
+         * A record always follows the padding : they were published together
+         */
+        m_read += m_capacity - (m_read & (m_capacity - 1));
+        header = getHeader(m_read);
+    }
+
+    size = header->size;
+    m_read += (sizeof(Header) + size + 7) & ~static_cast<Uint64>(7);
+
+    return header + 1;
+}
+
+inline void SpscRecordQueue::release()
+{
+    m_head.store(m_read, std::memory_order_release);
+}
+
+inline bool SpscRecordQueue::reserve(Uint64 needed)
+{
+    if (m_capacity - (m_allocated - m_cachedHead) >= needed)
+        return true;
+
+    m_cachedHead = m_head.load(std::memory_order_acquire);
+    return m_capacity - (m_allocated - m_cachedHead) >= needed;
+}
+
+inline SpscRecordQueue::Header* SpscRecordQueue::getHeader(Uint64 position) const
+{
+    return reinterpret_cast<Header*>(m_buffer + (position & (m_capacity - 1)));
+}
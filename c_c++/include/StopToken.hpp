@@ -0,0 +1,332 @@
+#ifndef __CRCR_STOP_TOKEN_HPP__
+#define __CRCR_STOP_TOKEN_HPP__
+
+#include <Clock.hpp>
+#include <ConditionVariable.hpp>
+#include <Lock.hpp>
+#include <Mutex.hpp>
+#include <NonCopyable.hpp>
+#include <Time.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+class StopToken;
+
+namespace priv
+{
+	/**
+	 * \brief Callback registered in a stop state
+	 */
+	struct StopCallbackBase
+	{
+		virtual ~StopCallbackBase() {}
+		virtual void invoke() = 0;
+
+		StopCallbackBase* m_previous;  /**< previous callback of the list */
+		StopCallbackBase* m_next;      /**< next callback of the list */
+	};
+
+	/**
+	 * \brief State shared by a cr::StopSource and its tokens
+	 */
+	class StopState : NonCopyable
+	{
+	public:
+		StopState();
+
+		void addReference();
+		void removeReference();
+
+		bool isStopRequested() const;
+		bool requestStop();
+		bool sleep(Time duration);
+
+		bool addCallback(StopCallbackBase* callback);
+		void removeCallback(StopCallbackBase* callback);
+
+	private:
+		std::atomic<bool>        m_isStopRequested;  /**< was a stop requested? */
+		std::atomic<std::size_t> m_references;       /**< number of sources and tokens */
+		Mutex                    m_mutex;            /**< protects the members below */
+		ConditionVariable        m_changed;          /**< signaled on stop, and after each callback */
+		StopCallbackBase*        m_callbacks;        /**< callbacks not invoked yet */
+		StopCallbackBase*        m_running;          /**< callback being invoked */
+		std::thread::id          m_stoppingThread;   /**< thread invoking the callbacks */
+	};
+}
+
+/**
+ * \brief Tag to construct a cr::StopSource without state
+ */
+struct NoStopState
+{
+};
+
+/**
+ * \brief Side of a stop request which sees it
+ *
+ * A token is given to a task (a thread function...) which checks
+ * it regularly, and stops by itself when asked : unlike killing
+ * the thread, its locks are released and its resources freed.
+ *
+ * Tokens are cheap to copy ; all the copies see the stop request
+ * of the cr::StopSource they come from. A default-constructed
+ * token is never stopped.
+ */
+class StopToken
+{
+public:
+
+	/**
+	 * \brief Construct a token which can't be stopped
+	 */
+	StopToken();
+
+	/**
+	 * \brief Copy constructor
+	 */
+	StopToken(const StopToken& other);
+
+	/**
+	 * \brief Move constructor
+	 */
+	StopToken(StopToken&& other);
+
+	/**
+	 * \brief Destructor
+	 */
+	~StopToken();
+
+	/**
+	 * \brief Assignment operator
+	 */
+	StopToken& operator =(StopToken other);
+
+	/**
+	 * \brief Tell whether a stop was requested
+	 *
+	 * This is a single atomic load, cheap enough to be checked
+	 * at each iteration of a loop.
+	 */
+	bool isStopRequested() const;
+
+	/**
+	 * \brief Tell whether a stop can ever be requested
+	 *
+	 * \return False for a token without cr::StopSource
+	 */
+	bool isStopPossible() const;
+
+	/**
+	 * \brief Sleep, unless a stop is requested
+	 *
+	 * \param duration Time to sleep
+	 *
+	 * \return False if the sleep was interrupted by a stop request
+	 */
+	bool sleep(Time duration) const;
+
+	/**
+	 * \brief Wait on a condition variable until a predicate is true or a stop is requested
+	 *
+	 * The condition variable is notified by the stop request :
+	 * the threads notifying it otherwise must change the state
+	 * checked by \a predicate while holding the mutex of \a lock.
+	 *
+	 * \param lock      Lock on the mutex protecting the state (locked)
+	 * \param condition Condition variable signaled when the state changes
+	 * \param predicate Function returning true when the wait is over
+	 *
+	 * \return Result of \a predicate : false if the wait was interrupted
+	 */
+	template <typename P>
+	bool wait(std::unique_lock<std::mutex>& lock, std::condition_variable& condition, P predicate) const;
+
+	/**
+	 * \brief Same as wait(), with a timeout
+	 *
+	 * \param lock      Lock on the mutex protecting the state (locked)
+	 * \param condition Condition variable signaled when the state changes
+	 * \param timeout   Maximum time to wait
+	 * \param predicate Function returning true when the wait is over
+	 *
+	 * \return Result of \a predicate : false if the wait was interrupted or timed out
+	 */
+	template <typename P>
+	bool waitFor(std::unique_lock<std::mutex>& lock, std::condition_variable& condition, Time timeout, P predicate) const;
+
+private:
+
+	friend class StopSource;
+	template <typename F> friend class StopCallback;
+
+	explicit StopToken(priv::StopState* state);
+
+	/**
+	 * \brief Member data
+	 */
+	priv::StopState* m_state;  /**< shared state, NULL if no source */
+};
+
+/**
+ * \brief Side of a stop request which makes it
+ *
+ * Copies of a source share the same state : a stop requested
+ * through any of them is seen by all the tokens.
+ */
+class StopSource
+{
+public:
+
+	/**
+	 * \brief Construct a source with a new state
+	 */
+	StopSource();
+
+	/**
+	 * \brief Construct a source without state
+	 *
+	 * Nothing is allocated ; requestStop() does nothing.
+	 */
+	explicit StopSource(NoStopState);
+
+	/**
+	 * \brief Copy constructor
+	 */
+	StopSource(const StopSource& other);
+
+	/**
+	 * \brief Move constructor
+	 */
+	StopSource(StopSource&& other);
+
+	/**
+	 * \brief Destructor
+	 */
+	~StopSource();
+
+	/**
+	 * \brief Assignment operator
+	 */
+	StopSource& operator =(StopSource other);
+
+	/**
+	 * \brief Request the tasks holding a token to stop
+	 *
+	 * The sleeps and waits of the tokens are interrupted, and the
+	 * callbacks are invoked, by the calling thread.
+	 *
+	 * \return True if this call made the request, false if it was
+	 *         already made or the source has no state
+	 */
+	bool requestStop();
+
+	/**
+	 * \brief Tell whether a stop was requested
+	 */
+	bool isStopRequested() const;
+
+	/**
+	 * \brief Tell whether the source has a state
+	 */
+	bool isStopPossible() const;
+
+	/**
+	 * \brief Get a token seeing the requests of this source
+	 */
+	StopToken getToken() const;
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	priv::StopState* m_state;  /**< shared state, NULL if none */
+};
+
+/**
+ * \brief Function invoked when a stop is requested
+ *
+ * The callback is registered for the lifetime of the instance :
+ * it is invoked by the thread calling StopSource::requestStop(),
+ * or immediately by the constructor if the stop was already
+ * requested. The destructor waits for the callback to return
+ * when another thread is invoking it.
+ *
+ * This is how waits which aren't aware of tokens (a socket, an
+ * IoRing...) are interrupted.
+ */
+template <typename F>
+class StopCallback : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Register a callback
+	 *
+	 * \param token    Token whose stop request triggers the callback
+	 * \param function Function to invoke, without arguments
+	 */
+	template <typename G>
+	StopCallback(const StopToken& token, G&& function);
+
+	/**
+	 * \brief Destructor, unregister the callback
+	 */
+	~StopCallback();
+
+private:
+
+	struct Callback : priv::StopCallbackBase
+	{
+		template <typename G>
+		explicit Callback(G&& function) : m_function(std::forward<G>(function)) {}
+
+		virtual void invoke() { m_function(); }
+
+		F m_function;
+	};
+
+	/**
+	 * \brief Member data
+	 */
+	priv::StopState* m_state;     /**< state the callback is registered in, NULL if invoked */
+	Callback         m_callback;  /**< function and its links */
+};
+
+#include <StopToken.inl>
+
+} // namespace cr
+
+#endif // __CRCR_STOP_TOKEN_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * void serve(cr::StopToken token, Queue* queue)
+ * {
+ *     std::unique_lock<std::mutex> lock(queue->mutex);
+ *     while (token.wait(lock, queue->notEmpty, [&]() { return !queue->items.empty(); }))
+ *         handle(queue->pop());
+ *     // stop requested : the locks and the stack are released normally
+ * }
+ *
+ * cr::Thread thread(&serve, &queue);  // the token is passed by the thread
+ * thread.launch();
+ * ...
+ * if (!thread.terminate(cr::seconds(2)))
+ *     std::cerr << "worker still busy" << std::endl;
+ * \endcode
+ */
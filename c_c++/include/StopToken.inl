@@ -0,0 +1,188 @@
+template <typename P>
+bool StopToken::wait(std::unique_lock<std::mutex>& lock, std::condition_variable& condition, P predicate) const
+{
+    if (!m_state)
+    {
+        condition.wait(lock, predicate);
+        return true;
+    }
+
+    std::mutex& mutex = *lock.mutex();
+    auto wake = [&mutex, &condition]()
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        condition.notify_all();
+    };
+
+    for (;;)
+    {
+        if (predicate())
+            return true;
+        if (isStopRequested())
+            return false;
+
+        /*
+         * The callback locks the mutex : it is registered and
+         * unregistered with the mutex unlocked, and the state is
+         * checked again once it is locked back
+         */
+        lock.unlock();
+        {
+            StopCallback<decltype(wake)> callback(*this, wake);
+
+            lock.lock();
+            while (!predicate() && !isStopRequested())
+                condition.wait(lock);
+            lock.unlock();
+        }
+        lock.lock();
+    }
+}
+
+template <typename P>
+bool StopToken::waitFor(std::unique_lock<std::mutex>& lock, std::condition_variable& condition, Time timeout, P predicate) const
+{
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout.asMicroseconds());
+
+    if (!m_state)
+        return condition.wait_until(lock, deadline, predicate);
+
+    std::mutex& mutex = *lock.mutex();
+    auto wake = [&mutex, &condition]()
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        condition.notify_all();
+    };
+
+    for (;;)
+    {
+        if (predicate())
+            return true;
+        if (isStopRequested() || std::chrono::steady_clock::now() >= deadline)
+            return false;
+
+        lock.unlock();
+        {
+            StopCallback<decltype(wake)> callback(*this, wake);
+
+            lock.lock();
+            while (!predicate() && !isStopRequested())
+            {
+                if (condition.wait_until(lock, deadline) == std::cv_status::timeout)
+                    break;
+            }
+            lock.unlock();
+        }
+        lock.lock();
+    }
+}
+
+template <typename P>
+bool ConditionVariable::wait(Lock& lock, const StopToken& token, P predicate)
+{
+    if (!token.isStopPossible())
+    {
+        wait(lock, predicate);
+        return true;
+    }
+
+    Mutex& mutex = lock.m_mutex;
+    auto wake = [this, &mutex]()
+    {
+        Lock guard(mutex);
+        notifyAll();
+    };
+
+    for (;;)
+    {
+        if (predicate())
+            return true;
+        if (token.isStopRequested())
+            return false;
+
+        /*
+         * The callback locks the mutex : it is registered and
+         * unregistered with the mutex unlocked
+         */
+        lock.unlock();
+        {
+            StopCallback<decltype(wake)> callback(token, wake);
+
+            lock.lock();
+            while (!predicate() && !token.isStopRequested())
+                wait(lock);
+            lock.unlock();
+        }
+        lock.lock();
+    }
+}
+
+template <typename P>
+bool ConditionVariable::waitFor(Lock& lock, const StopToken& token, Time timeout, P predicate)
+{
+    if (!token.isStopPossible())
+        return waitFor(lock, timeout, predicate);
+
+    Clock clock;
+    Mutex& mutex = lock.m_mutex;
+    auto wake = [this, &mutex]()
+    {
+        Lock guard(mutex);
+        notifyAll();
+    };
+
+    for (;;)
+    {
+        if (predicate())
+            return true;
+        if (token.isStopRequested() || clock.getElapsedTime() >= timeout)
+            return false;
+
+        lock.unlock();
+        {
+            StopCallback<decltype(wake)> callback(token, wake);
+
+            lock.lock();
+            while (!predicate() && !token.isStopRequested())
+            {
+                Time remaining = timeout - clock.getElapsedTime();
+                if (remaining <= Time::Zero || !waitFor(lock, remaining))
+                    break;
+            }
+            lock.unlock();
+        }
+        lock.lock();
+    }
+}
+
+template <typename F>
+template <typename G>
+StopCallback<F>::StopCallback(const StopToken& token, G&& function) :
+    m_state   (token.m_state),
+    m_callback(std::forward<G>(function))
+{
+    if (!m_state)
+        return;
+
+    m_state->addReference();
+
+    /*
+     * Already stopped : invoked right away
+     */
+    if (!m_state->addCallback(&m_callback))
+    {
+        m_state->removeReference();
+        m_state = NULL;
+        m_callback.invoke();
+    }
+}
+
+template <typename F>
+StopCallback<F>::~StopCallback()
+{
+    if (m_state)
+    {
+        m_state->removeCallback(&m_callback);
+        m_state->removeReference();
+    }
+}
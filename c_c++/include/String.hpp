@@ -2,6 +2,7 @@
 #define __CRCR_STRING_HPP__
 
 #include <Utf.hpp>
+#include <iosfwd>
 #include <locale>
 #include <string>
 
@@ -122,6 +123,16 @@ public:
 	 */
 	String(const String& copy);
 
+	/**
+	 * \brief Move constructor
+	 *
+	 * The characters of \a source are handed over without copy,
+	 * \a source is left empty.
+	 *
+	 * \param source Instance to move from
+	 */
+	String(String&& source);
+
 	/**
 	 * \brief Create a new cr::String from a UTF-8 encoded string
 	 *
@@ -260,6 +271,15 @@ public:
      */
     String& operator = (const String& right);
 
+    /**
+     * \brief Overload of move assignment operator
+     *
+     * \param right Instance to move from (left empty)
+     *
+     * \return Reference to self
+     */
+    String& operator = (String&& right);
+
     /**
      * \brief Overload of += operator to append an UTF-32 string
      *
@@ -482,9 +502,10 @@ public:
     ConstIterator end() const;
 	
 private:
+    friend class StringBuilder;
     friend bool operator == (const String& left, const String& right);
     friend bool operator  < (const String& left, const String& right);
-    friend std::istream& operator >> (std::istream& os, String& str);
+    friend std::istream& operator >> (std::istream& is, String& str);
 
     std::basic_string<Uint32> m_string;  /**< internal UTF-32 character string */
 };
@@ -519,23 +540,37 @@ String operator + (const String& left, const String& right);
  * \relates String
  * \brief output stream
  *
+ * The characters are encoded as UTF-8 straight into the
+ * stream buffer, through a small fixed-size chunk; no
+ * intermediate std::string is created. The width and fill
+ * of the stream are honored like for std::string.
+ *
  * \param os  Output stream (left operand)
  * \param str String (right operand)
  *
  * \return Output stream
  */
-//std::ostream& operator << (std::ostream& os, const String& str);
+std::ostream& operator << (std::ostream& os, const String& str);
 
 /**
  * \relates String
  * \brief input stream
  *
+ * Like for std::string, leading whitespaces are skipped and
+ * a single word is extracted, up to the next whitespace or
+ * to the width of the stream if it is set. The UTF-8 input is
+ * decoded chunk by chunk straight into the string. The bytes
+ * are validated like by cr::Utf8View::isValid (no overlong form,
+ * surrogate or code point past U+10FFFF) and each malformed
+ * sequence is decoded as U+FFFD, like cr::TextReader does. The
+ * width counts decoded characters.
+ *
  * \param is  Input stream (left operand)
  * \param str String (right operand)
  *
  * \return Input stream
  */
-//std::istream& operator >> (std::istream& os, String& str);
+std::istream& operator >> (std::istream& is, String& str);
 
 #include <String.inl>
 
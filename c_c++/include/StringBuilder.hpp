@@ -0,0 +1,340 @@
+#ifndef __CRCR_STRING_BUILDER_HPP__
+#define __CRCR_STRING_BUILDER_HPP__
+
+#include <String.hpp>
+#include <NonCopyable.hpp>
+#include <locale>
+#include <string>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Utility class to assemble a cr::String piece by piece
+ *
+ * cr::StringBuilder owns a single UTF-32 buffer which grows
+ * geometrically (its capacity is at least doubled whenever it
+ * has to be enlarged), so that appending one element costs
+ * amortized O(1) and never creates an intermediate cr::String.
+ *
+ * When the content is complete, build() moves the buffer into
+ * the resulting cr::String without copying the characters.
+ */
+class StringBuilder : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Default constructor
+	 *
+	 * create an empty builder, no memory is allocated
+	 */
+	StringBuilder();
+
+	/**
+	 * \brief Construct an empty builder with a reserved capacity
+	 *
+	 * \param capacity Number of characters to reserve
+	 */
+	explicit StringBuilder(std::size_t capacity);
+
+	/**
+	 * \brief Append a single UTF-32 character
+	 *
+	 * \param utf32Char UTF-32 character to append
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& append(Uint32 utf32Char);
+
+	/**
+	 * \brief Append a single ANSI character
+	 *
+	 * ASCII characters are appended directly, other characters
+	 * are converted to UTF-32 according to the global locale.
+	 *
+	 * \param ansiChar ANSI character to append
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& append(char ansiChar);
+
+	/**
+	 * \brief Append a single ANSI character converted with a locale
+	 *
+	 * \param ansiChar ANSI character to append
+	 * \param locale   Locale to use for conversion
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& append(char ansiChar, const std::locale& locale);
+
+	/**
+	 * \brief Append a single wide character
+	 *
+	 * \param wideChar Wide character to append
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& append(wchar_t wideChar);
+
+	/**
+	 * \brief Append a null-terminated C-style ANSI string
+	 *
+	 * The leading ASCII part of the string is copied directly,
+	 * the rest is converted according to the global locale.
+	 *
+	 * \param ansiString ANSI string to append (NULL is ignored)
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& append(const char* ansiString);
+
+	/**
+	 * \brief Append a null-terminated C-style ANSI string converted with a locale
+	 *
+	 * \param ansiString ANSI string to append (NULL is ignored)
+	 * \param locale     Locale to use for conversion
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& append(const char* ansiString, const std::locale& locale);
+
+	/**
+	 * \brief Append an ANSI string
+	 *
+	 * \param ansiString ANSI string to append
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& append(const std::string& ansiString);
+
+	/**
+	 * \brief Append the characters of a cr::String
+	 *
+	 * \param str String to append
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& append(const String& str);
+
+	/**
+	 * \brief Append a range of UTF-32 characters
+	 *
+	 * \param begin Pointer to the first character
+	 * \param end   Pointer to one past the last character
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& append(const Uint32* begin, const Uint32* end);
+
+	/**
+	 * \brief Append a UTF-8 encoded span
+	 *
+	 * Runs of ASCII bytes are copied directly, multi-bytes
+	 * sequences are decoded with the rules of cr::Utf8View::isValid.
+	 * Each malformed or truncated sequence is decoded as U+FFFD.
+	 *
+	 * \param begin Pointer to the first byte of the UTF-8 sequence
+	 * \param end   Pointer to one past the last byte of the UTF-8 sequence
+	 *
+	 * \return Reference to self
+	 *
+	 * \see appendUtf16
+	 */
+	StringBuilder& appendUtf8(const Uint8* begin, const Uint8* end);
+
+	/**
+	 * \brief Append a UTF-8 encoded span
+	 *
+	 * \param data Pointer to the first byte of the UTF-8 sequence
+	 * \param size Number of bytes in the sequence
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& appendUtf8(const char* data, std::size_t size);
+
+	/**
+	 * \brief Append a UTF-16 encoded span
+	 *
+	 * \param begin Pointer to the first element of the UTF-16 sequence
+	 * \param end   Pointer to one past the last element of the UTF-16 sequence
+	 *
+	 * \return Reference to self
+	 *
+	 * \see appendUtf8
+	 */
+	StringBuilder& appendUtf16(const Uint16* begin, const Uint16* end);
+
+	/**
+	 * \brief Append the decimal representation of an integer
+	 *
+	 * The digits are formatted in a local buffer and copied,
+	 * no temporary string is created.
+	 *
+	 * \param number Number to append
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& appendNumber(Int32 number);
+	StringBuilder& appendNumber(Uint32 number);
+	StringBuilder& appendNumber(Int64 number);
+	StringBuilder& appendNumber(Uint64 number);
+	StringBuilder& appendNumber(long number);
+	StringBuilder& appendNumber(unsigned long number);
+
+	/**
+	 * \brief Append the representation of a floating point number
+	 *
+	 * The number is formatted like printf("%.*g").
+	 *
+	 * \param number    Number to append
+	 * \param precision Maximum number of significant digits
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& appendNumber(double number, int precision = 6);
+
+	/**
+	 * \brief Append the same character several times
+	 *
+	 * \param count     Number of times to repeat the character
+	 * \param utf32Char UTF-32 character to append
+	 *
+	 * \return Reference to self
+	 */
+	StringBuilder& appendFill(std::size_t count, Uint32 utf32Char);
+
+	/**
+	 * \brief Reserve storage for at least \a capacity characters
+	 *
+	 * This function never shrinks the buffer.
+	 *
+	 * \param capacity Minimum number of characters to store without reallocation
+	 *
+	 * \see getCapacity, shrinkToFit
+	 */
+	void reserve(std::size_t capacity);
+
+	/**
+	 * \brief Get the number of characters that fit without reallocation
+	 *
+	 * \return Capacity of the internal buffer
+	 *
+	 * \see reserve
+	 */
+	std::size_t getCapacity() const;
+
+	/**
+	 * \brief Release the unused capacity of the internal buffer
+	 *
+	 * \see reserve
+	 */
+	void shrinkToFit();
+
+	/**
+	 * \brief Get the number of characters appended so far
+	 *
+	 * \return Number of characters in the builder
+	 */
+	std::size_t getSize() const;
+
+	/**
+	 * \brief Check whether the builder is empty or not
+	 *
+	 * \return True if no character has been appended
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * \brief Remove all the characters, keeping the capacity
+	 *
+	 * This allows the same builder to be reused without
+	 * allocating again.
+	 */
+	void clear();
+
+	/**
+	 * \brief Get a read-only pointer to the characters appended so far
+	 *
+	 * The returned pointer is invalidated by the next append.
+	 *
+	 * \return Pointer to the null-terminated UTF-32 characters
+	 */
+	const Uint32* getData() const;
+
+	/**
+	 * \brief Copy the content into a new cr::String
+	 *
+	 * The builder is left untouched.
+	 *
+	 * \return String containing the characters appended so far
+	 *
+	 * \see build
+	 */
+	String toString() const;
+
+	/**
+	 * \brief Move the content into a new cr::String
+	 *
+	 * The internal buffer is handed over to the returned string,
+	 * no character is copied. The builder is empty afterwards and
+	 * has no capacity left.
+	 *
+	 * \return String containing the characters appended so far
+	 *
+	 * \see toString
+	 */
+	String build();
+
+private:
+
+	/**
+	 * \brief Make room for \a count more characters
+	 *
+	 * The capacity grows to at least twice its current value,
+	 * which keeps the cost of appending amortized constant.
+	 *
+	 * \param count Number of characters about to be appended
+	 */
+	void grow(std::size_t count);
+
+	/**
+	 * \brief Append an ANSI range, with a fast path for ASCII characters
+	 */
+	void appendAnsi(const char* begin, const char* end, const std::locale* locale);
+
+	/**
+	 * \brief Append an ASCII digits buffer
+	 */
+	void appendDigits(const char* begin, const char* end);
+
+	/**
+	 * \brief Member data
+	 */
+	std::basic_string<Uint32> m_buffer;  /**< UTF-32 characters appended so far */
+};
+
+#include <StringBuilder.inl>
+
+} // namespace cr
+
+#endif // __CRCR_STRING_BUILDER_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::StringBuilder builder(1024);
+ *
+ * builder.append("id=").appendNumber(42).append(',');
+ * builder.appendUtf8(utf8Data, utf8Size);
+ * builder.append(cr::Uint32(0x263A));
+ *
+ * cr::String s = builder.build(); // no copy of the characters
+ * \endcode
+ */
@@ -0,0 +1,45 @@
+inline StringBuilder& StringBuilder::append(Uint32 utf32Char)
+{
+    if (m_buffer.size() == m_buffer.capacity())
+        grow(1);
+
+    m_buffer.push_back(utf32Char);
+    return *this;
+}
+
+inline StringBuilder& StringBuilder::append(char ansiChar)
+{
+    /*
+     * ASCII characters are the same in every ANSI encoding,
+     * no need to go through the locale for them
+     */
+    if (static_cast<Uint8>(ansiChar) < 0x80)
+        return append(static_cast<Uint32>(static_cast<Uint8>(ansiChar)));
+
+    return append(ansiChar, std::locale());
+}
+
+inline StringBuilder& StringBuilder::append(wchar_t wideChar)
+{
+    return append(Utf32::decodeWide(wideChar));
+}
+
+inline std::size_t StringBuilder::getSize() const
+{
+    return m_buffer.size();
+}
+
+inline std::size_t StringBuilder::getCapacity() const
+{
+    return m_buffer.capacity();
+}
+
+inline bool StringBuilder::isEmpty() const
+{
+    return m_buffer.empty();
+}
+
+inline const Uint32* StringBuilder::getData() const
+{
+    return m_buffer.c_str();
+}
@@ -0,0 +1,64 @@
+#ifndef __CRCR_STRING_SORT_HPP__
+#define __CRCR_STRING_SORT_HPP__
+
+#include <String.hpp>
+#include <StringView.hpp>
+#include <vector>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Sort a vector of strings
+ *
+ * The strings are ordered exactly like with operator <, but
+ * using a multikey quicksort (Bentley & Sedgewick): the sequence
+ * is partitioned on one code point at a time, so that a common
+ * prefix is never compared again once it has been examined.
+ * This is much faster than std::sort when many strings share
+ * long prefixes (paths, URLs, identifiers...).
+ *
+ * The sort is not stable, but equal strings are indistinguishable
+ * anyway. The characters themselves are never copied: the strings
+ * are moved to their final position once, at the end.
+ *
+ * When \a threadCount is greater than 1, the first partitioning
+ * levels are done by the calling thread and the resulting
+ * independent ranges are sorted by \a threadCount cr::Thread
+ * workers. Pass 0 to use one worker per online processor.
+ * Small inputs are always sorted by the calling thread.
+ *
+ * \param strings     Strings to sort
+ * \param threadCount Number of worker threads (1 to sort in the calling thread)
+ */
+void sortStrings(std::vector<String>& strings, unsigned int threadCount = 1);
+
+/**
+ * \brief Sort a vector of string views
+ *
+ * Same as the cr::String overload, the views are reordered
+ * and the characters they refer to are left untouched.
+ *
+ * \param views       Views to sort
+ * \param threadCount Number of worker threads (1 to sort in the calling thread)
+ */
+void sortStrings(std::vector<StringView>& views, unsigned int threadCount = 1);
+
+} // namespace cr
+
+#endif // __CRCR_STRING_SORT_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * std::vector<cr::String> names;
+ * ...
+ * cr::sortStrings(names);     // sort in the calling thread
+ * cr::sortStrings(names, 0);  // sort with one worker per processor
+ * \endcode
+ */
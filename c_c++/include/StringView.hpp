@@ -0,0 +1,210 @@
+#ifndef __CRCR_STRING_VIEW_HPP__
+#define __CRCR_STRING_VIEW_HPP__
+
+#include <String.hpp>
+#include <Config.hpp>
+#include <cstddef>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Read-only, non-owning view on a range of UTF-32 characters
+ *
+ * cr::StringView is just a pointer and a size: it is cheap to
+ * copy and never allocates. It is typically constructed from
+ * a cr::String, and stays valid only as long as the characters
+ * it refers to are not modified or destroyed.
+ */
+class StringView
+{
+public:
+
+	typedef const Uint32* ConstIterator; /**< read-only */
+
+	static const std::size_t InvalidPos;   /**< invalid position in the view */
+
+	/**
+	 * \brief Default constructor
+	 *
+	 * create an empty view
+	 */
+	StringView();
+
+	/**
+	 * \brief Construct a view on the characters of a cr::String
+	 *
+	 * \param str String to refer to
+	 */
+	StringView(const String& str);
+
+	/**
+	 * \brief Construct a view on a null-terminated UTF-32 string
+	 *
+	 * \param utf32String UTF-32 string to refer to (NULL gives an empty view)
+	 */
+	StringView(const Uint32* utf32String);
+
+	/**
+	 * \brief Construct a view on a range of UTF-32 characters
+	 *
+	 * \param data Pointer to the first character
+	 * \param size Number of characters
+	 */
+	StringView(const Uint32* data, std::size_t size);
+
+	/**
+	 * \brief Overload of [] operator to access a character by its position
+	 *
+	 * Note : the behavior is undefined if \a index is out of range.
+	 *
+	 * \param index Index of the character to get
+	 *
+	 * \return Character at position \a index
+	 */
+	Uint32 operator [] (std::size_t index) const;
+
+	/**
+	 * \brief Get the size of the view
+	 *
+	 * \return Number of characters in the view
+	 *
+	 * \see isEmpty
+	 */
+	std::size_t getSize() const;
+
+	/**
+	 * \brief Get the size of the view
+	 *
+	 * \return Number of characters in the view
+	 *
+	 * \see isEmpty
+	 */
+	std::size_t size() const;
+
+	/**
+	 * \brief Check whether the view is empty or not
+	 *
+	 * \return True if the view contains no character
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * \brief Get a pointer to the first character
+	 *
+	 * The characters are not null-terminated in general.
+	 *
+	 * \return Read-only pointer to the characters
+	 */
+	const Uint32* getData() const;
+
+	/**
+	 * \brief Return a part of the view
+	 *
+	 * \param position Index of the first character
+	 * \param length   Number of characters to include (if the view is
+	 *                 shorter, as many characters as possible are included)
+	 *
+	 * \return View on the requested characters
+	 */
+	StringView substring(std::size_t position, std::size_t length = InvalidPos) const;
+
+	/**
+	 * \brief Check whether the view starts with the characters of another one
+	 *
+	 * \param prefix Characters to look for
+	 *
+	 * \return True if \a prefix is a prefix of this view
+	 */
+	bool startsWith(StringView prefix) const;
+
+	/**
+	 * \brief Find a sequence of one or more characters in the view
+	 *
+	 * \param str   Characters to find
+	 * \param start Where to begin searching
+	 *
+	 * \return Position of \a str in the view, or StringView::InvalidPos if not found
+	 */
+	std::size_t find(StringView str, std::size_t start = 0) const;
+
+	/**
+	 * \brief Compare with another view
+	 *
+	 * Characters are compared by code point, a prefix is
+	 * ordered before the longer sequence (same order as
+	 * the cr::String comparison operators).
+	 *
+	 * \param right View to compare with
+	 *
+	 * \return Negative, zero or positive value if this view is respectively
+	 *         lower than, equal to or greater than \a right
+	 */
+	int compare(StringView right) const;
+
+	/**
+	 * \brief Copy the characters into a new cr::String
+	 *
+	 * \return String containing the characters of the view
+	 */
+	String toString() const;
+
+	/**
+	 * \brief Return an iterator to the beginning of the view
+	 *
+	 * \return Read-only iterator to the first character
+	 */
+	ConstIterator begin() const;
+
+	/**
+	 * \brief Return an iterator to the end of the view
+	 *
+	 * \return Read-only iterator to one past the last character
+	 */
+	ConstIterator end() const;
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	const Uint32* m_data;  /**< first character */
+	std::size_t   m_size;  /**< number of characters */
+};
+
+/**
+ * \relates StringView
+ * \brief Overload of various operators to compare two views
+ *
+ * \param left  Left operand (a view)
+ * \param right Right operand (a view)
+ */
+bool operator == (StringView left, StringView right);
+bool operator != (StringView left, StringView right);
+bool operator  < (StringView left, StringView right);
+bool operator  > (StringView left, StringView right);
+bool operator <= (StringView left, StringView right);
+bool operator >= (StringView left, StringView right);
+
+#include <StringView.inl>
+
+} // namespace cr
+
+#endif // __CRCR_STRING_VIEW_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::String s("hello world");
+ * cr::StringView v(s);
+ *
+ * cr::StringView w = v.substring(6);  // no allocation
+ * if (w == cr::StringView(cr::String("world")))
+ *     ...
+ * \endcode
+ */
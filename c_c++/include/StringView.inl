@@ -0,0 +1,82 @@
+inline StringView::StringView() :
+    m_data(NULL),
+    m_size(0)
+{
+}
+
+inline StringView::StringView(const String& str) :
+    m_data(str.getData()),
+    m_size(str.getSize())
+{
+}
+
+inline StringView::StringView(const Uint32* data, std::size_t size) :
+    m_data(data),
+    m_size(size)
+{
+}
+
+inline Uint32 StringView::operator [] (std::size_t index) const
+{
+    return m_data[index];
+}
+
+inline std::size_t StringView::getSize() const
+{
+    return m_size;
+}
+
+inline std::size_t StringView::size() const
+{
+    return m_size;
+}
+
+inline bool StringView::isEmpty() const
+{
+    return m_size == 0;
+}
+
+inline const Uint32* StringView::getData() const
+{
+    return m_data;
+}
+
+inline StringView::ConstIterator StringView::begin() const
+{
+    return m_data;
+}
+
+inline StringView::ConstIterator StringView::end() const
+{
+    return m_data + m_size;
+}
+
+inline bool operator == (StringView left, StringView right)
+{
+    return left.getSize() == right.getSize() && left.compare(right) == 0;
+}
+
+inline bool operator != (StringView left, StringView right)
+{
+    return !(left == right);
+}
+
+inline bool operator < (StringView left, StringView right)
+{
+    return left.compare(right) < 0;
+}
+
+inline bool operator > (StringView left, StringView right)
+{
+    return right < left;
+}
+
+inline bool operator <= (StringView left, StringView right)
+{
+    return !(right < left);
+}
+
+inline bool operator >= (StringView left, StringView right)
+{
+    return !(left < right);
+}
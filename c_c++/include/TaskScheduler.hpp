@@ -0,0 +1,233 @@
+#ifndef __CRCR_TASK_SCHEDULER_HPP__
+#define __CRCR_TASK_SCHEDULER_HPP__
+
+#include <Config.hpp>
+#include <Mutex.hpp>
+#include <NonCopyable.hpp>
+#include <Thread.hpp>
+#include <ThreadLocal.hpp>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+class TaskGroup;
+
+namespace priv
+{
+	struct SchedulerTask;
+	struct SchedulerWorker;
+}
+
+/**
+ * \brief Work-stealing scheduler for fine-grained fork/join tasks
+ *
+ * Each worker has its own cr::WorkStealingDeque : the tasks it
+ * spawns are pushed and popped there without contention, and an
+ * idle worker steals the oldest task of a victim picked at random.
+ * Tasks spawned from other threads go through a shared injection
+ * queue. Workers finding nothing to do spin briefly, then sleep on
+ * a futex until new tasks are spawned.
+ *
+ * Tasks are spawned and waited for through a cr::TaskGroup.
+ */
+class TaskScheduler : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Create the scheduler and start its workers
+	 *
+	 * \param threadCount Number of workers, 0 for one per core
+	 */
+	explicit TaskScheduler(std::size_t threadCount = 0);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Stop the workers. All the task groups must be synchronized first.
+	 */
+	~TaskScheduler();
+
+	/**
+	 * \brief Run a function on a worker and wait for its end
+	 *
+	 * The entry point of a computation started from outside the
+	 * scheduler : the tasks it spawns go to the worker's own deque
+	 * rather than to the injection queue. Rethrow the exception
+	 * thrown by the function, if any.
+	 *
+	 * \param function Callable without argument
+	 */
+	template <typename F>
+	void run(F&& function);
+
+	/**
+	 * \brief Get the number of workers
+	 */
+	std::size_t getThreadCount() const;
+
+private:
+
+	friend class TaskGroup;
+
+	/**
+	 * \brief Queue a task : in the deque of the current worker, or in the injection queue
+	 */
+	void spawn(priv::SchedulerTask* task);
+
+	/**
+	 * \brief Find a task and run it
+	 *
+	 * \param self Current worker, NULL for other threads
+	 *
+	 * \return False if no task was found
+	 */
+	bool runOne(priv::SchedulerWorker* self);
+
+	/**
+	 * \brief Get the worker running the calling thread
+	 *
+	 * \return Worker, NULL if the thread is not a worker of this scheduler
+	 */
+	priv::SchedulerWorker* getCurrentWorker() const;
+
+	/**
+	 * \brief Tell whether any task is queued
+	 */
+	bool hasWork() const;
+
+	/**
+	 * \brief Wake up a sleeping worker, if any
+	 */
+	void notify();
+
+	/**
+	 * \brief Entry point of the workers
+	 */
+	static void work(priv::SchedulerWorker* self);
+
+	/**
+	 * \brief Member data
+	 */
+	std::vector<priv::SchedulerWorker*> m_workers;        /**< workers, with their deques */
+	ThreadLocal                         m_current;        /**< worker of the calling thread */
+	Mutex                               m_injectedMutex;  /**< protects m_injected */
+	std::deque<priv::SchedulerTask*>    m_injected;       /**< tasks spawned by other threads */
+	std::atomic<std::size_t>            m_injectedCount;  /**< size of m_injected, read without lock */
+	std::atomic<Int32>                  m_epoch;          /**< futex : changed to wake up the sleepers */
+	std::atomic<Int32>                  m_sleepers;       /**< number of workers sleeping or about to */
+	std::atomic<bool>                   m_isStopped;      /**< are the workers asked to finish? */
+};
+
+/**
+ * \brief Set of tasks spawned on a cr::TaskScheduler, waited for together
+ *
+ * spawn() forks a task, sync() joins all the tasks of the group.
+ * A task can itself create a group and spawn sub-tasks : this is
+ * the recursive fork/join model. While sync() waits, a calling
+ * worker runs other tasks instead of blocking ; a thread which is
+ * not a worker of the scheduler sleeps.
+ *
+ * The first exception thrown by a task of the group is rethrown
+ * by sync().
+ */
+class TaskGroup : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Create an empty group
+	 *
+	 * \param scheduler Scheduler running the tasks
+	 */
+	explicit TaskGroup(TaskScheduler& scheduler);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Wait for the tasks of the group, ignoring their exceptions.
+	 */
+	~TaskGroup();
+
+	/**
+	 * \brief Spawn a task
+	 *
+	 * \param function Callable without argument
+	 */
+	template <typename F>
+	void spawn(F&& function);
+
+	/**
+	 * \brief Wait until all the spawned tasks are finished
+	 *
+	 * Rethrow the first exception thrown by a task, if any.
+	 */
+	void sync();
+
+private:
+
+	friend class TaskScheduler;
+
+	/**
+	 * \brief Wait until all the spawned tasks are finished
+	 */
+	void wait();
+
+	/**
+	 * \brief Called when a task of the group ends
+	 */
+	void finish();
+
+	/**
+	 * \brief Member data
+	 *
+	 * m_state is the number of pending tasks times two, plus one
+	 * when a thread sleeps in wait() : the task decrementing the
+	 * count to zero knows atomically whether to wake it up
+	 */
+	TaskScheduler&     m_scheduler;     /**< scheduler running the tasks */
+	std::atomic<Int32> m_state;         /**< futex : pending tasks and waiter flag */
+	std::atomic<bool>  m_hasException;  /**< did a task throw? */
+	std::exception_ptr m_exception;     /**< first exception thrown by a task */
+};
+
+#include <TaskScheduler.inl>
+
+} // namespace cr
+
+#endif // __CRCR_TASK_SCHEDULER_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * long fibonacci(cr::TaskScheduler& scheduler, int n)
+ * {
+ *     if (n < 20)
+ *         return serialFibonacci(n);
+ *
+ *     long a, b;
+ *     cr::TaskGroup group(scheduler);
+ *     group.spawn([&]() { a = fibonacci(scheduler, n - 1); });
+ *     b = fibonacci(scheduler, n - 2);
+ *     group.sync();
+ *
+ *     return a + b;
+ * }
+ *
+ * cr::TaskScheduler scheduler;
+ * long result;
+ * scheduler.run([&]() { result = fibonacci(scheduler, 40); });
+ * \endcode
+ */
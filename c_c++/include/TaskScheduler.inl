@@ -0,0 +1,44 @@
+namespace priv
+{
+    /*
+     * Base class for the spawned tasks
+     */
+    struct SchedulerTask
+    {
+        explicit SchedulerTask(TaskGroup* group_) : group(group_) {}
+        virtual ~SchedulerTask() {}
+        virtual void run() = 0;
+
+        TaskGroup* group;
+    };
+
+    template <typename F>
+    struct SchedulerFunctor : SchedulerTask
+    {
+        template <typename G>
+        SchedulerFunctor(TaskGroup* group_, G&& function) :
+            SchedulerTask(group_),
+            m_function   (std::forward<G>(function))
+        {
+        }
+
+        virtual void run() { m_function(); }
+
+        F m_function;
+    };
+} // namespace priv
+
+template <typename F>
+void TaskGroup::spawn(F&& function)
+{
+    m_state.fetch_add(2, std::memory_order_relaxed);
+    m_scheduler.spawn(new priv::SchedulerFunctor<typename std::decay<F>::type>(this, std::forward<F>(function)));
+}
+
+template <typename F>
+void TaskScheduler::run(F&& function)
+{
+    TaskGroup group(*this);
+    group.spawn(std::forward<F>(function));
+    group.sync();
+}
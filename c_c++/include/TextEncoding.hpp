@@ -0,0 +1,48 @@
+#ifndef __CRCR_TEXT_ENCODING_HPP__
+#define __CRCR_TEXT_ENCODING_HPP__
+
+#include <Config.hpp>
+#include <cstddef>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Unicode encodings of text files
+ */
+enum TextEncoding
+{
+	UTF8,     /**< UTF-8 */
+	UTF16LE,  /**< UTF-16, little endian */
+	UTF16BE,  /**< UTF-16, big endian */
+	UTF32LE,  /**< UTF-32, little endian */
+	UTF32BE   /**< UTF-32, big endian */
+};
+
+/**
+ * \brief Detect the encoding of a text from its byte order mark
+ *
+ * \param data     First bytes of the text
+ * \param size     Number of bytes available (4 are enough)
+ * \param fallback Encoding to assume when there is no byte order mark
+ * \param bomSize  Receives the size of the byte order mark, 0 if there is none
+ *
+ * \return Encoding of the text
+ */
+TextEncoding detectEncoding(const Uint8* data, std::size_t size, TextEncoding fallback, std::size_t* bomSize);
+
+/**
+ * \brief Get the size of a code unit of an encoding
+ *
+ * \param encoding Encoding
+ *
+ * \return 1, 2 or 4 bytes
+ */
+std::size_t getCodeUnitSize(TextEncoding encoding);
+
+} // namespace cr
+
+#endif // __CRCR_TEXT_ENCODING_HPP__
@@ -0,0 +1,167 @@
+#ifndef __CRCR_TEXT_READER_HPP__
+#define __CRCR_TEXT_READER_HPP__
+
+#include <NonCopyable.hpp>
+#include <StringView.hpp>
+#include <TextEncoding.hpp>
+#include <cstddef>
+#include <string>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Line by line reader of UTF-8, UTF-16 and UTF-32 text files
+ *
+ * The encoding is detected from the byte order mark at the
+ * beginning of the file ; files without one are read in the
+ * encoding given at opening (UTF-8 by default).
+ *
+ * The file is read in large blocks aligned on pages, each block
+ * being decoded into a UTF-32 buffer which is reused from line
+ * to line : reading a line allocates nothing, the line is a view
+ * on this buffer. Characters split across two blocks are decoded
+ * once the next block is read.
+ *
+ * The input is validated : each malformed sequence (invalid UTF-8
+ * byte, unpaired surrogate, character truncated by the end of the
+ * file...) is decoded as U+FFFD, and the unit which breaks a
+ * sequence is decoded on its own, so that it never swallows a
+ * line end.
+ */
+class TextReader : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Default constructor
+	 *
+	 * create a closed reader
+	 */
+	TextReader();
+
+	/**
+	 * \brief Open a file
+	 *
+	 * Check isOpen() to know whether it succeeded.
+	 *
+	 * \param filename Path of the file
+	 * \param fallback Encoding of the file if it has no byte order mark
+	 */
+	explicit TextReader(const std::string& filename, TextEncoding fallback = UTF8);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Close the file
+	 */
+	~TextReader();
+
+	/**
+	 * \brief Open a file
+	 *
+	 * The file previously open, if any, is closed first.
+	 * An error message is written to std::cerr on failure.
+	 *
+	 * \param filename Path of the file
+	 * \param fallback Encoding of the file if it has no byte order mark
+	 *
+	 * \return True if the file was open
+	 */
+	bool open(const std::string& filename, TextEncoding fallback = UTF8);
+
+	/**
+	 * \brief Close the file
+	 */
+	void close();
+
+	/**
+	 * \brief Tell whether a file is open
+	 */
+	bool isOpen() const;
+
+	/**
+	 * \brief Get the encoding of the file
+	 *
+	 * \return Encoding detected from the byte order mark, or the fallback
+	 */
+	TextEncoding getEncoding() const;
+
+	/**
+	 * \brief Tell whether the file starts with a byte order mark
+	 */
+	bool hasBom() const;
+
+	/**
+	 * \brief Read the next line
+	 *
+	 * Lines end with LF or CR LF, which are not part of the line.
+	 * The last line may have no end of line.
+	 *
+	 * \param line Receives the characters of the line ; the view is
+	 *             valid until the next call to readLine or close
+	 *
+	 * \return True if a line was read, false at the end of the file
+	 */
+	bool readLine(StringView& line);
+
+	/**
+	 * \brief Get the number of lines read so far
+	 */
+	std::size_t getLineCount() const;
+
+private:
+
+	/**
+	 * \brief Read and decode the next block of the file
+	 *
+	 * \return False at the end of the file
+	 */
+	bool readBlock();
+
+	/**
+	 * \brief Decode the bytes [begin, end) of the current block
+	 *
+	 * \return Number of bytes decoded ; the rest is an incomplete
+	 *         character, kept for the next block
+	 */
+	std::size_t decode(const Uint8* begin, const Uint8* end, bool last);
+
+	/**
+	 * \brief Member data
+	 */
+	int                       m_file;       /**< file descriptor, -1 if closed */
+	TextEncoding              m_encoding;   /**< encoding of the file */
+	bool                      m_hasBom;     /**< does the file start with a byte order mark? */
+	bool                      m_isEnd;      /**< has the whole file been read? */
+	bool                      m_isFirst;    /**< is the next block the first one? */
+	Uint8*                    m_block;      /**< aligned block of bytes read from the file */
+	std::size_t               m_pending;    /**< bytes of an incomplete character, before the block */
+	std::basic_string<Uint32> m_chars;      /**< decoded characters not consumed yet */
+	std::size_t               m_lineStart;  /**< beginning of the next line in m_chars */
+	std::size_t               m_scan;       /**< where to search the next end of line */
+	std::size_t               m_lineCount;  /**< number of lines read */
+};
+
+} // namespace cr
+
+#endif // __CRCR_TEXT_READER_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::TextReader reader("partner.csv", cr::UTF16LE);
+ *
+ * cr::StringView line;
+ * while (reader.readLine(line))
+ * {
+ *     // the view is only valid until the next line
+ *     records.push_back(parse(line));
+ * }
+ * \endcode
+ */
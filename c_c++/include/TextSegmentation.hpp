@@ -0,0 +1,254 @@
+#ifndef __CRCR_TEXT_SEGMENTATION_HPP__
+#define __CRCR_TEXT_SEGMENTATION_HPP__
+
+#include <StringView.hpp>
+#include <UnicodeTables.hpp>
+#include <cstddef>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ *
+ * Text segmentation (UAX #29) : grapheme clusters and words.
+ *
+ * cr::String::getSize counts code points, but what a user sees
+ * as one character may be several code points (a letter and its
+ * accents, a Hangul syllable in jamos, an emoji sequence...).
+ * The iterators below find the boundaries of the extended
+ * grapheme clusters and of the words, on UTF-32 (cr::String,
+ * cr::StringView) or directly on UTF-8 input.
+ *
+ * The character properties come from compact two-level tables
+ * generated from the Unicode character database (see
+ * tools/gen_unicode_tables.py), and the simple grapheme rules
+ * are a table indexed by pairs of classes. The iterators never
+ * allocate : they are cheap enough to be created per request.
+ */
+namespace cr
+{
+
+namespace priv
+{
+	/**
+	 * \brief Read-only access to UTF-32 or UTF-8 text by position
+	 */
+	class TextCursor
+	{
+	public:
+		TextCursor(const Uint32* utf32, std::size_t size);
+		TextCursor(const Uint8* utf8, std::size_t size);
+
+		/**
+		 * \brief Get the size of the text, in code units
+		 */
+		std::size_t getSize() const;
+
+		/**
+		 * \brief Decode the character at a position
+		 *
+		 * Invalid UTF-8 sequences are decoded as U+FFFD.
+		 *
+		 * \param position Position of the character, in code units
+		 * \param next     Receives the position of the next character
+		 *
+		 * \return Code point of the character
+		 */
+		Uint32 decode(std::size_t position, std::size_t* next) const;
+
+	private:
+		/**
+		 * \brief Decode a multi-byte UTF-8 sequence, or U+FFFD if it is invalid
+		 */
+		static Uint32 decodeSequence(const Uint8* begin, const Uint8* end, std::size_t* length);
+
+		const Uint32* m_utf32;  /**< UTF-32 text, or NULL */
+		const Uint8*  m_utf8;   /**< UTF-8 text, or NULL */
+		std::size_t   m_size;   /**< number of code units */
+	};
+}
+
+/**
+ * \brief Iterator over the grapheme clusters of a text
+ *
+ * Positions are in code units of the input : characters
+ * for UTF-32 text, bytes for UTF-8 text. The iterator starts
+ * before the first cluster, call next() to move to it.
+ */
+class GraphemeIterator
+{
+public:
+
+	/**
+	 * \brief Construct an iterator over UTF-32 text
+	 *
+	 * \param text Text to segment (must outlive the iterator)
+	 */
+	explicit GraphemeIterator(StringView text);
+
+	/**
+	 * \brief Construct an iterator over UTF-8 text
+	 *
+	 * \param utf8 Text to segment (must outlive the iterator)
+	 * \param size Size of the text, in bytes
+	 */
+	GraphemeIterator(const char* utf8, std::size_t size);
+
+	/**
+	 * \brief Move to the next grapheme cluster
+	 *
+	 * \return True if there was one, false at the end of the text
+	 */
+	bool next();
+
+	/**
+	 * \brief Get the position of the current cluster
+	 *
+	 * \return Position of the first code unit of the cluster
+	 */
+	std::size_t getBegin() const;
+
+	/**
+	 * \brief Get the end of the current cluster
+	 *
+	 * \return Position following the last code unit of the cluster
+	 */
+	std::size_t getEnd() const;
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	priv::TextCursor m_cursor;  /**< text */
+	std::size_t      m_begin;   /**< beginning of the current cluster */
+	std::size_t      m_end;     /**< end of the current cluster */
+};
+
+/**
+ * \brief Iterator over the words of a text
+ *
+ * The text is split at every word boundary : words, but also
+ * runs of spaces and punctuation, are segments ; isWord tells
+ * them apart. Positions are in code units of the input, like
+ * for cr::GraphemeIterator.
+ */
+class WordIterator
+{
+public:
+
+	/**
+	 * \brief Construct an iterator over UTF-32 text
+	 *
+	 * \param text Text to segment (must outlive the iterator)
+	 */
+	explicit WordIterator(StringView text);
+
+	/**
+	 * \brief Construct an iterator over UTF-8 text
+	 *
+	 * \param utf8 Text to segment (must outlive the iterator)
+	 * \param size Size of the text, in bytes
+	 */
+	WordIterator(const char* utf8, std::size_t size);
+
+	/**
+	 * \brief Move to the next segment
+	 *
+	 * \return True if there was one, false at the end of the text
+	 */
+	bool next();
+
+	/**
+	 * \brief Get the position of the current segment
+	 *
+	 * \return Position of the first code unit of the segment
+	 */
+	std::size_t getBegin() const;
+
+	/**
+	 * \brief Get the end of the current segment
+	 *
+	 * \return Position following the last code unit of the segment
+	 */
+	std::size_t getEnd() const;
+
+	/**
+	 * \brief Tell whether the current segment is a word
+	 *
+	 * \return True if the segment contains a letter or a digit
+	 */
+	bool isWord() const;
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	priv::TextCursor m_cursor;  /**< text */
+	std::size_t      m_begin;   /**< beginning of the current segment */
+	std::size_t      m_end;     /**< end of the current segment */
+	bool             m_isWord;  /**< does the current segment contain a letter or a digit? */
+};
+
+/**
+ * \brief Count the grapheme clusters of a text
+ *
+ * \param text Text to measure
+ *
+ * \return Number of user-perceived characters in \a text
+ */
+std::size_t countGraphemes(StringView text);
+
+/**
+ * \brief Count the grapheme clusters of a UTF-8 text
+ *
+ * \param utf8 Text to measure
+ * \param size Size of the text, in bytes
+ *
+ * \return Number of user-perceived characters in \a utf8
+ */
+std::size_t countGraphemes(const char* utf8, std::size_t size);
+
+/**
+ * \brief Find where to truncate a text without splitting a grapheme cluster
+ *
+ * \param text  Text to truncate
+ * \param count Maximum number of grapheme clusters to keep
+ *
+ * \return Number of characters of the first \a count clusters
+ */
+std::size_t graphemePrefixSize(StringView text, std::size_t count);
+
+/**
+ * \brief Find where to truncate a UTF-8 text without splitting a grapheme cluster
+ *
+ * \param utf8  Text to truncate
+ * \param size  Size of the text, in bytes
+ * \param count Maximum number of grapheme clusters to keep
+ *
+ * \return Number of bytes of the first \a count clusters
+ */
+std::size_t graphemePrefixSize(const char* utf8, std::size_t size, std::size_t count);
+
+#include <TextSegmentation.inl>
+
+} // namespace cr
+
+#endif // __CRCR_TEXT_SEGMENTATION_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * // keep at most 20 user-perceived characters of a title
+ * title.erase(cr::graphemePrefixSize(title, 20));
+ *
+ * // list the words of a UTF-8 buffer
+ * cr::WordIterator words(data, size);
+ * while (words.next())
+ * {
+ *     if (words.isWord())
+ *         index(data + words.getBegin(), words.getEnd() - words.getBegin());
+ * }
+ * \endcode
+ */
@@ -0,0 +1,70 @@
+namespace priv
+{
+
+inline TextCursor::TextCursor(const Uint32* utf32, std::size_t size) :
+    m_utf32(utf32),
+    m_utf8 (NULL),
+    m_size (size)
+{
+}
+
+inline TextCursor::TextCursor(const Uint8* utf8, std::size_t size) :
+    m_utf32(NULL),
+    m_utf8 (utf8),
+    m_size (size)
+{
+}
+
+inline std::size_t TextCursor::getSize() const
+{
+    return m_size;
+}
+
+inline Uint32 TextCursor::decode(std::size_t position, std::size_t* next) const
+{
+    if (m_utf32)
+    {
+        *next = position + 1;
+        return m_utf32[position];
+    }
+
+    const Uint8* begin = m_utf8 + position;
+    if (*begin < 0x80)
+    {
+        *next = position + 1;
+        return *begin;
+    }
+
+    std::size_t length;
+    Uint32 codepoint = decodeSequence(begin, m_utf8 + m_size, &length);
+    *next = position + length;
+
+    return codepoint;
+}
+
+} // namespace priv
+
+inline std::size_t GraphemeIterator::getBegin() const
+{
+    return m_begin;
+}
+
+inline std::size_t GraphemeIterator::getEnd() const
+{
+    return m_end;
+}
+
+inline std::size_t WordIterator::getBegin() const
+{
+    return m_begin;
+}
+
+inline std::size_t WordIterator::getEnd() const
+{
+    return m_end;
+}
+
+inline bool WordIterator::isWord() const
+{
+    return m_isWord;
+}
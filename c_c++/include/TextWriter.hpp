@@ -0,0 +1,242 @@
+#ifndef __CRCR_TEXT_WRITER_HPP__
+#define __CRCR_TEXT_WRITER_HPP__
+
+#include <NonCopyable.hpp>
+#include <StringView.hpp>
+#include <TextEncoding.hpp>
+#include <Utf8View.hpp>
+#include <cstddef>
+#include <string>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Buffered writer of text to a file descriptor
+ *
+ * The characters are encoded (UTF-8, UTF-16 or UTF-32) directly
+ * into a large output buffer, which is written with a single
+ * write() call when it is full : no temporary string is built
+ * per cr::String. Large UTF-8 spans given as is are written
+ * together with the buffer by writev(), without being copied.
+ *
+ * In Direct mode the file is open with O_DIRECT : the data goes
+ * from the buffer to the disk without filling the page cache,
+ * which suits large outputs that won't be read back soon. Only
+ * whole blocks are written while the file is open, the tail is
+ * written by close(). File systems without O_DIRECT support
+ * (tmpfs...) silently fall back to the Buffered mode.
+ *
+ * After an error the writer ignores the writes ; isGood() tells
+ * whether everything was written so far.
+ */
+class TextWriter : NonCopyable
+{
+public:
+
+	/**
+	 * \brief How the data reaches the file
+	 */
+	enum Mode
+	{
+		Buffered,  /**< through the page cache */
+		Direct     /**< straight to the disk (O_DIRECT) */
+	};
+
+	/**
+	 * \brief Default constructor
+	 *
+	 * create a closed writer
+	 *
+	 * \param bufferSize Size of the output buffer, in bytes
+	 */
+	explicit TextWriter(std::size_t bufferSize = 1 << 20);
+
+	/**
+	 * \brief Create a file and open it for writing
+	 *
+	 * Check isOpen() to know whether it succeeded.
+	 *
+	 * \param filename   Path of the file, truncated if it exists
+	 * \param encoding   Encoding of the characters
+	 * \param mode       How the data reaches the file
+	 * \param bufferSize Size of the output buffer, in bytes
+	 */
+	TextWriter(const std::string& filename, TextEncoding encoding = UTF8, Mode mode = Buffered,
+	           std::size_t bufferSize = 1 << 20);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Flush and close the file
+	 */
+	~TextWriter();
+
+	/**
+	 * \brief Create a file and open it for writing
+	 *
+	 * The file previously open, if any, is closed first.
+	 * An error message is written to std::cerr on failure.
+	 *
+	 * \param filename Path of the file, truncated if it exists
+	 * \param encoding Encoding of the characters
+	 * \param mode     How the data reaches the file
+	 *
+	 * \return True if the file was open
+	 */
+	bool open(const std::string& filename, TextEncoding encoding = UTF8, Mode mode = Buffered);
+
+	/**
+	 * \brief Write to an already open file descriptor
+	 *
+	 * The descriptor (a socket, a pipe, the standard output...)
+	 * is not closed by the writer.
+	 *
+	 * \param descriptor File descriptor open for writing
+	 * \param encoding   Encoding of the characters
+	 */
+	void attach(int descriptor, TextEncoding encoding = UTF8);
+
+	/**
+	 * \brief Flush the buffer and close the file
+	 *
+	 * \return True if all the data was written
+	 */
+	bool close();
+
+	/**
+	 * \brief Tell whether a file is open
+	 */
+	bool isOpen() const;
+
+	/**
+	 * \brief Tell whether all the data was written so far
+	 */
+	bool isGood() const;
+
+	/**
+	 * \brief Get the encoding of the characters
+	 */
+	TextEncoding getEncoding() const;
+
+	/**
+	 * \brief Get the mode of the writer
+	 *
+	 * \return Direct only if the file system accepted O_DIRECT
+	 */
+	Mode getMode() const;
+
+	/**
+	 * \brief Write the byte order mark of the encoding
+	 *
+	 * \return Reference to self
+	 */
+	TextWriter& writeBom();
+
+	/**
+	 * \brief Write a character
+	 *
+	 * \param utf32Char Character to write
+	 *
+	 * \return Reference to self
+	 */
+	TextWriter& write(Uint32 utf32Char);
+
+	/**
+	 * \brief Write characters
+	 *
+	 * \param str Characters to write (a cr::String converts to it)
+	 *
+	 * \return Reference to self
+	 */
+	TextWriter& write(StringView str);
+
+	/**
+	 * \brief Write characters followed by an end of line (LF)
+	 *
+	 * \param str Characters to write
+	 *
+	 * \return Reference to self
+	 */
+	TextWriter& writeLine(StringView str);
+
+	/**
+	 * \brief Write UTF-8 encoded text
+	 *
+	 * In UTF-8 the bytes are written as is, otherwise they are
+	 * decoded and encoded again.
+	 *
+	 * \param text Text to write
+	 *
+	 * \return Reference to self
+	 */
+	TextWriter& write(Utf8View text);
+
+	/**
+	 * \brief Write the content of the buffer to the file
+	 *
+	 * In Direct mode, only whole blocks are written.
+	 *
+	 * \return True if the data was written
+	 */
+	bool flush();
+
+	/**
+	 * \brief Get the number of bytes given to the file so far
+	 *
+	 * \return Number of bytes written, not counting the buffer
+	 */
+	Uint64 getWrittenSize() const;
+
+private:
+
+	/**
+	 * \brief Write the buffer, then \a size more bytes from \a data
+	 *
+	 * \param data  Bytes to write after the buffer (may be NULL)
+	 * \param size  Number of bytes from \a data
+	 * \param whole In Direct mode, write only whole blocks of the buffer
+	 */
+	bool writeBuffer(const char* data, std::size_t size, bool whole);
+
+	/**
+	 * \brief Make room for \a size bytes in the buffer
+	 */
+	void reserve(std::size_t size);
+
+	/**
+	 * \brief Member data
+	 */
+	int          m_file;      /**< file descriptor, -1 if closed */
+	bool         m_isOwner;   /**< close the descriptor with the writer? */
+	bool         m_isGood;    /**< has everything been written? */
+	TextEncoding m_encoding;  /**< encoding of the characters */
+	Mode         m_mode;      /**< Buffered or Direct */
+	char*        m_buffer;    /**< output buffer, aligned for O_DIRECT */
+	std::size_t  m_capacity;  /**< size of the buffer */
+	std::size_t  m_size;      /**< bytes in the buffer */
+	Uint64       m_written;   /**< bytes given to the file */
+};
+
+} // namespace cr
+
+#endif // __CRCR_TEXT_WRITER_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::TextWriter writer("export.txt", cr::UTF16LE);
+ * writer.writeBom();
+ *
+ * for (std::size_t i = 0; i < names.size(); ++i)
+ *     writer.writeLine(names[i]);
+ *
+ * if (!writer.close())
+ *     return false;
+ * \endcode
+ */
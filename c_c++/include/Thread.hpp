@@ -3,7 +3,15 @@
 
 #include <NonCopyable.hpp>
 #include <ThreadImpl.hpp>
+#include <ThreadAttributes.hpp>
+#include <StopToken.hpp>
+#include <Time.hpp>
+#include <cstddef>
 #include <cstdlib>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 /**
  * \brief namespace : cr(CloudRain21) (my private library)
@@ -13,7 +21,6 @@ namespace cr
 
 namespace priv
 {
-	class ThreadImpl;
 	struct ThreadFunc;
 }
 
@@ -24,80 +31,46 @@ class Thread : NonCopyable
 {
 public:
 	/**
-	 * \brief Construct the thread from a functor with no argument
-	 *
-	 * This constructor works for function objects, as well
-	 * as free functions.
+	 * \brief Construct the thread from a function and its arguments
 	 *
+	 * The function can be a free function, a function object (a
+	 * lambda...) or a member function, whose first argument is
+	 * then a pointer to the object :
 	 * \code
-	 * void function();
+	 * void function(int number, std::string text);
+	 * cr::Thread first(&function, 5, "text");
 	 *
-	 * // --- or ---
+	 * cr::Thread second([&]() { ... });
 	 *
-	 * struct Functor
+	 * class MyClass
 	 * {
-	 *     void operator();
+	 * public:
+	 *     void function(int number);
 	 * };
+	 * cr::Thread third(&MyClass::function, &object, 5);
 	 * \endcode
 	 *
-	 * Note : this does not run the thread, use launch().
-	 *
-	 * \param function Functor or free function to use as the entry point
-	 *                 of the thread
-	 */
-	template<typename F>
-    Thread(F function);
-
-	/**
-	 * \brief Construct the thread from a functor with an argument
+	 * The function and the arguments are copied, or moved from
+	 * rvalues, into the thread ; the arguments are moved to the
+	 * function when it runs, so move-only types can be passed.
+	 * Callables up to InlineSize bytes are stored inside the
+	 * cr::Thread instance : constructing and launching the thread
+	 * then allocates nothing.
 	 *
-	 * This constructor works for function objects, as well
-	 * as free functions.
-	 * It is a template, which means that the arguments can
-	 * have any type (int, std::string, void *, Toto, ...).
-	 *
-	 * Use this constructor for this kind of function:
-	 * \code
-	 * void function(int arg);
-	 *
-	 * // --- or ---
-	 *
-	 * struct Functor
-	 * {
-	 *     void operator()(std::string arg);
-	 * };
-	 * \endcode
+	 * A function whose first parameter is a cr::StopToken (after
+	 * the object, for a member function) receives the token of the
+	 * thread as first argument, the arguments given here following :
+	 * it stops when it sees requestStop() or terminate(). The
+	 * shared state of the token is the only allocation then.
 	 *
 	 * Note : this does not run the thread, use launch().
 	 *
-	 * \param function Functor or free function to use as the entry point
-	 *                 of the thread
-	 * \param argument argument to forward to the function
+	 * \param function  Entry point of the thread
+	 * \param arguments Arguments to pass to the function
 	 */
-	template<typename F, typename A>
-    Thread(F function, A argument);
-
-	/**
-	 * \brief Construct the thread from a member function and an object
-	 *
-	 * This constructor is a template, which means that you can
-	 * use it with any class.
-	 * Use this constructor for this kink of function:
-	 * \code
-	 * class MyClass
-	 * {
-	 * public:
-	 *     void function();
-	 * };
-	 * \endcode
-	 *
-	 * Note : this does not run the thread. use launch().
-	 *
-	 * \param function Entry point of the thread
-	 * \param object   Pointer to the object to use
-	 */
-	template<typename C>
-    Thread( void(C::*function)(), C* object );
+	template <typename F, typename... A,
+	          typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, Thread>::value>::type>
+	Thread(F&& function, A&&... arguments);
 
 	/**
 	 * \brief Destructor
@@ -114,8 +87,24 @@ public:
 	 * thread's constructor, and returns immediately.
 	 * After this function returns, the thread's function is
 	 * running in parallel to the calling code.
+	 *
+	 * \return True if the thread was started
 	 */
-	void launch();
+	bool launch();
+
+	/**
+	 * \brief Run the thread with given attributes
+	 *
+	 * Same as launch(), the thread being created with a given
+	 * stack size, affinity, scheduling policy and name. An error
+	 * message is written to std::cerr if the system refuses them
+	 * (an invalid CPU, a real-time policy without the privilege).
+	 *
+	 * \param attributes Attributes of the thread
+	 *
+	 * \return True if the thread was started
+	 */
+	bool launch(const ThreadAttributes& attributes);
 
 	/**
 	 * \brief Wait until the thread finishes
@@ -130,17 +119,48 @@ public:
 	void wait();
 
 	/**
-	 * \brief Terminate the thread
-	 *
-	 * This function immediately stops the thread, without waiting
-	 * for its function to finish.
-	 * Terminating a thread with this function is not safe,
-	 * and can lead to local variables not being destroyed
-	 * on some operating systems. You should rather try to make
-	 * the thread function terminate by itself.
+	 * \brief Ask the thread function to stop
+	 *
+	 * The stop token given to the function sees the request,
+	 * and its sleeps and waits are interrupted. This function
+	 * returns immediately.
+	 *
+	 * \return True if the request was made, false if it was already
+	 *         made or the function doesn't take a stop token
+	 */
+	bool requestStop();
+
+	/**
+	 * \brief Get the stop token given to the thread function
+	 *
+	 * \return Token which can't be stopped if the function doesn't take one
+	 */
+	StopToken getStopToken() const;
+
+	/**
+	 * \brief Stop the thread and wait for it
+	 *
+	 * Same as requestStop() followed by wait() : the function
+	 * returns by itself, its locks are released and its local
+	 * variables destroyed. The thread is never killed.
+	 * Warning : if the thread function ignores the stop token,
+	 * the calling thread will block until it ends.
 	 */
 	void terminate();
 
+	/**
+	 * \brief Stop the thread and wait for it, at most a given time
+	 *
+	 * Same as terminate(), except that waiting is abandoned after
+	 * \a timeout : the thread keeps running (and the destructor will
+	 * still wait for it) ; the call can be repeated.
+	 *
+	 * \param timeout Maximum time to wait
+	 *
+	 * \return True if the thread finished and was joined
+	 */
+	bool terminate(Time timeout);
+
 private:
 
 	friend class priv::ThreadImpl;
@@ -152,11 +172,29 @@ private:
 	 */
 	void run();
 
+	/**
+	 * \brief Give a fresh stop state to a function stopped before
+	 */
+	void resetStopSource();
+
+public:
+
+	/**
+	 * \brief Size of the storage of small callables, in bytes
+	 */
+	static const std::size_t InlineSize = 64;
+
+private:
+
+	typedef std::aligned_storage<InlineSize, alignof(std::max_align_t)>::type Storage;
+
 	/**
 	 * \brief Member data
 	 */
-	priv::ThreadImpl * m_impl;        /**< OS-specific implementation of the thread */
+	priv::ThreadImpl   m_impl;        /**< OS-specific implementation of the thread */
 	priv::ThreadFunc * m_entryPoint;  /**< Abstraction of the function to run */
+	StopSource         m_stopSource;  /**< Stop requests, without state if the function takes no token */
+	Storage            m_storage;     /**< m_entryPoint, when small enough */
 };
 
 #include <Thread.inl>
@@ -212,4 +250,28 @@ private:
  * sf::Thread thread(Task());
  * thread.launch(); // start the thread (internally calls operator() on the Task instance)
  * \endcode
+ *
+ * \code
+ * // example 4: several arguments, a move-only one
+ *
+ * void consume(int id, std::unique_ptr<Buffer> buffer);
+ *
+ * cr::Thread thread(&consume, 7, std::move(buffer));
+ * thread.launch(); // start the thread (internally calls consume(7, std::move(buffer)))
+ * \endcode
+ *
+ * \code
+ * // example 5: stopping the thread
+ *
+ * void poll(cr::StopToken token, Device* device)
+ * {
+ *     while (!token.isStopRequested())
+ *         device->poll();
+ * }
+ *
+ * cr::Thread thread(&poll, &device);
+ * thread.launch(); // start the thread (internally calls poll(token, &device))
+ * ...
+ * thread.terminate(); // request the stop, and wait for poll to return
+ * \endcode
  */
@@ -6,69 +6,141 @@ namespace priv
     struct ThreadFunc
     {
         virtual ~ThreadFunc() {}
-        virtual void run() = 0;
+        virtual void run(const StopToken& token) = 0;
     };
 
     /*
-     * Specialization using a functor (including free functions) with no argument
+     * Compile-time list of indices, to expand the stored arguments
      */
-    template<typename T>
-    struct ThreadFunctor : ThreadFunc
+    template <std::size_t... I>
+    struct IndexSequence
     {
-        ThreadFunctor(T functor) : m_functor(functor) {}
+    };
 
-        virtual void run() { m_functor(); }
+    template <std::size_t N, std::size_t... I>
+    struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, I...>
+    {
+    };
 
-        T m_functor;
+    template <std::size_t... I>
+    struct MakeIndexSequence<0, I...>
+    {
+        typedef IndexSequence<I...> Type;
     };
 
     /*
-     * Specialization using a functor (including free functions) with no argument
+     * Call a functor (including free functions)
+     */
+    template <typename F, typename... A>
+    inline auto invokeThreadFunc(F& function, A&&... arguments) -> decltype(function(std::forward<A>(arguments)...))
+    {
+        return function(std::forward<A>(arguments)...);
+    }
+
+    /*
+     * Call a member function on a pointer to the object
+     */
+    template <typename R, typename C, typename... P, typename O, typename... A>
+    inline R invokeThreadFunc(R (C::*function)(P...), O&& object, A&&... arguments)
+    {
+        return ((*object).*function)(std::forward<A>(arguments)...);
+    }
+
+    template <typename R, typename C, typename... P, typename O, typename... A>
+    inline R invokeThreadFunc(R (C::*function)(P...) const, O&& object, A&&... arguments)
+    {
+        return ((*object).*function)(std::forward<A>(arguments)...);
+    }
+
+    /*
+     * Call a function whose first argument is the stop token ; for
+     * a member function, the token follows the object
+     */
+    template <typename F, typename... A>
+    inline auto invokeWithStopToken(F& function, const StopToken& token, A&&... arguments) -> decltype(function(token, std::forward<A>(arguments)...))
+    {
+        return function(token, std::forward<A>(arguments)...);
+    }
+
+    template <typename M, typename C, typename O, typename... A>
+    inline auto invokeWithStopToken(M C::* function, const StopToken& token, O&& object, A&&... arguments)
+        -> decltype(((*object).*function)(token, std::forward<A>(arguments)...))
+    {
+        return ((*object).*function)(token, std::forward<A>(arguments)...);
+    }
+
+    /*
+     * Tell whether a function takes the stop token
      */
-    template<typename F, typename A>
-    struct ThreadFunctorWithArg : ThreadFunc
+    template <typename F, typename... A>
+    struct TakesStopToken
     {
-        ThreadFunctorWithArg(F function, A arg): m_function(function), m_arg(arg) {}
+        template <typename G>
+        static auto test(int) -> decltype(invokeWithStopToken(std::declval<G&>(), std::declval<const StopToken&>(), std::declval<A>()...), std::true_type());
 
-        virtual void run() { m_function(m_arg); }
+        template <typename G>
+        static std::false_type test(...);
 
-        F m_function;
-        A m_arg;
+        typedef decltype(test<F>(0)) Type;
     };
 
     /*
-     * Specialization using a member function
+     * Function with its arguments
      */
-    template<typename C>
-    struct ThreadMemberFunc : ThreadFunc
+    template <typename F, typename... A>
+    struct ThreadCallable : ThreadFunc
     {
-        ThreadMemberFunc(void(C::*function)(), C* object)
-            : m_function(function), m_object(object) {}
+        template <typename G, typename... B>
+        explicit ThreadCallable(G&& function, B&&... arguments) :
+            m_function (std::forward<G>(function)),
+            m_arguments(std::forward<B>(arguments)...)
+        {
+        }
+
+        typedef typename TakesStopToken<F, A...>::Type IsStoppable;
+
+        virtual void run(const StopToken& token) { call(token, IsStoppable(), typename MakeIndexSequence<sizeof...(A)>::Type()); }
+
+        template <std::size_t... I>
+        void call(const StopToken&, std::false_type, IndexSequence<I...>) { invokeThreadFunc(m_function, std::move(std::get<I>(m_arguments))...); }
 
-        virtual void run() { (m_object->*m_function)(); }
+        template <std::size_t... I>
+        void call(const StopToken& token, std::true_type, IndexSequence<I...>) { invokeWithStopToken(m_function, token, std::move(std::get<I>(m_arguments))...); }
 
-        void(C::*m_function)();
-        C* m_object;
+        F                m_function;
+        std::tuple<A...> m_arguments;
     };
+
+    template <typename Callable, typename... A>
+    ThreadFunc* createThreadFunc(void* storage, std::true_type, A&&... arguments)
+    {
+        return new (storage) Callable(std::forward<A>(arguments)...);
+    }
+
+    template <typename Callable, typename... A>
+    ThreadFunc* createThreadFunc(void*, std::false_type, A&&... arguments)
+    {
+        return new Callable(std::forward<A>(arguments)...);
+    }
 }  // namespace priv
 
-template<typename F>
-Thread::Thread(F functor) :
-    m_impl      (NULL),
-    m_entryPoint(new priv::ThreadFunctor<F>(functor))
+template <typename F, typename... A, typename>
+Thread::Thread(F&& function, A&&... arguments) :
+    m_entryPoint(NULL),
+    m_stopSource(NoStopState())
 {
-}
+    typedef priv::ThreadCallable<typename std::decay<F>::type, typename std::decay<A>::type...> Callable;
 
-template<typename F, typename A>
-Thread::Thread(F function, A argument) :
-    m_impl      (NULL),
-    m_entryPoint(new priv::ThreadFunctorWithArg<F,A>(function, argument))
-{
-}
+    /*
+     * Small callables live in the instance, the others on the heap
+     */
+    typedef std::integral_constant<bool, sizeof(Callable) <= sizeof(Storage) && alignof(Callable) <= alignof(Storage)> IsInline;
 
-template<typename C>
-Thread::Thread(void(C::*function)(), C* object) :
-    m_impl      (NULL),
-    m_entryPoint(new priv::ThreadMemberFunc<C>(function, object))
-{
+    m_entryPoint = priv::createThreadFunc<Callable>(&m_storage, IsInline(), std::forward<F>(function), std::forward<A>(arguments)...);
+
+    /*
+     * Only the functions which can see a stop request get a state
+     */
+    if (Callable::IsStoppable::value)
+        m_stopSource = StopSource();
 }
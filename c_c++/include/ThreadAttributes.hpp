@@ -0,0 +1,103 @@
+#ifndef __CRCR_THREAD_ATTRIBUTES_HPP__
+#define __CRCR_THREAD_ATTRIBUTES_HPP__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Attributes of a thread, given to Thread::launch()
+ *
+ * The default values are the ones of the system : an 8 MiB stack
+ * typically, any CPU, the normal time-sharing policy.
+ *
+ * Real-time policies (Fifo, RoundRobin) need the CAP_SYS_NICE
+ * capability or an RLIMIT_RTPRIO limit ; without them the launch
+ * fails.
+ */
+struct ThreadAttributes
+{
+	/**
+	 * \brief Scheduling policies
+	 */
+	enum Policy
+	{
+		Inherit,     /**< same as the launching thread */
+		Other,       /**< normal time-sharing (SCHED_OTHER) */
+		Batch,       /**< CPU-bound, not interactive (SCHED_BATCH) */
+		Idle,        /**< lowest priority (SCHED_IDLE) */
+		Fifo,        /**< real-time, runs until it blocks (SCHED_FIFO) */
+		RoundRobin   /**< real-time, with time slices (SCHED_RR) */
+	};
+
+	/**
+	 * \brief Value of guardSize selecting the system default
+	 */
+	static const std::size_t DefaultGuardSize = static_cast<std::size_t>(-1);
+
+	/**
+	 * \brief Default constructor
+	 *
+	 * \param stack      Size of the stack, 0 for the system default
+	 * \param threadName Name of the thread
+	 */
+	explicit ThreadAttributes(std::size_t stack = 0, const std::string& threadName = std::string()) :
+		stackSize(stack),
+		guardSize(DefaultGuardSize),
+		policy   (Inherit),
+		priority (0),
+		name     (threadName)
+	{
+	}
+
+	/**
+	 * \brief Restrict the thread to a single CPU
+	 *
+	 * \param cpu CPU id (see cr::CpuTopology)
+	 */
+	ThreadAttributes& pinTo(unsigned int cpu)
+	{
+		affinity.assign(1, cpu);
+		return *this;
+	}
+
+	/**
+	 * \brief Member data
+	 */
+	std::size_t               stackSize;  /**< bytes, rounded up to whole pages ; 0 for the default */
+	std::size_t               guardSize;  /**< bytes of the overflow guard below the stack, 0 for none */
+	std::vector<unsigned int> affinity;   /**< CPUs the thread may run on, empty for any */
+	Policy                    policy;     /**< scheduling policy */
+	int                       priority;   /**< 1 to 99 for the real-time policies, 0 otherwise */
+	std::string               name;       /**< shown by ps and debuggers ; 15 characters at most are kept */
+};
+
+} // namespace cr
+
+#endif // __CRCR_THREAD_ATTRIBUTES_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * // thousands of small workers
+ * cr::ThreadAttributes small(64 * 1024, "worker");
+ *
+ * // latency-critical thread, alone on an isolated core
+ * cr::ThreadAttributes critical(0, "feed");
+ * critical.pinTo(cr::CpuTopology::getIsolatedCpus().at(0));
+ * critical.policy = cr::ThreadAttributes::Fifo;
+ * critical.priority = 80;
+ *
+ * cr::Thread thread(&readFeed, &socket);
+ * if (!thread.launch(critical))
+ *     thread.launch();
+ * \endcode
+ */
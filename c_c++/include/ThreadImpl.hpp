@@ -3,6 +3,7 @@
 
 #include <Config.hpp>
 #include <NonCopyable.hpp>
+#include <Time.hpp>
 #include <pthread.h>
 
 /**
@@ -11,6 +12,7 @@
 namespace cr
 {
 class Thread;
+struct ThreadAttributes;
 
 namespace priv
 {
@@ -22,11 +24,19 @@ class ThreadImpl : NonCopyable
 {
 public:
 	/**
-	 * \brief Default constructor, lauch the thread
+	 * \brief Default constructor, no thread running
+	 */
+	ThreadImpl();
+
+	/**
+	 * \brief Launch the thread
 	 *
-	 * \param owner The Thread instance to run
+	 * \param owner      The Thread instance to run
+	 * \param attributes Attributes of the thread, NULL for the defaults
+	 *
+	 * \return True if the thread was started
 	 */
-	ThreadImpl(Thread * owner);
+	bool launch(Thread * owner, const ThreadAttributes * attributes);
 
 	/**
 	 * \brief Wait until the thread finishes
@@ -34,9 +44,13 @@ public:
 	void wait();
 
 	/**
-	 * \brief Terminate the thread
+	 * \brief Wait until the thread finishes, at most a given time
+	 *
+	 * \param timeout Maximum time to wait
+	 *
+	 * \return True if the thread finished (or was not running)
 	 */
-	void terminate();
+	bool wait(Time timeout);
 
 private:
 
@@ -0,0 +1,164 @@
+#ifndef __CRCR_THREAD_POOL_HPP__
+#define __CRCR_THREAD_POOL_HPP__
+
+#include <ConditionVariable.hpp>
+#include <Mutex.hpp>
+#include <NonCopyable.hpp>
+#include <Thread.hpp>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+namespace priv
+{
+	struct PoolTask;
+}
+
+/**
+ * \brief Fixed set of worker threads running queued tasks
+ *
+ * Launching a cr::Thread per task costs a pthread_create and a
+ * pthread_join each time ; the workers of a pool are created
+ * once and take the tasks from a shared queue, in order.
+ *
+ * The queue can be bounded : submitting to a full queue blocks
+ * until a worker takes a task, so that fast producers are slowed
+ * down instead of filling the memory.
+ *
+ * A task must not wait for another task of the same pool when
+ * all the workers could be waiting that way (deadlock).
+ */
+class ThreadPool : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Create the pool and start its workers
+	 *
+	 * \param threadCount   Number of workers, 0 for one per core
+	 * \param queueCapacity Maximum number of queued tasks, 0 for no limit
+	 */
+	explicit ThreadPool(std::size_t threadCount = 0, std::size_t queueCapacity = 0);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Call shutdown() : the queued tasks are run first.
+	 */
+	~ThreadPool();
+
+	/**
+	 * \brief Queue a task, and get a handle on its result
+	 *
+	 * The handle's get() returns the value returned by the task,
+	 * or throws the exception it threw. After shutdown() the task
+	 * is not run and get() throws std::future_error.
+	 *
+	 * \param function Callable without argument
+	 *
+	 * \return Handle on the result of the task
+	 */
+	template <typename F>
+	std::future<typename std::result_of<typename std::decay<F>::type()>::type> submit(F&& function);
+
+	/**
+	 * \brief Queue a task whose result is not needed
+	 *
+	 * Cheaper than submit() : no shared state is created. An
+	 * exception thrown by the task is reported to std::cerr.
+	 *
+	 * \param function Callable without argument
+	 *
+	 * \return False if the pool is shut down
+	 */
+	template <typename F>
+	bool execute(F&& function);
+
+	/**
+	 * \brief Stop the pool
+	 *
+	 * The tasks already queued are run, then the workers
+	 * finish ; new tasks are refused. Can't be called from a
+	 * task of the pool.
+	 */
+	void shutdown();
+
+	/**
+	 * \brief Tell whether the pool accepts new tasks
+	 */
+	bool isRunning() const;
+
+	/**
+	 * \brief Get the number of workers
+	 *
+	 * \return Number of workers, 0 after shutdown()
+	 */
+	std::size_t getThreadCount() const;
+
+	/**
+	 * \brief Get the number of tasks waiting for a worker
+	 */
+	std::size_t getQueueSize() const;
+
+	/**
+	 * \brief Get the maximum number of queued tasks
+	 *
+	 * \return Capacity of the queue, 0 if unbounded
+	 */
+	std::size_t getQueueCapacity() const;
+
+private:
+
+	/**
+	 * \brief Queue a task, waiting for room if the queue is full
+	 *
+	 * \return False if the pool is shut down (the task is then deleted)
+	 */
+	bool push(priv::PoolTask* task);
+
+	/**
+	 * \brief Entry point of the workers
+	 */
+	void work();
+
+	/**
+	 * \brief Member data
+	 */
+	std::vector<Thread*>        m_workers;    /**< worker threads */
+	std::deque<priv::PoolTask*> m_queue;      /**< tasks waiting for a worker */
+	std::size_t                 m_capacity;   /**< maximum size of the queue, 0 if unbounded */
+	bool                        m_isRunning;  /**< are new tasks accepted? */
+	mutable Mutex               m_mutex;      /**< protects the queue and the state */
+	ConditionVariable           m_notEmpty;   /**< signaled when a task is queued */
+	ConditionVariable           m_notFull;    /**< signaled when a task is taken */
+};
+
+#include <ThreadPool.inl>
+
+} // namespace cr
+
+#endif // __CRCR_THREAD_POOL_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::ThreadPool pool(4, 1024);
+ *
+ * std::future<int> result = pool.submit([]() { return compute(); });
+ * pool.execute([]() { log("fire and forget"); });
+ *
+ * int value = result.get();
+ * pool.shutdown();
+ * \endcode
+ */
@@ -0,0 +1,62 @@
+namespace priv
+{
+    /*
+     * Base class for the queued tasks
+     */
+    struct PoolTask
+    {
+        virtual ~PoolTask() {}
+        virtual void run() = 0;
+    };
+
+    /*
+     * Task without result
+     */
+    template <typename F>
+    struct PoolFunctor : PoolTask
+    {
+        template <typename G>
+        explicit PoolFunctor(G&& function) : m_function(std::forward<G>(function)) {}
+
+        virtual void run() { m_function(); }
+
+        F m_function;
+    };
+
+    /*
+     * Task whose result is stored in a shared state
+     */
+    template <typename R>
+    struct PoolPackagedTask : PoolTask
+    {
+        template <typename G>
+        explicit PoolPackagedTask(G&& function) : m_task(std::forward<G>(function)) {}
+
+        virtual void run() { m_task(); }
+
+        std::packaged_task<R()> m_task;
+    };
+} // namespace priv
+
+template <typename F>
+std::future<typename std::result_of<typename std::decay<F>::type()>::type> ThreadPool::submit(F&& function)
+{
+    typedef typename std::result_of<typename std::decay<F>::type()>::type Result;
+
+    priv::PoolPackagedTask<Result>* task = new priv::PoolPackagedTask<Result>(std::forward<F>(function));
+    std::future<Result> result = task->m_task.get_future();
+
+    /*
+     * A refused task is deleted without being run : its
+     * shared state then holds a broken promise
+     */
+    push(task);
+
+    return result;
+}
+
+template <typename F>
+bool ThreadPool::execute(F&& function)
+{
+    return push(new priv::PoolFunctor<typename std::decay<F>::type>(std::forward<F>(function)));
+}
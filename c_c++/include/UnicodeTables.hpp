@@ -0,0 +1,284 @@
+#ifndef __CRCR_UNICODE_TABLES_HPP__
+#define __CRCR_UNICODE_TABLES_HPP__
+
+#include <Config.hpp>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+namespace priv
+{
+	/**
+	 * \brief Lookup tables generated from the Unicode character database
+	 *
+	 * The tables are generated by tools/gen_unicode_tables.py, they
+	 * are split in blocks of consecutive code points so that
+	 * identical blocks (most of the code space) are stored once.
+	 */
+
+	/**
+	 * \brief Simple case mappings of a code point, as deltas
+	 */
+	struct CaseRecord
+	{
+		Int32 lower;  /**< lowercase mapping minus the code point */
+		Int32 upper;  /**< uppercase mapping minus the code point */
+		Int32 fold;   /**< case folding minus the code point */
+	};
+
+	const Uint32 CaseBlockShift = 7;        /**< log2 of the number of code points per block */
+	extern const Uint32     CaseTableLimit; /**< code points from here on have no mapping */
+	extern const CaseRecord CaseRecords[];  /**< distinct mappings, the first one is the identity */
+	extern const Uint8      CaseStage1[];   /**< block of each range of code points */
+	extern const Uint8      CaseStage2[];   /**< record of each code point, by block */
+
+	/**
+	 * \brief Get the case mappings of a code point
+	 *
+	 * \param codepoint Code point to look up
+	 *
+	 * \return Case mappings of \a codepoint
+	 */
+	inline const CaseRecord& getCaseRecord(Uint32 codepoint)
+	{
+		if (codepoint >= CaseTableLimit)
+			return CaseRecords[0];
+
+		Uint32 block = CaseStage1[codepoint >> CaseBlockShift];
+		Uint32 mask = (1u << CaseBlockShift) - 1;
+
+		return CaseRecords[CaseStage2[(block << CaseBlockShift) | (codepoint & mask)]];
+	}
+
+	/**
+	 * \brief Normalization properties of a code point
+	 */
+	struct NormRecord
+	{
+		Uint8 ccc;    /**< canonical combining class */
+		Uint8 flags;  /**< combination of NormFlags */
+	};
+
+	/**
+	 * \brief Quick check properties (see UAX #15)
+	 */
+	enum NormFlags
+	{
+		NfdNo      = 1 << 0,  /**< has a canonical decomposition */
+		NfkdNo     = 1 << 1,  /**< has a canonical or compatibility decomposition */
+		NfcNo      = 1 << 2,  /**< never appears in NFC */
+		NfcMaybe   = 1 << 3,  /**< may combine with a previous character in NFC */
+		NfkcNo     = 1 << 4,  /**< never appears in NFKC */
+		NfkcMaybe  = 1 << 5   /**< may combine with a previous character in NFKC */
+	};
+
+	const Uint32 NormBlockShift = 6;         /**< log2 of the number of code points per block */
+	extern const Uint32     NormTableLimit;  /**< code points from here on are starters without decomposition */
+	extern const NormRecord NormRecords[];   /**< distinct properties, the first one is the default */
+	extern const Uint8      NormStage1[];    /**< block of each range of code points */
+	extern const Uint8      NormStage2[];    /**< record of each code point, by block */
+
+	/**
+	 * Full decompositions are stored in a shared pool of code
+	 * points; each index entry is (offset << 5) | length. The
+	 * compatibility table only holds the code points whose
+	 * compatibility decomposition differs from the canonical one.
+	 */
+	extern const Uint32 DecompositionPool[];    /**< decomposed code points */
+	extern const Uint32 CanonicalCount;         /**< number of canonical decompositions */
+	extern const Uint32 CanonicalCodepoints[];  /**< sorted decomposable code points */
+	extern const Uint32 CanonicalIndex[];       /**< position of each decomposition in the pool */
+	extern const Uint32 CompatCount;            /**< number of compatibility decompositions */
+	extern const Uint32 CompatCodepoints[];     /**< sorted decomposable code points */
+	extern const Uint32 CompatIndex[];          /**< position of each decomposition in the pool */
+
+	extern const Uint32 CompositionCount;       /**< number of primary composites */
+	extern const Uint64 CompositionKeys[];      /**< sorted (first << 32) | second pairs */
+	extern const Uint32 CompositionValues[];    /**< composite of each pair */
+
+	/**
+	 * \brief Get the normalization properties of a code point
+	 *
+	 * \param codepoint Code point to look up
+	 *
+	 * \return Normalization properties of \a codepoint
+	 */
+	inline const NormRecord& getNormRecord(Uint32 codepoint)
+	{
+		if (codepoint >= NormTableLimit)
+			return NormRecords[0];
+
+		Uint32 block = NormStage1[codepoint >> NormBlockShift];
+		Uint32 mask = (1u << NormBlockShift) - 1;
+
+		return NormRecords[NormStage2[(block << NormBlockShift) | (codepoint & mask)]];
+	}
+
+	/**
+	 * \brief Grapheme_Cluster_Break values (UAX #29)
+	 */
+	enum GraphemeClass
+	{
+		GraphemeOther,
+		GraphemeCR,
+		GraphemeLF,
+		GraphemeControl,
+		GraphemeExtend,
+		GraphemeZWJ,
+		GraphemeRegionalIndicator,
+		GraphemePrepend,
+		GraphemeSpacingMark,
+		GraphemeL,
+		GraphemeV,
+		GraphemeT,
+		GraphemeLV,
+		GraphemeLVT
+	};
+
+	/**
+	 * \brief Word_Break values (UAX #29)
+	 */
+	enum WordClass
+	{
+		WordOther,
+		WordCR,
+		WordLF,
+		WordNewline,
+		WordExtend,
+		WordZWJ,
+		WordRegionalIndicator,
+		WordFormat,
+		WordKatakana,
+		WordHebrewLetter,
+		WordALetter,
+		WordSingleQuote,
+		WordDoubleQuote,
+		WordMidNumLet,
+		WordMidLetter,
+		WordMidNum,
+		WordNumeric,
+		WordExtendNumLet,
+		WordWSegSpace
+	};
+
+	/**
+	 * \brief Other segmentation properties
+	 */
+	enum SegmentFlags
+	{
+		SegmentPictographic  = 1 << 0,  /**< Extended_Pictographic */
+		SegmentAlphanumeric  = 1 << 1   /**< letter or number (general category L* or N*) */
+	};
+
+	/**
+	 * \brief Segmentation properties of a code point
+	 */
+	struct SegmentRecord
+	{
+		Uint8 grapheme;  /**< GraphemeClass */
+		Uint8 word;      /**< WordClass */
+		Uint8 flags;     /**< combination of SegmentFlags */
+	};
+
+	const Uint32 SegmentBlockShift = 7;          /**< log2 of the number of code points per block */
+	extern const Uint32        SegmentTableLimit; /**< code points from here on have the default properties */
+	extern const SegmentRecord SegmentRecords[];  /**< distinct properties, the first one is the default */
+	extern const Uint8         SegmentStage1[];   /**< block of each range of code points */
+	extern const Uint8         SegmentStage2[];   /**< record of each code point, by block */
+
+	/**
+	 * Rules GB3 to GB9b as a table : bit \a right of GraphemeNoBreak[left]
+	 * is set when there is no boundary between the two classes.
+	 * The rules which need more context (GB11 to GB13) are applied
+	 * by the iterator.
+	 */
+	extern const Uint16 GraphemeNoBreak[];
+
+	/**
+	 * \brief Get the segmentation properties of a code point
+	 *
+	 * \param codepoint Code point to look up
+	 *
+	 * \return Segmentation properties of \a codepoint
+	 */
+	inline const SegmentRecord& getSegmentRecord(Uint32 codepoint)
+	{
+		if (codepoint >= SegmentTableLimit)
+			return SegmentRecords[0];
+
+		Uint32 block = SegmentStage1[codepoint >> SegmentBlockShift];
+		Uint32 mask = (1u << SegmentBlockShift) - 1;
+
+		return SegmentRecords[SegmentStage2[(block << SegmentBlockShift) | (codepoint & mask)]];
+	}
+
+	/**
+	 * Collation elements of the DUCET (UTS #10) are packed in 32 bits :
+	 * primary weight (bits 16 to 31), secondary weight (bits 7 to 15),
+	 * tertiary weight (bits 2 to 6) and variable flag (bit 0).
+	 *
+	 * The mapping of a code point (or of a contraction) is
+	 * (offset << 8) | (count << 1) | contraction : \a count elements
+	 * from \a offset in CollationElements ; the contraction bit tells
+	 * that longer sequences starting with the code point have their
+	 * own mapping. A mapping of 0 means that the code point has
+	 * implicit weights.
+	 */
+
+	/**
+	 * \brief Mapping of a sequence of code points
+	 */
+	struct ContractionRecord
+	{
+		Uint32 codepoints[3];  /**< code points of the sequence, padded with 0 */
+		Uint32 mapping;        /**< collation elements of the sequence */
+	};
+
+	/**
+	 * \brief Range of code points with computed (implicit) weights
+	 */
+	struct ImplicitRange
+	{
+		Uint32 first;   /**< first code point of the range */
+		Uint32 last;    /**< last code point of the range */
+		Uint32 base;    /**< base of the first primary weight */
+		Uint32 origin;  /**< first code point of the script (siniform scripts), 0 for Han */
+	};
+
+	const Uint32 CollationBlockShift = 7;                 /**< log2 of the number of code points per block */
+	extern const Uint32            CollationTableLimit;   /**< code points from here on have implicit weights */
+	extern const Uint32            CollationElements[];   /**< packed collation elements */
+	extern const Uint32            CollationMappings[];   /**< distinct mappings, the first one is 0 */
+	extern const Uint16            CollationStage1[];     /**< block of each range of code points */
+	extern const Uint16            CollationStage2[];     /**< mapping of each code point, by block */
+	extern const Uint32            ContractionCount;      /**< number of contractions */
+	extern const ContractionRecord Contractions[];        /**< contractions, sorted by code points */
+	extern const Uint32            ImplicitRangeCount;    /**< number of implicit weight ranges */
+	extern const ImplicitRange     ImplicitRanges[];      /**< implicit weight ranges, sorted */
+
+	/**
+	 * \brief Get the collation mapping of a code point
+	 *
+	 * \param codepoint Code point to look up
+	 *
+	 * \return Mapping of \a codepoint, 0 if it has implicit weights
+	 */
+	inline Uint32 getCollationMapping(Uint32 codepoint)
+	{
+		if (codepoint >= CollationTableLimit)
+			return 0;
+
+		Uint32 block = CollationStage1[codepoint >> CollationBlockShift];
+		Uint32 mask = (1u << CollationBlockShift) - 1;
+
+		return CollationMappings[CollationStage2[(block << CollationBlockShift) | (codepoint & mask)]];
+	}
+
+} // namespace priv
+
+} // namespace cr
+
+#endif // __CRCR_UNICODE_TABLES_HPP__
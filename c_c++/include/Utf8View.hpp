@@ -0,0 +1,185 @@
+#ifndef __CRCR_UTF8_VIEW_HPP__
+#define __CRCR_UTF8_VIEW_HPP__
+
+#include <String.hpp>
+#include <Config.hpp>
+#include <cstddef>
+#include <string>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+namespace priv
+{
+	/**
+	 * \brief Get the size of a UTF-8 sequence from its lead byte
+	 *
+	 * Well-formed byte sequences (Unicode table 3-7) : the range of
+	 * the second byte depends on the lead byte, the other trailing
+	 * bytes are in [0x80, 0xBF]. This rejects the overlong forms,
+	 * the surrogates and the code points past U+10FFFF.
+	 *
+	 * \param lead First byte of the sequence
+	 * \param low  Receives the lowest valid second byte
+	 * \param high Receives the highest valid second byte
+	 *
+	 * \return Number of bytes of the sequence, 0 if the byte can't start one
+	 */
+	std::size_t getUtf8Size(Uint8 lead, Uint8& low, Uint8& high);
+
+	/**
+	 * \brief Decode a UTF-8 sequence, replacing it if it is malformed
+	 *
+	 * A malformed sequence gives a single U+FFFD, and only its
+	 * valid beginning is consumed (at least one byte) : the byte
+	 * which breaks it is decoded next, so that a stray byte never
+	 * swallows a line end or the character after it.
+	 *
+	 * \param begin Start of the sequence (not end), moved past it
+	 * \param end   End of the bytes
+	 *
+	 * \return Code point, 0xFFFD for a malformed sequence
+	 */
+	Uint32 decodeUtf8(const Uint8*& begin, const Uint8* end);
+}
+
+/**
+ * \brief Read-only, non-owning view on UTF-8 encoded bytes
+ *
+ * cr::Utf8View is the UTF-8 counterpart of cr::StringView :
+ * a pointer and a size, typically on a file mapped in memory
+ * (cr::MappedFile) or on a network buffer. The bytes are not
+ * decoded until toString() is called, so that scanning or
+ * forwarding them costs nothing.
+ */
+class Utf8View
+{
+public:
+
+	typedef const char* ConstIterator; /**< read-only */
+
+	/**
+	 * \brief Default constructor
+	 *
+	 * create an empty view
+	 */
+	Utf8View();
+
+	/**
+	 * \brief Construct a view on a range of bytes
+	 *
+	 * \param data Pointer to the first byte
+	 * \param size Number of bytes
+	 */
+	Utf8View(const char* data, std::size_t size);
+
+	/**
+	 * \brief Construct a view on the bytes of a std::string
+	 *
+	 * \param str String to refer to
+	 */
+	Utf8View(const std::string& str);
+
+	/**
+	 * \brief Get the size of the view
+	 *
+	 * \return Number of bytes in the view
+	 */
+	std::size_t getSize() const;
+
+	/**
+	 * \brief Check whether the view is empty or not
+	 *
+	 * \return True if the view is empty
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * \brief Get a pointer to the bytes of the view
+	 *
+	 * The bytes are not null-terminated.
+	 *
+	 * \return Pointer to the first byte
+	 */
+	const char* getData() const;
+
+	/**
+	 * \brief Return an iterator to the beginning of the view
+	 */
+	ConstIterator begin() const;
+
+	/**
+	 * \brief Return an iterator to the end of the view
+	 */
+	ConstIterator end() const;
+
+	/**
+	 * \brief Get a part of the view
+	 *
+	 * \param position Position of the first byte (clamped to the end)
+	 * \param length   Number of bytes, truncated at the end of the view
+	 *
+	 * \return View on the bytes [position, position + length)
+	 */
+	Utf8View substring(std::size_t position, std::size_t length = static_cast<std::size_t>(-1)) const;
+
+	/**
+	 * \brief Tell whether the view starts with a byte order mark (EF BB BF)
+	 */
+	bool hasBom() const;
+
+	/**
+	 * \brief Get the view without its byte order mark, if it has one
+	 */
+	Utf8View skipBom() const;
+
+	/**
+	 * \brief Check that the bytes are well-formed UTF-8
+	 *
+	 * Overlong forms, surrogates, code points past U+10FFFF and
+	 * truncated sequences are rejected.
+	 *
+	 * \return True if the whole view is valid UTF-8
+	 */
+	bool isValid() const;
+
+	/**
+	 * \brief Decode the view into a cr::String
+	 *
+	 * The whole view is decoded in one pass by
+	 * cr::StringBuilder::appendUtf8, into a buffer allocated once.
+	 * Each malformed sequence is decoded as U+FFFD.
+	 *
+	 * \return Decoded string
+	 */
+	String toString() const;
+
+private:
+
+	/**
+	 * \brief Member data
+	 */
+	const char* m_data;  /**< first byte */
+	std::size_t m_size;  /**< number of bytes */
+};
+
+#include <Utf8View.inl>
+
+} // namespace cr
+
+#endif // __CRCR_UTF8_VIEW_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::Utf8View view(buffer, size);
+ *
+ * if (view.isValid())
+ *     cr::String text = view.skipBom().toString();
+ * \endcode
+ */
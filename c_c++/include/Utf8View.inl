@@ -0,0 +1,119 @@
+namespace priv
+{
+    inline std::size_t getUtf8Size(Uint8 lead, Uint8& low, Uint8& high)
+    {
+        low = 0x80;
+        high = 0xBF;
+
+        if (lead < 0x80)
+            return 1;
+
+        if (lead >= 0xC2 && lead <= 0xDF)
+            return 2;
+
+        if (lead >= 0xE0 && lead <= 0xEF)
+        {
+            if (lead == 0xE0) low = 0xA0;
+            if (lead == 0xED) high = 0x9F;
+            return 3;
+        }
+
+        if (lead >= 0xF0 && lead <= 0xF4)
+        {
+            if (lead == 0xF0) low = 0x90;
+            if (lead == 0xF4) high = 0x8F;
+            return 4;
+        }
+
+        return 0;
+    }
+
+    inline Uint32 decodeUtf8(const Uint8*& begin, const Uint8* end)
+    {
+        Uint8 low;
+        Uint8 high;
+        std::size_t size = getUtf8Size(*begin, low, high);
+
+        Uint32 codepoint = *begin++;
+        if (size <= 1)
+            return size == 1 ? codepoint : 0xFFFD;
+
+        codepoint &= 0x3F >> (size - 1);
+        for (std::size_t i = 1; i < size; ++i)
+        {
+            if (begin == end || *begin < low || *begin > high)
+                return 0xFFFD;
+
+            codepoint = (codepoint << 6) | (*begin++ & 0x3F);
+            low = 0x80;
+            high = 0xBF;
+        }
+
+        return codepoint;
+    }
+} // namespace priv
+
+inline Utf8View::Utf8View() :
+    m_data(NULL),
+    m_size(0)
+{
+}
+
+inline Utf8View::Utf8View(const char* data, std::size_t size) :
+    m_data(data),
+    m_size(size)
+{
+}
+
+inline Utf8View::Utf8View(const std::string& str) :
+    m_data(str.data()),
+    m_size(str.size())
+{
+}
+
+inline std::size_t Utf8View::getSize() const
+{
+    return m_size;
+}
+
+inline bool Utf8View::isEmpty() const
+{
+    return m_size == 0;
+}
+
+inline const char* Utf8View::getData() const
+{
+    return m_data;
+}
+
+inline Utf8View::ConstIterator Utf8View::begin() const
+{
+    return m_data;
+}
+
+inline Utf8View::ConstIterator Utf8View::end() const
+{
+    return m_data + m_size;
+}
+
+inline Utf8View Utf8View::substring(std::size_t position, std::size_t length) const
+{
+    if (position > m_size)
+        position = m_size;
+
+    std::size_t available = m_size - position;
+    return Utf8View(m_data + position, length < available ? length : available);
+}
+
+inline bool Utf8View::hasBom() const
+{
+    return m_size >= 3 &&
+           static_cast<Uint8>(m_data[0]) == 0xEF &&
+           static_cast<Uint8>(m_data[1]) == 0xBB &&
+           static_cast<Uint8>(m_data[2]) == 0xBF;
+}
+
+inline Utf8View Utf8View::skipBom() const
+{
+    return hasBom() ? Utf8View(m_data + 3, m_size - 3) : *this;
+}
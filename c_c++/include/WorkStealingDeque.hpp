@@ -0,0 +1,148 @@
+#ifndef __CRCR_WORK_STEALING_DEQUE_HPP__
+#define __CRCR_WORK_STEALING_DEQUE_HPP__
+
+#include <Config.hpp>
+#include <NonCopyable.hpp>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * \brief namespace : cr(CloudRain21) (my private library)
+ */
+namespace cr
+{
+
+/**
+ * \brief Chase-Lev work-stealing deque
+ *
+ * The owner thread pushes and pops at the bottom (LIFO, the most
+ * recent task, whose data is still in cache) ; any other thread
+ * steals at the top (FIFO, the oldest task, usually the largest
+ * in a recursive decomposition). Owner operations don't use any
+ * atomic read-modify-write except when a single element is left ;
+ * a steal is one compare-and-swap.
+ *
+ * The memory orderings follow "Correct and Efficient Work-Stealing
+ * for Weak Memory Models" (Le, Pop, Cohen, Zappa Nardelli, 2013).
+ * The array grows as needed ; the old arrays, which a thief may
+ * still read, are only freed with the deque.
+ *
+ * T must be trivially copyable, typically a pointer.
+ */
+template <typename T>
+class WorkStealingDeque : NonCopyable
+{
+public:
+
+	/**
+	 * \brief Construct an empty deque
+	 *
+	 * \param capacity Initial capacity, rounded to a power of two
+	 */
+	explicit WorkStealingDeque(std::size_t capacity = 256);
+
+	/**
+	 * \brief Destructor
+	 */
+	~WorkStealingDeque();
+
+	/**
+	 * \brief Add an element at the bottom (owner thread only)
+	 *
+	 * \param value Element to add
+	 */
+	void push(T value);
+
+	/**
+	 * \brief Remove the element at the bottom (owner thread only)
+	 *
+	 * \param value Receives the element
+	 *
+	 * \return False if the deque is empty
+	 */
+	bool pop(T& value);
+
+	/**
+	 * \brief Remove the element at the top (any thread)
+	 *
+	 * \param value Receives the element
+	 *
+	 * \return False if the deque is empty, or another thread
+	 *         took the element first
+	 */
+	bool steal(T& value);
+
+	/**
+	 * \brief Tell whether the deque looks empty
+	 *
+	 * The result may already be wrong when the function returns.
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * \brief Get the approximate number of elements
+	 */
+	std::size_t getSize() const;
+
+private:
+
+	/**
+	 * \brief Circular array of elements
+	 */
+	struct Array
+	{
+		explicit Array(Int64 capacity);
+		~Array();
+
+		T    get(Int64 index) const;
+		void put(Int64 index, T value);
+
+		Int64           capacity;  /**< power of two */
+		Int64           mask;      /**< capacity - 1 */
+		std::atomic<T>* elements;  /**< elements, read concurrently by the thieves */
+	};
+
+	/**
+	 * \brief Replace the array by one twice as large
+	 */
+	Array* grow(Array* array, Int64 bottom, Int64 top);
+
+	/**
+	 * \brief Member data
+	 *
+	 * top and bottom are on separate cache lines : the thieves
+	 * write the former, the owner the latter
+	 */
+	std::atomic<Int64>  m_top;                       /**< next element to steal */
+	char                m_padding[64 - sizeof(Int64)];  /**< keeps m_top alone on its cache line */
+	std::atomic<Int64>  m_bottom;                    /**< next free slot of the owner */
+	std::atomic<Array*> m_array;                     /**< current array */
+	std::vector<Array*> m_garbage;                   /**< replaced arrays */
+};
+
+#include <WorkStealingDeque.inl>
+
+} // namespace cr
+
+#endif // __CRCR_WORK_STEALING_DEQUE_HPP__
+
+
+/**
+ * \brief How to use
+ *
+ * \code
+ * cr::WorkStealingDeque<Task*> deque;
+ *
+ * // owner thread
+ * deque.push(task);
+ * Task* next;
+ * if (deque.pop(next))
+ *     next->run();
+ *
+ * // other threads
+ * Task* stolen;
+ * if (deque.steal(stolen))
+ *     stolen->run();
+ * \endcode
+ */
@@ -0,0 +1,134 @@
+template <typename T>
+WorkStealingDeque<T>::Array::Array(Int64 capacity_) :
+    capacity(capacity_),
+    mask    (capacity_ - 1),
+    elements(new std::atomic<T>[capacity_])
+{
+}
+
+template <typename T>
+WorkStealingDeque<T>::Array::~Array()
+{
+    delete [] elements;
+}
+
+template <typename T>
+T WorkStealingDeque<T>::Array::get(Int64 index) const
+{
+    return elements[index & mask].load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void WorkStealingDeque<T>::Array::put(Int64 index, T value)
+{
+    elements[index & mask].store(value, std::memory_order_relaxed);
+}
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(std::size_t capacity) :
+    m_top   (0),
+    m_bottom(0),
+    m_array (NULL)
+{
+    Int64 size = 2;
+    while (size < static_cast<Int64>(capacity))
+        size *= 2;
+
+    m_array.store(new Array(size), std::memory_order_relaxed);
+}
+
+template <typename T>
+WorkStealingDeque<T>::~WorkStealingDeque()
+{
+    delete m_array.load(std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < m_garbage.size(); ++i)
+        delete m_garbage[i];
+}
+
+template <typename T>
+void WorkStealingDeque<T>::push(T value)
+{
+    Int64 bottom = m_bottom.load(std::memory_order_relaxed);
+    Int64 top = m_top.load(std::memory_order_acquire);
+    Array* array = m_array.load(std::memory_order_relaxed);
+
+    if (bottom - top > array->capacity - 1)
+        array = grow(array, bottom, top);
+
+    array->put(bottom, value);
+    m_bottom.store(bottom + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::pop(T& value)
+{
+    Int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    Array* array = m_array.load(std::memory_order_relaxed);
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Int64 top = m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        /*
+         * Empty
+         */
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    value = array->get(bottom);
+    if (top < bottom)
+        return true;
+
+    /*
+     * Last element : race against the thieves
+     */
+    bool taken = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+    return taken;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::steal(T& value)
+{
+    Int64 top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+        return false;
+
+    Array* array = m_array.load(std::memory_order_acquire);
+    value = array->get(top);
+
+    return m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::isEmpty() const
+{
+    return m_bottom.load(std::memory_order_relaxed) <= m_top.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+std::size_t WorkStealingDeque<T>::getSize() const
+{
+    Int64 size = m_bottom.load(std::memory_order_relaxed) - m_top.load(std::memory_order_relaxed);
+    return size > 0 ? static_cast<std::size_t>(size) : 0;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::Array* WorkStealingDeque<T>::grow(Array* array, Int64 bottom, Int64 top)
+{
+    Array* larger = new Array(array->capacity * 2);
+    for (Int64 i = top; i < bottom; ++i)
+        larger->put(i, array->get(i));
+
+    m_garbage.push_back(array);
+    m_array.store(larger, std::memory_order_release);
+
+    return larger;
+}
@@ -0,0 +1,83 @@
+#include <AsyncFile.hpp>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cr
+{
+
+    AsyncFile::AsyncFile(IoRing& ring) :
+        m_ring(ring),
+        m_file(-1)
+    {
+    }
+
+    AsyncFile::~AsyncFile()
+    {
+        close();
+    }
+
+    bool AsyncFile::open(const std::string& filename, Mode mode, bool direct)
+    {
+        close();
+
+        int flags = O_CLOEXEC | (direct ? O_DIRECT : 0);
+        switch (mode)
+        {
+            case Read:  flags |= O_RDONLY; break;
+            case Write: flags |= O_WRONLY | O_CREAT | O_TRUNC; break;
+            default:    flags |= O_RDWR | O_CREAT; break;
+        }
+
+        m_file = ::open(filename.c_str(), flags, 0644);
+        if (m_file < 0)
+        {
+            std::cerr << "Failed to open file \"" << filename << "\" (" << std::strerror(errno) << ")" << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    void AsyncFile::close()
+    {
+        if (m_file >= 0)
+        {
+            ::close(m_file);
+            m_file = -1;
+        }
+    }
+
+    bool AsyncFile::isOpen() const
+    {
+        return m_file >= 0;
+    }
+
+    Uint64 AsyncFile::getSize() const
+    {
+        struct stat status;
+        if (m_file < 0 || fstat(m_file, &status) != 0)
+            return 0;
+
+        return static_cast<Uint64>(status.st_size);
+    }
+
+    int AsyncFile::getDescriptor() const
+    {
+        return m_file;
+    }
+
+    bool AsyncFile::read(void* buffer, std::size_t size, Uint64 offset, Uint64 userData)
+    {
+        return m_file >= 0 && m_ring.prepareRead(m_file, buffer, size, offset, userData);
+    }
+
+    bool AsyncFile::write(const void* buffer, std::size_t size, Uint64 offset, Uint64 userData)
+    {
+        return m_file >= 0 && m_ring.prepareWrite(m_file, buffer, size, offset, userData);
+    }
+
+} // namespace cr
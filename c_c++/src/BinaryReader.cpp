@@ -0,0 +1,116 @@
+#include <BinaryReader.hpp>
+#include <StringBuilder.hpp>
+
+namespace cr
+{
+
+    BinaryReader::BinaryReader(const char* data, std::size_t size) :
+        m_data    (data),
+        m_size    (size),
+        m_position(0),
+        m_isValid (true)
+    {
+    }
+
+    bool BinaryReader::readUint(Uint64& value)
+    {
+        if (!m_isValid)
+            return false;
+
+        const Uint8* bytes = reinterpret_cast<const Uint8*>(m_data);
+
+        /*
+         * Most values are small : one byte
+         */
+        if (m_position < m_size && bytes[m_position] < 0x80)
+        {
+            value = bytes[m_position++];
+            return true;
+        }
+
+        Uint64 result = 0;
+        for (unsigned int shift = 0; m_position < m_size && shift < 64; shift += 7)
+        {
+            Uint8 byte = bytes[m_position++];
+            result |= static_cast<Uint64>(byte & 0x7F) << shift;
+
+            if (byte < 0x80)
+            {
+                /*
+                 * The tenth byte only holds the highest bit
+                 */
+                if (shift == 63 && byte > 1)
+                    break;
+
+                value = result;
+                return true;
+            }
+        }
+
+        m_isValid = false;
+        return false;
+    }
+
+    bool BinaryReader::readInt(Int64& value)
+    {
+        Uint64 bits;
+        if (!readUint(bits))
+            return false;
+
+        value = static_cast<Int64>((bits >> 1) ^ (~(bits & 1) + 1));
+        return true;
+    }
+
+    bool BinaryReader::readUtf8(Utf8View& text)
+    {
+        Uint64 size;
+        if (!readUint(size))
+            return false;
+
+        if (size > m_size - m_position)
+        {
+            m_isValid = false;
+            return false;
+        }
+
+        text = Utf8View(m_data + m_position, static_cast<std::size_t>(size));
+        m_position += static_cast<std::size_t>(size);
+        return true;
+    }
+
+    bool BinaryReader::readString(String& str)
+    {
+        Utf8View text;
+        if (!readUtf8(text))
+            return false;
+
+        str = StringBuilder(text.getSize()).appendUtf8(text.getData(), text.getSize()).build();
+        return true;
+    }
+
+    bool BinaryReader::readTime(Time& time)
+    {
+        Int64 value;
+        if (!readInt(value))
+            return false;
+
+        time = microseconds(value);
+        return true;
+    }
+
+    bool BinaryReader::isValid() const
+    {
+        return m_isValid;
+    }
+
+    bool BinaryReader::endOfData() const
+    {
+        return m_position >= m_size;
+    }
+
+    std::size_t BinaryReader::getPosition() const
+    {
+        return m_position;
+    }
+
+} // namespace cr
@@ -0,0 +1,156 @@
+#include <BinaryWriter.hpp>
+#include <cstring>
+
+namespace
+{
+    /*
+     * Number of UTF-8 bytes of a code point, invalid ones
+     * being replaced by U+FFFD
+     */
+    inline std::size_t getUtf8Size(cr::Uint32 c)
+    {
+        if (c < 0x80)
+            return 1;
+        if (c < 0x800)
+            return 2;
+        if (c < 0x10000 || c > 0x10FFFF)
+            return 3;
+        return 4;
+    }
+
+    inline char* encodeUtf8(cr::Uint32 c, char* output)
+    {
+        if ((c >= 0xD800 && c <= 0xDFFF) || c > 0x10FFFF)
+            c = 0xFFFD;
+
+        if (c < 0x80)
+        {
+            *output++ = static_cast<char>(c);
+        }
+        else if (c < 0x800)
+        {
+            *output++ = static_cast<char>(0xC0 | (c >> 6));
+            *output++ = static_cast<char>(0x80 | (c & 0x3F));
+        }
+        else if (c < 0x10000)
+        {
+            *output++ = static_cast<char>(0xE0 | (c >> 12));
+            *output++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            *output++ = static_cast<char>(0x80 | (c & 0x3F));
+        }
+        else
+        {
+            *output++ = static_cast<char>(0xF0 | (c >> 18));
+            *output++ = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+            *output++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            *output++ = static_cast<char>(0x80 | (c & 0x3F));
+        }
+
+        return output;
+    }
+
+} // namespace
+
+
+namespace cr
+{
+
+    BinaryWriter::BinaryWriter(std::size_t capacity)
+    {
+        m_data.reserve(capacity);
+    }
+
+    BinaryWriter& BinaryWriter::writeUint(Uint64 value)
+    {
+        char bytes[10];
+        std::size_t size = 0;
+
+        while (value >= 0x80)
+        {
+            bytes[size++] = static_cast<char>(value | 0x80);
+            value >>= 7;
+        }
+        bytes[size++] = static_cast<char>(value);
+
+        std::memcpy(grow(size), bytes, size);
+        return *this;
+    }
+
+    BinaryWriter& BinaryWriter::writeInt(Int64 value)
+    {
+        /*
+         * Zig-zag : 0, -1, 1, -2, 2... become 0, 1, 2, 3, 4...
+         */
+        Uint64 bits = static_cast<Uint64>(value);
+        return writeUint((bits << 1) ^ (value < 0 ? ~Uint64(0) : 0));
+    }
+
+    BinaryWriter& BinaryWriter::writeString(StringView str)
+    {
+        const Uint32* begin = str.begin();
+        const Uint32* end = str.end();
+
+        std::size_t size = 0;
+        for (const Uint32* c = begin; c < end; ++c)
+            size += getUtf8Size(*c);
+
+        writeUint(size);
+        if (size == 0)
+            return *this;
+
+        char* output = grow(size);
+
+        /*
+         * ASCII only : the sizes match
+         */
+        if (size == str.getSize())
+        {
+            for (const Uint32* c = begin; c < end; ++c)
+                *output++ = static_cast<char>(*c);
+        }
+        else
+        {
+            for (const Uint32* c = begin; c < end; ++c)
+                output = encodeUtf8(*c, output);
+        }
+
+        return *this;
+    }
+
+    BinaryWriter& BinaryWriter::writeUtf8(Utf8View text)
+    {
+        writeUint(text.getSize());
+        if (text.getSize() > 0)
+            std::memcpy(grow(text.getSize()), text.getData(), text.getSize());
+
+        return *this;
+    }
+
+    BinaryWriter& BinaryWriter::writeTime(Time time)
+    {
+        return writeInt(time.asMicroseconds());
+    }
+
+    const char* BinaryWriter::getData() const
+    {
+        return m_data.empty() ? NULL : &m_data[0];
+    }
+
+    std::size_t BinaryWriter::getSize() const
+    {
+        return m_data.size();
+    }
+
+    void BinaryWriter::clear()
+    {
+        m_data.clear();
+    }
+
+    char* BinaryWriter::grow(std::size_t size)
+    {
+        std::size_t position = m_data.size();
+        m_data.resize(position + size);
+        return &m_data[position];
+    }
+
+} // namespace cr
@@ -0,0 +1,148 @@
+#include <CaseMapping.hpp>
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace
+{
+    /*
+     * Which mapping a conversion applies
+     */
+    enum CaseKind
+    {
+        Lower,
+        Upper,
+        Fold
+    };
+
+    inline cr::Uint32 mapCharacter(cr::Uint32 codepoint, CaseKind kind)
+    {
+        switch (kind)
+        {
+            case Lower: return cr::toLower(codepoint);
+            case Upper: return cr::toUpper(codepoint);
+            default:    return cr::caseFold(codepoint);
+        }
+    }
+
+    /*
+     * Convert a range of characters ; \a output may be equal to \a begin
+     */
+    void mapCase(const cr::Uint32* begin, const cr::Uint32* end, cr::Uint32* output, CaseKind kind)
+    {
+    #if defined(__SSE2__)
+        /*
+         * ASCII fast path, four characters at a time : the letters of
+         * the source case are those in [first, first + 26)
+         */
+        const __m128i nonAscii = _mm_set1_epi32(~0x7F);
+        const __m128i zero     = _mm_setzero_si128();
+        const __m128i first    = _mm_set1_epi32(kind == Upper ? 'a' : 'A');
+        const __m128i limit    = _mm_set1_epi32(26);
+        const __m128i below    = _mm_set1_epi32(-1);
+        const __m128i delta    = _mm_set1_epi32(kind == Upper ? -32 : 32);
+
+        while (end - begin >= 4)
+        {
+            __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+            __m128i ascii = _mm_cmpeq_epi32(_mm_and_si128(chars, nonAscii), zero);
+
+            if (_mm_movemask_epi8(ascii) == 0xFFFF)
+            {
+                __m128i offset  = _mm_sub_epi32(chars, first);
+                __m128i inRange = _mm_and_si128(_mm_cmpgt_epi32(offset, below),
+                                                _mm_cmplt_epi32(offset, limit));
+
+                chars = _mm_add_epi32(chars, _mm_and_si128(inRange, delta));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output), chars);
+            }
+            else
+            {
+                for (int i = 0; i < 4; ++i)
+                    output[i] = mapCharacter(begin[i], kind);
+            }
+
+            begin += 4;
+            output += 4;
+        }
+    #endif
+
+        while (begin < end)
+            *output++ = mapCharacter(*begin++, kind);
+    }
+
+    cr::String mapString(cr::StringView str, CaseKind kind)
+    {
+        cr::String result = str.toString();
+
+        if (!result.isEmpty())
+        {
+            cr::Uint32* data = &*result.begin();
+            mapCase(data, data + result.getSize(), data, kind);
+        }
+
+        return result;
+    }
+}
+
+namespace cr
+{
+    String toLower(StringView str)
+    {
+        return mapString(str, Lower);
+    }
+
+    String toUpper(StringView str)
+    {
+        return mapString(str, Upper);
+    }
+
+    String caseFold(StringView str)
+    {
+        return mapString(str, Fold);
+    }
+
+    int caseInsensitiveCompare(StringView left, StringView right)
+    {
+        std::size_t length = left.getSize() < right.getSize() ? left.getSize() : right.getSize();
+        const Uint32* l = left.getData();
+        const Uint32* r = right.getData();
+
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            /*
+             * Identical characters don't need to be folded
+             */
+            if (l[i] == r[i])
+                continue;
+
+            Uint32 a = caseFold(l[i]);
+            Uint32 b = caseFold(r[i]);
+
+            if (a != b)
+                return a < b ? -1 : 1;
+        }
+
+        if (left.getSize() == right.getSize())
+            return 0;
+
+        return left.getSize() < right.getSize() ? -1 : 1;
+    }
+
+    std::size_t caseInsensitiveHash(StringView str)
+    {
+        /*
+         * 64-bit FNV-1a over the folded characters
+         */
+        Uint64 hash = 14695981039346656037ULL;
+
+        for (StringView::ConstIterator it = str.begin(); it != str.end(); ++it)
+        {
+            hash ^= caseFold(*it);
+            hash *= 1099511628211ULL;
+        }
+
+        return static_cast<std::size_t>(hash);
+    }
+
+} // namespace cr
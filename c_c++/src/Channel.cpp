@@ -0,0 +1,376 @@
+#include <Channel.hpp>
+#include <Clock.hpp>
+#include <FutexImpl.hpp>
+#include <Lock.hpp>
+#include <thread>
+
+namespace
+{
+    /*
+     * Pick the first operation tried by a select : xorshift, one state per thread
+     */
+    std::size_t getStart(std::size_t count)
+    {
+        static thread_local cr::Uint32 random = 2463534242u;
+
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+
+        return random % count;
+    }
+
+    /*
+     * Signal a waiter that a channel changed
+     */
+    void notify(cr::priv::ChannelWaiter* waiter)
+    {
+        cr::Int32 state = waiter->state.load(std::memory_order_acquire);
+
+        for (;;)
+        {
+            if (state == cr::priv::ChannelWaiter::Waiting)
+            {
+                if (waiter->state.compare_exchange_weak(state, cr::priv::ChannelWaiter::Notified, std::memory_order_acq_rel))
+                {
+                    cr::priv::futexWake(&waiter->state, 1);
+                    return;
+                }
+            }
+            else if (state == cr::priv::ChannelWaiter::Busy)
+            {
+                if (waiter->state.compare_exchange_weak(state, cr::priv::ChannelWaiter::BusyNotified, std::memory_order_acq_rel))
+                    return;
+            }
+            else
+            {
+                return;
+            }
+        }
+    }
+}
+
+namespace cr
+{
+namespace priv
+{
+
+    ChannelBase::ChannelBase() :
+        m_sendState(0),
+        m_isClosed (false)
+    {
+    }
+
+    ChannelBase::~ChannelBase()
+    {
+    }
+
+    std::size_t ChannelBase::select(const Case* cases, std::size_t count, Time timeout, bool& isClosed)
+    {
+        isClosed = false;
+        if (count == 0)
+            return count;
+
+        std::size_t start = getStart(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Case& operation = cases[(start + i) % count];
+            Status status = operation.attempt(*operation.channel, operation.value, NULL);
+            if (status != WouldBlock)
+            {
+                isClosed = status == Closed;
+                return (start + i) % count;
+            }
+        }
+
+        if (timeout == Time::Zero)
+            return count;
+
+        /*
+         * Register in all the channels, then try again before each sleep :
+         * a change made after the registration wakes this thread up
+         */
+        bool isInfinite = timeout < Time::Zero;
+        Clock clock;
+        ChannelWaiter waiter;
+        std::vector<ChannelNode> nodes(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            nodes[i].waiter = &waiter;
+            nodes[i].value = cases[i].value;
+            nodes[i].index = i;
+            nodes[i].previous = NULL;
+            nodes[i].next = NULL;
+            nodes[i].isLinked = false;
+        }
+
+        std::size_t result = count;
+        bool isClaimed = false;
+
+        for (;;)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                ChannelBase& channel = *cases[i].channel;
+                channel.link(cases[i].isSend ? channel.m_senders : channel.m_receivers, &nodes[i]);
+            }
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            for (std::size_t i = 0; i < count && result == count; ++i)
+            {
+                const Case& operation = cases[(start + i) % count];
+                Status status = operation.attempt(*operation.channel, operation.value, &waiter);
+                if (status != WouldBlock)
+                {
+                    isClosed = status == Closed;
+                    result = (start + i) % count;
+                }
+            }
+            if (result != count)
+                break;
+
+            /*
+             * A channel changed during the attempts : try again
+             */
+            Int32 state = ChannelWaiter::Busy;
+            if (!waiter.state.compare_exchange_strong(state, ChannelWaiter::Waiting, std::memory_order_acq_rel))
+            {
+                waiter.state.store(ChannelWaiter::Busy, std::memory_order_relaxed);
+                continue;
+            }
+
+            bool isAwake = true;
+            if (isInfinite)
+            {
+                priv::futexWait(&waiter.state, ChannelWaiter::Waiting);
+            }
+            else
+            {
+                Time remaining = timeout - clock.getElapsedTime();
+                isAwake = remaining > Time::Zero && priv::futexWait(&waiter.state, ChannelWaiter::Waiting, remaining);
+            }
+
+            /*
+             * Back to Busy, unless a partner completed an operation
+             */
+            state = waiter.state.load(std::memory_order_acquire);
+            while (state != ChannelWaiter::Claimed)
+            {
+                if (waiter.state.compare_exchange_weak(state, ChannelWaiter::Busy, std::memory_order_acq_rel))
+                    break;
+            }
+            if (state == ChannelWaiter::Claimed)
+            {
+                isClaimed = true;
+                break;
+            }
+
+            if (!isAwake && state == ChannelWaiter::Waiting)
+                break;
+        }
+
+        /*
+         * Once unlinked, no partner can claim the waiter anymore
+         */
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ChannelBase& channel = *cases[i].channel;
+            Lock lock(channel.m_mutex);
+            if (nodes[i].isLinked)
+                channel.unlink(cases[i].isSend ? channel.m_senders : channel.m_receivers, &nodes[i]);
+        }
+
+        if (isClaimed)
+        {
+            isClosed = false;
+            result = waiter.selected;
+        }
+
+        return result;
+    }
+
+    bool ChannelBase::close()
+    {
+        if (m_sendState.fetch_or(1, std::memory_order_acq_rel) & 1)
+            return false;
+
+        /*
+         * Let the sends in progress end, they only take a few instructions
+         */
+        while (m_sendState.load(std::memory_order_acquire) != 1)
+            std::this_thread::yield();
+
+        Lock lock(m_mutex);
+        m_isClosed.store(true, std::memory_order_seq_cst);
+
+        notifyAll(m_senders);
+        notifyAll(m_receivers);
+
+        return true;
+    }
+
+    bool ChannelBase::isClosed() const
+    {
+        return (m_sendState.load(std::memory_order_relaxed) & 1) != 0;
+    }
+
+    void ChannelBase::wakeUp(List& list)
+    {
+        Lock lock(m_mutex);
+        notifyAll(list);
+    }
+
+    ChannelBase::Status ChannelBase::handOff(ChannelWaiter* self, void* value, void (*move)(void* from, void* to))
+    {
+        Lock lock(m_mutex);
+
+        if (m_isClosed.load(std::memory_order_relaxed))
+            return Closed;
+
+        return claim(m_receivers, self, value, move, true);
+    }
+
+    ChannelBase::Status ChannelBase::takeOver(ChannelWaiter* self, void* value, void (*move)(void* from, void* to))
+    {
+        Lock lock(m_mutex);
+
+        Status status = claim(m_senders, self, value, move, false);
+        if (status == WouldBlock && m_isClosed.load(std::memory_order_relaxed))
+            return Closed;
+
+        return status;
+    }
+
+    void ChannelBase::link(List& list, ChannelNode* node)
+    {
+        Lock lock(m_mutex);
+
+        if (!node->isLinked)
+        {
+            node->previous = list.last;
+            node->next = NULL;
+            if (list.last)
+                list.last->next = node;
+            else
+                list.first = node;
+            list.last = node;
+            node->isLinked = true;
+        }
+
+        list.mayHaveWaiters.store(1, std::memory_order_relaxed);
+    }
+
+    void ChannelBase::unlink(List& list, ChannelNode* node)
+    {
+        if (node->previous)
+            node->previous->next = node->next;
+        else
+            list.first = node->next;
+
+        if (node->next)
+            node->next->previous = node->previous;
+        else
+            list.last = node->previous;
+
+        node->isLinked = false;
+    }
+
+    void ChannelBase::notifyAll(List& list)
+    {
+        /*
+         * The waiters register again if they have to wait more
+         */
+        while (list.first)
+        {
+            ChannelNode* node = list.first;
+            unlink(list, node);
+            notify(node->waiter);
+        }
+    }
+
+    ChannelBase::Status ChannelBase::claim(List& list, ChannelWaiter* self, void* value, void (*move)(void* from, void* to), bool isSender)
+    {
+        for (ChannelNode* node = list.first; node; node = node->next)
+        {
+            ChannelWaiter* waiter = node->waiter;
+            if (waiter == self)
+                continue;
+
+            Int32 state = waiter->state.load(std::memory_order_acquire);
+            for (;;)
+            {
+                if (state == ChannelWaiter::Waiting || state == ChannelWaiter::Notified)
+                {
+                    if (waiter->state.compare_exchange_weak(state, ChannelWaiter::Claimed, std::memory_order_acq_rel))
+                        break;
+                }
+                else if (state == ChannelWaiter::Busy)
+                {
+                    /*
+                     * The waiter is trying its operations : it will try
+                     * again, and find this thread registered
+                     */
+                    if (waiter->state.compare_exchange_weak(state, ChannelWaiter::BusyNotified, std::memory_order_acq_rel))
+                        break;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            if (state != ChannelWaiter::Waiting && state != ChannelWaiter::Notified)
+                continue;
+
+            /*
+             * Claimed : the waiter reads the result after unlinking its
+             * nodes, which needs the mutex held by this thread
+             */
+            if (isSender)
+                move(value, node->value);
+            else
+                move(node->value, value);
+
+            waiter->selected = node->index;
+            unlink(list, node);
+            futexWake(&waiter->state, 1);
+
+            return Done;
+        }
+
+        return WouldBlock;
+    }
+
+} // namespace priv
+
+
+    const std::size_t Select::None;
+
+    Select::Select() :
+        m_isClosed(false)
+    {
+    }
+
+    std::size_t Select::wait()
+    {
+        return waitFor(microseconds(-1));
+    }
+
+    std::size_t Select::waitFor(Time timeout)
+    {
+        std::size_t index = priv::ChannelBase::select(m_cases.empty() ? NULL : &m_cases[0], m_cases.size(), timeout, m_isClosed);
+        return index == m_cases.size() ? None : index;
+    }
+
+    std::size_t Select::tryWait()
+    {
+        return waitFor(Time::Zero);
+    }
+
+    bool Select::isClosed() const
+    {
+        return m_isClosed;
+    }
+
+} // namespace cr
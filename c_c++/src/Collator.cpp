@@ -0,0 +1,482 @@
+#include <Collator.hpp>
+#include <Normalization.hpp>
+#include <UnicodeTables.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    using namespace cr::priv;
+
+    inline cr::Uint32 primaryOf(cr::Uint32 element)   { return element >> 16; }
+    inline cr::Uint32 secondaryOf(cr::Uint32 element) { return (element >> 7) & 0x1FF; }
+    inline cr::Uint32 tertiaryOf(cr::Uint32 element)  { return (element >> 2) & 0x1F; }
+    inline bool       isVariable(cr::Uint32 element)  { return (element & 1) != 0; }
+
+    inline cr::Uint32 pack(cr::Uint32 primary, cr::Uint32 secondary, cr::Uint32 tertiary)
+    {
+        return (primary << 16) | (secondary << 7) | (tertiary << 2);
+    }
+
+    inline bool lessCodepoints(const ContractionRecord& record, const cr::Uint32* key)
+    {
+        return std::lexicographical_compare(record.codepoints, record.codepoints + 3, key, key + 3);
+    }
+
+    /*
+     * Mapping of a contraction, or 0 if the sequence has none
+     */
+    cr::Uint32 findContraction(cr::Uint32 first, cr::Uint32 second, cr::Uint32 third)
+    {
+        const cr::Uint32 key[3] = { first, second, third };
+        const ContractionRecord* end = Contractions + ContractionCount;
+        const ContractionRecord* found = std::lower_bound(Contractions, end, key, lessCodepoints);
+
+        if (found != end && std::equal(key, key + 3, found->codepoints))
+            return found->mapping;
+
+        return 0;
+    }
+
+    inline cr::Uint8 getCombiningClass(cr::Uint32 codepoint)
+    {
+        return codepoint < 0x300 ? 0 : getNormRecord(codepoint).ccc;
+    }
+
+    /*
+     * Implicit weights of a code point without mapping (UTS #10, 10.1)
+     */
+    void appendImplicit(cr::Uint32 codepoint, std::vector<cr::Uint32>& elements)
+    {
+        cr::Uint32 first = 0xFBC0 + (codepoint >> 15);
+        cr::Uint32 second = (codepoint & 0x7FFF) | 0x8000;
+
+        for (cr::Uint32 i = 0; i < ImplicitRangeCount; ++i)
+        {
+            const ImplicitRange& range = ImplicitRanges[i];
+            if (codepoint < range.first || codepoint > range.last)
+                continue;
+
+            if (range.origin)
+            {
+                first = range.base;
+                second = (codepoint - range.origin) | 0x8000;
+            }
+            else
+            {
+                first = range.base + (codepoint >> 15);
+            }
+            break;
+        }
+
+        elements.push_back(pack(first, 0x20, 0x02));
+        elements.push_back(pack(second, 0, 0));
+    }
+
+    /*
+     * Collation elements of a string in NFD (UTS #10, step 2) ;
+     * contractions are matched contiguously first, then with the
+     * unblocked non-starters which follow (discontiguous match)
+     */
+    void collectElements(const cr::Uint32* text, std::size_t size, std::vector<cr::Uint32>& elements)
+    {
+        /*
+         * Copy of the text, made when a character matched by a
+         * discontiguous contraction has to be removed
+         */
+        std::basic_string<cr::Uint32> work;
+
+        std::size_t i = 0;
+        while (i < size)
+        {
+            cr::Uint32 codepoint = text[i];
+            cr::Uint32 mapping = getCollationMapping(codepoint);
+            std::size_t length = 1;
+
+            if (mapping & 1)
+            {
+                cr::Uint32 sequence[3] = { codepoint, 0, 0 };
+                cr::Uint32 found;
+
+                if (i + 2 < size && (found = findContraction(codepoint, text[i + 1], text[i + 2])) != 0)
+                {
+                    mapping = found;
+                    length = 3;
+                }
+                else if (i + 1 < size && (found = findContraction(codepoint, text[i + 1], 0)) != 0)
+                {
+                    mapping = found;
+                    length = 2;
+                    sequence[1] = text[i + 1];
+                }
+
+                std::size_t matched = length;
+                cr::Uint8 lastSkipped = 0;
+
+                for (std::size_t j = i + length; matched < 3 && j < size; )
+                {
+                    cr::Uint8 ccc = getCombiningClass(text[j]);
+                    if (ccc == 0)
+                        break;
+
+                    if (ccc > lastSkipped)
+                    {
+                        sequence[matched] = text[j];
+                        found = findContraction(sequence[0], sequence[1], sequence[2]);
+
+                        if (found)
+                        {
+                            mapping = found;
+                            ++matched;
+
+                            if (work.empty())
+                                work.assign(text, size);
+                            work.erase(j, 1);
+                            text = work.data();
+                            size = work.size();
+                            continue;
+                        }
+
+                        sequence[matched] = 0;
+                    }
+
+                    lastSkipped = ccc;
+                    ++j;
+                }
+            }
+
+            cr::Uint32 count = (mapping >> 1) & 0x7F;
+            if (count)
+            {
+                const cr::Uint32* first = CollationElements + (mapping >> 8);
+                elements.insert(elements.end(), first, first + count);
+            }
+            else
+            {
+                appendImplicit(codepoint, elements);
+            }
+
+            i += length;
+        }
+    }
+
+    /*
+     * Weights of an element after the variable weighting (UTS #10, 4)
+     */
+    struct Weights
+    {
+        cr::Uint32 level[4];
+    };
+
+    class Weighting
+    {
+    public:
+        explicit Weighting(bool shifted) :
+            m_shifted      (shifted),
+            m_afterVariable(false)
+        {
+        }
+
+        Weights operator()(cr::Uint32 element)
+        {
+            Weights weights = {{ primaryOf(element), secondaryOf(element), tertiaryOf(element), 0xFFFF }};
+
+            if (!m_shifted)
+                return weights;
+
+            if (isVariable(element))
+            {
+                weights.level[3] = weights.level[0];
+                weights.level[0] = weights.level[1] = weights.level[2] = 0;
+                m_afterVariable = true;
+            }
+            else if (element == 0 || (weights.level[0] == 0 && m_afterVariable))
+            {
+                weights.level[0] = weights.level[1] = weights.level[2] = weights.level[3] = 0;
+            }
+            else if (weights.level[0] != 0)
+            {
+                /*
+                 * The second element of an implicit weight only
+                 * continues the primary of the first one
+                 */
+                if (weights.level[1] == 0 && weights.level[2] == 0)
+                    weights.level[3] = 0;
+                m_afterVariable = false;
+            }
+
+            return weights;
+        }
+
+    private:
+        bool m_shifted;
+        bool m_afterVariable;
+    };
+
+    inline void appendWeight(cr::SortKey& key, cr::Uint32 weight)
+    {
+        key.push_back(static_cast<cr::Uint8>(weight >> 8));
+        key.push_back(static_cast<cr::Uint8>(weight & 0xFF));
+    }
+
+    /*
+     * Order of the strings by sort key, then by code point
+     */
+    struct KeyOrder
+    {
+        KeyOrder(const std::vector<cr::String>& strings, const std::vector<const cr::SortKey*>& keys) :
+            m_strings(strings),
+            m_keys   (keys)
+        {
+        }
+
+        bool operator()(std::size_t left, std::size_t right) const
+        {
+            const cr::SortKey& first = *m_keys[left];
+            const cr::SortKey& second = *m_keys[right];
+
+            /*
+             * memcmp rather than SortKey::compare, whose character
+             * traits compare unsigned chars one by one
+             */
+            std::size_t size = std::min(first.size(), second.size());
+            int result = std::memcmp(first.data(), second.data(), size);
+            if (result == 0 && first.size() != second.size())
+                return first.size() < second.size();
+
+            return result != 0 ? result < 0 : m_strings[left] < m_strings[right];
+        }
+
+        const std::vector<cr::String>&          m_strings;
+        const std::vector<const cr::SortKey*>& m_keys;
+    };
+
+    void sortByKeys(std::vector<cr::String>& strings, const std::vector<const cr::SortKey*>& keys)
+    {
+        std::vector<std::size_t> order(strings.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+
+        std::sort(order.begin(), order.end(), KeyOrder(strings, keys));
+
+        std::vector<cr::String> sorted;
+        sorted.reserve(strings.size());
+
+        for (std::size_t i = 0; i < order.size(); ++i)
+            sorted.push_back(std::move(strings[order[i]]));
+
+        strings.swap(sorted);
+    }
+
+} // namespace
+
+
+namespace cr
+{
+
+    Collator::Collator(Strength strength, Alternate alternate) :
+        m_strength (strength),
+        m_alternate(alternate)
+    {
+    }
+
+    SortKey Collator::getSortKey(StringView str) const
+    {
+        SortKey key;
+        getSortKey(str, key);
+        return key;
+    }
+
+    void Collator::getSortKey(StringView str, SortKey& key) const
+    {
+        key.clear();
+
+        /*
+         * The algorithm works on NFD, most strings already are
+         */
+        String decomposed;
+        if (!isNormalized(str, NFD))
+        {
+            decomposed = normalize(str, NFD);
+            str = StringView(decomposed);
+        }
+
+        std::vector<Uint32> elements;
+        elements.reserve(str.getSize() + 8);
+        collectElements(str.getData(), str.getSize(), elements);
+
+        /*
+         * One pass per level, levels separated by a zero weight
+         * (lower than any other weight)
+         */
+        int levels = m_strength;
+        if (levels > Tertiary && m_alternate == NonIgnorable)
+            levels = Tertiary;
+
+        key.reserve(elements.size() * 2 * levels + 2 * levels);
+
+        for (int level = 0; level < levels; ++level)
+        {
+            if (level > 0)
+                appendWeight(key, 0);
+
+            Weighting weigh(m_alternate == Shifted);
+
+            for (std::size_t i = 0; i < elements.size(); ++i)
+            {
+                Uint32 weight = weigh(elements[i]).level[level];
+                if (weight)
+                    appendWeight(key, weight);
+            }
+        }
+    }
+
+    int Collator::compare(StringView left, StringView right) const
+    {
+        SortKey leftKey;
+        SortKey rightKey;
+
+        getSortKey(left, leftKey);
+        getSortKey(right, rightKey);
+
+        int result = leftKey.compare(rightKey);
+        return result < 0 ? -1 : (result > 0 ? 1 : 0);
+    }
+
+    void Collator::sort(std::vector<String>& strings) const
+    {
+        std::vector<SortKey> keys(strings.size());
+        std::vector<const SortKey*> pointers(strings.size());
+
+        for (std::size_t i = 0; i < strings.size(); ++i)
+        {
+            getSortKey(strings[i], keys[i]);
+            pointers[i] = &keys[i];
+        }
+
+        sortByKeys(strings, pointers);
+    }
+
+    void Collator::sort(std::vector<String>& strings, CollationKeyCache& cache) const
+    {
+        /*
+         * The missing keys are only added once the strings are sorted :
+         * adding them may empty the cache, which would invalidate the
+         * keys found in it
+         */
+        std::vector<SortKey> computed;
+        std::vector<std::size_t> owners;
+        std::vector<const SortKey*> pointers(strings.size());
+
+        computed.reserve(strings.size());
+
+        for (std::size_t i = 0; i < strings.size(); ++i)
+        {
+            pointers[i] = cache.findSortKey(*this, strings[i]);
+            if (!pointers[i])
+            {
+                computed.push_back(SortKey());
+                getSortKey(strings[i], computed.back());
+                pointers[i] = &computed.back();
+                owners.push_back(i);
+            }
+        }
+
+        /*
+         * Remember which string each computed key belongs to, by
+         * value : the strings move while they are sorted
+         */
+        std::vector<String> missing;
+        missing.reserve(owners.size());
+        for (std::size_t i = 0; i < owners.size(); ++i)
+            missing.push_back(strings[owners[i]]);
+
+        sortByKeys(strings, pointers);
+
+        for (std::size_t i = 0; i < computed.size(); ++i)
+            cache.insert(*this, missing[i], std::move(computed[i]));
+    }
+
+    Collator::Strength Collator::getStrength() const
+    {
+        return m_strength;
+    }
+
+    Collator::Alternate Collator::getAlternate() const
+    {
+        return m_alternate;
+    }
+
+namespace priv
+{
+    std::size_t StringHash::operator()(const String& str) const
+    {
+        Uint64 hash = 14695981039346656037ULL;
+
+        for (String::ConstIterator it = str.begin(); it != str.end(); ++it)
+        {
+            hash ^= *it;
+            hash *= 1099511628211ULL;
+        }
+
+        return static_cast<std::size_t>(hash);
+    }
+
+} // namespace priv
+
+    CollationKeyCache::CollationKeyCache(std::size_t capacity) :
+        m_capacity (capacity),
+        m_strength (Collator::Tertiary),
+        m_alternate(Collator::NonIgnorable)
+    {
+    }
+
+    const SortKey& CollationKeyCache::getSortKey(const Collator& collator, const String& str)
+    {
+        const SortKey* found = findSortKey(collator, str);
+        if (found)
+            return *found;
+
+        insert(collator, str, collator.getSortKey(str));
+        return m_keys.find(str)->second;
+    }
+
+    const SortKey* CollationKeyCache::findSortKey(const Collator& collator, const String& str)
+    {
+        select(collator);
+
+        KeyMap::const_iterator it = m_keys.find(str);
+        return it != m_keys.end() ? &it->second : NULL;
+    }
+
+    void CollationKeyCache::insert(const Collator& collator, const String& str, SortKey&& key)
+    {
+        select(collator);
+
+        if (m_capacity && m_keys.size() >= m_capacity && m_keys.find(str) == m_keys.end())
+            m_keys.clear();
+
+        m_keys[str] = std::move(key);
+    }
+
+    void CollationKeyCache::clear()
+    {
+        m_keys.clear();
+    }
+
+    std::size_t CollationKeyCache::getSize() const
+    {
+        return m_keys.size();
+    }
+
+    void CollationKeyCache::select(const Collator& collator)
+    {
+        if (collator.getStrength() != m_strength || collator.getAlternate() != m_alternate)
+        {
+            m_keys.clear();
+            m_strength = collator.getStrength();
+            m_alternate = collator.getAlternate();
+        }
+    }
+
+} // namespace cr
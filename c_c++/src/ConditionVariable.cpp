@@ -0,0 +1,79 @@
+#include <ConditionVariable.hpp>
+#include <FutexImpl.hpp>
+#include <climits>
+
+namespace cr
+{
+
+    ConditionVariable::ConditionVariable() :
+        m_sequence(0),
+        m_waiters (0),
+        m_mutex   (NULL)
+    {
+    }
+
+    void ConditionVariable::wait(Lock& lock)
+    {
+        Mutex& mutex = lock.m_mutex;
+
+        /*
+         * The sequence is read before unlocking : a notification
+         * made afterwards changes it, and the futex doesn't sleep
+         */
+        m_mutex.store(&mutex, std::memory_order_relaxed);
+        m_waiters.fetch_add(1, std::memory_order_seq_cst);
+        Int32 sequence = m_sequence.load(std::memory_order_relaxed);
+
+        mutex.unlock();
+        priv::futexWait(&m_sequence, sequence);
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+
+        /*
+         * Other waiters may have been moved to the mutex : it stays
+         * marked as contended so that unlocking it wakes them
+         */
+        mutex.lockContended();
+    }
+
+    bool ConditionVariable::waitFor(Lock& lock, Time timeout)
+    {
+        Mutex& mutex = lock.m_mutex;
+
+        m_mutex.store(&mutex, std::memory_order_relaxed);
+        m_waiters.fetch_add(1, std::memory_order_seq_cst);
+        Int32 sequence = m_sequence.load(std::memory_order_relaxed);
+
+        mutex.unlock();
+        bool notified = priv::futexWait(&m_sequence, sequence, timeout);
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+
+        mutex.lockContended();
+
+        return notified;
+    }
+
+    void ConditionVariable::notifyOne()
+    {
+        m_sequence.fetch_add(1, std::memory_order_seq_cst);
+
+        if (m_waiters.load(std::memory_order_seq_cst) > 0)
+            priv::futexWake(&m_sequence, 1);
+    }
+
+    void ConditionVariable::notifyAll()
+    {
+        Int32 sequence = m_sequence.fetch_add(1, std::memory_order_seq_cst) + 1;
+
+        if (m_waiters.load(std::memory_order_seq_cst) == 0)
+            return;
+
+        /*
+         * Wake up one thread, the others wait for the mutex ; if
+         * another notification changed the sequence, wake up all
+         */
+        Mutex* mutex = m_mutex.load(std::memory_order_relaxed);
+        if (!mutex || !priv::futexRequeue(&m_sequence, sequence, &mutex->m_state))
+            priv::futexWake(&m_sequence, INT_MAX);
+    }
+
+} // namespace cr
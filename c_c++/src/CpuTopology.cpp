@@ -0,0 +1,178 @@
+#include <CpuTopology.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <dirent.h>
+#include <fstream>
+#include <set>
+#include <sched.h>
+#include <unistd.h>
+
+namespace
+{
+    const char* CpuDirectory = "/sys/devices/system/cpu";
+
+    /*
+     * Read the first line of a file
+     */
+    bool readLine(const std::string& path, std::string& line)
+    {
+        std::ifstream file(path.c_str());
+        return std::getline(file, line).good() || !line.empty();
+    }
+
+    bool readNumber(const std::string& path, unsigned int& number)
+    {
+        std::string line;
+        if (!readLine(path, line) || line.empty())
+            return false;
+
+        char* end;
+        long value = std::strtol(line.c_str(), &end, 10);
+        if (end == line.c_str() || value < 0)
+            return false;
+
+        number = static_cast<unsigned int>(value);
+        return true;
+    }
+
+    std::string getCpuPath(unsigned int cpu, const char* file)
+    {
+        char path[128];
+        std::snprintf(path, sizeof(path), "%s/cpu%u/%s", CpuDirectory, cpu, file);
+        return path;
+    }
+
+    /*
+     * NUMA node : the cpuN directory holds a nodeM link
+     */
+    unsigned int getNode(unsigned int cpu)
+    {
+        char path[128];
+        std::snprintf(path, sizeof(path), "%s/cpu%u", CpuDirectory, cpu);
+
+        DIR* directory = opendir(path);
+        if (!directory)
+            return 0;
+
+        unsigned int node = 0;
+        while (dirent* entry = readdir(directory))
+        {
+            unsigned int number;
+            char extra;
+            if (std::sscanf(entry->d_name, "node%u%c", &number, &extra) == 1)
+            {
+                node = number;
+                break;
+            }
+        }
+
+        closedir(directory);
+        return node;
+    }
+
+} // namespace
+
+
+namespace cr
+{
+
+    std::vector<CpuInfo> CpuTopology::getCpus()
+    {
+        std::string online;
+        std::vector<unsigned int> ids;
+
+        if (readLine(std::string(CpuDirectory) + "/online", online))
+            ids = parseList(online);
+
+        if (ids.empty())
+        {
+            long count = sysconf(_SC_NPROCESSORS_ONLN);
+            for (long i = 0; i < std::max(count, 1L); ++i)
+                ids.push_back(static_cast<unsigned int>(i));
+        }
+
+        std::vector<unsigned int> isolated = getIsolatedCpus();
+
+        std::vector<CpuInfo> cpus(ids.size());
+        for (std::size_t i = 0; i < ids.size(); ++i)
+        {
+            CpuInfo& cpu = cpus[i];
+            cpu.id = ids[i];
+
+            if (!readNumber(getCpuPath(cpu.id, "topology/core_id"), cpu.core))
+                cpu.core = cpu.id;
+            if (!readNumber(getCpuPath(cpu.id, "topology/physical_package_id"), cpu.package))
+                cpu.package = 0;
+
+            cpu.node = getNode(cpu.id);
+            cpu.isolated = std::binary_search(isolated.begin(), isolated.end(), cpu.id);
+        }
+
+        return cpus;
+    }
+
+    std::size_t CpuTopology::getCoreCount()
+    {
+        std::vector<CpuInfo> cpus = getCpus();
+
+        std::set<std::pair<unsigned int, unsigned int> > cores;
+        for (std::size_t i = 0; i < cpus.size(); ++i)
+            cores.insert(std::make_pair(cpus[i].package, cpus[i].core));
+
+        return cores.size();
+    }
+
+    std::vector<unsigned int> CpuTopology::getIsolatedCpus()
+    {
+        std::string isolated;
+        if (!readLine(std::string(CpuDirectory) + "/isolated", isolated))
+            return std::vector<unsigned int>();
+
+        return parseList(isolated);
+    }
+
+    unsigned int CpuTopology::getCurrentCpu()
+    {
+        int cpu = sched_getcpu();
+        return cpu >= 0 ? static_cast<unsigned int>(cpu) : 0;
+    }
+
+    std::vector<unsigned int> CpuTopology::parseList(const std::string& list)
+    {
+        std::vector<unsigned int> cpus;
+        const char* current = list.c_str();
+
+        while (*current && *current != '\n')
+        {
+            char* end;
+            unsigned long first = std::strtoul(current, &end, 10);
+            if (end == current)
+                return std::vector<unsigned int>();
+
+            unsigned long last = first;
+            current = end;
+            if (*current == '-')
+            {
+                last = std::strtoul(current + 1, &end, 10);
+                if (end == current + 1 || last < first)
+                    return std::vector<unsigned int>();
+                current = end;
+            }
+
+            for (unsigned long cpu = first; cpu <= last; ++cpu)
+                cpus.push_back(static_cast<unsigned int>(cpu));
+
+            if (*current == ',')
+                ++current;
+            else if (*current && *current != '\n')
+                return std::vector<unsigned int>();
+        }
+
+        std::sort(cpus.begin(), cpus.end());
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+        return cpus;
+    }
+
+} // namespace cr
@@ -0,0 +1,55 @@
+#include <FutexImpl.hpp>
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace cr
+{
+namespace priv
+{
+    void futexWait(std::atomic<Int32>* address, Int32 value)
+    {
+        syscall(SYS_futex, reinterpret_cast<int*>(address), FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+    }
+
+    bool futexWait(std::atomic<Int32>* address, Int32 value, Time timeout)
+    {
+        Int64 microseconds = timeout.asMicroseconds();
+        if (microseconds <= 0)
+            return false;
+
+        timespec relative;
+        relative.tv_sec = static_cast<time_t>(microseconds / 1000000);
+        relative.tv_nsec = static_cast<long>(microseconds % 1000000) * 1000;
+
+        if (syscall(SYS_futex, reinterpret_cast<int*>(address), FUTEX_WAIT_PRIVATE, value, &relative, NULL, 0) == 0)
+            return true;
+
+        return errno != ETIMEDOUT;
+    }
+
+    void futexWake(std::atomic<Int32>* address, int count)
+    {
+        syscall(SYS_futex, reinterpret_cast<int*>(address), FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+    }
+
+    bool futexRequeue(std::atomic<Int32>* address, Int32 expected, std::atomic<Int32>* target)
+    {
+        /*
+         * The fourth argument is the number of threads moved,
+         * passed in place of the timeout
+         */
+        return syscall(SYS_futex, reinterpret_cast<int*>(address), FUTEX_CMP_REQUEUE_PRIVATE, 1,
+                       reinterpret_cast<void*>(static_cast<long>(INT_MAX)), reinterpret_cast<int*>(target), expected) >= 0;
+    }
+
+    bool isMultiCore()
+    {
+        static const bool multiCore = sysconf(_SC_NPROCESSORS_ONLN) > 1;
+        return multiCore;
+    }
+} // namespace priv
+} // namespace cr
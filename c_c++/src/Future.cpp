@@ -0,0 +1,130 @@
+#include <Future.hpp>
+#include <Clock.hpp>
+#include <FutexImpl.hpp>
+#include <climits>
+
+namespace cr
+{
+namespace priv
+{
+    FutureStateBase::FutureStateBase() :
+        m_flags     (0),
+        m_references(1),
+        m_callback  (NULL)
+    {
+    }
+
+    FutureStateBase::~FutureStateBase()
+    {
+    }
+
+    void FutureStateBase::addReference()
+    {
+        m_references.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void FutureStateBase::removeReference()
+    {
+        if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this;
+    }
+
+    bool FutureStateBase::isReady() const
+    {
+        return (m_flags.load(std::memory_order_acquire) & Complete) != 0;
+    }
+
+    void FutureStateBase::wait()
+    {
+        waitFor(microseconds(-1));
+    }
+
+    bool FutureStateBase::waitFor(Time timeout)
+    {
+        bool isInfinite = timeout < Time::Zero;
+        Clock clock;
+
+        for (;;)
+        {
+            Int32 flags = m_flags.load(std::memory_order_acquire);
+            if (flags & Complete)
+                return true;
+
+            /*
+             * The completing thread only calls the kernel when
+             * it sees the Waiting flag
+             */
+            if (!(flags & Waiting))
+            {
+                if (!m_flags.compare_exchange_weak(flags, flags | Waiting, std::memory_order_acquire))
+                    continue;
+                flags |= Waiting;
+            }
+
+            if (isInfinite)
+            {
+                priv::futexWait(&m_flags, flags);
+                continue;
+            }
+
+            Time remaining = timeout - clock.getElapsedTime();
+            if (remaining <= Time::Zero || !priv::futexWait(&m_flags, flags, remaining))
+                return isReady();
+        }
+    }
+
+    void FutureStateBase::setCallback(FutureCallback* callback)
+    {
+        m_callback = callback;
+
+        /*
+         * Whichever of the result and the continuation comes
+         * second runs the continuation
+         */
+        if (m_flags.fetch_or(Continuation, std::memory_order_acq_rel) & Complete)
+        {
+            m_callback = NULL;
+            callback->run();
+            delete callback;
+        }
+    }
+
+    void FutureStateBase::claim()
+    {
+        if (m_flags.fetch_or(Claimed, std::memory_order_relaxed) & Claimed)
+            throw std::future_error(std::future_errc::promise_already_satisfied);
+    }
+
+    bool FutureStateBase::isClaimed() const
+    {
+        return (m_flags.load(std::memory_order_relaxed) & Claimed) != 0;
+    }
+
+    void FutureStateBase::complete()
+    {
+        Int32 flags = m_flags.fetch_or(Complete, std::memory_order_acq_rel);
+
+        if (flags & Waiting)
+            priv::futexWake(&m_flags, INT_MAX);
+
+        if (flags & Continuation)
+        {
+            FutureCallback* callback = m_callback;
+            m_callback = NULL;
+            callback->run();
+            delete callback;
+        }
+    }
+
+    void FutureStateBase::setException(std::exception_ptr exception)
+    {
+        m_exception = exception;
+        complete();
+    }
+
+    const std::exception_ptr& FutureStateBase::getException() const
+    {
+        return m_exception;
+    }
+} // namespace priv
+} // namespace cr
@@ -0,0 +1,82 @@
+#include <IoRing.hpp>
+#include <IoRingImpl.hpp>
+#include <iostream>
+
+namespace cr
+{
+
+    IoRing::IoRing(std::size_t depth, Backend backend) :
+        m_impl(NULL)
+    {
+        if (backend != Threads)
+            m_impl = priv::UringImpl::create(depth);
+
+        if (!m_impl)
+        {
+            if (backend == Uring)
+                std::cerr << "Failed to create an io_uring (not supported by the system)" << std::endl;
+            else
+                m_impl = new priv::ThreadedIoImpl(depth);
+        }
+    }
+
+    IoRing::~IoRing()
+    {
+        delete m_impl;
+    }
+
+    bool IoRing::isValid() const
+    {
+        return m_impl != NULL;
+    }
+
+    IoRing::Backend IoRing::getBackend() const
+    {
+        return m_impl ? m_impl->getBackend() : Auto;
+    }
+
+    bool IoRing::prepareRead(int descriptor, void* buffer, std::size_t size, Uint64 offset, Uint64 userData)
+    {
+        priv::IoOperation operation = {priv::IoOperation::Read, descriptor, buffer, size, offset, userData};
+        return m_impl && m_impl->prepare(operation);
+    }
+
+    bool IoRing::prepareWrite(int descriptor, const void* buffer, std::size_t size, Uint64 offset, Uint64 userData)
+    {
+        priv::IoOperation operation = {priv::IoOperation::Write, descriptor, const_cast<void*>(buffer), size, offset, userData};
+        return m_impl && m_impl->prepare(operation);
+    }
+
+    bool IoRing::prepareNop(Uint64 userData)
+    {
+        priv::IoOperation operation = {priv::IoOperation::Nop, -1, NULL, 0, 0, userData};
+        return m_impl && m_impl->prepare(operation);
+    }
+
+    std::size_t IoRing::submit()
+    {
+        return m_impl ? m_impl->submit() : 0;
+    }
+
+    std::size_t IoRing::waitCompletions(IoCompletion* completions, std::size_t maximum, std::size_t minimum)
+    {
+        return m_impl ? m_impl->waitCompletions(completions, maximum, minimum) : 0;
+    }
+
+    std::size_t IoRing::pollCompletions(IoCompletion* completions, std::size_t maximum)
+    {
+        return m_impl ? m_impl->waitCompletions(completions, maximum, 0) : 0;
+    }
+
+    std::size_t IoRing::getPendingCount() const
+    {
+        return m_impl ? m_impl->getPendingCount() : 0;
+    }
+
+    void IoRing::shutdown()
+    {
+        if (m_impl)
+            m_impl->shutdown();
+    }
+
+} // namespace cr
@@ -0,0 +1,478 @@
+#include <IoRingImpl.hpp>
+#include <FutexImpl.hpp>
+#include <Lock.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <iostream>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+    /*
+     * Largest transfer of a single read or write on Linux
+     */
+    const std::size_t MaximumTransfer = 0x7FFFF000;
+
+    /*
+     * Submissions failing with EAGAIN before giving up
+     */
+    const unsigned int MaximumSubmitAttempts = 10;
+
+    int setupRing(unsigned int entries, io_uring_params* params)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    int enterRing(int ring, unsigned int submit, unsigned int wait, unsigned int flags)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_enter, ring, submit, wait, flags, NULL, 0));
+    }
+
+    void* mapRing(int ring, std::size_t size, off_t offset)
+    {
+        void* memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, offset);
+        return memory == MAP_FAILED ? NULL : memory;
+    }
+
+    template <typename T>
+    T* atOffset(void* memory, unsigned int offset)
+    {
+        return reinterpret_cast<T*>(static_cast<char*>(memory) + offset);
+    }
+
+    /*
+     * Run an operation synchronously
+     */
+    cr::Int64 execute(const cr::priv::IoOperation& operation)
+    {
+        std::size_t size = std::min(operation.size, MaximumTransfer);
+        ssize_t result = 0;
+
+        do
+        {
+            switch (operation.type)
+            {
+                case cr::priv::IoOperation::Read:
+                    result = pread(operation.descriptor, operation.buffer, size, operation.offset);
+                    break;
+                case cr::priv::IoOperation::Write:
+                    result = pwrite(operation.descriptor, operation.buffer, size, operation.offset);
+                    break;
+                default:
+                    result = 0;
+                    break;
+            }
+        }
+        while (result < 0 && errno == EINTR);
+
+        return result < 0 ? -static_cast<cr::Int64>(errno) : static_cast<cr::Int64>(result);
+    }
+
+} // namespace
+
+
+namespace cr
+{
+
+namespace priv
+{
+    UringImpl::UringImpl() :
+        m_ring         (-1),
+        m_entries      (0),
+        m_sqMemory     (NULL),
+        m_sqMemorySize (0),
+        m_cqMemory     (NULL),
+        m_cqMemorySize (0),
+        m_sqes         (NULL),
+        m_sqHead       (NULL),
+        m_sqTail       (NULL),
+        m_sqMask       (0),
+        m_sqArray      (NULL),
+        m_cqHead       (NULL),
+        m_cqTail       (NULL),
+        m_cqMask       (0),
+        m_cqes         (NULL),
+        m_preparedTail (0),
+        m_prepared     (0),
+        m_submitted    (0),
+        m_completed    (0),
+        m_submitEvent  (0),
+        m_isShutdown   (false)
+    {
+    }
+
+    UringImpl* UringImpl::create(std::size_t depth)
+    {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+
+        unsigned int entries = static_cast<unsigned int>(std::min<std::size_t>(std::max<std::size_t>(depth, 1), 4096));
+        int ring = setupRing(entries, &params);
+        if (ring < 0)
+            return NULL;
+
+        /*
+         * IORING_OP_READ and IORING_OP_WRITE appeared with this
+         * feature (Linux 5.6) : older kernels use the threads
+         */
+        if (!(params.features & IORING_FEAT_RW_CUR_POS))
+        {
+            ::close(ring);
+            return NULL;
+        }
+
+        UringImpl* impl = new UringImpl;
+        impl->m_ring = ring;
+        impl->m_entries = params.sq_entries;
+
+        impl->m_sqMemorySize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+        impl->m_cqMemorySize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        /*
+         * Both rings may share a single mapping
+         */
+        bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single)
+            impl->m_sqMemorySize = impl->m_cqMemorySize = std::max(impl->m_sqMemorySize, impl->m_cqMemorySize);
+
+        impl->m_sqMemory = mapRing(ring, impl->m_sqMemorySize, IORING_OFF_SQ_RING);
+        impl->m_cqMemory = single ? impl->m_sqMemory : mapRing(ring, impl->m_cqMemorySize, IORING_OFF_CQ_RING);
+        impl->m_sqes = static_cast<io_uring_sqe*>(mapRing(ring, params.sq_entries * sizeof(io_uring_sqe), IORING_OFF_SQES));
+
+        if (!impl->m_sqMemory || !impl->m_cqMemory || !impl->m_sqes)
+        {
+            delete impl;
+            return NULL;
+        }
+
+        impl->m_sqHead  = atOffset<unsigned int>(impl->m_sqMemory, params.sq_off.head);
+        impl->m_sqTail  = atOffset<unsigned int>(impl->m_sqMemory, params.sq_off.tail);
+        impl->m_sqMask  = *atOffset<unsigned int>(impl->m_sqMemory, params.sq_off.ring_mask);
+        impl->m_sqArray = atOffset<unsigned int>(impl->m_sqMemory, params.sq_off.array);
+        impl->m_cqHead  = atOffset<unsigned int>(impl->m_cqMemory, params.cq_off.head);
+        impl->m_cqTail  = atOffset<unsigned int>(impl->m_cqMemory, params.cq_off.tail);
+        impl->m_cqMask  = *atOffset<unsigned int>(impl->m_cqMemory, params.cq_off.ring_mask);
+        impl->m_cqes    = atOffset<io_uring_cqe>(impl->m_cqMemory, params.cq_off.cqes);
+
+        impl->m_preparedTail = *impl->m_sqTail;
+
+        return impl;
+    }
+
+    UringImpl::~UringImpl()
+    {
+        if (m_sqes)
+            munmap(m_sqes, m_entries * sizeof(io_uring_sqe));
+        if (m_cqMemory && m_cqMemory != m_sqMemory)
+            munmap(m_cqMemory, m_cqMemorySize);
+        if (m_sqMemory)
+            munmap(m_sqMemory, m_sqMemorySize);
+        if (m_ring >= 0)
+            ::close(m_ring);
+    }
+
+    IoRing::Backend UringImpl::getBackend() const
+    {
+        return IoRing::Uring;
+    }
+
+    bool UringImpl::prepare(const IoOperation& operation)
+    {
+        Lock lock(m_submitMutex);
+
+        /*
+         * The completion queue is twice as large as the submission
+         * queue : limiting the pending operations to the size of the
+         * latter, neither queue can overflow
+         */
+        if (m_prepared.load() - m_completed.load() >= m_entries)
+            return false;
+
+        unsigned int index = m_preparedTail & m_sqMask;
+        io_uring_sqe* sqe = &m_sqes[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+
+        switch (operation.type)
+        {
+            case IoOperation::Read:  sqe->opcode = IORING_OP_READ; break;
+            case IoOperation::Write: sqe->opcode = IORING_OP_WRITE; break;
+            default:                 sqe->opcode = IORING_OP_NOP; break;
+        }
+
+        sqe->fd = operation.descriptor;
+        sqe->addr = reinterpret_cast<Uint64>(operation.buffer);
+        sqe->len = static_cast<Uint32>(std::min(operation.size, MaximumTransfer));
+        sqe->off = operation.offset;
+        sqe->user_data = operation.userData;
+
+        m_sqArray[index] = index;
+        ++m_preparedTail;
+        ++m_prepared;
+
+        return true;
+    }
+
+    std::size_t UringImpl::submit()
+    {
+        Lock lock(m_submitMutex);
+
+        unsigned int count = static_cast<unsigned int>(m_prepared.load() - m_submitted.load());
+        if (count == 0)
+            return 0;
+
+        /*
+         * Publish the prepared entries to the kernel
+         */
+        __atomic_store_n(m_sqTail, m_preparedTail, __ATOMIC_RELEASE);
+
+        /*
+         * EAGAIN : the kernel is short of memory for the requests,
+         * retry a few times, leaving it some time. Entries not
+         * consumed stay in the ring and go with the next submit()
+         */
+        unsigned int submitted = 0;
+        unsigned int attempts = 0;
+        while (submitted < count)
+        {
+            int result = enterRing(m_ring, count - submitted, 0, 0);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                if (errno == EAGAIN && ++attempts < MaximumSubmitAttempts)
+                {
+                    ::usleep(attempts * 100);
+                    continue;
+                }
+
+                std::cerr << "Failed to submit I/O operations (" << std::strerror(errno) << ")" << std::endl;
+                break;
+            }
+
+            if (result == 0)
+                break;
+
+            submitted += result;
+        }
+
+        if (submitted > 0)
+        {
+            m_submitted += submitted;
+
+            /*
+             * Wake up the threads waiting for completions on an idle ring
+             */
+            ++m_submitEvent;
+            priv::futexWake(&m_submitEvent, INT_MAX);
+        }
+
+        return submitted;
+    }
+
+    std::size_t UringImpl::waitCompletions(IoCompletion* completions, std::size_t maximum, std::size_t minimum)
+    {
+        Lock lock(m_completeMutex);
+
+        std::size_t count = 0;
+        minimum = std::min(minimum, maximum);
+
+        for (;;)
+        {
+            unsigned int head = *m_cqHead;
+            unsigned int tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+            std::size_t consumed = 0;
+
+            while (head != tail && count < maximum)
+            {
+                const io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+                completions[count].userData = cqe.user_data;
+                completions[count].result = cqe.res;
+                ++head;
+                ++count;
+                ++consumed;
+            }
+
+            __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+            m_completed += consumed;
+
+            if (count >= minimum)
+                return count;
+
+            /*
+             * Nothing in flight : sleep until a submission or a
+             * shutdown, the event being read before the counters
+             */
+            Int32 event = m_submitEvent.load();
+            std::size_t inFlight = m_submitted.load() - m_completed.load();
+            if (inFlight == 0)
+            {
+                if (m_isShutdown.load())
+                    return count;
+
+                priv::futexWait(&m_submitEvent, event);
+                continue;
+            }
+
+            unsigned int wait = static_cast<unsigned int>(std::min(minimum - count, inFlight));
+            if (enterRing(m_ring, 0, wait, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+            {
+                std::cerr << "Failed to wait for I/O completions (" << std::strerror(errno) << ")" << std::endl;
+                return count;
+            }
+        }
+    }
+
+    std::size_t UringImpl::getPendingCount() const
+    {
+        return m_prepared.load() - m_completed.load();
+    }
+
+    void UringImpl::shutdown()
+    {
+        m_isShutdown = true;
+        ++m_submitEvent;
+        priv::futexWake(&m_submitEvent, INT_MAX);
+    }
+
+
+    ThreadedIoImpl::ThreadedIoImpl(std::size_t depth) :
+        m_depth    (std::max<std::size_t>(depth, 1)),
+        m_pending  (0),
+        m_running   (0),
+        m_isStopped (false),
+        m_isShutdown(false)
+    {
+        /*
+         * A few threads are enough to keep a disk busy
+         */
+        std::size_t count = std::min<std::size_t>(m_depth, 8);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            m_workers.push_back(new Thread(&ThreadedIoImpl::work, this));
+            m_workers.back()->launch();
+        }
+    }
+
+    ThreadedIoImpl::~ThreadedIoImpl()
+    {
+        {
+            Lock lock(m_mutex);
+            m_isStopped = true;
+        }
+        m_workReady.notifyAll();
+
+        for (std::size_t i = 0; i < m_workers.size(); ++i)
+        {
+            m_workers[i]->wait();
+            delete m_workers[i];
+        }
+    }
+
+    IoRing::Backend ThreadedIoImpl::getBackend() const
+    {
+        return IoRing::Threads;
+    }
+
+    bool ThreadedIoImpl::prepare(const IoOperation& operation)
+    {
+        Lock lock(m_mutex);
+
+        if (m_pending >= m_depth)
+            return false;
+
+        m_prepared.push_back(operation);
+        ++m_pending;
+
+        return true;
+    }
+
+    std::size_t ThreadedIoImpl::submit()
+    {
+        std::size_t count;
+        {
+            Lock lock(m_mutex);
+
+            count = m_prepared.size();
+            m_queue.insert(m_queue.end(), m_prepared.begin(), m_prepared.end());
+            m_prepared.clear();
+        }
+
+        if (count > 0)
+            m_workReady.notifyAll();
+
+        return count;
+    }
+
+    std::size_t ThreadedIoImpl::waitCompletions(IoCompletion* completions, std::size_t maximum, std::size_t minimum)
+    {
+        Lock lock(m_mutex);
+
+        minimum = std::min(minimum, maximum);
+
+        /*
+         * With nothing in flight, the completions come from operations
+         * submitted later : wait for them, unless shut down
+         */
+        while (m_completed.size() < minimum && (m_queue.size() + m_running > 0 || !m_isShutdown))
+            m_workDone.wait(lock);
+
+        std::size_t count = std::min(maximum, m_completed.size());
+        std::copy(m_completed.begin(), m_completed.begin() + count, completions);
+        m_completed.erase(m_completed.begin(), m_completed.begin() + count);
+        m_pending -= count;
+
+        return count;
+    }
+
+    std::size_t ThreadedIoImpl::getPendingCount() const
+    {
+        Lock lock(m_mutex);
+        return m_pending;
+    }
+
+    void ThreadedIoImpl::shutdown()
+    {
+        {
+            Lock lock(m_mutex);
+            m_isShutdown = true;
+        }
+        m_workDone.notifyAll();
+    }
+
+    void ThreadedIoImpl::work()
+    {
+        Lock lock(m_mutex);
+
+        for (;;)
+        {
+            while (m_queue.empty() && !m_isStopped)
+                m_workReady.wait(lock);
+
+            if (m_queue.empty())
+                return;
+
+            IoOperation operation = m_queue.front();
+            m_queue.pop_front();
+            ++m_running;
+
+            lock.unlock();
+            IoCompletion completion;
+            completion.userData = operation.userData;
+            completion.result = execute(operation);
+            lock.lock();
+
+            m_completed.push_back(completion);
+            --m_running;
+            m_workDone.notifyAll();
+        }
+    }
+
+} // namespace priv
+
+} // namespace cr
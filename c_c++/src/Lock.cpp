@@ -0,0 +1,43 @@
+#include <Lock.hpp>
+#include <Mutex.hpp>
+
+namespace cr
+{
+
+    Lock::Lock(Mutex& mutex) :
+        m_mutex   (mutex),
+        m_isLocked(true)
+    {
+        m_mutex.lock();
+    }
+
+    Lock::~Lock()
+    {
+        if (m_isLocked)
+            m_mutex.unlock();
+    }
+
+    void Lock::lock()
+    {
+        if (!m_isLocked)
+        {
+            m_mutex.lock();
+            m_isLocked = true;
+        }
+    }
+
+    void Lock::unlock()
+    {
+        if (m_isLocked)
+        {
+            m_mutex.unlock();
+            m_isLocked = false;
+        }
+    }
+
+    bool Lock::isLocked() const
+    {
+        return m_isLocked;
+    }
+
+} // namespace cr
@@ -0,0 +1,191 @@
+#include <MappedFile.hpp>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    int toAdvice(cr::MappedFile::AccessPattern pattern)
+    {
+        switch (pattern)
+        {
+            case cr::MappedFile::Sequential: return MADV_SEQUENTIAL;
+            case cr::MappedFile::Random:     return MADV_RANDOM;
+            default:                         return MADV_NORMAL;
+        }
+    }
+
+} // namespace
+
+
+namespace cr
+{
+
+    MappedFile::MappedFile() :
+        m_data  (NULL),
+        m_size  (0),
+        m_isOpen(false)
+    {
+    }
+
+    MappedFile::MappedFile(const std::string& filename, AccessPattern pattern) :
+        m_data  (NULL),
+        m_size  (0),
+        m_isOpen(false)
+    {
+        open(filename, pattern);
+    }
+
+    MappedFile::MappedFile(MappedFile&& source) :
+        m_data  (source.m_data),
+        m_size  (source.m_size),
+        m_isOpen(source.m_isOpen)
+    {
+        source.m_data = NULL;
+        source.m_size = 0;
+        source.m_isOpen = false;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile& MappedFile::operator = (MappedFile&& source)
+    {
+        if (this != &source)
+        {
+            close();
+
+            m_data = source.m_data;
+            m_size = source.m_size;
+            m_isOpen = source.m_isOpen;
+
+            source.m_data = NULL;
+            source.m_size = 0;
+            source.m_isOpen = false;
+        }
+
+        return *this;
+    }
+
+    bool MappedFile::open(const std::string& filename, AccessPattern pattern)
+    {
+        close();
+
+        int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            std::cerr << "Failed to open file \"" << filename << "\" (" << std::strerror(errno) << ")" << std::endl;
+            return false;
+        }
+
+        struct stat status;
+        if (fstat(fd, &status) != 0 || !S_ISREG(status.st_mode))
+        {
+            std::cerr << "Failed to map file \"" << filename << "\" (not a regular file)" << std::endl;
+            ::close(fd);
+            return false;
+        }
+
+        /*
+         * An empty file cannot be mapped, but is a valid empty content
+         */
+        std::size_t size = static_cast<std::size_t>(status.st_size);
+        if (size > 0)
+        {
+            void* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                std::cerr << "Failed to map file \"" << filename << "\" (" << std::strerror(errno) << ")" << std::endl;
+                ::close(fd);
+                return false;
+            }
+
+            m_data = data;
+        }
+
+        /*
+         * The mapping keeps its own reference to the file
+         */
+        ::close(fd);
+
+        m_size = size;
+        m_isOpen = true;
+        advise(pattern);
+
+        return true;
+    }
+
+    void MappedFile::close()
+    {
+        if (m_data)
+            munmap(m_data, m_size);
+
+        m_data = NULL;
+        m_size = 0;
+        m_isOpen = false;
+    }
+
+    bool MappedFile::isOpen() const
+    {
+        return m_isOpen;
+    }
+
+    void MappedFile::advise(AccessPattern pattern)
+    {
+        if (!m_data)
+            return;
+
+        madvise(m_data, m_size, toAdvice(pattern));
+
+        /*
+         * A file read sequentially will be read entirely :
+         * start reading it now
+         */
+        if (pattern == Sequential)
+            madvise(m_data, m_size, MADV_WILLNEED);
+    }
+
+    void MappedFile::prefetch(std::size_t offset, std::size_t size)
+    {
+        if (!m_data || offset >= m_size)
+            return;
+
+        if (size > m_size - offset)
+            size = m_size - offset;
+
+        /*
+         * madvise wants a page-aligned address
+         */
+        std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        std::size_t aligned = offset - offset % page;
+
+        madvise(static_cast<char*>(m_data) + aligned, size + (offset - aligned), MADV_WILLNEED);
+    }
+
+    const char* MappedFile::getData() const
+    {
+        return static_cast<const char*>(m_data);
+    }
+
+    std::size_t MappedFile::getSize() const
+    {
+        return m_size;
+    }
+
+    Utf8View MappedFile::getView() const
+    {
+        return Utf8View(getData(), m_size);
+    }
+
+    String MappedFile::toString() const
+    {
+        return getView().skipBom().toString();
+    }
+
+} // namespace cr
@@ -0,0 +1,67 @@
+#include <Mutex.hpp>
+#include <FutexImpl.hpp>
+#include <algorithm>
+
+namespace
+{
+    /*
+     * Bounds of the spin before sleeping, in iterations of the
+     * loop (a pause instruction and a load each)
+     */
+    const cr::Int32 MinSpins = 16;
+    const cr::Int32 MaxSpins = 2000;
+}
+
+namespace cr
+{
+
+    Mutex::Mutex() :
+        m_state(0),
+        m_spins(MinSpins)
+    {
+    }
+
+    void Mutex::wakeOne()
+    {
+        priv::futexWake(&m_state, 1);
+    }
+
+    void Mutex::lockSlow()
+    {
+        /*
+         * Spin while the owner runs on another CPU, up to twice
+         * the recent average ; no spinning once threads sleep
+         */
+        if (priv::isMultiCore())
+        {
+            Int32 spins = m_spins.load(std::memory_order_relaxed);
+            Int32 limit = std::min(std::max(spins * 2, MinSpins), MaxSpins);
+
+            for (Int32 i = 0; i < limit; ++i)
+            {
+                Int32 state = m_state.load(std::memory_order_relaxed);
+                if (state == 2)
+                    break;
+
+                if (state == 0 && m_state.compare_exchange_weak(state, 1, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    m_spins.store(spins + (i - spins) / 8, std::memory_order_relaxed);
+                    return;
+                }
+
+                priv::cpuRelax();
+            }
+
+            m_spins.store(spins + (limit - spins) / 8, std::memory_order_relaxed);
+        }
+
+        lockContended();
+    }
+
+    void Mutex::lockContended()
+    {
+        while (m_state.exchange(2, std::memory_order_acquire) != 0)
+            priv::futexWait(&m_state, 2);
+    }
+
+} // namespace cr
@@ -0,0 +1,371 @@
+#include <Normalization.hpp>
+#include <UnicodeTables.hpp>
+#include <algorithm>
+#include <string>
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace
+{
+    typedef std::basic_string<cr::Uint32> Buffer;
+
+    /*
+     * Hangul syllables are composed algorithmically (Unicode 3.12)
+     */
+    const cr::Uint32 SBase  = 0xAC00;
+    const cr::Uint32 LBase  = 0x1100;
+    const cr::Uint32 VBase  = 0x1161;
+    const cr::Uint32 TBase  = 0x11A7;
+    const cr::Uint32 LCount = 19;
+    const cr::Uint32 VCount = 21;
+    const cr::Uint32 TCount = 28;
+    const cr::Uint32 NCount = VCount * TCount;
+    const cr::Uint32 SCount = LCount * NCount;
+
+    enum QuickCheck
+    {
+        Yes,
+        No,
+        Maybe
+    };
+
+    inline bool isCompatibility(cr::NormalizationForm form)
+    {
+        return form == cr::NFKC || form == cr::NFKD;
+    }
+
+    inline bool isComposed(cr::NormalizationForm form)
+    {
+        return form == cr::NFC || form == cr::NFKC;
+    }
+
+    /*
+     * Characters below this limit are starters, and are
+     * unchanged by the normalization form
+     */
+    inline cr::Uint32 getStableLimit(cr::NormalizationForm form)
+    {
+        switch (form)
+        {
+            case cr::NFC: return 0x300;
+            case cr::NFD: return 0xC0;
+            default:      return 0xA0;
+        }
+    }
+
+    inline cr::Uint8 getCombiningClass(cr::Uint32 codepoint)
+    {
+        return codepoint < 0x300 ? 0 : cr::priv::getNormRecord(codepoint).ccc;
+    }
+
+    /*
+     * Quick check algorithm of UAX #15 ; \a stop receives the
+     * position of the first character which is not a "yes"
+     */
+    QuickCheck quickCheck(const cr::Uint32* begin, const cr::Uint32* end, cr::NormalizationForm form, std::size_t* stop)
+    {
+        using namespace cr::priv;
+
+        static const cr::Uint8 noFlags[]    = { NfcNo, NfdNo, NfkcNo, NfkdNo };
+        static const cr::Uint8 maybeFlags[] = { NfcMaybe, 0, NfkcMaybe, 0 };
+
+        const cr::Uint8 noMask = noFlags[form];
+        const cr::Uint8 maybeMask = maybeFlags[form];
+        const cr::Uint32 limit = getStableLimit(form);
+
+        const cr::Uint32* current = begin;
+        cr::Uint8 lastClass = 0;
+
+        while (current < end)
+        {
+        #if defined(__SSE2__)
+            /*
+             * Skip four stable characters at a time ; the comparison is
+             * signed, so the sign bits are flipped to compare unsigned values
+             */
+            const __m128i sign = _mm_set1_epi32(static_cast<int>(0x80000000u));
+            const __m128i bound = _mm_set1_epi32(static_cast<int>(limit ^ 0x80000000u));
+
+            while (end - current >= 4)
+            {
+                __m128i chars = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(current)), sign);
+                if (_mm_movemask_epi8(_mm_cmplt_epi32(chars, bound)) != 0xFFFF)
+                    break;
+
+                current += 4;
+                lastClass = 0;
+            }
+
+            if (current == end)
+                break;
+        #endif
+
+            cr::Uint32 codepoint = *current;
+            if (codepoint < limit)
+            {
+                lastClass = 0;
+                ++current;
+                continue;
+            }
+
+            const NormRecord& record = getNormRecord(codepoint);
+
+            if ((record.ccc != 0 && lastClass > record.ccc) || (record.flags & noMask))
+            {
+                *stop = current - begin;
+                return No;
+            }
+
+            if (record.flags & maybeMask)
+            {
+                *stop = current - begin;
+                return Maybe;
+            }
+
+            lastClass = record.ccc;
+            ++current;
+        }
+
+        *stop = end - begin;
+        return Yes;
+    }
+
+    /*
+     * Find the full decomposition of a code point in a table
+     */
+    const cr::Uint32* findDecomposition(const cr::Uint32* codepoints, const cr::Uint32* index, cr::Uint32 count,
+                                        cr::Uint32 codepoint, std::size_t* length)
+    {
+        const cr::Uint32* end = codepoints + count;
+        const cr::Uint32* found = std::lower_bound(codepoints, end, codepoint);
+
+        if (found == end || *found != codepoint)
+            return NULL;
+
+        cr::Uint32 entry = index[found - codepoints];
+        *length = entry & 0x1F;
+
+        return cr::priv::DecompositionPool + (entry >> 5);
+    }
+
+    /*
+     * Append the full decomposition of [begin, end) to \a output
+     */
+    void decompose(const cr::Uint32* begin, const cr::Uint32* end, bool compatibility, Buffer& output)
+    {
+        using namespace cr::priv;
+
+        const cr::Uint8 mask = compatibility ? NfkdNo : NfdNo;
+        const cr::Uint32 limit = compatibility ? 0xA0 : 0xC0;
+
+        for (; begin < end; ++begin)
+        {
+            cr::Uint32 codepoint = *begin;
+
+            if (codepoint < limit || !(getNormRecord(codepoint).flags & mask))
+            {
+                output.push_back(codepoint);
+                continue;
+            }
+
+            if (codepoint - SBase < SCount)
+            {
+                cr::Uint32 index = codepoint - SBase;
+
+                output.push_back(LBase + index / NCount);
+                output.push_back(VBase + (index % NCount) / TCount);
+                if (index % TCount)
+                    output.push_back(TBase + index % TCount);
+                continue;
+            }
+
+            std::size_t length = 0;
+            const cr::Uint32* mapping = NULL;
+
+            if (compatibility)
+                mapping = findDecomposition(CompatCodepoints, CompatIndex, CompatCount, codepoint, &length);
+            if (!mapping)
+                mapping = findDecomposition(CanonicalCodepoints, CanonicalIndex, CanonicalCount, codepoint, &length);
+
+            output.append(mapping, length);
+        }
+    }
+
+    /*
+     * Sort each run of non-starters by combining class (stable),
+     * starting at \a start
+     */
+    void reorder(Buffer& buffer, std::size_t start)
+    {
+        for (std::size_t i = start + 1; i < buffer.size(); ++i)
+        {
+            cr::Uint32 codepoint = buffer[i];
+            cr::Uint8 ccc = getCombiningClass(codepoint);
+            if (ccc == 0)
+                continue;
+
+            std::size_t j = i;
+            while (j > start)
+            {
+                cr::Uint8 previous = getCombiningClass(buffer[j - 1]);
+                if (previous <= ccc)
+                    break;
+
+                buffer[j] = buffer[j - 1];
+                --j;
+            }
+
+            buffer[j] = codepoint;
+        }
+    }
+
+    /*
+     * Primary composite of a pair, or 0 if there is none
+     */
+    cr::Uint32 composePair(cr::Uint32 first, cr::Uint32 second)
+    {
+        using namespace cr::priv;
+
+        if (first - LBase < LCount && second - VBase < VCount)
+            return SBase + ((first - LBase) * VCount + (second - VBase)) * TCount;
+
+        if (first - SBase < SCount && (first - SBase) % TCount == 0 && second - TBase - 1 < TCount - 1)
+            return first + (second - TBase);
+
+        cr::Uint64 key = (static_cast<cr::Uint64>(first) << 32) | second;
+        const cr::Uint64* end = CompositionKeys + CompositionCount;
+        const cr::Uint64* found = std::lower_bound(CompositionKeys, end, key);
+
+        return (found != end && *found == key) ? CompositionValues[found - CompositionKeys] : 0;
+    }
+
+    /*
+     * Canonical composition of a decomposed and reordered
+     * buffer, starting at \a start (which must be a starter)
+     */
+    void compose(Buffer& buffer, std::size_t start)
+    {
+        using namespace cr::priv;
+
+        const std::size_t none = static_cast<std::size_t>(-1);
+        std::size_t starter = none;
+        std::size_t output = start;
+        cr::Uint8 lastClass = 0;
+
+        for (std::size_t i = start; i < buffer.size(); ++i)
+        {
+            cr::Uint32 codepoint = buffer[i];
+            cr::Uint8 ccc = 0;
+            cr::Uint8 flags = 0;
+
+            if (codepoint >= 0x300)
+            {
+                const NormRecord& record = getNormRecord(codepoint);
+                ccc = record.ccc;
+                flags = record.flags;
+            }
+
+            /*
+             * The character combines with the last starter if nothing
+             * blocks it : either it follows the starter, or all the
+             * characters in between have a lower non-zero class
+             */
+            if (starter != none && (flags & (NfcMaybe | NfkcMaybe)) &&
+                (output == starter + 1 || (lastClass != 0 && lastClass < ccc)))
+            {
+                cr::Uint32 composite = composePair(buffer[starter], codepoint);
+                if (composite)
+                {
+                    buffer[starter] = composite;
+                    continue;
+                }
+            }
+
+            if (ccc == 0)
+                starter = output;
+
+            lastClass = ccc;
+            buffer[output++] = codepoint;
+        }
+
+        buffer.resize(output);
+    }
+
+    /*
+     * Normalize a string which fails the quick check at \a stop ;
+     * the characters before the last starter preceding \a stop are
+     * copied as is, only the rest is decomposed and recomposed
+     */
+    void normalizeTail(const cr::Uint32* data, std::size_t size, std::size_t stop,
+                       cr::NormalizationForm form, Buffer& buffer)
+    {
+        std::size_t start = stop;
+        while (start > 0)
+        {
+            --start;
+            if (getCombiningClass(data[start]) == 0)
+                break;
+        }
+
+        buffer.reserve(size + size / 4 + 8);
+        buffer.assign(data, start);
+
+        decompose(data + start, data + size, isCompatibility(form), buffer);
+        reorder(buffer, start);
+
+        if (isComposed(form))
+            compose(buffer, start);
+    }
+
+} // namespace
+
+
+namespace cr
+{
+
+    bool isNormalized(StringView str, NormalizationForm form)
+    {
+        std::size_t stop;
+        QuickCheck result = quickCheck(str.begin(), str.end(), form, &stop);
+
+        if (result != Maybe)
+            return result == Yes;
+
+        Buffer buffer;
+        normalizeTail(str.getData(), str.getSize(), stop, form, buffer);
+
+        return buffer.size() == str.getSize() && std::equal(buffer.begin(), buffer.end(), str.begin());
+    }
+
+    String normalize(StringView str, NormalizationForm form)
+    {
+        std::size_t stop;
+        if (quickCheck(str.begin(), str.end(), form, &stop) == Yes)
+            return str.toString();
+
+        Buffer buffer;
+        normalizeTail(str.getData(), str.getSize(), stop, form, buffer);
+
+        return String(buffer);
+    }
+
+    bool normalizeInPlace(String& str, NormalizationForm form)
+    {
+        StringView view(str);
+
+        std::size_t stop;
+        if (quickCheck(view.begin(), view.end(), form, &stop) == Yes)
+            return false;
+
+        Buffer buffer;
+        normalizeTail(view.getData(), view.getSize(), stop, form, buffer);
+
+        if (buffer.size() == view.getSize() && std::equal(buffer.begin(), buffer.end(), view.begin()))
+            return false;
+
+        str = String(buffer);
+        return true;
+    }
+
+} // namespace cr
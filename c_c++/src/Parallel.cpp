@@ -0,0 +1,15 @@
+#include <Parallel.hpp>
+
+namespace cr
+{
+
+    TaskScheduler& getDefaultScheduler()
+    {
+        /*
+         * Thread-safe initialization of a function-local static (C++11)
+         */
+        static TaskScheduler scheduler;
+        return scheduler;
+    }
+
+} // namespace cr
@@ -0,0 +1,47 @@
+#include <PrefixTrie.hpp>
+#include <Utf.hpp>
+
+namespace cr
+{
+
+namespace priv
+{
+    TrieKey::TrieKey(StringView key) :
+        m_data(m_local),
+        m_size(0)
+    {
+        /*
+         * A character takes at most 4 bytes in UTF-8
+         */
+        std::size_t capacity = key.getSize() * 4;
+        if (capacity > sizeof(m_local))
+            m_data = new Uint8[capacity];
+
+        Uint8* end = Utf32::toUtf8(key.begin(), key.end(), m_data);
+        m_size = end - m_data;
+    }
+
+    TrieKey::~TrieKey()
+    {
+        if (m_data != m_local)
+            delete [] m_data;
+    }
+
+    std::size_t TrieKey::countCharacters(const Uint8* begin, const Uint8* end)
+    {
+        /*
+         * Count the bytes which start a character
+         */
+        std::size_t count = 0;
+        for (; begin < end; ++begin)
+        {
+            if ((*begin & 0xC0) != 0x80)
+                ++count;
+        }
+
+        return count;
+    }
+
+} // namespace priv
+
+} // namespace cr
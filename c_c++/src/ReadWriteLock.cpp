@@ -0,0 +1,149 @@
+#include <ReadWriteLock.hpp>
+#include <FutexImpl.hpp>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sched.h>
+#include <unistd.h>
+
+namespace
+{
+    const std::size_t CacheLine = 64;
+    const std::size_t MaxSlots = 256;
+
+    /*
+     * Number of slots : the CPUs, rounded up to a power of two
+     */
+    std::size_t getSlotCount()
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_CONF);
+
+        std::size_t count = 1;
+        while (count < static_cast<std::size_t>(cpus > 0 ? cpus : 1) && count < MaxSlots)
+            count *= 2;
+
+        return count;
+    }
+
+}
+
+namespace cr
+{
+namespace priv
+{
+    unsigned int getReaderCpu()
+    {
+        /*
+         * A thread moved to another CPU keeps its slot, so
+         * that its unlock finds the right counter
+         */
+        int cpu = sched_getcpu();
+        return cpu < 0 ? 0 : static_cast<unsigned int>(cpu);
+    }
+} // namespace priv
+
+
+    ReadWriteLock::ReadWriteLock() :
+        m_slots  (NULL),
+        m_memory (NULL),
+        m_mask   (0),
+        m_writer (0),
+        m_drained(0)
+    {
+        std::size_t count = getSlotCount();
+
+        if (posix_memalign(&m_memory, CacheLine, count * sizeof(priv::ReaderSlot)) != 0)
+        {
+            std::cerr << "Failed to allocate the reader counters" << std::endl;
+            throw std::bad_alloc();
+        }
+
+        m_slots = static_cast<priv::ReaderSlot*>(m_memory);
+        for (std::size_t i = 0; i < count; ++i)
+            new (&m_slots[i].readers) std::atomic<Int32>(0);
+
+        m_mask = count - 1;
+    }
+
+    ReadWriteLock::~ReadWriteLock()
+    {
+        std::free(m_memory);
+    }
+
+    void ReadWriteLock::lockSharedSlow()
+    {
+        for (;;)
+        {
+            /*
+             * Sleep until the writer is done
+             */
+            Int32 writer = m_writer.load(std::memory_order_relaxed);
+            while (writer != 0)
+            {
+                if (writer == 2 || m_writer.compare_exchange_weak(writer, 2, std::memory_order_relaxed))
+                    priv::futexWait(&m_writer, 2);
+                writer = m_writer.load(std::memory_order_relaxed);
+            }
+
+            if (tryLockShared())
+                return;
+        }
+    }
+
+    void ReadWriteLock::notifyWriter()
+    {
+        m_drained.fetch_add(1, std::memory_order_seq_cst);
+        priv::futexWake(&m_drained, 1);
+    }
+
+    void ReadWriteLock::lock()
+    {
+        m_writeLock.lock();
+        m_writer.store(1, std::memory_order_seq_cst);
+
+        for (std::size_t i = 0; i <= m_mask; ++i)
+        {
+            for (;;)
+            {
+                Int32 drained = m_drained.load(std::memory_order_seq_cst);
+                if (m_slots[i].readers.load(std::memory_order_seq_cst) == 0)
+                    break;
+
+                priv::futexWait(&m_drained, drained);
+            }
+        }
+    }
+
+    void ReadWriteLock::unlock()
+    {
+        if (m_writer.exchange(0, std::memory_order_seq_cst) == 2)
+            priv::futexWake(&m_writer, INT_MAX);
+
+        m_writeLock.unlock();
+    }
+
+
+    ReadLock::ReadLock(ReadWriteLock& lock) :
+        m_lock(lock)
+    {
+        m_lock.lockShared();
+    }
+
+    ReadLock::~ReadLock()
+    {
+        m_lock.unlockShared();
+    }
+
+    WriteLock::WriteLock(ReadWriteLock& lock) :
+        m_lock(lock)
+    {
+        m_lock.lock();
+    }
+
+    WriteLock::~WriteLock()
+    {
+        m_lock.unlock();
+    }
+
+} // namespace cr
@@ -0,0 +1,103 @@
+#include <Semaphore.hpp>
+#include <Clock.hpp>
+#include <FutexImpl.hpp>
+
+namespace
+{
+    /*
+     * Iterations of the spin before sleeping
+     */
+    const int SpinCount = 100;
+}
+
+namespace cr
+{
+
+    Semaphore::Semaphore(unsigned int count) :
+        m_count  (static_cast<Int32>(count)),
+        m_waiters(0)
+    {
+    }
+
+    void Semaphore::wait()
+    {
+        waitFor(microseconds(-1));
+    }
+
+    bool Semaphore::tryWait()
+    {
+        Int32 count = m_count.load(std::memory_order_relaxed);
+
+        while (count > 0)
+        {
+            if (m_count.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        }
+
+        return false;
+    }
+
+    bool Semaphore::waitFor(Time timeout)
+    {
+        if (tryWait())
+            return true;
+
+        if (priv::isMultiCore())
+        {
+            for (int i = 0; i < SpinCount; ++i)
+            {
+                priv::cpuRelax();
+                if (m_count.load(std::memory_order_relaxed) > 0 && tryWait())
+                    return true;
+            }
+        }
+
+        bool isInfinite = timeout < Time::Zero;
+        Clock clock;
+
+        for (;;)
+        {
+            /*
+             * post() reads the waiters after changing the count :
+             * either it sees this thread, or the futex sees the count
+             */
+            m_waiters.fetch_add(1, std::memory_order_seq_cst);
+
+            bool isAwake = true;
+            if (m_count.load(std::memory_order_seq_cst) <= 0)
+            {
+                if (isInfinite)
+                {
+                    priv::futexWait(&m_count, 0);
+                }
+                else
+                {
+                    Time remaining = timeout - clock.getElapsedTime();
+                    isAwake = remaining > Time::Zero && priv::futexWait(&m_count, 0, remaining);
+                }
+            }
+
+            m_waiters.fetch_sub(1, std::memory_order_relaxed);
+
+            if (tryWait())
+                return true;
+            if (!isAwake)
+                return false;
+        }
+    }
+
+    void Semaphore::post(unsigned int count)
+    {
+        m_count.fetch_add(static_cast<Int32>(count), std::memory_order_seq_cst);
+
+        if (m_waiters.load(std::memory_order_seq_cst) > 0)
+            priv::futexWake(&m_count, static_cast<int>(count));
+    }
+
+    unsigned int Semaphore::getCount() const
+    {
+        Int32 count = m_count.load(std::memory_order_relaxed);
+        return count > 0 ? static_cast<unsigned int>(count) : 0;
+    }
+
+} // namespace cr
@@ -0,0 +1,60 @@
+#include <SpscRecordQueue.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+namespace cr
+{
+
+    SpscRecordQueue::SpscRecordQueue(std::size_t capacity) :
+        m_buffer    (NULL),
+        m_capacity  (64),
+        m_tail      (0),
+        m_allocated (0),
+        m_cachedHead(0),
+        m_head      (0),
+        m_read      (0),
+        m_cachedTail(0)
+    {
+        while (m_capacity < capacity)
+            m_capacity *= 2;
+
+        void* memory = NULL;
+        if (posix_memalign(&memory, 64, m_capacity) != 0)
+        {
+            std::cerr << "Failed to allocate the buffer of the record queue" << std::endl;
+            throw std::bad_alloc();
+        }
+
+        m_buffer = static_cast<char*>(memory);
+    }
+
+    SpscRecordQueue::~SpscRecordQueue()
+    {
+        std::free(m_buffer);
+    }
+
+    bool SpscRecordQueue::write(const void* data, std::size_t size)
+    {
+        void* record = allocate(size);
+        if (!record)
+            return false;
+
+        std::memcpy(record, data, size);
+        publish();
+
+        return true;
+    }
+
+    std::size_t SpscRecordQueue::getMaximumSize() const
+    {
+        /*
+         * Half of the ring : when the queue is empty, either the
+         * record fits before the end of the ring, or the skipped end
+         * is larger than the record, which then fits at the beginning
+         */
+        return static_cast<std::size_t>(m_capacity / 2 - sizeof(Header));
+    }
+
+} // namespace cr
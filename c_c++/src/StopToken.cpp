@@ -0,0 +1,226 @@
+#include <StopToken.hpp>
+#include <algorithm>
+
+namespace cr
+{
+namespace priv
+{
+    StopState::StopState() :
+        m_isStopRequested(false),
+        m_references     (1),
+        m_callbacks      (NULL),
+        m_running        (NULL)
+    {
+    }
+
+    void StopState::addReference()
+    {
+        m_references.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void StopState::removeReference()
+    {
+        if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this;
+    }
+
+    bool StopState::isStopRequested() const
+    {
+        return m_isStopRequested.load(std::memory_order_acquire);
+    }
+
+    bool StopState::requestStop()
+    {
+        if (m_isStopRequested.exchange(true, std::memory_order_acq_rel))
+            return false;
+
+        Lock lock(m_mutex);
+        m_stoppingThread = std::this_thread::get_id();
+        m_changed.notifyAll();
+
+        /*
+         * The callbacks are invoked without the lock, so that they
+         * can unregister themselves or take other locks
+         */
+        while (m_callbacks)
+        {
+            StopCallbackBase* callback = m_callbacks;
+            m_callbacks = callback->m_next;
+            if (m_callbacks)
+                m_callbacks->m_previous = NULL;
+            callback->m_next = NULL;
+            m_running = callback;
+
+            lock.unlock();
+            callback->invoke();
+            lock.lock();
+
+            m_running = NULL;
+            m_changed.notifyAll();
+        }
+
+        return true;
+    }
+
+    bool StopState::sleep(Time duration)
+    {
+        Lock lock(m_mutex);
+
+        return !m_changed.waitFor(lock, duration, [this]() { return m_isStopRequested.load(std::memory_order_acquire); });
+    }
+
+    bool StopState::addCallback(StopCallbackBase* callback)
+    {
+        Lock lock(m_mutex);
+
+        if (m_isStopRequested.load(std::memory_order_acquire))
+            return false;
+
+        callback->m_previous = NULL;
+        callback->m_next = m_callbacks;
+        if (m_callbacks)
+            m_callbacks->m_previous = callback;
+        m_callbacks = callback;
+
+        return true;
+    }
+
+    void StopState::removeCallback(StopCallbackBase* callback)
+    {
+        Lock lock(m_mutex);
+
+        if (callback->m_previous || m_callbacks == callback)
+        {
+            if (callback->m_previous)
+                callback->m_previous->m_next = callback->m_next;
+            else
+                m_callbacks = callback->m_next;
+            if (callback->m_next)
+                callback->m_next->m_previous = callback->m_previous;
+            return;
+        }
+
+        /*
+         * Being invoked by another thread : it may use the callback
+         * until it returns (a callback destroying itself is not waited for)
+         */
+        if (m_stoppingThread != std::this_thread::get_id())
+            m_changed.wait(lock, [this, callback]() { return m_running != callback; });
+    }
+} // namespace priv
+
+
+    StopToken::StopToken() :
+        m_state(NULL)
+    {
+    }
+
+    StopToken::StopToken(priv::StopState* state) :
+        m_state(state)
+    {
+        if (m_state)
+            m_state->addReference();
+    }
+
+    StopToken::StopToken(const StopToken& other) :
+        m_state(other.m_state)
+    {
+        if (m_state)
+            m_state->addReference();
+    }
+
+    StopToken::StopToken(StopToken&& other) :
+        m_state(other.m_state)
+    {
+        other.m_state = NULL;
+    }
+
+    StopToken::~StopToken()
+    {
+        if (m_state)
+            m_state->removeReference();
+    }
+
+    StopToken& StopToken::operator =(StopToken other)
+    {
+        std::swap(m_state, other.m_state);
+        return *this;
+    }
+
+    bool StopToken::isStopRequested() const
+    {
+        return m_state && m_state->isStopRequested();
+    }
+
+    bool StopToken::isStopPossible() const
+    {
+        return m_state != NULL;
+    }
+
+    bool StopToken::sleep(Time duration) const
+    {
+        if (!m_state)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(std::max<Int64>(duration.asMicroseconds(), 0)));
+            return true;
+        }
+
+        return m_state->sleep(duration);
+    }
+
+
+    StopSource::StopSource() :
+        m_state(new priv::StopState)
+    {
+    }
+
+    StopSource::StopSource(NoStopState) :
+        m_state(NULL)
+    {
+    }
+
+    StopSource::StopSource(const StopSource& other) :
+        m_state(other.m_state)
+    {
+        if (m_state)
+            m_state->addReference();
+    }
+
+    StopSource::StopSource(StopSource&& other) :
+        m_state(other.m_state)
+    {
+        other.m_state = NULL;
+    }
+
+    StopSource::~StopSource()
+    {
+        if (m_state)
+            m_state->removeReference();
+    }
+
+    StopSource& StopSource::operator =(StopSource other)
+    {
+        std::swap(m_state, other.m_state);
+        return *this;
+    }
+
+    bool StopSource::requestStop()
+    {
+        return m_state && m_state->requestStop();
+    }
+
+    bool StopSource::isStopRequested() const
+    {
+        return m_state && m_state->isStopRequested();
+    }
+
+    bool StopSource::isStopPossible() const
+    {
+        return m_state != NULL;
+    }
+
+    StopToken StopSource::getToken() const
+    {
+        return StopToken(m_state);
+    }
+} // namespace cr
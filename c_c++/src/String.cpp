@@ -1,9 +1,60 @@
 #include <String.hpp>
 #include <Utf.hpp>
+#include <Utf8View.hpp>
 #include <iterator>
 #include <cstring>
 #include <iostream>
 
+namespace
+{
+    /*
+     * Encode UTF-32 characters as UTF-8 into a stream buffer,
+     * through a fixed-size chunk
+     */
+    bool writeUtf8(std::streambuf* buffer, const cr::Uint32* begin, const cr::Uint32* end)
+    {
+        char chunk[1024];
+        char* output = chunk;
+
+        while (begin < end)
+        {
+            /*
+             * Keep room for the longest UTF-8 sequence
+             */
+            if (output > chunk + sizeof(chunk) - 4)
+            {
+                if (buffer->sputn(chunk, output - chunk) != output - chunk)
+                    return false;
+
+                output = chunk;
+            }
+
+            cr::Uint32 codepoint = *begin++;
+            if (codepoint < 0x80)
+                *output++ = static_cast<char>(codepoint);
+            else
+                output = cr::Utf8::encode(codepoint, output);
+        }
+
+        return buffer->sputn(chunk, output - chunk) == output - chunk;
+    }
+
+    /*
+     * Write \a count fill characters into a stream buffer
+     */
+    bool writeFill(std::streambuf* buffer, char fill, std::size_t count)
+    {
+        for (; count > 0; --count)
+        {
+            if (std::streambuf::traits_type::eq_int_type(buffer->sputc(fill),
+                                                          std::streambuf::traits_type::eof()))
+                return false;
+        }
+
+        return true;
+    }
+}
+
 namespace cr
 {
     const std::size_t String::InvalidPos = std::basic_string<Uint32>::npos;
@@ -98,6 +149,12 @@ namespace cr
     {
     }
 
+    String::String(String&& source) :
+        m_string()
+    {
+        m_string.swap(source.m_string);
+    }
+
     String::operator std::string() const
     {
         return toAnsiString();
@@ -147,6 +204,24 @@ namespace cr
         return output;
     }
 
+    std::basic_string<Uint8> String::toUtf8() const
+    {
+        /*
+         * Prepare the output string
+         */
+        std::basic_string<Uint8> output;
+        output.reserve(m_string.length());
+
+        /*
+         * Convert
+         */
+        Utf32::toUtf8( m_string.begin(),
+                       m_string.end(),
+                       std::back_inserter(output) );
+
+        return output;
+    }
+
     std::basic_string<Uint16> String::toUtf16() const
     {
         /*
@@ -176,6 +251,17 @@ namespace cr
         return *this;
     }
 
+    String& String::operator = (String&& right)
+    {
+        if (this != &right)
+        {
+            m_string.swap(right.m_string);
+            right.m_string.clear();
+        }
+
+        return *this;
+    }
+
     String& String::operator += (const String& right)
     {
         m_string += right.m_string;
@@ -328,21 +414,131 @@ namespace cr
         return string;
     }
 
-#if 0
     std::ostream& operator << (std::ostream& os, const String& str)
     {
-        os << str.toAnsiString();
+        std::ostream::sentry sentry(os);
+
+        if (sentry)
+        {
+            std::streambuf* buffer = os.rdbuf();
+            std::size_t size = str.getSize();
+            std::size_t width = os.width() > 0 ? static_cast<std::size_t>(os.width()) : 0;
+            std::size_t padding = width > size ? width - size : 0;
+            bool padLeft = (os.flags() & std::ios_base::adjustfield) != std::ios_base::left;
+            bool good = true;
+
+            if (padding && padLeft)
+                good = writeFill(buffer, os.fill(), padding);
+
+            if (good)
+                good = writeUtf8(buffer, str.getData(), str.getData() + size);
+
+            if (good && padding && !padLeft)
+                good = writeFill(buffer, os.fill(), padding);
+
+            os.width(0);
+
+            if (!good)
+                os.setstate(std::ios_base::badbit);
+        }
+
         return os;
     }
 
     std::istream& operator >> (std::istream& is, String& str)
     {
-        std::string s;
-        is >> s;
-        str = s;
+        /*
+         * The sentry skips the leading whitespaces
+         */
+        std::istream::sentry sentry(is);
+
+        if (sentry)
+        {
+            std::ios_base::iostate state = std::ios_base::goodbit;
+            const std::ctype<char>& ctype = std::use_facet< std::ctype<char> >(is.getloc());
+            std::streambuf* buffer = is.rdbuf();
+
+            std::size_t limit = is.width() > 0 ? static_cast<std::size_t>(is.width())
+                                               : str.m_string.max_size();
+            std::size_t count = 0;
+
+            /*
+             * Decoded characters are gathered in a fixed-size chunk
+             * and appended to the string in bulk
+             */
+            Uint32 chunk[256];
+            std::size_t used = 0;
+
+            str.m_string.clear();
+
+            std::streambuf::int_type c = buffer->sgetc();
+            while (count < limit)
+            {
+                if (std::streambuf::traits_type::eq_int_type(c, std::streambuf::traits_type::eof()))
+                {
+                    state |= std::ios_base::eofbit;
+                    break;
+                }
+
+                Uint8 lead = static_cast<Uint8>(c);
+                if (lead < 0x80 && ctype.is(std::ctype_base::space, static_cast<char>(lead)))
+                    break;
+
+                c = buffer->snextc();
+
+                /*
+                 * Decode the trailing bytes of a multi-bytes sequence with
+                 * the ranges of cr::Utf8View::isValid, stopping at the first
+                 * byte which doesn't belong to it : a malformed sequence
+                 * gives a single U+FFFD, like in cr::TextReader
+                 */
+                Uint8 low;
+                Uint8 high;
+                std::size_t size = priv::getUtf8Size(lead, low, high);
+
+                Uint32 codepoint = lead;
+                if (size == 0)
+                {
+                    codepoint = 0xFFFD;
+                }
+                else if (size > 1)
+                {
+                    codepoint &= 0x3F >> (size - 1);
+                    for (std::size_t i = 1; i < size; ++i)
+                    {
+                        if (std::streambuf::traits_type::eq_int_type(c, std::streambuf::traits_type::eof()) ||
+                            static_cast<Uint8>(c) < low || static_cast<Uint8>(c) > high)
+                        {
+                            codepoint = 0xFFFD;
+                            break;
+                        }
+
+                        codepoint = (codepoint << 6) | (static_cast<Uint8>(c) & 0x3F);
+                        c = buffer->snextc();
+                        low = 0x80;
+                        high = 0xBF;
+                    }
+                }
+
+                chunk[used++] = codepoint;
+                ++count;
+                if (used == sizeof(chunk) / sizeof(chunk[0]))
+                {
+                    str.m_string.append(chunk, used);
+                    used = 0;
+                }
+            }
+
+            str.m_string.append(chunk, used);
+            is.width(0);
+
+            if (count == 0)
+                state |= std::ios_base::failbit;
+
+            is.setstate(state);
+        }
 
         return is;
     }
-#endif
 
 }; // namespace cr
@@ -0,0 +1,317 @@
+#include <StringBuilder.hpp>
+#include <Utf.hpp>
+#include <Utf8View.hpp>
+#include <cstdio>
+#include <cstring>
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace cr
+{
+    StringBuilder::StringBuilder()
+    {
+    }
+
+    StringBuilder::StringBuilder(std::size_t capacity)
+    {
+        m_buffer.reserve(capacity);
+    }
+
+    StringBuilder& StringBuilder::append(char ansiChar, const std::locale& locale)
+    {
+        return append(Utf32::decodeAnsi(ansiChar, locale));
+    }
+
+    StringBuilder& StringBuilder::append(const char* ansiString)
+    {
+        if (ansiString)
+            appendAnsi(ansiString, ansiString + std::strlen(ansiString), NULL);
+
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::append(const char* ansiString, const std::locale& locale)
+    {
+        if (ansiString)
+            appendAnsi(ansiString, ansiString + std::strlen(ansiString), &locale);
+
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::append(const std::string& ansiString)
+    {
+        const char* data = ansiString.data();
+        appendAnsi(data, data + ansiString.size(), NULL);
+
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::append(const String& str)
+    {
+        return append(str.getData(), str.getData() + str.getSize());
+    }
+
+    StringBuilder& StringBuilder::append(const Uint32* begin, const Uint32* end)
+    {
+        if (begin < end)
+        {
+            grow(end - begin);
+            m_buffer.append(begin, end);
+        }
+
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::appendUtf8(const Uint8* begin, const Uint8* end)
+    {
+        if (begin >= end)
+            return *this;
+
+        /*
+         * A UTF-8 sequence never holds more characters than bytes :
+         * the buffer is sized once for the whole span, characters are
+         * written through a pointer, and the unused tail is cut at the end
+         */
+        std::size_t start = m_buffer.size();
+        grow(end - begin);
+        m_buffer.resize(start + (end - begin));
+
+        Uint32* output = &m_buffer[start];
+
+        while (begin < end)
+        {
+        #if defined(__SSE2__)
+            /*
+             * Widen runs of 16 ASCII bytes to UTF-32 at once
+             */
+            const __m128i zero = _mm_setzero_si128();
+
+            while (end - begin >= 16)
+            {
+                __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+                if (_mm_movemask_epi8(bytes) != 0)
+                    break;
+
+                __m128i low = _mm_unpacklo_epi8(bytes, zero);
+                __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output),      _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 4),  _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 8),  _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 12), _mm_unpackhi_epi16(high, zero));
+
+                begin += 16;
+                output += 16;
+            }
+
+            if (begin == end)
+                break;
+        #endif
+
+            if (*begin < 0x80)
+            {
+                *output++ = *begin++;
+                continue;
+            }
+
+            *output++ = priv::decodeUtf8(begin, end);
+        }
+
+        m_buffer.resize(output - m_buffer.data());
+
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::appendUtf8(const char* data, std::size_t size)
+    {
+        const Uint8* begin = reinterpret_cast<const Uint8*>(data);
+        return appendUtf8(begin, begin + size);
+    }
+
+    StringBuilder& StringBuilder::appendUtf16(const Uint16* begin, const Uint16* end)
+    {
+        if (begin < end)
+            grow(end - begin);
+
+        while (begin < end)
+        {
+            Uint32 codepoint;
+            begin = Utf16::decode(begin, end, codepoint);
+            m_buffer.push_back(codepoint);
+        }
+
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::appendNumber(Int32 number)
+    {
+        return appendNumber(static_cast<Int64>(number));
+    }
+
+    StringBuilder& StringBuilder::appendNumber(Uint32 number)
+    {
+        return appendNumber(static_cast<Uint64>(number));
+    }
+
+    StringBuilder& StringBuilder::appendNumber(Int64 number)
+    {
+        /*
+         * Work on the magnitude as unsigned, so that the smallest
+         * negative value doesn't overflow
+         */
+        Uint64 magnitude = static_cast<Uint64>(number);
+        if (number < 0)
+        {
+            append(static_cast<Uint32>('-'));
+            magnitude = 0 - magnitude;
+        }
+
+        return appendNumber(magnitude);
+    }
+
+    StringBuilder& StringBuilder::appendNumber(Uint64 number)
+    {
+        char digits[20];
+        char* end = digits + sizeof(digits);
+        char* begin = end;
+
+        do
+        {
+            *--begin = static_cast<char>('0' + number % 10);
+            number /= 10;
+        }
+        while (number);
+
+        appendDigits(begin, end);
+
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::appendNumber(long number)
+    {
+        return appendNumber(static_cast<Int64>(number));
+    }
+
+    StringBuilder& StringBuilder::appendNumber(unsigned long number)
+    {
+        return appendNumber(static_cast<Uint64>(number));
+    }
+
+    StringBuilder& StringBuilder::appendNumber(double number, int precision)
+    {
+        char digits[64];
+        int length = std::snprintf(digits, sizeof(digits), "%.*g", precision, number);
+
+        if (length > 0)
+        {
+            if (length >= static_cast<int>(sizeof(digits)))
+                length = sizeof(digits) - 1;
+
+            appendDigits(digits, digits + length);
+        }
+
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::appendFill(std::size_t count, Uint32 utf32Char)
+    {
+        grow(count);
+        m_buffer.append(count, utf32Char);
+
+        return *this;
+    }
+
+    void StringBuilder::reserve(std::size_t capacity)
+    {
+        if (capacity > m_buffer.capacity())
+            m_buffer.reserve(capacity);
+    }
+
+    void StringBuilder::shrinkToFit()
+    {
+        std::basic_string<Uint32>(m_buffer).swap(m_buffer);
+    }
+
+    void StringBuilder::clear()
+    {
+        m_buffer.clear();
+    }
+
+    String StringBuilder::toString() const
+    {
+        return String(m_buffer);
+    }
+
+    String StringBuilder::build()
+    {
+        String string;
+        string.m_string.swap(m_buffer);
+
+        /*
+         * Give back whatever the swap left in the builder
+         */
+        std::basic_string<Uint32>().swap(m_buffer);
+
+        return string;
+    }
+
+    void StringBuilder::grow(std::size_t count)
+    {
+        std::size_t required = m_buffer.size() + count;
+        std::size_t capacity = m_buffer.capacity();
+
+        if (required <= capacity)
+            return;
+
+        /*
+         * Geometric growth keeps appending amortized O(1)
+         */
+        std::size_t newCapacity = capacity < 16 ? 16 : capacity * 2;
+        if (newCapacity < required)
+            newCapacity = required;
+
+        m_buffer.reserve(newCapacity);
+    }
+
+    void StringBuilder::appendAnsi(const char* begin, const char* end, const std::locale* locale)
+    {
+        grow(end - begin);
+
+        /*
+         * Copy the ASCII prefix directly
+         */
+        while (begin < end && static_cast<Uint8>(*begin) < 0x80)
+            m_buffer.push_back(static_cast<Uint8>(*begin++));
+
+        if (begin == end)
+            return;
+
+        /*
+         * Convert the remaining characters, looking up the
+         * conversion facet only once
+         */
+        std::locale global;
+        const std::ctype<wchar_t>& facet =
+            std::use_facet< std::ctype<wchar_t> >(locale ? *locale : global);
+
+        while (begin < end)
+        {
+            if (static_cast<Uint8>(*begin) < 0x80)
+                m_buffer.push_back(static_cast<Uint8>(*begin));
+            else
+                m_buffer.push_back(static_cast<Uint32>(facet.widen(*begin)));
+
+            ++begin;
+        }
+    }
+
+    void StringBuilder::appendDigits(const char* begin, const char* end)
+    {
+        grow(end - begin);
+
+        while (begin < end)
+            m_buffer.push_back(static_cast<Uint8>(*begin++));
+    }
+
+} // namespace cr
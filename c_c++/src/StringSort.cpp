@@ -0,0 +1,291 @@
+#include <StringSort.hpp>
+#include <Thread.hpp>
+#include <algorithm>
+#include <atomic>
+#include <unistd.h>
+
+namespace cr
+{
+
+namespace priv
+{
+    /*
+     * A view remembering the position of its string in the
+     * input vector, so that the strings can be moved at the end
+     */
+    struct IndexedView
+    {
+        StringView  view;
+        std::size_t index;
+    };
+
+    inline const StringView& viewOf(const StringView& item)  { return item; }
+    inline const StringView& viewOf(const IndexedView& item) { return item.view; }
+
+    /*
+     * Code point at \a depth, or -1 past the end of the string
+     * (so that a prefix is ordered first)
+     */
+    template <typename Item>
+    inline Int64 keyAt(const Item& item, std::size_t depth)
+    {
+        const StringView& view = viewOf(item);
+        return depth < view.getSize() ? static_cast<Int64>(view[depth]) : -1;
+    }
+
+    /*
+     * Range of items sharing their first \a depth characters
+     */
+    template <typename Item>
+    struct SortTask
+    {
+        Item*       begin;
+        Item*       end;
+        std::size_t depth;
+    };
+
+    /*
+     * Below this size, a plain insertion sort is faster
+     */
+    const std::ptrdiff_t InsertionThreshold = 16;
+
+    template <typename Item>
+    void insertionSort(Item* begin, Item* end, std::size_t depth)
+    {
+        for (Item* i = begin + 1; i < end; ++i)
+        {
+            Item item = *i;
+            StringView key = viewOf(item).substring(depth);
+            Item* j = i;
+
+            while (j > begin && key < viewOf(*(j - 1)).substring(depth))
+            {
+                *j = *(j - 1);
+                --j;
+            }
+
+            *j = item;
+        }
+    }
+
+    /*
+     * Partition a range in three on the code point at its depth
+     * (lower, equal, greater than a median-of-three pivot) and
+     * push the resulting sub-ranges to \a stack.
+     */
+    template <typename Item>
+    void partition(const SortTask<Item>& task, std::vector< SortTask<Item> >& stack)
+    {
+        Item* begin = task.begin;
+        Item* end = task.end;
+        std::size_t depth = task.depth;
+        std::ptrdiff_t count = end - begin;
+
+        /*
+         * Median of three pivot
+         */
+        Int64 a = keyAt(begin[0], depth);
+        Int64 b = keyAt(begin[count / 2], depth);
+        Int64 c = keyAt(begin[count - 1], depth);
+        Int64 pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+
+        Item* lower = begin;
+        Item* current = begin;
+        Item* greater = end;
+
+        while (current < greater)
+        {
+            Int64 key = keyAt(*current, depth);
+
+            if (key < pivot)
+                std::swap(*lower++, *current++);
+            else if (key > pivot)
+                std::swap(*current, *--greater);
+            else
+                ++current;
+        }
+
+        SortTask<Item> low = { begin, lower, depth };
+        SortTask<Item> equal = { lower, greater, depth + 1 };
+        SortTask<Item> high = { greater, end, depth };
+
+        stack.push_back(low);
+        stack.push_back(high);
+
+        /*
+         * Strings which all ended at this depth are equal, nothing more to do
+         */
+        if (pivot >= 0)
+            stack.push_back(equal);
+    }
+
+    /*
+     * Sort all the ranges of \a stack completely
+     */
+    template <typename Item>
+    void sortTasks(std::vector< SortTask<Item> >& stack)
+    {
+        while (!stack.empty())
+        {
+            SortTask<Item> task = stack.back();
+            stack.pop_back();
+
+            std::ptrdiff_t count = task.end - task.begin;
+            if (count < 2)
+                continue;
+
+            if (count < InsertionThreshold)
+                insertionSort(task.begin, task.end, task.depth);
+            else
+                partition(task, stack);
+        }
+    }
+
+    /*
+     * Worker sorting independent ranges taken from a shared list
+     */
+    template <typename Item>
+    struct SortWorker
+    {
+        SortWorker(const std::vector< SortTask<Item> >* tasks, std::atomic<std::size_t>* next) :
+            m_tasks(tasks),
+            m_next (next)
+        {
+        }
+
+        void operator()()
+        {
+            std::vector< SortTask<Item> > stack;
+
+            for (;;)
+            {
+                std::size_t index = m_next->fetch_add(1);
+                if (index >= m_tasks->size())
+                    break;
+
+                stack.push_back((*m_tasks)[index]);
+                sortTasks(stack);
+            }
+        }
+
+        const std::vector< SortTask<Item> >* m_tasks;
+        std::atomic<std::size_t>*            m_next;
+    };
+
+    template <typename Item>
+    bool isLarger(const SortTask<Item>& left, const SortTask<Item>& right)
+    {
+        return (left.end - left.begin) > (right.end - right.begin);
+    }
+
+    /*
+     * Inputs smaller than this are not worth spawning threads
+     */
+    const std::size_t ParallelThreshold = 65536;
+
+    template <typename Item>
+    void multikeySort(Item* begin, Item* end, unsigned int threadCount)
+    {
+        std::size_t count = end - begin;
+
+        if (threadCount == 0)
+        {
+            long processors = sysconf(_SC_NPROCESSORS_ONLN);
+            threadCount = processors > 0 ? static_cast<unsigned int>(processors) : 1;
+        }
+
+        SortTask<Item> root = { begin, end, 0 };
+        std::vector< SortTask<Item> > stack(1, root);
+
+        if (threadCount < 2 || count < ParallelThreshold)
+        {
+            sortTasks(stack);
+            return;
+        }
+
+        /*
+         * Split the input in the calling thread until every range
+         * is small enough to balance the load between the workers
+         */
+        std::ptrdiff_t grain = static_cast<std::ptrdiff_t>(count / (threadCount * 8));
+        std::vector< SortTask<Item> > tasks;
+
+        while (!stack.empty())
+        {
+            SortTask<Item> task = stack.back();
+            stack.pop_back();
+
+            std::ptrdiff_t size = task.end - task.begin;
+            if (size < 2)
+                continue;
+
+            if (size <= grain || size < InsertionThreshold)
+                tasks.push_back(task);
+            else
+                partition(task, stack);
+        }
+
+        /*
+         * Largest ranges first, the small ones fill the gaps
+         */
+        std::sort(tasks.begin(), tasks.end(), isLarger<Item>);
+
+        std::atomic<std::size_t> next(0);
+        std::vector<Thread*> workers;
+
+        for (unsigned int i = 1; i < threadCount; ++i)
+        {
+            workers.push_back(new Thread(SortWorker<Item>(&tasks, &next)));
+            workers.back()->launch();
+        }
+
+        /*
+         * The calling thread works too
+         */
+        SortWorker<Item>(&tasks, &next)();
+
+        for (std::size_t i = 0; i < workers.size(); ++i)
+        {
+            workers[i]->wait();
+            delete workers[i];
+        }
+    }
+
+} // namespace priv
+
+    void sortStrings(std::vector<String>& strings, unsigned int threadCount)
+    {
+        std::size_t count = strings.size();
+        if (count < 2)
+            return;
+
+        std::vector<priv::IndexedView> items(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            items[i].view = StringView(strings[i]);
+            items[i].index = i;
+        }
+
+        priv::multikeySort(&items[0], &items[0] + count, threadCount);
+
+        /*
+         * Move each string to its final position
+         */
+        std::vector<String> sorted;
+        sorted.reserve(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+            sorted.push_back(std::move(strings[items[i].index]));
+
+        strings.swap(sorted);
+    }
+
+    void sortStrings(std::vector<StringView>& views, unsigned int threadCount)
+    {
+        if (views.size() < 2)
+            return;
+
+        priv::multikeySort(&views[0], &views[0] + views.size(), threadCount);
+    }
+
+} // namespace cr
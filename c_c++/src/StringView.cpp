@@ -0,0 +1,76 @@
+#include <StringView.hpp>
+
+namespace cr
+{
+    const std::size_t StringView::InvalidPos = static_cast<std::size_t>(-1);
+
+    StringView::StringView(const Uint32* utf32String) :
+        m_data(utf32String),
+        m_size(0)
+    {
+        if (utf32String)
+        {
+            while (utf32String[m_size])
+                ++m_size;
+        }
+    }
+
+    StringView StringView::substring(std::size_t position, std::size_t length) const
+    {
+        if (position > m_size)
+            position = m_size;
+
+        if (length > m_size - position)
+            length = m_size - position;
+
+        return StringView(m_data + position, length);
+    }
+
+    bool StringView::startsWith(StringView prefix) const
+    {
+        if (prefix.m_size > m_size)
+            return false;
+
+        return StringView(m_data, prefix.m_size).compare(prefix) == 0;
+    }
+
+    std::size_t StringView::find(StringView str, std::size_t start) const
+    {
+        if (str.m_size > m_size)
+            return InvalidPos;
+
+        for (std::size_t i = start; i + str.m_size <= m_size; ++i)
+        {
+            /*
+             * Check the first character before comparing the whole sequence
+             */
+            if (str.m_size == 0 || (m_data[i] == str.m_data[0] &&
+                StringView(m_data + i, str.m_size).compare(str) == 0))
+                return i;
+        }
+
+        return InvalidPos;
+    }
+
+    int StringView::compare(StringView right) const
+    {
+        std::size_t length = m_size < right.m_size ? m_size : right.m_size;
+
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            if (m_data[i] != right.m_data[i])
+                return m_data[i] < right.m_data[i] ? -1 : 1;
+        }
+
+        if (m_size == right.m_size)
+            return 0;
+
+        return m_size < right.m_size ? -1 : 1;
+    }
+
+    String StringView::toString() const
+    {
+        return String::fromUtf32(m_data, m_data + m_size);
+    }
+
+} // namespace cr
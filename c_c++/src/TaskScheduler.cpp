@@ -0,0 +1,335 @@
+#include <TaskScheduler.hpp>
+#include <WorkStealingDeque.hpp>
+#include <FutexImpl.hpp>
+#include <Lock.hpp>
+#include <climits>
+#include <sched.h>
+#include <unistd.h>
+
+namespace
+{
+    /*
+     * Number of failed searches before a worker sleeps
+     */
+    const int SpinCount = 64;
+
+} // namespace
+
+
+namespace cr
+{
+
+namespace priv
+{
+    /*
+     * State of a worker thread
+     */
+    struct SchedulerWorker
+    {
+        SchedulerWorker(TaskScheduler* scheduler_, std::size_t index_) :
+            scheduler(scheduler_),
+            index    (index_),
+            random   (static_cast<Uint32>(index_ * 2654435761u + 1)),
+            thread   (NULL)
+        {
+        }
+
+        /*
+         * xorshift, to pick the victims
+         */
+        Uint32 nextRandom()
+        {
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+            return random;
+        }
+
+        TaskScheduler*                    scheduler;
+        std::size_t                       index;
+        Uint32                            random;
+        WorkStealingDeque<SchedulerTask*> deque;
+        Thread*                           thread;
+    };
+
+} // namespace priv
+
+
+    TaskScheduler::TaskScheduler(std::size_t threadCount) :
+        m_injectedCount(0),
+        m_epoch        (0),
+        m_sleepers     (0),
+        m_isStopped    (false)
+    {
+        if (threadCount == 0)
+        {
+            long cores = sysconf(_SC_NPROCESSORS_ONLN);
+            threadCount = cores > 0 ? static_cast<std::size_t>(cores) : 1;
+        }
+
+        /*
+         * All the workers exist before any starts stealing
+         */
+        for (std::size_t i = 0; i < threadCount; ++i)
+            m_workers.push_back(new priv::SchedulerWorker(this, i));
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            m_workers[i]->thread = new Thread(&TaskScheduler::work, m_workers[i]);
+            m_workers[i]->thread->launch();
+        }
+    }
+
+    TaskScheduler::~TaskScheduler()
+    {
+        m_isStopped.store(true);
+        m_epoch.fetch_add(1);
+        priv::futexWake(&m_epoch, INT_MAX);
+
+        /*
+         * Join all the workers before freeing any deque : they
+         * look at each other's
+         */
+        for (std::size_t i = 0; i < m_workers.size(); ++i)
+            delete m_workers[i]->thread;
+
+        for (std::size_t i = 0; i < m_workers.size(); ++i)
+            delete m_workers[i];
+    }
+
+    std::size_t TaskScheduler::getThreadCount() const
+    {
+        return m_workers.size();
+    }
+
+    void TaskScheduler::spawn(priv::SchedulerTask* task)
+    {
+        priv::SchedulerWorker* self = getCurrentWorker();
+
+        if (self)
+        {
+            self->deque.push(task);
+        }
+        else
+        {
+            Lock lock(m_injectedMutex);
+            m_injected.push_back(task);
+            m_injectedCount.fetch_add(1);
+        }
+
+        notify();
+    }
+
+    bool TaskScheduler::runOne(priv::SchedulerWorker* self)
+    {
+        priv::SchedulerTask* task = NULL;
+        bool found = self && self->deque.pop(task);
+
+        /*
+         * Steal from the workers, starting at a random one
+         */
+        if (!found)
+        {
+            std::size_t count = m_workers.size();
+            std::size_t start = self ? self->nextRandom() % count : 0;
+
+            for (std::size_t i = 0; i < count && !found; ++i)
+            {
+                priv::SchedulerWorker* victim = m_workers[(start + i) % count];
+                if (victim != self)
+                    found = victim->deque.steal(task);
+            }
+        }
+
+        if (!found && m_injectedCount.load(std::memory_order_relaxed) > 0)
+        {
+            Lock lock(m_injectedMutex);
+            if (!m_injected.empty())
+            {
+                task = m_injected.front();
+                m_injected.pop_front();
+                m_injectedCount.fetch_sub(1);
+                found = true;
+            }
+        }
+
+        if (!found)
+            return false;
+
+        TaskGroup* group = task->group;
+        try
+        {
+            task->run();
+        }
+        catch (...)
+        {
+            if (!group->m_hasException.exchange(true))
+                group->m_exception = std::current_exception();
+        }
+
+        delete task;
+        group->finish();
+
+        return true;
+    }
+
+    priv::SchedulerWorker* TaskScheduler::getCurrentWorker() const
+    {
+        return static_cast<priv::SchedulerWorker*>(m_current.getValue());
+    }
+
+    bool TaskScheduler::hasWork() const
+    {
+        if (m_injectedCount.load() > 0)
+            return true;
+
+        for (std::size_t i = 0; i < m_workers.size(); ++i)
+        {
+            if (!m_workers[i]->deque.isEmpty())
+                return true;
+        }
+
+        return false;
+    }
+
+    void TaskScheduler::notify()
+    {
+        /*
+         * Pairs with the fence of a worker going to sleep : either
+         * it sees the new task, or we see it as a sleeper
+         */
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_sleepers.load(std::memory_order_relaxed) > 0)
+        {
+            m_epoch.fetch_add(1);
+            priv::futexWake(&m_epoch, 1);
+        }
+    }
+
+    void TaskScheduler::work(priv::SchedulerWorker* self)
+    {
+        TaskScheduler* scheduler = self->scheduler;
+        scheduler->m_current.setValue(self);
+
+        int spins = 0;
+        while (!scheduler->m_isStopped.load(std::memory_order_relaxed))
+        {
+            if (scheduler->runOne(self))
+            {
+                spins = 0;
+                continue;
+            }
+
+            if (++spins < SpinCount)
+            {
+                priv::cpuRelax();
+                continue;
+            }
+
+            /*
+             * Sleep until the epoch changes, unless work arrived
+             * after we last looked
+             */
+            Int32 epoch = scheduler->m_epoch.load();
+            scheduler->m_sleepers.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (!scheduler->hasWork() && !scheduler->m_isStopped.load())
+                priv::futexWait(&scheduler->m_epoch, epoch);
+
+            scheduler->m_sleepers.fetch_sub(1);
+            spins = 0;
+        }
+    }
+
+
+    TaskGroup::TaskGroup(TaskScheduler& scheduler) :
+        m_scheduler   (scheduler),
+        m_state       (0),
+        m_hasException(false)
+    {
+    }
+
+    TaskGroup::~TaskGroup()
+    {
+        wait();
+    }
+
+    void TaskGroup::sync()
+    {
+        wait();
+
+        if (m_hasException.load())
+        {
+            std::exception_ptr exception = m_exception;
+            m_exception = std::exception_ptr();
+            m_hasException.store(false);
+            std::rethrow_exception(exception);
+        }
+    }
+
+    void TaskGroup::wait()
+    {
+        priv::SchedulerWorker* self = m_scheduler.getCurrentWorker();
+        int spins = 0;
+
+        for (;;)
+        {
+            Int32 state = m_state.load(std::memory_order_acquire);
+            if (state < 2)
+            {
+                /*
+                 * Clear the waiter flag, unless a task was spawned
+                 * into the group meanwhile
+                 */
+                if (state == 0 || m_state.compare_exchange_strong(state, 0))
+                    return;
+                continue;
+            }
+
+            /*
+             * A worker helps : it runs tasks, ours or others', instead
+             * of blocking. Other threads don't, so that their stack
+             * doesn't pile up unrelated tasks : they sleep until the
+             * last task ends
+             */
+            if (self && m_scheduler.runOne(self))
+            {
+                spins = 0;
+                continue;
+            }
+
+            if (++spins < SpinCount)
+            {
+                priv::cpuRelax();
+                continue;
+            }
+
+            if (self)
+            {
+                sched_yield();
+            }
+            else if (!(state & 1))
+            {
+                m_state.compare_exchange_weak(state, state | 1);
+            }
+            else
+            {
+                priv::futexWait(&m_state, state);
+            }
+        }
+    }
+
+    void TaskGroup::finish()
+    {
+        /*
+         * The group may be destroyed as soon as the count reaches
+         * zero : only its address is used afterwards
+         */
+        std::atomic<Int32>* state = &m_state;
+        if (state->fetch_sub(2, std::memory_order_acq_rel) == 3)
+            priv::futexWake(state, INT_MAX);
+    }
+
+} // namespace cr
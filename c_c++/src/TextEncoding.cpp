@@ -0,0 +1,58 @@
+#include <TextEncoding.hpp>
+
+namespace cr
+{
+
+    TextEncoding detectEncoding(const Uint8* data, std::size_t size, TextEncoding fallback, std::size_t* bomSize)
+    {
+        /*
+         * FF FE is both the UTF-16LE mark and the beginning of the
+         * UTF-32LE one : the longer mark is checked first
+         */
+        if (size >= 4 && data[0] == 0xFF && data[1] == 0xFE && data[2] == 0x00 && data[3] == 0x00)
+        {
+            *bomSize = 4;
+            return UTF32LE;
+        }
+
+        if (size >= 4 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0xFE && data[3] == 0xFF)
+        {
+            *bomSize = 4;
+            return UTF32BE;
+        }
+
+        if (size >= 3 && data[0] == 0xEF && data[1] == 0xBB && data[2] == 0xBF)
+        {
+            *bomSize = 3;
+            return UTF8;
+        }
+
+        if (size >= 2 && data[0] == 0xFF && data[1] == 0xFE)
+        {
+            *bomSize = 2;
+            return UTF16LE;
+        }
+
+        if (size >= 2 && data[0] == 0xFE && data[1] == 0xFF)
+        {
+            *bomSize = 2;
+            return UTF16BE;
+        }
+
+        *bomSize = 0;
+        return fallback;
+    }
+
+    std::size_t getCodeUnitSize(TextEncoding encoding)
+    {
+        switch (encoding)
+        {
+            case UTF16LE:
+            case UTF16BE: return 2;
+            case UTF32LE:
+            case UTF32BE: return 4;
+            default:      return 1;
+        }
+    }
+
+} // namespace cr
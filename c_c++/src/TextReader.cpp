@@ -0,0 +1,343 @@
+#include <TextReader.hpp>
+#include <Utf8View.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace
+{
+    /*
+     * The blocks are read at a page boundary ; the bytes of a
+     * character split between two blocks are moved just before it
+     */
+    const std::size_t BlockAlignment = 4096;
+    const std::size_t BlockSize = 1 << 20;
+
+    inline cr::Uint16 readUnit16(const cr::Uint8* bytes, bool bigEndian)
+    {
+        return bigEndian ? static_cast<cr::Uint16>((bytes[0] << 8) | bytes[1])
+                         : static_cast<cr::Uint16>((bytes[1] << 8) | bytes[0]);
+    }
+
+    inline cr::Uint32 readUnit32(const cr::Uint8* bytes, bool bigEndian)
+    {
+        return bigEndian ? (static_cast<cr::Uint32>(bytes[0]) << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3]
+                         : (static_cast<cr::Uint32>(bytes[3]) << 24) | (bytes[2] << 16) | (bytes[1] << 8) | bytes[0];
+    }
+} // namespace
+
+
+namespace cr
+{
+
+    TextReader::TextReader() :
+        m_file     (-1),
+        m_encoding (UTF8),
+        m_hasBom   (false),
+        m_isEnd    (true),
+        m_isFirst  (false),
+        m_block    (NULL),
+        m_pending  (0),
+        m_lineStart(0),
+        m_scan     (0),
+        m_lineCount(0)
+    {
+    }
+
+    TextReader::TextReader(const std::string& filename, TextEncoding fallback) :
+        m_file     (-1),
+        m_encoding (UTF8),
+        m_hasBom   (false),
+        m_isEnd    (true),
+        m_isFirst  (false),
+        m_block    (NULL),
+        m_pending  (0),
+        m_lineStart(0),
+        m_scan     (0),
+        m_lineCount(0)
+    {
+        open(filename, fallback);
+    }
+
+    TextReader::~TextReader()
+    {
+        close();
+        std::free(m_block);
+    }
+
+    bool TextReader::open(const std::string& filename, TextEncoding fallback)
+    {
+        close();
+
+        if (!m_block)
+        {
+            void* block = NULL;
+            if (posix_memalign(&block, BlockAlignment, BlockAlignment + BlockSize) != 0)
+            {
+                std::cerr << "Failed to allocate the read buffer of \"" << filename << "\"" << std::endl;
+                return false;
+            }
+
+            m_block = static_cast<Uint8*>(block);
+        }
+
+        m_file = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (m_file < 0)
+        {
+            std::cerr << "Failed to open file \"" << filename << "\" (" << std::strerror(errno) << ")" << std::endl;
+            return false;
+        }
+
+        posix_fadvise(m_file, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+        m_encoding = fallback;
+        m_isEnd = false;
+        m_isFirst = true;
+        m_chars.reserve(BlockSize);
+
+        return true;
+    }
+
+    void TextReader::close()
+    {
+        if (m_file >= 0)
+            ::close(m_file);
+
+        m_file = -1;
+        m_hasBom = false;
+        m_isEnd = true;
+        m_isFirst = false;
+        m_pending = 0;
+        m_chars.clear();
+        m_lineStart = 0;
+        m_scan = 0;
+        m_lineCount = 0;
+    }
+
+    bool TextReader::isOpen() const
+    {
+        return m_file >= 0;
+    }
+
+    TextEncoding TextReader::getEncoding() const
+    {
+        return m_encoding;
+    }
+
+    bool TextReader::hasBom() const
+    {
+        return m_hasBom;
+    }
+
+    bool TextReader::readLine(StringView& line)
+    {
+        for (;;)
+        {
+            const Uint32* chars = m_chars.data();
+            std::size_t size = m_chars.size();
+
+            const Uint32* found = std::find(chars + m_scan, chars + size, Uint32('\n'));
+            if (found != chars + size)
+            {
+                std::size_t end = found - chars;
+                std::size_t stop = (end > m_lineStart && chars[end - 1] == '\r') ? end - 1 : end;
+
+                line = StringView(chars + m_lineStart, stop - m_lineStart);
+                m_lineStart = m_scan = end + 1;
+                ++m_lineCount;
+                return true;
+            }
+
+            m_scan = size;
+
+            if (m_isEnd)
+            {
+                if (m_lineStart == size)
+                    return false;
+
+                /*
+                 * Last line, without end of line
+                 */
+                line = StringView(chars + m_lineStart, size - m_lineStart);
+                m_lineStart = size;
+                ++m_lineCount;
+                return true;
+            }
+
+            /*
+             * Drop the lines already returned, keep the beginning of
+             * the current one, and append the next block to it
+             */
+            if (m_lineStart > 0)
+            {
+                m_chars.erase(0, m_lineStart);
+                m_scan -= m_lineStart;
+                m_lineStart = 0;
+            }
+
+            readBlock();
+        }
+    }
+
+    std::size_t TextReader::getLineCount() const
+    {
+        return m_lineCount;
+    }
+
+    bool TextReader::readBlock()
+    {
+        if (m_isEnd)
+            return false;
+
+        Uint8* data = m_block + BlockAlignment;
+
+        ssize_t count;
+        do
+        {
+            count = ::read(m_file, data, BlockSize);
+        }
+        while (count < 0 && errno == EINTR);
+
+        if (count < 0)
+        {
+            std::cerr << "Failed to read file (" << std::strerror(errno) << ")" << std::endl;
+            count = 0;
+        }
+
+        bool last = (count == 0);
+        const Uint8* begin = data - m_pending;
+        const Uint8* end = data + count;
+
+        if (m_isFirst)
+        {
+            std::size_t bomSize;
+            m_encoding = detectEncoding(begin, end - begin, m_encoding, &bomSize);
+            m_hasBom = bomSize > 0;
+            m_isFirst = false;
+            begin += bomSize;
+        }
+
+        std::size_t used = decode(begin, end, last);
+
+        /*
+         * Keep the incomplete character for the next block
+         */
+        m_pending = (end - begin) - used;
+        std::memmove(data - m_pending, begin + used, m_pending);
+
+        m_isEnd = last;
+        return true;
+    }
+
+    std::size_t TextReader::decode(const Uint8* begin, const Uint8* end, bool last)
+    {
+        /*
+         * No encoding produces more characters than bytes
+         */
+        std::size_t start = m_chars.size();
+        m_chars.resize(start + (end - begin));
+
+        Uint32* output = &m_chars[0] + start;
+        const Uint8* current = begin;
+
+        switch (m_encoding)
+        {
+            case UTF8:
+            {
+                while (current < end)
+                {
+                    if (*current < 0x80)
+                    {
+                        *output++ = *current++;
+                        continue;
+                    }
+
+                    /*
+                     * A sequence cut by the end of the block is decoded
+                     * with the next one ; a malformed sequence gives a
+                     * single U+FFFD and doesn't consume the byte breaking it
+                     */
+                    Uint8 low;
+                    Uint8 high;
+                    if (!last && static_cast<std::size_t>(end - current) < priv::getUtf8Size(*current, low, high))
+                        break;
+
+                    *output++ = priv::decodeUtf8(current, end);
+                }
+                break;
+            }
+
+            case UTF16LE:
+            case UTF16BE:
+            {
+                bool bigEndian = (m_encoding == UTF16BE);
+
+                while (end - current >= 2)
+                {
+                    Uint32 unit = readUnit16(current, bigEndian);
+
+                    if (unit >= 0xD800 && unit <= 0xDBFF)
+                    {
+                        if (end - current < 4 && !last)
+                            break;
+
+                        /*
+                         * A high surrogate not followed by a low one is
+                         * malformed : the next unit is decoded on its own
+                         */
+                        Uint32 second = end - current >= 4 ? readUnit16(current + 2, bigEndian) : 0;
+                        if (second >= 0xDC00 && second <= 0xDFFF)
+                        {
+                            *output++ = ((unit - 0xD800) << 10) + (second - 0xDC00) + 0x10000;
+                            current += 4;
+                            continue;
+                        }
+
+                        unit = 0xFFFD;
+                    }
+                    else if (unit >= 0xDC00 && unit <= 0xDFFF)
+                    {
+                        unit = 0xFFFD;
+                    }
+
+                    *output++ = unit;
+                    current += 2;
+                }
+                break;
+            }
+
+            default:
+            {
+                bool bigEndian = (m_encoding == UTF32BE);
+
+                while (end - current >= 4)
+                {
+                    Uint32 codepoint = readUnit32(current, bigEndian);
+                    bool isValid = codepoint < 0x110000 && (codepoint < 0xD800 || codepoint > 0xDFFF);
+
+                    *output++ = isValid ? codepoint : 0xFFFD;
+                    current += 4;
+                }
+                break;
+            }
+        }
+
+        /*
+         * Bytes left at the end of the file : truncated character
+         */
+        if (last && current < end)
+        {
+            *output++ = 0xFFFD;
+            current = end;
+        }
+
+        m_chars.resize(output - m_chars.data());
+
+        return current - begin;
+    }
+
+} // namespace cr
@@ -0,0 +1,402 @@
+#include <TextSegmentation.hpp>
+
+namespace
+{
+    using namespace cr::priv;
+
+    /*
+     * Progress of the emoji sequence rule (GB11) :
+     * ExtPict Extend* ZWJ x ExtPict
+     */
+    enum EmojiState
+    {
+        EmojiNone,
+        EmojiBase,     /* after ExtPict Extend* */
+        EmojiJoiner    /* after ExtPict Extend* ZWJ */
+    };
+
+    inline bool isAHLetter(cr::Uint8 word)
+    {
+        return word == WordALetter || word == WordHebrewLetter;
+    }
+
+    inline bool isMidLetter(cr::Uint8 word)
+    {
+        return word == WordMidLetter || word == WordMidNumLet || word == WordSingleQuote;
+    }
+
+    inline bool isMidNum(cr::Uint8 word)
+    {
+        return word == WordMidNum || word == WordMidNumLet || word == WordSingleQuote;
+    }
+
+    inline bool isIgnored(cr::Uint8 word)
+    {
+        return word == WordExtend || word == WordFormat || word == WordZWJ;
+    }
+
+    inline bool isNewline(cr::Uint8 word)
+    {
+        return word == WordCR || word == WordLF || word == WordNewline;
+    }
+
+    /*
+     * Word class of the first character from \a position which
+     * is not ignored by rule WB4, or WordOther at the end
+     */
+    cr::Uint8 peekWordClass(const TextCursor& cursor, std::size_t position)
+    {
+        while (position < cursor.getSize())
+        {
+            cr::Uint8 word = getSegmentRecord(cursor.decode(position, &position)).word;
+            if (!isIgnored(word))
+                return word;
+        }
+
+        return WordOther;
+    }
+
+    /*
+     * Context of the current word segment, for the rules which
+     * look further back than the last character
+     */
+    struct WordContext
+    {
+        cr::Uint8   raw;         /* class of the last character */
+        cr::Uint8   last;        /* class of the last character not ignored by WB4 */
+        cr::Uint8   beforeLast;  /* class of the one before */
+        std::size_t regional;    /* number of consecutive regional indicators */
+    };
+
+    /*
+     * Rules WB3 to WB16 : is there no boundary between the current
+     * segment and the next character (described by \a record,
+     * \a following is the position after it)?
+     */
+    bool joinsWord(const WordContext& context, const SegmentRecord& record,
+                   const TextCursor& cursor, std::size_t following)
+    {
+        cr::Uint8 word = record.word;
+        cr::Uint8 last = context.last;
+
+        if (context.raw == WordCR && word == WordLF)                                 /* WB3 */
+            return true;
+        if (isNewline(context.raw) || isNewline(word))                               /* WB3a, WB3b */
+            return false;
+        if (context.raw == WordZWJ && (record.flags & SegmentPictographic))          /* WB3c */
+            return true;
+        if (context.raw == WordWSegSpace && word == WordWSegSpace)                   /* WB3d */
+            return true;
+        if (isIgnored(word))                                                         /* WB4 */
+            return true;
+
+        if (isAHLetter(last))
+        {
+            if (isAHLetter(word) || word == WordNumeric)                             /* WB5, WB9 */
+                return true;
+            if (isMidLetter(word) && isAHLetter(peekWordClass(cursor, following)))   /* WB6 */
+                return true;
+        }
+
+        if (isAHLetter(word) && isMidLetter(last) && isAHLetter(context.beforeLast)) /* WB7 */
+            return true;
+
+        if (last == WordHebrewLetter)
+        {
+            if (word == WordSingleQuote)                                             /* WB7a */
+                return true;
+            if (word == WordDoubleQuote && peekWordClass(cursor, following) == WordHebrewLetter)
+                return true;                                                         /* WB7b */
+        }
+
+        if (word == WordHebrewLetter && last == WordDoubleQuote && context.beforeLast == WordHebrewLetter)
+            return true;                                                             /* WB7c */
+
+        if (last == WordNumeric)
+        {
+            if (word == WordNumeric || isAHLetter(word))                             /* WB8, WB10 */
+                return true;
+            if (isMidNum(word) && peekWordClass(cursor, following) == WordNumeric)   /* WB12 */
+                return true;
+        }
+
+        if (word == WordNumeric && isMidNum(last) && context.beforeLast == WordNumeric)
+            return true;                                                             /* WB11 */
+
+        if (last == WordKatakana && word == WordKatakana)                            /* WB13 */
+            return true;
+
+        if (word == WordExtendNumLet &&
+            (isAHLetter(last) || last == WordNumeric || last == WordKatakana || last == WordExtendNumLet))
+            return true;                                                             /* WB13a */
+
+        if (last == WordExtendNumLet && (isAHLetter(word) || word == WordNumeric || word == WordKatakana))
+            return true;                                                             /* WB13b */
+
+        if (last == WordRegionalIndicator && word == WordRegionalIndicator)          /* WB15, WB16 */
+            return context.regional % 2 == 1;
+
+        return false;                                                                /* WB999 */
+    }
+
+    /*
+     * Count up to \a limit clusters, \a end receives the end of the last one
+     */
+    std::size_t countClusters(cr::GraphemeIterator it, std::size_t limit, std::size_t* end)
+    {
+        std::size_t count = 0;
+        *end = 0;
+
+        while (count < limit && it.next())
+        {
+            *end = it.getEnd();
+            ++count;
+        }
+
+        return count;
+    }
+
+} // namespace
+
+
+namespace cr
+{
+
+namespace priv
+{
+    Uint32 TextCursor::decodeSequence(const Uint8* begin, const Uint8* end, std::size_t* length)
+    {
+        Uint8 lead = *begin;
+        std::size_t size;
+        Uint32 codepoint;
+
+        if (lead >= 0xC2 && lead < 0xE0)
+        {
+            size = 2;
+            codepoint = lead & 0x1F;
+        }
+        else if (lead >= 0xE0 && lead < 0xF0)
+        {
+            size = 3;
+            codepoint = lead & 0x0F;
+        }
+        else if (lead >= 0xF0 && lead < 0xF5)
+        {
+            size = 4;
+            codepoint = lead & 0x07;
+        }
+        else
+        {
+            *length = 1;
+            return 0xFFFD;
+        }
+
+        if (static_cast<std::size_t>(end - begin) < size)
+        {
+            *length = 1;
+            return 0xFFFD;
+        }
+
+        for (std::size_t i = 1; i < size; ++i)
+        {
+            if ((begin[i] & 0xC0) != 0x80)
+            {
+                *length = 1;
+                return 0xFFFD;
+            }
+
+            codepoint = (codepoint << 6) | (begin[i] & 0x3F);
+        }
+
+        /*
+         * Overlong forms, surrogates and code points past U+10FFFF
+         */
+        static const Uint32 minimum[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+        if (codepoint < minimum[size] || (codepoint >= 0xD800 && codepoint < 0xE000) || codepoint > 0x10FFFF)
+        {
+            *length = 1;
+            return 0xFFFD;
+        }
+
+        *length = size;
+        return codepoint;
+    }
+
+} // namespace priv
+
+    GraphemeIterator::GraphemeIterator(StringView text) :
+        m_cursor(text.getData(), text.getSize()),
+        m_begin (0),
+        m_end   (0)
+    {
+    }
+
+    GraphemeIterator::GraphemeIterator(const char* utf8, std::size_t size) :
+        m_cursor(reinterpret_cast<const Uint8*>(utf8), size),
+        m_begin (0),
+        m_end   (0)
+    {
+    }
+
+    bool GraphemeIterator::next()
+    {
+        std::size_t size = m_cursor.getSize();
+
+        m_begin = m_end;
+        if (m_begin >= size)
+            return false;
+
+        std::size_t position;
+        Uint32 previous = m_cursor.decode(m_begin, &position);
+
+        /*
+         * Most text is ASCII : between two ASCII characters,
+         * only CR LF is not a boundary
+         */
+        if (previous < 0x80 && position < size)
+        {
+            std::size_t following;
+            Uint32 codepoint = m_cursor.decode(position, &following);
+
+            if (codepoint < 0x80)
+            {
+                m_end = (previous == '\r' && codepoint == '\n') ? following : position;
+                return true;
+            }
+        }
+
+        const SegmentRecord& first = getSegmentRecord(previous);
+        Uint8 last = first.grapheme;
+        EmojiState emoji = (first.flags & SegmentPictographic) ? EmojiBase : EmojiNone;
+        std::size_t regional = (last == GraphemeRegionalIndicator) ? 1 : 0;
+
+        while (position < size)
+        {
+            std::size_t following;
+            Uint32 codepoint = m_cursor.decode(position, &following);
+
+            if (previous < 0x80 && codepoint < 0x80)
+            {
+                if (previous != '\r' || codepoint != '\n')
+                    break;
+            }
+
+            const SegmentRecord& record = getSegmentRecord(codepoint);
+            Uint8 current = record.grapheme;
+
+            if (!((GraphemeNoBreak[last] >> current) & 1))
+            {
+                bool joined = false;
+
+                if (last == GraphemeZWJ && emoji == EmojiJoiner && (record.flags & SegmentPictographic))
+                    joined = true;                                                  /* GB11 */
+                else if (last == GraphemeRegionalIndicator && current == GraphemeRegionalIndicator)
+                    joined = regional % 2 == 1;                                     /* GB12, GB13 */
+
+                if (!joined)
+                    break;                                                          /* GB999 */
+            }
+
+            if (record.flags & SegmentPictographic)
+                emoji = EmojiBase;
+            else if (emoji == EmojiBase && current == GraphemeZWJ)
+                emoji = EmojiJoiner;
+            else if (emoji != EmojiBase || current != GraphemeExtend)
+                emoji = EmojiNone;
+
+            regional = (current == GraphemeRegionalIndicator) ? regional + 1 : 0;
+            last = current;
+            previous = codepoint;
+            position = following;
+        }
+
+        m_end = position;
+        return true;
+    }
+
+    WordIterator::WordIterator(StringView text) :
+        m_cursor(text.getData(), text.getSize()),
+        m_begin (0),
+        m_end   (0),
+        m_isWord(false)
+    {
+    }
+
+    WordIterator::WordIterator(const char* utf8, std::size_t size) :
+        m_cursor(reinterpret_cast<const Uint8*>(utf8), size),
+        m_begin (0),
+        m_end   (0),
+        m_isWord(false)
+    {
+    }
+
+    bool WordIterator::next()
+    {
+        std::size_t size = m_cursor.getSize();
+
+        m_begin = m_end;
+        m_isWord = false;
+        if (m_begin >= size)
+            return false;
+
+        std::size_t position;
+        const SegmentRecord& first = getSegmentRecord(m_cursor.decode(m_begin, &position));
+
+        WordContext context;
+        context.raw = first.word;
+        context.last = first.word;
+        context.beforeLast = WordOther;
+        context.regional = (first.word == WordRegionalIndicator) ? 1 : 0;
+        m_isWord = (first.flags & SegmentAlphanumeric) != 0;
+
+        while (position < size)
+        {
+            std::size_t following;
+            const SegmentRecord& record = getSegmentRecord(m_cursor.decode(position, &following));
+
+            if (!joinsWord(context, record, m_cursor, following))
+                break;
+
+            context.raw = record.word;
+            if (!isIgnored(record.word))
+            {
+                context.beforeLast = context.last;
+                context.last = record.word;
+                context.regional = (record.word == WordRegionalIndicator) ? context.regional + 1 : 0;
+            }
+
+            m_isWord = m_isWord || (record.flags & SegmentAlphanumeric);
+            position = following;
+        }
+
+        m_end = position;
+        return true;
+    }
+
+    std::size_t countGraphemes(StringView text)
+    {
+        std::size_t end;
+        return countClusters(GraphemeIterator(text), static_cast<std::size_t>(-1), &end);
+    }
+
+    std::size_t countGraphemes(const char* utf8, std::size_t size)
+    {
+        std::size_t end;
+        return countClusters(GraphemeIterator(utf8, size), static_cast<std::size_t>(-1), &end);
+    }
+
+    std::size_t graphemePrefixSize(StringView text, std::size_t count)
+    {
+        std::size_t end;
+        countClusters(GraphemeIterator(text), count, &end);
+        return end;
+    }
+
+    std::size_t graphemePrefixSize(const char* utf8, std::size_t size, std::size_t count)
+    {
+        std::size_t end;
+        countClusters(GraphemeIterator(utf8, size), count, &end);
+        return end;
+    }
+
+} // namespace cr
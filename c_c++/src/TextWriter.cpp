@@ -0,0 +1,464 @@
+#include <TextWriter.hpp>
+#include <Utf.hpp>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace
+{
+    /*
+     * O_DIRECT wants the buffer, the size and the file offset
+     * of each write aligned on the logical block size
+     */
+    const std::size_t BlockAlignment = 4096;
+
+    /*
+     * Allocate a buffer of whole blocks, aligned for O_DIRECT ; there
+     * are at least two blocks, so that the partial block left by a
+     * direct write never fills the buffer
+     */
+    char* allocateBuffer(std::size_t size, std::size_t* capacity)
+    {
+        size = (size + BlockAlignment - 1) / BlockAlignment * BlockAlignment;
+        if (size < 2 * BlockAlignment)
+            size = 2 * BlockAlignment;
+
+        void* buffer = NULL;
+        if (posix_memalign(&buffer, BlockAlignment, size) != 0)
+        {
+            std::cerr << "Failed to allocate the write buffer" << std::endl;
+            *capacity = 0;
+            return NULL;
+        }
+
+        *capacity = size;
+        return static_cast<char*>(buffer);
+    }
+
+    /*
+     * Write all the bytes of \a vectors, resuming after partial writes
+     */
+    bool writeAll(int file, struct iovec* vectors, int count)
+    {
+        while (count > 0)
+        {
+            ssize_t written = writev(file, vectors, count);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+
+            std::size_t remaining = static_cast<std::size_t>(written);
+            while (count > 0 && remaining >= vectors->iov_len)
+            {
+                remaining -= vectors->iov_len;
+                ++vectors;
+                --count;
+            }
+
+            if (count > 0)
+            {
+                vectors->iov_base = static_cast<char*>(vectors->iov_base) + remaining;
+                vectors->iov_len -= remaining;
+            }
+        }
+
+        return true;
+    }
+
+    inline char* storeUnit16(char* output, cr::Uint16 unit, bool bigEndian)
+    {
+        output[bigEndian ? 0 : 1] = static_cast<char>(unit >> 8);
+        output[bigEndian ? 1 : 0] = static_cast<char>(unit & 0xFF);
+        return output + 2;
+    }
+
+    inline char* storeUnit32(char* output, cr::Uint32 unit, bool bigEndian)
+    {
+        for (int i = 0; i < 4; ++i)
+            output[i] = static_cast<char>(unit >> (bigEndian ? 24 - 8 * i : 8 * i));
+        return output + 4;
+    }
+
+} // namespace
+
+
+namespace cr
+{
+
+    TextWriter::TextWriter(std::size_t bufferSize) :
+        m_file    (-1),
+        m_isOwner (false),
+        m_isGood  (false),
+        m_encoding(UTF8),
+        m_mode    (Buffered),
+        m_buffer  (NULL),
+        m_capacity(0),
+        m_size    (0),
+        m_written (0)
+    {
+        m_buffer = allocateBuffer(bufferSize, &m_capacity);
+    }
+
+    TextWriter::TextWriter(const std::string& filename, TextEncoding encoding, Mode mode, std::size_t bufferSize) :
+        m_file    (-1),
+        m_isOwner (false),
+        m_isGood  (false),
+        m_encoding(UTF8),
+        m_mode    (Buffered),
+        m_buffer  (NULL),
+        m_capacity(0),
+        m_size    (0),
+        m_written (0)
+    {
+        m_buffer = allocateBuffer(bufferSize, &m_capacity);
+        open(filename, encoding, mode);
+    }
+
+    TextWriter::~TextWriter()
+    {
+        close();
+        std::free(m_buffer);
+    }
+
+    bool TextWriter::open(const std::string& filename, TextEncoding encoding, Mode mode)
+    {
+        close();
+
+        int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+        int file = ::open(filename.c_str(), flags | (mode == Direct ? O_DIRECT : 0), 0644);
+
+        /*
+         * The file system doesn't support O_DIRECT
+         */
+        if (file < 0 && mode == Direct && errno == EINVAL)
+        {
+            mode = Buffered;
+            file = ::open(filename.c_str(), flags, 0644);
+        }
+
+        if (file < 0)
+        {
+            std::cerr << "Failed to create file \"" << filename << "\" (" << std::strerror(errno) << ")" << std::endl;
+            return false;
+        }
+
+        m_file = file;
+        m_isOwner = true;
+        m_isGood = (m_buffer != NULL);
+        m_encoding = encoding;
+        m_mode = mode;
+        m_size = 0;
+        m_written = 0;
+
+        return true;
+    }
+
+    void TextWriter::attach(int descriptor, TextEncoding encoding)
+    {
+        close();
+
+        m_file = descriptor;
+        m_isOwner = false;
+        m_isGood = (m_buffer != NULL);
+        m_encoding = encoding;
+        m_mode = Buffered;
+        m_size = 0;
+        m_written = 0;
+    }
+
+    bool TextWriter::close()
+    {
+        if (m_file < 0)
+            return m_isGood;
+
+        /*
+         * The tail of a direct file is not a whole block : it is
+         * written through the page cache
+         */
+        if (m_mode == Direct)
+        {
+            writeBuffer(NULL, 0, true);
+
+            if (m_size > 0)
+            {
+                fcntl(m_file, F_SETFL, fcntl(m_file, F_GETFL) & ~O_DIRECT);
+                m_mode = Buffered;
+            }
+        }
+
+        writeBuffer(NULL, 0, false);
+
+        if (m_isOwner && ::close(m_file) != 0)
+        {
+            std::cerr << "Failed to close file (" << std::strerror(errno) << ")" << std::endl;
+            m_isGood = false;
+        }
+
+        m_file = -1;
+        m_isOwner = false;
+        m_size = 0;
+
+        return m_isGood;
+    }
+
+    bool TextWriter::isOpen() const
+    {
+        return m_file >= 0;
+    }
+
+    bool TextWriter::isGood() const
+    {
+        return m_isGood;
+    }
+
+    TextEncoding TextWriter::getEncoding() const
+    {
+        return m_encoding;
+    }
+
+    TextWriter::Mode TextWriter::getMode() const
+    {
+        return m_mode;
+    }
+
+    TextWriter& TextWriter::writeBom()
+    {
+        return write(Uint32(0xFEFF));
+    }
+
+    TextWriter& TextWriter::write(Uint32 utf32Char)
+    {
+        return write(StringView(&utf32Char, 1));
+    }
+
+    TextWriter& TextWriter::write(StringView str)
+    {
+        if (m_file < 0 || !m_isGood)
+            return *this;
+
+        const Uint32* begin = str.begin();
+        const Uint32* end = str.end();
+
+        while (begin < end)
+        {
+            /*
+             * Each pass encodes as many characters as the
+             * buffer can hold, 4 bytes being the largest
+             */
+            reserve(4);
+
+            char* output = m_buffer + m_size;
+            char* limit = m_buffer + m_capacity;
+
+            switch (m_encoding)
+            {
+                case UTF8:
+                {
+                    while (begin < end && limit - output >= 4)
+                    {
+                    #if defined(__SSE2__)
+                        /*
+                         * Narrow runs of 16 ASCII characters at once
+                         */
+                        const __m128i high = _mm_set1_epi32(~0x7F);
+
+                        while (end - begin >= 16 && limit - output >= 16)
+                        {
+                            const __m128i* chars = reinterpret_cast<const __m128i*>(begin);
+                            __m128i a = _mm_loadu_si128(chars);
+                            __m128i b = _mm_loadu_si128(chars + 1);
+                            __m128i c = _mm_loadu_si128(chars + 2);
+                            __m128i d = _mm_loadu_si128(chars + 3);
+
+                            __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+                            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(any, high), _mm_setzero_si128())) != 0xFFFF)
+                                break;
+
+                            __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+                            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), bytes);
+
+                            begin += 16;
+                            output += 16;
+                        }
+
+                        if (begin == end || limit - output < 4)
+                            break;
+                    #endif
+
+                        if (*begin < 0x80)
+                            *output++ = static_cast<char>(*begin);
+                        else
+                            output = Utf8::encode(*begin, output);
+                        ++begin;
+                    }
+                    break;
+                }
+
+                case UTF16LE:
+                case UTF16BE:
+                {
+                    bool bigEndian = (m_encoding == UTF16BE);
+
+                    while (begin < end && limit - output >= 4)
+                    {
+                        Uint16 units[2];
+                        Uint16* last = Utf16::encode(*begin++, units);
+
+                        for (Uint16* unit = units; unit < last; ++unit)
+                            output = storeUnit16(output, *unit, bigEndian);
+                    }
+                    break;
+                }
+
+                default:
+                {
+                    bool bigEndian = (m_encoding == UTF32BE);
+
+                    while (begin < end && limit - output >= 4)
+                        output = storeUnit32(output, *begin++, bigEndian);
+                    break;
+                }
+            }
+
+            m_size = output - m_buffer;
+        }
+
+        return *this;
+    }
+
+    TextWriter& TextWriter::writeLine(StringView str)
+    {
+        write(str);
+        return write(Uint32('\n'));
+    }
+
+    TextWriter& TextWriter::write(Utf8View text)
+    {
+        if (m_file < 0 || !m_isGood)
+            return *this;
+
+        if (m_encoding != UTF8)
+        {
+            /*
+             * Decode by chunks, which are encoded again
+             */
+            Uint32 chunk[256];
+            const char* begin = text.begin();
+            const char* end = text.end();
+
+            while (begin < end)
+            {
+                std::size_t count = 0;
+                while (begin < end && count < sizeof(chunk) / sizeof(chunk[0]))
+                    begin = Utf8::decode(begin, end, chunk[count++], 0xFFFD);
+
+                write(StringView(chunk, count));
+            }
+
+            return *this;
+        }
+
+        /*
+         * Large spans are written along with the buffer, without copy
+         */
+        if (m_mode == Buffered && text.getSize() >= m_capacity / 2)
+        {
+            writeBuffer(text.getData(), text.getSize(), false);
+            return *this;
+        }
+
+        const char* data = text.getData();
+        std::size_t size = text.getSize();
+
+        while (size > 0)
+        {
+            reserve(1);
+
+            std::size_t count = m_capacity - m_size;
+            if (count > size)
+                count = size;
+
+            std::memcpy(m_buffer + m_size, data, count);
+            m_size += count;
+            data += count;
+            size -= count;
+        }
+
+        return *this;
+    }
+
+    bool TextWriter::flush()
+    {
+        return writeBuffer(NULL, 0, true);
+    }
+
+    Uint64 TextWriter::getWrittenSize() const
+    {
+        return m_written;
+    }
+
+    bool TextWriter::writeBuffer(const char* data, std::size_t size, bool whole)
+    {
+        if (m_file < 0 || !m_isGood)
+        {
+            m_size = 0;
+            return false;
+        }
+
+        std::size_t count = m_size;
+        if (m_mode == Direct && whole)
+            count -= count % BlockAlignment;
+
+        struct iovec vectors[2];
+        int vectorCount = 0;
+
+        if (count > 0)
+        {
+            vectors[vectorCount].iov_base = m_buffer;
+            vectors[vectorCount].iov_len = count;
+            ++vectorCount;
+        }
+
+        if (size > 0)
+        {
+            vectors[vectorCount].iov_base = const_cast<char*>(data);
+            vectors[vectorCount].iov_len = size;
+            ++vectorCount;
+        }
+
+        if (!writeAll(m_file, vectors, vectorCount))
+        {
+            std::cerr << "Failed to write file (" << std::strerror(errno) << ")" << std::endl;
+            m_isGood = false;
+            m_size = 0;
+            return false;
+        }
+
+        m_written += count + size;
+
+        /*
+         * In Direct mode, the partial block stays at the beginning
+         */
+        std::memmove(m_buffer, m_buffer + count, m_size - count);
+        m_size -= count;
+
+        return true;
+    }
+
+    void TextWriter::reserve(std::size_t size)
+    {
+        if (m_capacity - m_size < size)
+            writeBuffer(NULL, 0, true);
+    }
+
+} // namespace cr
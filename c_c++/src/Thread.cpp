@@ -2,40 +2,77 @@
 
 namespace cr
 {
+    const std::size_t Thread::InlineSize;
+    const std::size_t ThreadAttributes::DefaultGuardSize;
+
     Thread::~Thread()
     {
         wait();
-        delete m_entryPoint;
+
+        /*
+         * The entry point was built either in m_storage or on the heap
+         */
+        const char * storage = reinterpret_cast<const char*>(&m_storage);
+        const char * entryPoint = reinterpret_cast<const char*>(m_entryPoint);
+
+        if( entryPoint >= storage && entryPoint < storage + sizeof(m_storage) )
+            m_entryPoint->~ThreadFunc();
+        else
+            delete m_entryPoint;
+    }
+
+    bool Thread::launch()
+    {
+        wait();
+        resetStopSource();
+        return m_impl.launch(this, NULL);
     }
 
-    void Thread::launch()
+    bool Thread::launch(const ThreadAttributes& attributes)
     {
         wait();
-        m_impl = new priv::ThreadImpl(this);
+        resetStopSource();
+        return m_impl.launch(this, &attributes);
     }
 
     void Thread::wait()
     {
-        if( m_impl )
-        {
-            m_impl->wait();
-            delete m_impl;
-            m_impl = NULL;
-        }
+        m_impl.wait();
+    }
+
+    bool Thread::requestStop()
+    {
+        return m_stopSource.requestStop();
+    }
+
+    StopToken Thread::getStopToken() const
+    {
+        return m_stopSource.getToken();
     }
 
     void Thread::terminate()
     {
-        if( m_impl )
-        {
-            m_impl->terminate();
-            delete m_impl;
-            m_impl = NULL;
-        }
+        requestStop();
+        wait();
+    }
+
+    bool Thread::terminate(Time timeout)
+    {
+        requestStop();
+        return m_impl.wait(timeout);
     }
 
     void Thread::run()
     {
-        m_entryPoint->run();
+        m_entryPoint->run(m_stopSource.getToken());
+    }
+
+    void Thread::resetStopSource()
+    {
+        /*
+         * A relaunched function starts with a fresh token
+         */
+        if( m_stopSource.isStopRequested() )
+            m_stopSource = StopSource();
     }
 } // namespace cr
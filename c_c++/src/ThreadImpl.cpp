@@ -1,22 +1,147 @@
 #include <ThreadImpl.hpp>
 #include <Thread.hpp>
+#include <ThreadAttributes.hpp>
 #include <iostream>
 #include <cassert>
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#include <cstring>
+#include <sched.h>
+#include <unistd.h>
+
+namespace
+{
+    int getPolicy(cr::ThreadAttributes::Policy policy)
+    {
+        switch( policy )
+        {
+            case cr::ThreadAttributes::Batch:      return SCHED_BATCH;
+            case cr::ThreadAttributes::Idle:       return SCHED_IDLE;
+            case cr::ThreadAttributes::Fifo:       return SCHED_FIFO;
+            case cr::ThreadAttributes::RoundRobin: return SCHED_RR;
+            default:                               return SCHED_OTHER;
+        }
+    }
+
+    bool isLinuxPolicy(cr::ThreadAttributes::Policy policy)
+    {
+        return policy == cr::ThreadAttributes::Batch || policy == cr::ThreadAttributes::Idle;
+    }
+
+    /*
+     * Translate the attributes ; returns an error code
+     */
+    int setAttributes(pthread_attr_t * attr, const cr::ThreadAttributes & attributes)
+    {
+        int result = 0;
+
+        if( attributes.stackSize > 0 )
+        {
+            std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            std::size_t size = (attributes.stackSize + page - 1) / page * page;
+            if( size < static_cast<std::size_t>(PTHREAD_STACK_MIN) )
+                size = PTHREAD_STACK_MIN;
+
+            result = pthread_attr_setstacksize(attr, size);
+        }
+
+        if( result == 0 && attributes.guardSize != cr::ThreadAttributes::DefaultGuardSize )
+            result = pthread_attr_setguardsize(attr, attributes.guardSize);
+
+        if( result == 0 && !attributes.affinity.empty() )
+        {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+
+            for( std::size_t i = 0; i < attributes.affinity.size(); ++i )
+            {
+                if( attributes.affinity[i] >= CPU_SETSIZE )
+                    return EINVAL;
+                CPU_SET(attributes.affinity[i], &cpus);
+            }
+
+            result = pthread_attr_setaffinity_np(attr, sizeof(cpus), &cpus);
+        }
+
+        /*
+         * pthread attributes only take the POSIX policies : the
+         * Linux ones (Batch, Idle) are set once the thread exists
+         */
+        if( result == 0 && attributes.policy != cr::ThreadAttributes::Inherit && !isLinuxPolicy(attributes.policy) )
+        {
+            sched_param param;
+            std::memset(&param, 0, sizeof(param));
+            param.sched_priority = attributes.priority;
+
+            result = pthread_attr_setinheritsched(attr, PTHREAD_EXPLICIT_SCHED);
+            if( result == 0 )
+                result = pthread_attr_setschedpolicy(attr, getPolicy(attributes.policy));
+            if( result == 0 )
+                result = pthread_attr_setschedparam(attr, &param);
+        }
+
+        return result;
+    }
+} // namespace
 
 namespace cr
 {
 
 namespace priv
 {
-    ThreadImpl::ThreadImpl(Thread * owner) :
-        m_isActive(true)
+    ThreadImpl::ThreadImpl() :
+        m_isActive(false)
+    {
+    }
+
+    bool ThreadImpl::launch(Thread * owner, const ThreadAttributes * attributes)
     {
-        m_isActive = pthread_create(&m_thread, NULL, &ThreadImpl::entryPoint, owner) == 0;
+        int result = 0;
+
+        if( !attributes )
+        {
+            result = pthread_create(&m_thread, NULL, &ThreadImpl::entryPoint, owner);
+        }
+        else
+        {
+            pthread_attr_t attr;
+            pthread_attr_init(&attr);
+
+            result = setAttributes(&attr, *attributes);
+            if( result == 0 )
+                result = pthread_create(&m_thread, &attr, &ThreadImpl::entryPoint, owner);
+
+            pthread_attr_destroy(&attr);
+        }
+
+        m_isActive = (result == 0);
 
         if( !m_isActive )
         {
-            std::cerr << "Failed to create thread" << std::endl;
+            std::cerr << "Failed to create thread (" << std::strerror(result) << ")" << std::endl;
+        }
+        else if( attributes )
+        {
+            if( isLinuxPolicy(attributes->policy) )
+            {
+                sched_param param;
+                std::memset(&param, 0, sizeof(param));
+                param.sched_priority = attributes->priority;
+
+                int error = pthread_setschedparam(m_thread, getPolicy(attributes->policy), &param);
+                if( error != 0 )
+                    std::cerr << "Failed to set the thread scheduling policy (" << std::strerror(error) << ")" << std::endl;
+            }
+
+            /*
+             * The kernel keeps 15 characters
+             */
+            if( !attributes->name.empty() )
+                pthread_setname_np(m_thread, attributes->name.substr(0, 15).c_str());
         }
+
+        return m_isActive;
     }
 
     void ThreadImpl::wait()
@@ -28,20 +153,40 @@ namespace priv
              */
             assert(pthread_equal(pthread_self(), m_thread) == 0);
             pthread_join(m_thread, NULL);
+            m_isActive = false;
         } 
     }
 
-    void ThreadImpl::terminate()
+    bool ThreadImpl::wait(Time timeout)
     {
-        if( m_isActive )
+        if( !m_isActive )
+            return true;
+
+        /*
+         * A thread cannot wait for itself!
+         */
+        assert(pthread_equal(pthread_self(), m_thread) == 0);
+
+        timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+
+        Int64 microseconds = timeout.asMicroseconds();
+        if( microseconds < 0 )
+            microseconds = 0;
+
+        deadline.tv_sec += static_cast<time_t>(microseconds / 1000000);
+        deadline.tv_nsec += static_cast<long>(microseconds % 1000000) * 1000;
+        if( deadline.tv_nsec >= 1000000000 )
         {
-            #ifndef __ANDROID__
-                pthread_cancel(m_thread);
-            #else
-                // See http://stackoverflow.com/questions/4610086/pthread-cancel-al
-                pthread_kill(m_thread, SIGUSR1);
-            #endif
+            deadline.tv_sec += 1;
+            deadline.tv_nsec -= 1000000000;
         }
+
+        if( pthread_timedjoin_np(m_thread, NULL, &deadline) != 0 )
+            return false;
+
+        m_isActive = false;
+        return true;
     }
 
     void * ThreadImpl::entryPoint(void * userData)
@@ -51,15 +196,9 @@ namespace priv
          */
         Thread * owner = static_cast<Thread*>(userData);
 
-        #ifndef __ANDROID__
-            /*
-             * Tell the thread to handle cancel requests immediately
-             */
-            pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
-        #endif
-
         /*
-         * Forward to the owner
+         * Forward to the owner ; the thread is never cancelled,
+         * its function stops when it sees its stop token
          */
         owner->run();
 
@@ -0,0 +1,141 @@
+#include <ThreadPool.hpp>
+#include <Lock.hpp>
+#include <exception>
+#include <iostream>
+#include <unistd.h>
+
+namespace cr
+{
+
+    ThreadPool::ThreadPool(std::size_t threadCount, std::size_t queueCapacity) :
+        m_capacity (queueCapacity),
+        m_isRunning(true)
+    {
+        if (threadCount == 0)
+        {
+            long cores = sysconf(_SC_NPROCESSORS_ONLN);
+            threadCount = cores > 0 ? static_cast<std::size_t>(cores) : 1;
+        }
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            m_workers.push_back(new Thread(&ThreadPool::work, this));
+            m_workers.back()->launch();
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        shutdown();
+    }
+
+    void ThreadPool::shutdown()
+    {
+        std::vector<Thread*> workers;
+        {
+            Lock lock(m_mutex);
+            m_isRunning = false;
+            workers.swap(m_workers);
+        }
+
+        /*
+         * Wake up the idle workers, and the producers waiting
+         * for room so that they see the pool is stopped
+         */
+        m_notEmpty.notifyAll();
+        m_notFull.notifyAll();
+
+        for (std::size_t i = 0; i < workers.size(); ++i)
+        {
+            workers[i]->wait();
+            delete workers[i];
+        }
+    }
+
+    bool ThreadPool::isRunning() const
+    {
+        Lock lock(m_mutex);
+        return m_isRunning;
+    }
+
+    std::size_t ThreadPool::getThreadCount() const
+    {
+        Lock lock(m_mutex);
+        return m_workers.size();
+    }
+
+    std::size_t ThreadPool::getQueueSize() const
+    {
+        Lock lock(m_mutex);
+        return m_queue.size();
+    }
+
+    std::size_t ThreadPool::getQueueCapacity() const
+    {
+        return m_capacity;
+    }
+
+    bool ThreadPool::push(priv::PoolTask* task)
+    {
+        {
+            Lock lock(m_mutex);
+
+            while (m_isRunning && m_capacity > 0 && m_queue.size() >= m_capacity)
+                m_notFull.wait(lock);
+
+            if (!m_isRunning)
+            {
+                lock.unlock();
+                delete task;
+                return false;
+            }
+
+            m_queue.push_back(task);
+        }
+
+        m_notEmpty.notifyOne();
+        return true;
+    }
+
+    void ThreadPool::work()
+    {
+        for (;;)
+        {
+            priv::PoolTask* task;
+            {
+                Lock lock(m_mutex);
+
+                while (m_queue.empty() && m_isRunning)
+                    m_notEmpty.wait(lock);
+
+                /*
+                 * Stopped, and nothing left to run
+                 */
+                if (m_queue.empty())
+                    return;
+
+                task = m_queue.front();
+                m_queue.pop_front();
+            }
+
+            if (m_capacity > 0)
+                m_notFull.notifyOne();
+
+            try
+            {
+                task->run();
+            }
+            catch (const std::exception& exception)
+            {
+                std::cerr << "Uncaught exception in a thread pool task (" << exception.what() << ")" << std::endl;
+            }
+            catch (...)
+            {
+                std::cerr << "Uncaught exception in a thread pool task" << std::endl;
+            }
+
+            delete task;
+        }
+    }
+
+} // namespace cr
@@ -0,0 +1,65 @@
+#include <Utf8View.hpp>
+#include <StringBuilder.hpp>
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace cr
+{
+
+    bool Utf8View::isValid() const
+    {
+        const Uint8* begin = reinterpret_cast<const Uint8*>(m_data);
+        const Uint8* end = begin + m_size;
+
+        while (begin < end)
+        {
+        #if defined(__SSE2__)
+            /*
+             * Skip 16 ASCII bytes at a time
+             */
+            while (end - begin >= 16 &&
+                   _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(begin))) == 0)
+                begin += 16;
+
+            if (begin == end)
+                break;
+        #endif
+
+            Uint8 lead = *begin;
+            if (lead < 0x80)
+            {
+                ++begin;
+                continue;
+            }
+
+            Uint8 low;
+            Uint8 high;
+            std::size_t size = priv::getUtf8Size(lead, low, high);
+            if (size == 0)
+                return false;
+
+            if (static_cast<std::size_t>(end - begin) < size || begin[1] < low || begin[1] > high)
+                return false;
+
+            for (std::size_t i = 2; i < size; ++i)
+            {
+                if ((begin[i] & 0xC0) != 0x80)
+                    return false;
+            }
+
+            begin += size;
+        }
+
+        return true;
+    }
+
+    String Utf8View::toString() const
+    {
+        StringBuilder builder(m_size);
+        builder.appendUtf8(m_data, m_size);
+
+        return builder.build();
+    }
+
+} // namespace cr
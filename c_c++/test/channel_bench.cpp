@@ -0,0 +1,197 @@
+#include <Channel.hpp>
+#include <ConditionVariable.hpp>
+#include <Lock.hpp>
+#include <Mutex.hpp>
+#include <Thread.hpp>
+#include <Clock.hpp>
+#include <atomic>
+#include <deque>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    const long Messages = 1000000;
+    const std::size_t Capacity = 256;
+
+    /*
+     * What the channel replaces : a std::deque protected by a mutex
+     */
+    class LockedChannel
+    {
+    public:
+        LockedChannel() : m_isClosed(false) {}
+
+        bool send(long value)
+        {
+            cr::Lock lock(m_mutex);
+            m_notFull.wait(lock, [this]() { return m_items.size() < Capacity || m_isClosed; });
+            if (m_isClosed)
+                return false;
+            m_items.push_back(value);
+            m_notEmpty.notifyOne();
+            return true;
+        }
+
+        bool receive(long& value)
+        {
+            cr::Lock lock(m_mutex);
+            m_notEmpty.wait(lock, [this]() { return !m_items.empty() || m_isClosed; });
+            if (m_items.empty())
+                return false;
+            value = m_items.front();
+            m_items.pop_front();
+            m_notFull.notifyOne();
+            return true;
+        }
+
+        void close()
+        {
+            cr::Lock lock(m_mutex);
+            m_isClosed = true;
+            m_notEmpty.notifyAll();
+            m_notFull.notifyAll();
+        }
+
+    private:
+        std::deque<long>      m_items;
+        bool                  m_isClosed;
+        cr::Mutex             m_mutex;
+        cr::ConditionVariable m_notEmpty;
+        cr::ConditionVariable m_notFull;
+    };
+
+    /*
+     * Producers sending, consumers receiving until the channel is closed
+     */
+    template <typename C>
+    double run(C& channel, int producers, int consumers, long messages)
+    {
+        std::atomic<long> received(0);
+        cr::Clock clock;
+
+        std::vector<cr::Thread*> receivers;
+        for (int i = 0; i < consumers; ++i)
+        {
+            receivers.push_back(new cr::Thread([&]()
+            {
+                long count = 0;
+                long value;
+                while (channel.receive(value))
+                    ++count;
+                received += count;
+            }));
+            receivers.back()->launch();
+        }
+
+        std::vector<cr::Thread*> senders;
+        for (int i = 0; i < producers; ++i)
+        {
+            long count = messages / producers;
+            senders.push_back(new cr::Thread([&channel, count]()
+            {
+                for (long j = 0; j < count; ++j)
+                    channel.send(j);
+            }));
+            senders.back()->launch();
+        }
+
+        for (int i = 0; i < producers; ++i)
+            delete senders[i];
+        channel.close();
+        for (int i = 0; i < consumers; ++i)
+            delete receivers[i];
+
+        double seconds = clock.getElapsedTime().asSeconds();
+        return received.load() == messages / producers * producers ? received.load() / seconds / 1e6 : -1;
+    }
+
+    /*
+     * One consumer selecting over four bounded channels, one producer each
+     */
+    double runSelect()
+    {
+        const int Channels = 4;
+        std::vector<cr::Channel<long>*> channels;
+        for (int i = 0; i < Channels; ++i)
+            channels.push_back(new cr::Channel<long>(Capacity));
+
+        cr::Clock clock;
+        std::vector<cr::Thread*> senders;
+        for (int i = 0; i < Channels; ++i)
+        {
+            cr::Channel<long>* channel = channels[i];
+            senders.push_back(new cr::Thread([channel]()
+            {
+                for (long j = 0; j < Messages / Channels; ++j)
+                    channel->send(j);
+                channel->close();
+            }));
+            senders.back()->launch();
+        }
+
+        long value;
+        long received = 0;
+        int open = Channels;
+        std::vector<bool> isClosed(Channels, false);
+        cr::Select select;
+        for (int i = 0; i < Channels; ++i)
+            select.addReceive(*channels[i], value);
+
+        while (open > 0)
+        {
+            /*
+             * A closed channel stays selectable : count it once
+             */
+            std::size_t index = select.wait();
+            if (!select.isClosed())
+                ++received;
+            else if (!isClosed[index])
+            {
+                isClosed[index] = true;
+                --open;
+            }
+        }
+
+        for (int i = 0; i < Channels; ++i)
+        {
+            delete senders[i];
+            delete channels[i];
+        }
+
+        double seconds = clock.getElapsedTime().asSeconds();
+        return received == Messages ? received / seconds / 1e6 : -1;
+    }
+}
+
+/*
+ * Messages per second, in millions (-1 : messages lost)
+ */
+int main()
+{
+    std::cout << "producers x consumers   mutex+deque   bounded   unbounded   rendezvous" << std::endl;
+
+    const int counts[][2] = { { 1, 1 }, { 4, 1 }, { 4, 4 } };
+    for (std::size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+    {
+        int producers = counts[i][0];
+        int consumers = counts[i][1];
+
+        LockedChannel locked;
+        cr::Channel<long> bounded(Capacity);
+        cr::Channel<long> unbounded(cr::Channel<long>::Unbounded);
+        cr::Channel<long> rendezvous(0);
+
+        double reference = run(locked, producers, consumers, Messages);
+        double fast = run(bounded, producers, consumers, Messages);
+        double growing = run(unbounded, producers, consumers, Messages);
+        double synchronous = run(rendezvous, producers, consumers, Messages / 10);
+
+        std::cout << "              " << producers << " x " << consumers << "   "
+                  << reference << "   " << fast << "   " << growing << "   " << synchronous << " M/s" << std::endl;
+    }
+
+    std::cout << "select over 4 bounded channels   " << runSelect() << " M/s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include <Collator.hpp>
+#include <String.hpp>
+#include <Clock.hpp>
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    /*
+     * Comparison through the collator, for std::sort
+     */
+    struct CollatorLess
+    {
+        explicit CollatorLess(const cr::Collator& collator) :
+            m_collator(collator)
+        {
+        }
+
+        bool operator()(const cr::String& left, const cr::String& right) const
+        {
+            return m_collator.compare(left, right) < 0;
+        }
+
+        const cr::Collator& m_collator;
+    };
+
+    /*
+     * Random words mixing ASCII, accented Latin and a few ideographs
+     */
+    std::vector<cr::String> makeWords(std::size_t count)
+    {
+        static const cr::Uint32 letters[] = { 'a', 'b', 'c', 'd', 'e', 'E', 'o', 'r', 's', 't', '-', ' ',
+                                              0x00E9, 0x00E8, 0x00F6, 0x00C0, 0x4E00, 0x6C34 };
+        const std::size_t letterCount = sizeof(letters) / sizeof(letters[0]);
+
+        std::vector<cr::String> words;
+        words.reserve(count);
+
+        cr::Uint32 seed = 12345;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            cr::String word;
+            std::size_t length = 4 + i % 12;
+            for (std::size_t j = 0; j < length; ++j)
+            {
+                seed = seed * 1103515245 + 12345;
+                word += cr::String(letters[(seed >> 16) % letterCount]);
+            }
+            words.push_back(word);
+        }
+
+        return words;
+    }
+
+    void report(const char* name, const cr::Clock& clock, std::size_t count)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " : " << static_cast<int>(seconds * 1000) << " ms"
+                  << " (" << static_cast<int>(count / seconds / 1000) << " Kstrings/s)" << std::endl;
+    }
+}
+
+/*
+ * Sorting with cr::Collator : comparison per pair (std::sort),
+ * sort keys computed once (Collator::sort), and sort keys kept
+ * in a cache between sorts
+ */
+int main()
+{
+    const std::size_t count = 200000;
+    const std::vector<cr::String> words = makeWords(count);
+
+    cr::Collator collator;
+    std::vector<cr::String> strings;
+
+    strings = words;
+    {
+        cr::Clock clock;
+        std::sort(strings.begin(), strings.end(), CollatorLess(collator));
+        report("std::sort + compare     ", clock, count);
+    }
+
+    strings = words;
+    {
+        cr::Clock clock;
+        collator.sort(strings);
+        report("Collator::sort          ", clock, count);
+    }
+
+    cr::CollationKeyCache cache;
+    strings = words;
+    {
+        cr::Clock clock;
+        collator.sort(strings, cache);
+        report("Collator::sort (cold)   ", clock, count);
+    }
+
+    strings = words;
+    {
+        cr::Clock clock;
+        collator.sort(strings, cache);
+        report("Collator::sort (cached) ", clock, count);
+    }
+
+    cr::SortKey key;
+    std::size_t bytes = 0;
+    {
+        cr::Clock clock;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            collator.getSortKey(words[i], key);
+            bytes += key.size();
+        }
+        report("getSortKey              ", clock, count);
+    }
+    std::cout << "average key size : " << bytes / count << " bytes" << std::endl;
+
+    return 0;
+}
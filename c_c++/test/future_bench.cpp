@@ -0,0 +1,94 @@
+#include <Future.hpp>
+#include <ThreadPool.hpp>
+#include <Clock.hpp>
+#include <future>
+#include <iostream>
+
+namespace
+{
+    void report(const char* name, const cr::Clock& clock, std::size_t count, long long check)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " : " << static_cast<int>(seconds * 1000) << " ms, "
+                  << seconds * 1e9 / count << " ns/step (" << check << ")" << std::endl;
+    }
+}
+
+/*
+ * Continuation chains : the cost of a step of cr::Future::then()
+ * against a std::promise/std::future handoff, in the same thread
+ * and through a cr::ThreadPool
+ */
+int main()
+{
+    const std::size_t chains = 20000;
+    const std::size_t length = 50;
+
+    {
+        cr::Clock clock;
+        long long total = 0;
+        for (std::size_t i = 0; i < chains; ++i)
+        {
+            for (std::size_t j = 0; j < length; ++j)
+            {
+                std::promise<long long> promise;
+                std::future<long long> future = promise.get_future();
+                promise.set_value(static_cast<long long>(j));
+                total += future.get();
+            }
+        }
+        report("std::promise set/get, inline  ", clock, chains * length, total);
+    }
+
+    {
+        cr::Clock clock;
+        long long total = 0;
+        for (std::size_t i = 0; i < chains; ++i)
+        {
+            for (std::size_t j = 0; j < length; ++j)
+            {
+                cr::Promise<long long> promise;
+                cr::Future<long long> future = promise.getFuture();
+                promise.setValue(static_cast<long long>(j));
+                total += future.get();
+            }
+        }
+        report("cr::Promise set/get, inline   ", clock, chains * length, total);
+    }
+
+    {
+        cr::Clock clock;
+        long long total = 0;
+        for (std::size_t i = 0; i < chains; ++i)
+        {
+            cr::Promise<long long> promise;
+            cr::Future<long long> future = promise.getFuture();
+            for (std::size_t j = 0; j < length; ++j)
+                future = future.then([j](long long value) { return value + static_cast<long long>(j); });
+            promise.setValue(0);
+            total += future.get();
+        }
+        report("cr::Future::then chain, inline", clock, chains * length, total);
+    }
+
+    const std::size_t poolSteps = 20000;
+    cr::ThreadPool pool(2);
+
+    {
+        cr::Clock clock;
+        long long value = 0;
+        for (std::size_t j = 0; j < poolSteps; ++j)
+            value = pool.submit([value, j]() { return value + static_cast<long long>(j); }).get();
+        report("ThreadPool::submit + get      ", clock, poolSteps, value);
+    }
+
+    {
+        cr::Clock clock;
+        cr::Future<long long> future = cr::async(pool, []() { return 0LL; });
+        for (std::size_t j = 0; j < poolSteps; ++j)
+            future = future.then(pool, [j](long long value) { return value + static_cast<long long>(j); });
+        report("cr::Future::then chain, pool  ", clock, poolSteps, future.get());
+    }
+
+    return 0;
+}
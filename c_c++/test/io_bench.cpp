@@ -0,0 +1,129 @@
+#include <IoRing.hpp>
+#include <Clock.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace
+{
+    const std::size_t BlockSize = 4096;
+    const std::size_t Depth = 64;
+
+    void report(const char* name, const cr::Clock& clock, std::size_t count, long long checksum)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " : " << static_cast<int>(seconds * 1000) << " ms, "
+                  << static_cast<int>(count / seconds) << " reads/s (" << checksum << ")" << std::endl;
+    }
+
+    /*
+     * One pread per block
+     */
+    void benchPread(const char* name, int file, const std::vector<unsigned long long>& offsets, char* buffers)
+    {
+        cr::Clock clock;
+        long long checksum = 0;
+        for (std::size_t i = 0; i < offsets.size(); ++i)
+        {
+            char* buffer = buffers + (i % Depth) * BlockSize;
+            if (pread(file, buffer, BlockSize, offsets[i]) == static_cast<ssize_t>(BlockSize))
+                checksum += buffer[17];
+        }
+        report(name, clock, offsets.size(), checksum);
+    }
+
+    /*
+     * Up to Depth reads in flight, each completion refilled at once
+     */
+    void benchRing(const char* name, cr::IoRing::Backend backend, int file, const std::vector<unsigned long long>& offsets, char* buffers)
+    {
+        cr::IoRing ring(Depth, backend);
+        if (!ring.isValid())
+            return;
+
+        cr::Clock clock;
+        long long checksum = 0;
+        std::size_t issued = 0;
+        std::size_t slot = 0;
+
+        for (; issued < offsets.size() && issued < Depth; ++issued, ++slot)
+            ring.prepareRead(file, buffers + slot * BlockSize, BlockSize, offsets[issued], slot);
+        ring.submit();
+
+        cr::IoCompletion completions[Depth];
+        while (ring.getPendingCount() > 0)
+        {
+            std::size_t count = ring.waitCompletions(completions, Depth);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::size_t index = completions[i].userData;
+                if (completions[i].result == static_cast<cr::Int64>(BlockSize))
+                    checksum += buffers[index * BlockSize + 17];
+
+                if (issued < offsets.size())
+                    ring.prepareRead(file, buffers + index * BlockSize, BlockSize, offsets[issued++], index);
+            }
+            ring.submit();
+        }
+
+        report(name, clock, offsets.size(), checksum);
+    }
+}
+
+/*
+ * Random 4 KiB reads of a large file : a pread loop against
+ * cr::IoRing keeping 64 reads in flight, through the page cache
+ * and with O_DIRECT
+ */
+int main(int argc, char** argv)
+{
+    const char* filename = argc > 1 ? argv[1] : "/tmp/cr_io_bench.bin";
+    const std::size_t size = 256 << 20;
+    const std::size_t count = 1 << 16;
+
+    if (argc <= 1)
+    {
+        std::vector<char> chunk(1 << 20);
+        for (std::size_t i = 0; i < chunk.size(); ++i)
+            chunk[i] = static_cast<char>(i * 7);
+
+        FILE* file = std::fopen(filename, "wb");
+        for (std::size_t written = 0; written < size; written += chunk.size())
+            std::fwrite(&chunk[0], 1, chunk.size(), file);
+        std::fclose(file);
+    }
+
+    std::srand(21);
+    std::vector<unsigned long long> offsets(count);
+    for (std::size_t i = 0; i < count; ++i)
+        offsets[i] = static_cast<unsigned long long>(std::rand() % (size / BlockSize)) * BlockSize;
+
+    void* memory = NULL;
+    if (posix_memalign(&memory, BlockSize, Depth * BlockSize) != 0)
+        return 1;
+    char* buffers = static_cast<char*>(memory);
+
+    int file = open(filename, O_RDONLY);
+    benchPread("pread             ", file, offsets, buffers);
+    benchRing ("IoRing Threads    ", cr::IoRing::Threads, file, offsets, buffers);
+    benchRing ("IoRing Uring      ", cr::IoRing::Uring, file, offsets, buffers);
+    close(file);
+
+    file = open(filename, O_RDONLY | O_DIRECT);
+    if (file >= 0)
+    {
+        benchPread("pread direct      ", file, offsets, buffers);
+        benchRing ("IoRing Threads dio", cr::IoRing::Threads, file, offsets, buffers);
+        benchRing ("IoRing Uring dio  ", cr::IoRing::Uring, file, offsets, buffers);
+        close(file);
+    }
+
+    std::free(buffers);
+    if (argc <= 1)
+        std::remove(filename);
+
+    return 0;
+}
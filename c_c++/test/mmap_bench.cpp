@@ -0,0 +1,76 @@
+#include <MappedFile.hpp>
+#include <String.hpp>
+#include <Clock.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    void report(const char* name, const cr::Clock& clock, std::size_t bytes, std::size_t result)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " : " << static_cast<int>(seconds * 1000) << " ms, "
+                  << static_cast<int>(bytes / seconds / 1e6) << " MB/s (" << result << ")" << std::endl;
+    }
+}
+
+/*
+ * Loading a large UTF-8 file : std::ifstream into a std::string
+ * then cr::String, against cr::MappedFile (scan in place, and
+ * decode into a cr::String)
+ */
+int main(int argc, char** argv)
+{
+    const char* filename = argc > 1 ? argv[1] : "/tmp/cr_mmap_bench.txt";
+    const std::size_t size = 256 << 20;
+
+    if (argc <= 1)
+    {
+        std::ofstream file(filename, std::ios::binary);
+        std::string line("The quick brown fox jumps over the lazy dog, caf\xC3\xA9 \xEA\xB0\x80\xEB\x82\x98.\n");
+        for (std::size_t written = 0; written < size; written += line.size())
+            file << line;
+    }
+
+    {
+        cr::Clock clock;
+        std::ifstream file(filename, std::ios::binary);
+        std::ostringstream buffer;
+        buffer << file.rdbuf();
+        std::string content = buffer.str();
+        cr::String text = cr::String::fromUtf8(content.begin(), content.end());
+        report("ifstream + String::fromUtf8 ", clock, content.size(), text.getSize());
+    }
+
+    {
+        cr::Clock clock;
+        cr::MappedFile file(filename);
+        cr::String text = file.toString();
+        report("MappedFile::toString        ", clock, file.getSize(), text.getSize());
+    }
+
+    {
+        cr::Clock clock;
+        cr::MappedFile file(filename);
+        cr::Utf8View view = file.getView();
+        std::size_t lines = std::count(view.begin(), view.end(), '\n');
+        report("MappedFile scan (lines)     ", clock, file.getSize(), lines);
+    }
+
+    {
+        cr::Clock clock;
+        cr::MappedFile file(filename);
+        bool valid = file.getView().isValid();
+        report("MappedFile isValid          ", clock, file.getSize(), valid);
+    }
+
+    if (argc <= 1)
+        std::remove(filename);
+
+    return 0;
+}
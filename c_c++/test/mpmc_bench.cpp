@@ -0,0 +1,166 @@
+#include <MpmcQueue.hpp>
+#include <ConditionVariable.hpp>
+#include <Lock.hpp>
+#include <Mutex.hpp>
+#include <Thread.hpp>
+#include <Clock.hpp>
+#include <atomic>
+#include <iostream>
+#include <queue>
+#include <vector>
+
+namespace
+{
+    const long Items = 2000000;
+    const std::size_t Capacity = 1024;
+    const std::size_t Batch = 16;
+
+    /*
+     * What the queue replaces : a std::queue protected by a mutex
+     */
+    class LockedQueue
+    {
+    public:
+        void push(long value)
+        {
+            cr::Lock lock(m_mutex);
+            m_notFull.wait(lock, [this]() { return m_items.size() < Capacity; });
+            m_items.push(value);
+            m_notEmpty.notifyOne();
+        }
+
+        void pop(long& value)
+        {
+            cr::Lock lock(m_mutex);
+            m_notEmpty.wait(lock, [this]() { return !m_items.empty(); });
+            value = m_items.front();
+            m_items.pop();
+            m_notFull.notifyOne();
+        }
+
+    private:
+        std::queue<long>      m_items;
+        cr::Mutex             m_mutex;
+        cr::ConditionVariable m_notEmpty;
+        cr::ConditionVariable m_notFull;
+    };
+
+    /*
+     * One element at a time
+     */
+    template <typename Q>
+    double runSingle(Q& queue, int producers, int consumers)
+    {
+        std::atomic<long> total(0);
+        cr::Clock clock;
+        std::vector<cr::Thread*> threads;
+
+        for (int i = 0; i < consumers; ++i)
+        {
+            long count = Items / consumers;
+            threads.push_back(new cr::Thread([&queue, &total, count]()
+            {
+                long sum = 0;
+                long value;
+                for (long j = 0; j < count; ++j)
+                {
+                    queue.pop(value);
+                    sum += value;
+                }
+                total += sum;
+            }));
+            threads.back()->launch();
+        }
+        for (int i = 0; i < producers; ++i)
+        {
+            long count = Items / producers;
+            threads.push_back(new cr::Thread([&queue, count]()
+            {
+                for (long j = 0; j < count; ++j)
+                    queue.push(1);
+            }));
+            threads.back()->launch();
+        }
+        for (std::size_t i = 0; i < threads.size(); ++i)
+            delete threads[i];
+
+        double seconds = clock.getElapsedTime().asSeconds();
+        return total.load() == Items ? Items / seconds / 1e6 : -1;
+    }
+
+    /*
+     * Batches of elements
+     */
+    double runBatch(int producers, int consumers)
+    {
+        cr::MpmcQueue<long> queue(Capacity);
+        std::atomic<long> total(0);
+        cr::Clock clock;
+        std::vector<cr::Thread*> threads;
+
+        for (int i = 0; i < consumers; ++i)
+        {
+            long count = Items / consumers;
+            threads.push_back(new cr::Thread([&queue, &total, count]()
+            {
+                long sum = 0;
+                long values[Batch];
+                for (long left = count; left > 0; )
+                {
+                    std::size_t popped = queue.popBatch(values, left < static_cast<long>(Batch) ? left : Batch);
+                    for (std::size_t j = 0; j < popped; ++j)
+                        sum += values[j];
+                    left -= popped;
+                }
+                total += sum;
+            }));
+            threads.back()->launch();
+        }
+        for (int i = 0; i < producers; ++i)
+        {
+            long count = Items / producers;
+            threads.push_back(new cr::Thread([&queue, count]()
+            {
+                long values[Batch];
+                for (std::size_t j = 0; j < Batch; ++j)
+                    values[j] = 1;
+                for (long j = 0; j < count; j += Batch)
+                    queue.pushBatch(values, Batch);
+            }));
+            threads.back()->launch();
+        }
+        for (std::size_t i = 0; i < threads.size(); ++i)
+            delete threads[i];
+
+        double seconds = clock.getElapsedTime().asSeconds();
+        return total.load() == Items ? Items / seconds / 1e6 : -1;
+    }
+}
+
+/*
+ * Throughput, in millions of elements per second, for several
+ * numbers of producers and consumers (-1 : elements lost)
+ */
+int main()
+{
+    std::cout << "producers x consumers   mutex+std::queue   cr::MpmcQueue   cr::MpmcQueue (batch " << Batch << ")" << std::endl;
+
+    const int counts[][2] = { { 1, 1 }, { 1, 4 }, { 4, 1 }, { 2, 2 }, { 4, 4 }, { 8, 8 } };
+    for (std::size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+    {
+        int producers = counts[i][0];
+        int consumers = counts[i][1];
+
+        LockedQueue locked;
+        cr::MpmcQueue<long> lockFree(Capacity);
+
+        double reference = runSingle(locked, producers, consumers);
+        double single = runSingle(lockFree, producers, consumers);
+        double batch = runBatch(producers, consumers);
+
+        std::cout << "              " << producers << " x " << consumers << "   "
+                  << reference << "   " << single << "   " << batch << " M/s" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,217 @@
+#include <ConditionVariable.hpp>
+#include <Lock.hpp>
+#include <Mutex.hpp>
+#include <Semaphore.hpp>
+#include <Thread.hpp>
+#include <Clock.hpp>
+#include <iostream>
+#include <vector>
+#include <pthread.h>
+#include <semaphore.h>
+
+namespace
+{
+    const int ThreadCount = 4;
+    const int Iterations = 1000000;
+    const int PingPongs = 50000;
+
+    void report(const char* name, const cr::Clock& clock, long count)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " : " << static_cast<int>(seconds * 1000) << " ms, "
+                  << seconds * 1e9 / count << " ns/op" << std::endl;
+    }
+
+    /*
+     * Contention : threads incrementing a shared counter
+     */
+    template <typename L>
+    void contend(const char* name, L& lock)
+    {
+        long counter = 0;
+        cr::Clock clock;
+        std::vector<cr::Thread*> threads;
+        for (int i = 0; i < ThreadCount; ++i)
+        {
+            threads.push_back(new cr::Thread([&]()
+            {
+                for (int j = 0; j < Iterations; ++j)
+                {
+                    lock.lock();
+                    ++counter;
+                    lock.unlock();
+                }
+            }));
+            threads.back()->launch();
+        }
+        for (int i = 0; i < ThreadCount; ++i)
+            delete threads[i];
+        report(name, clock, counter);
+    }
+
+    struct PthreadMutex
+    {
+        PthreadMutex() { pthread_mutex_init(&mutex, NULL); }
+        ~PthreadMutex() { pthread_mutex_destroy(&mutex); }
+        void lock() { pthread_mutex_lock(&mutex); }
+        void unlock() { pthread_mutex_unlock(&mutex); }
+        pthread_mutex_t mutex;
+    };
+}
+
+/*
+ * cr::Mutex, cr::ConditionVariable and cr::Semaphore against the
+ * pthread equivalents : lock/unlock alone, contended by several
+ * threads, and hand-offs between two threads (which sleep)
+ */
+int main()
+{
+    /*
+     * glibc skips the atomic instructions of pthread_mutex while
+     * the process has a single thread : keep a second one alive
+     */
+    cr::Thread idle([](cr::StopToken token) { token.sleep(cr::seconds(3600)); });
+    idle.launch();
+
+    {
+        cr::Mutex mutex;
+        cr::Clock clock;
+        for (int i = 0; i < Iterations * 10; ++i)
+        {
+            mutex.lock();
+            mutex.unlock();
+        }
+        report("cr::Mutex, uncontended          ", clock, Iterations * 10);
+    }
+
+    {
+        PthreadMutex mutex;
+        cr::Clock clock;
+        for (int i = 0; i < Iterations * 10; ++i)
+        {
+            mutex.lock();
+            mutex.unlock();
+        }
+        report("pthread_mutex, uncontended      ", clock, Iterations * 10);
+    }
+
+    idle.terminate();
+
+    {
+        cr::Mutex mutex;
+        contend("cr::Mutex, 4 threads            ", mutex);
+    }
+
+    {
+        PthreadMutex mutex;
+        contend("pthread_mutex, 4 threads        ", mutex);
+    }
+
+    {
+        cr::Mutex mutex;
+        cr::ConditionVariable condition;
+        int turn = 0;
+        cr::Clock clock;
+        cr::Thread other([&]()
+        {
+            for (int i = 0; i < PingPongs; ++i)
+            {
+                cr::Lock lock(mutex);
+                condition.wait(lock, [&]() { return turn == 1; });
+                turn = 0;
+                condition.notifyOne();
+            }
+        });
+        other.launch();
+        for (int i = 0; i < PingPongs; ++i)
+        {
+            cr::Lock lock(mutex);
+            turn = 1;
+            condition.notifyOne();
+            condition.wait(lock, [&]() { return turn == 0; });
+        }
+        other.wait();
+        report("cr::ConditionVariable ping-pong ", clock, PingPongs * 2);
+    }
+
+    {
+        pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+        pthread_cond_t condition = PTHREAD_COND_INITIALIZER;
+        int turn = 0;
+        cr::Clock clock;
+        cr::Thread other([&]()
+        {
+            for (int i = 0; i < PingPongs; ++i)
+            {
+                pthread_mutex_lock(&mutex);
+                while (turn != 1)
+                    pthread_cond_wait(&condition, &mutex);
+                turn = 0;
+                pthread_cond_signal(&condition);
+                pthread_mutex_unlock(&mutex);
+            }
+        });
+        other.launch();
+        for (int i = 0; i < PingPongs; ++i)
+        {
+            pthread_mutex_lock(&mutex);
+            turn = 1;
+            pthread_cond_signal(&condition);
+            while (turn != 0)
+                pthread_cond_wait(&condition, &mutex);
+            pthread_mutex_unlock(&mutex);
+        }
+        other.wait();
+        report("pthread_cond ping-pong          ", clock, PingPongs * 2);
+    }
+
+    {
+        cr::Semaphore ping;
+        cr::Semaphore pong;
+        cr::Clock clock;
+        cr::Thread other([&]()
+        {
+            for (int i = 0; i < PingPongs; ++i)
+            {
+                ping.wait();
+                pong.post();
+            }
+        });
+        other.launch();
+        for (int i = 0; i < PingPongs; ++i)
+        {
+            ping.post();
+            pong.wait();
+        }
+        other.wait();
+        report("cr::Semaphore ping-pong         ", clock, PingPongs * 2);
+    }
+
+    {
+        sem_t ping;
+        sem_t pong;
+        sem_init(&ping, 0, 0);
+        sem_init(&pong, 0, 0);
+        cr::Clock clock;
+        cr::Thread other([&]()
+        {
+            for (int i = 0; i < PingPongs; ++i)
+            {
+                sem_wait(&ping);
+                sem_post(&pong);
+            }
+        });
+        other.launch();
+        for (int i = 0; i < PingPongs; ++i)
+        {
+            sem_post(&ping);
+            sem_wait(&pong);
+        }
+        other.wait();
+        report("sem_t ping-pong                 ", clock, PingPongs * 2);
+        sem_destroy(&ping);
+        sem_destroy(&pong);
+    }
+
+    return 0;
+}
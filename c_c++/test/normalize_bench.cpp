@@ -0,0 +1,75 @@
+#include <Normalization.hpp>
+#include <String.hpp>
+#include <Clock.hpp>
+#include <iostream>
+
+namespace
+{
+    /*
+     * Normalize the same text many times, print the throughput
+     */
+    void run(const char* name, const cr::String& text, cr::NormalizationForm form, int rounds)
+    {
+        std::size_t total = 0;
+        cr::Clock clock;
+
+        for (int i = 0; i < rounds; ++i)
+            total += cr::normalize(text, form).getSize();
+
+        double seconds = clock.getElapsedTime().asSeconds();
+        double mchars = static_cast<double>(text.getSize()) * rounds / 1e6;
+
+        std::cout << name << " : " << static_cast<int>(mchars / seconds) << " Mchars/s"
+                  << " (" << total / rounds << " chars)" << std::endl;
+    }
+
+    void check(const char* name, const cr::String& text, cr::NormalizationForm form, int rounds)
+    {
+        int normalized = 0;
+        cr::Clock clock;
+
+        for (int i = 0; i < rounds; ++i)
+            normalized += cr::isNormalized(text, form);
+
+        double seconds = clock.getElapsedTime().asSeconds();
+        double mchars = static_cast<double>(text.getSize()) * rounds / 1e6;
+
+        std::cout << name << " : " << static_cast<int>(mchars / seconds) << " Mchars/s"
+                  << " (" << normalized << "/" << rounds << " normalized)" << std::endl;
+    }
+}
+
+/*
+ * Throughput of cr::normalize and cr::isNormalized on ASCII,
+ * composed Latin, decomposed Latin and Hangul text
+ */
+int main()
+{
+    const int size = 1 << 20;
+    const int rounds = 20;
+
+    cr::String ascii, latin, decomposed, hangul;
+
+    for (int i = 0; i < size; ++i)
+    {
+        ascii += cr::String(cr::Uint32('a' + i % 26));
+        latin += cr::String(cr::Uint32(i % 4 ? 'a' + i % 26 : 0x00E0 + i % 16));
+        hangul += cr::String(cr::Uint32(0xAC00 + (i * 7) % 11172));
+    }
+
+    decomposed = cr::normalize(latin, cr::NFD);
+
+    check("isNormalized NFC ascii      ", ascii, cr::NFC, rounds);
+    check("isNormalized NFC latin      ", latin, cr::NFC, rounds);
+    check("isNormalized NFD decomposed ", decomposed, cr::NFD, rounds);
+    check("isNormalized NFC hangul     ", hangul, cr::NFC, rounds);
+
+    run("normalize NFC ascii         ", ascii, cr::NFC, rounds);
+    run("normalize NFC latin         ", latin, cr::NFC, rounds);
+    run("normalize NFD latin         ", latin, cr::NFD, rounds);
+    run("normalize NFC decomposed    ", decomposed, cr::NFC, rounds);
+    run("normalize NFKD latin        ", latin, cr::NFKD, rounds);
+    run("normalize NFD hangul        ", hangul, cr::NFD, rounds);
+
+    return 0;
+}
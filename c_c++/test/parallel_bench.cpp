@@ -0,0 +1,115 @@
+#include <Parallel.hpp>
+#include <Clock.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include <unistd.h>
+
+namespace
+{
+    /*
+     * Some work per element, so that the loop is not memory bound
+     */
+    double shade(std::size_t i)
+    {
+        double x = static_cast<double>(i);
+        return std::sqrt(x) * std::sin(x) + std::log(x + 1);
+    }
+
+    void report(const char* name, long threads, const cr::Clock& clock, double serial)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " " << threads << " threads : " << static_cast<int>(seconds * 1000) << " ms";
+        if (serial > 0)
+            std::cout << ", speed-up " << serial / seconds;
+        std::cout << std::endl;
+    }
+}
+
+/*
+ * Each algorithm on a large array : serial version first, then
+ * the parallel one from 1 worker to all the cores. The workers
+ * are started before the clock, as with cr::getDefaultScheduler()
+ */
+int main(int argc, char** argv)
+{
+    const std::size_t count = argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : 10000000;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    std::vector<double> values(count);
+    std::vector<int> keys(count);
+    std::srand(1);
+    for (std::size_t i = 0; i < count; ++i)
+        keys[i] = std::rand();
+
+    double serialFor, serialReduce, serialScan, serialSort;
+    double check = 0;
+    {
+        cr::Clock clock;
+        for (std::size_t i = 0; i < count; ++i)
+            values[i] = shade(i);
+        serialFor = clock.getElapsedTime().asSeconds();
+        report("serial for      ", 1, clock, 0);
+    }
+    {
+        cr::Clock clock;
+        check = std::accumulate(values.begin(), values.end(), 0.0);
+        serialReduce = clock.getElapsedTime().asSeconds();
+        report("serial reduce   ", 1, clock, 0);
+    }
+    {
+        std::vector<double> prefixes(count);
+        cr::Clock clock;
+        std::partial_sum(values.begin(), values.end(), prefixes.begin());
+        serialScan = clock.getElapsedTime().asSeconds();
+        report("serial scan     ", 1, clock, 0);
+    }
+    {
+        std::vector<int> sorted = keys;
+        cr::Clock clock;
+        std::sort(sorted.begin(), sorted.end());
+        serialSort = clock.getElapsedTime().asSeconds();
+        report("serial sort     ", 1, clock, 0);
+    }
+
+    for (long threads = 1; threads <= cores; threads *= 2)
+    {
+        cr::TaskScheduler scheduler(threads);
+
+        {
+            cr::Clock clock;
+            cr::parallelFor(scheduler, std::size_t(0), count, [&](std::size_t i) { values[i] = shade(i); });
+            report("parallelFor     ", threads, clock, serialFor);
+        }
+        {
+            cr::Clock clock;
+            double sum = cr::parallelReduce(scheduler, values.begin(), values.end(), 0.0, std::plus<double>());
+            report("parallelReduce  ", threads, clock, serialReduce);
+            if (std::fabs(sum - check) > 1e-6 * std::fabs(check))
+                std::cerr << "Failed to reduce : " << sum << " instead of " << check << std::endl;
+        }
+        {
+            std::vector<double> prefixes(count);
+            cr::Clock clock;
+            cr::parallelScan(scheduler, values.begin(), values.end(), prefixes.begin(), 0.0, std::plus<double>());
+            report("parallelScan    ", threads, clock, serialScan);
+        }
+        {
+            std::vector<int> sorted = keys;
+            cr::Clock clock;
+            cr::parallelSort(scheduler, sorted.begin(), sorted.end());
+            report("parallelSort    ", threads, clock, serialSort);
+            if (!std::is_sorted(sorted.begin(), sorted.end()))
+                std::cerr << "Failed to sort" << std::endl;
+        }
+
+        if (threads * 2 > cores && threads != cores)
+            threads = cores / 2;
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <ThreadPool.hpp>
+#include <Thread.hpp>
+#include <Clock.hpp>
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    std::atomic<long long> total(0);
+
+    void work(int value)
+    {
+        total += value;
+    }
+
+    void report(const char* name, const cr::Clock& clock, std::size_t count)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " : " << static_cast<int>(seconds * 1000) << " ms, "
+                  << static_cast<int>(count / seconds) << " tasks/s, "
+                  << seconds * 1e6 / count << " us/task" << std::endl;
+    }
+}
+
+/*
+ * Small tasks : a cr::Thread launched and joined per task, against
+ * a cr::ThreadPool. Throughput with many tasks in flight, latency
+ * of a single task waited for at once
+ */
+int main()
+{
+    const std::size_t count = 20000;
+
+    {
+        cr::Clock clock;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            cr::Thread thread(&work, static_cast<int>(i));
+            thread.launch();
+        }
+        report("Thread per task, latency      ", clock, count);
+    }
+
+    {
+        cr::Clock clock;
+        const std::size_t batch = 8;
+        for (std::size_t i = 0; i < count; i += batch)
+        {
+            std::vector<cr::Thread*> threads;
+            for (std::size_t j = 0; j < batch; ++j)
+            {
+                threads.push_back(new cr::Thread(&work, static_cast<int>(i + j)));
+                threads.back()->launch();
+            }
+            for (std::size_t j = 0; j < batch; ++j)
+                delete threads[j];
+        }
+        report("Thread per task, throughput   ", clock, count);
+    }
+
+    cr::ThreadPool pool;
+
+    {
+        cr::Clock clock;
+        for (std::size_t i = 0; i < count; ++i)
+            pool.submit([i]() { work(static_cast<int>(i)); }).get();
+        report("ThreadPool, latency           ", clock, count);
+    }
+
+    {
+        cr::Clock clock;
+        std::vector<std::future<void> > results;
+        for (std::size_t i = 0; i < count; ++i)
+            results.push_back(pool.submit([i]() { work(static_cast<int>(i)); }));
+        for (std::size_t i = 0; i < count; ++i)
+            results[i].get();
+        report("ThreadPool submit, throughput ", clock, count);
+    }
+
+    {
+        cr::Clock clock;
+        for (std::size_t i = 0; i < count * 10; ++i)
+            pool.execute([i]() { work(static_cast<int>(i)); });
+        pool.shutdown();
+        report("ThreadPool execute, throughput", clock, count * 10);
+    }
+
+    std::cout << "(" << total.load() << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include <TextReader.hpp>
+#include <String.hpp>
+#include <Clock.hpp>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    void report(const char* name, const cr::Clock& clock, std::size_t bytes, std::size_t result)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " : " << static_cast<int>(seconds * 1000) << " ms, "
+                  << static_cast<int>(bytes / seconds / 1e6) << " MB/s (" << result << ")" << std::endl;
+    }
+}
+
+/*
+ * Reading a large UTF-8 file line by line : std::getline and
+ * String::fromUtf8 per line, against cr::TextReader
+ */
+int main(int argc, char** argv)
+{
+    const char* filename = argc > 1 ? argv[1] : "/tmp/cr_reader_bench.txt";
+    const std::size_t size = 256 << 20;
+    std::size_t bytes = size;
+
+    if (argc <= 1)
+    {
+        std::ofstream file(filename, std::ios::binary);
+        std::string line("The quick brown fox jumps over the lazy dog, caf\xC3\xA9 \xEA\xB0\x80\xEB\x82\x98.\n");
+        for (bytes = 0; bytes < size; bytes += line.size())
+            file << line;
+    }
+
+    {
+        cr::Clock clock;
+        std::ifstream file(filename, std::ios::binary);
+        std::string line;
+        std::size_t chars = 0;
+        while (std::getline(file, line))
+            chars += cr::String::fromUtf8(line.begin(), line.end()).getSize();
+        report("std::getline + fromUtf8 ", clock, bytes, chars);
+    }
+
+    {
+        cr::Clock clock;
+        cr::TextReader reader(filename);
+        cr::StringView line;
+        std::size_t chars = 0;
+        while (reader.readLine(line))
+            chars += line.getSize();
+        report("TextReader::readLine    ", clock, bytes, chars);
+    }
+
+    if (argc <= 1)
+        std::remove(filename);
+
+    return 0;
+}
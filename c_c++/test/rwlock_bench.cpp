@@ -0,0 +1,151 @@
+#include <ReadWriteLock.hpp>
+#include <SeqLock.hpp>
+#include <Mutex.hpp>
+#include <Thread.hpp>
+#include <Clock.hpp>
+#include <atomic>
+#include <iostream>
+#include <vector>
+#include <pthread.h>
+
+namespace
+{
+    const int ReadsPerThread = 2000000;
+
+    struct Config
+    {
+        cr::Int64 values[4];
+    };
+
+    struct PthreadRwLock
+    {
+        PthreadRwLock() { pthread_rwlock_init(&rwlock, NULL); }
+        ~PthreadRwLock() { pthread_rwlock_destroy(&rwlock); }
+        void lockShared() { pthread_rwlock_rdlock(&rwlock); }
+        void unlockShared() { pthread_rwlock_unlock(&rwlock); }
+        void lock() { pthread_rwlock_wrlock(&rwlock); }
+        void unlock() { pthread_rwlock_unlock(&rwlock); }
+        pthread_rwlock_t rwlock;
+    };
+
+    struct MutexLock
+    {
+        void lockShared() { mutex.lock(); }
+        void unlockShared() { mutex.unlock(); }
+        void lock() { mutex.lock(); }
+        void unlock() { mutex.unlock(); }
+        cr::Mutex mutex;
+    };
+
+    /*
+     * Readers summing the configuration, a writer changing it every millisecond
+     */
+    template <typename L>
+    double readLocked(L& lock, int readerCount)
+    {
+        Config config = { { 1, 2, 3, 4 } };
+        std::atomic<bool> isDone(false);
+        std::atomic<cr::Int64> total(0);
+
+        cr::Thread writer([&](cr::StopToken token)
+        {
+            while (token.sleep(cr::milliseconds(1)))
+            {
+                lock.lock();
+                ++config.values[0];
+                --config.values[3];
+                lock.unlock();
+            }
+        });
+        writer.launch();
+
+        cr::Clock clock;
+        std::vector<cr::Thread*> readers;
+        for (int i = 0; i < readerCount; ++i)
+        {
+            readers.push_back(new cr::Thread([&]()
+            {
+                cr::Int64 sum = 0;
+                for (int j = 0; j < ReadsPerThread; ++j)
+                {
+                    lock.lockShared();
+                    sum += config.values[0] + config.values[1] + config.values[2] + config.values[3];
+                    lock.unlockShared();
+                }
+                total += sum;
+            }));
+            readers.back()->launch();
+        }
+        for (int i = 0; i < readerCount; ++i)
+            delete readers[i];
+
+        double seconds = clock.getElapsedTime().asSeconds();
+        writer.terminate();
+
+        return total.load() == 10LL * ReadsPerThread * readerCount ? readerCount * ReadsPerThread / seconds / 1e6 : -1;
+    }
+
+    double readSequenced(int readerCount)
+    {
+        Config initial = { { 1, 2, 3, 4 } };
+        cr::SeqLock<Config> config(initial);
+        std::atomic<cr::Int64> total(0);
+
+        cr::Thread writer([&](cr::StopToken token)
+        {
+            while (token.sleep(cr::milliseconds(1)))
+                config.update([](Config& value) { ++value.values[0]; --value.values[3]; });
+        });
+        writer.launch();
+
+        cr::Clock clock;
+        std::vector<cr::Thread*> readers;
+        for (int i = 0; i < readerCount; ++i)
+        {
+            readers.push_back(new cr::Thread([&]()
+            {
+                cr::Int64 sum = 0;
+                for (int j = 0; j < ReadsPerThread; ++j)
+                {
+                    Config value = config.load();
+                    sum += value.values[0] + value.values[1] + value.values[2] + value.values[3];
+                }
+                total += sum;
+            }));
+            readers.back()->launch();
+        }
+        for (int i = 0; i < readerCount; ++i)
+            delete readers[i];
+
+        double seconds = clock.getElapsedTime().asSeconds();
+        writer.terminate();
+
+        return total.load() == 10LL * ReadsPerThread * readerCount ? readerCount * ReadsPerThread / seconds / 1e6 : -1;
+    }
+}
+
+/*
+ * Read throughput, in millions of reads per second, as the
+ * number of reader threads grows (-1 : inconsistent reads)
+ */
+int main()
+{
+    std::cout << "readers   cr::ReadWriteLock   pthread_rwlock   cr::Mutex   cr::SeqLock" << std::endl;
+
+    for (int readers = 1; readers <= 8; readers *= 2)
+    {
+        cr::ReadWriteLock rwLock;
+        PthreadRwLock pthreadLock;
+        MutexLock mutex;
+
+        double scalable = readLocked(rwLock, readers);
+        double pthread = readLocked(pthreadLock, readers);
+        double exclusive = readLocked(mutex, readers);
+        double sequenced = readSequenced(readers);
+
+        std::cout << "      " << readers << "   "
+                  << scalable << "   " << pthread << "   " << exclusive << "   " << sequenced << " M/s" << std::endl;
+    }
+
+    return 0;
+}
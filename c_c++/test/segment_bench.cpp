@@ -0,0 +1,92 @@
+#include <TextSegmentation.hpp>
+#include <String.hpp>
+#include <Clock.hpp>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    void report(const char* name, std::size_t characters, std::size_t segments, double seconds)
+    {
+        std::cout << name << " : " << static_cast<int>(characters / seconds / 1e6) << " Mchars/s"
+                  << " (" << segments << " segments)" << std::endl;
+    }
+
+    template <typename Iterator>
+    std::size_t segment(Iterator it)
+    {
+        std::size_t count = 0;
+        while (it.next())
+            ++count;
+        return count;
+    }
+
+    void run(const char* name, const cr::String& text, int rounds)
+    {
+        std::basic_string<cr::Uint8> bytes = text.toUtf8();
+        std::string utf8(bytes.begin(), bytes.end());
+        std::string label(name);
+        std::size_t count = 0;
+
+        {
+            cr::Clock clock;
+            for (int i = 0; i < rounds; ++i)
+                count = segment(cr::GraphemeIterator(text));
+            report((label + " graphemes UTF-32").c_str(), text.getSize() * rounds, count, clock.getElapsedTime().asSeconds());
+        }
+        {
+            cr::Clock clock;
+            for (int i = 0; i < rounds; ++i)
+                count = segment(cr::GraphemeIterator(utf8.data(), utf8.size()));
+            report((label + " graphemes UTF-8 ").c_str(), text.getSize() * rounds, count, clock.getElapsedTime().asSeconds());
+        }
+        {
+            cr::Clock clock;
+            for (int i = 0; i < rounds; ++i)
+                count = segment(cr::WordIterator(text));
+            report((label + " words UTF-32    ").c_str(), text.getSize() * rounds, count, clock.getElapsedTime().asSeconds());
+        }
+        {
+            cr::Clock clock;
+            for (int i = 0; i < rounds; ++i)
+                count = segment(cr::WordIterator(utf8.data(), utf8.size()));
+            report((label + " words UTF-8     ").c_str(), text.getSize() * rounds, count, clock.getElapsedTime().asSeconds());
+        }
+    }
+}
+
+/*
+ * Throughput of the grapheme and word iterators on English,
+ * accented and Korean text, in UTF-32 and UTF-8
+ */
+int main()
+{
+    const int size = 1 << 20;
+    const int rounds = 10;
+
+    const char* words[] = { "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog's", "3.14" };
+    cr::String english, accented, korean;
+
+    for (int i = 0; english.getSize() < static_cast<std::size_t>(size); ++i)
+    {
+        english += cr::String(words[i % 9]);
+        english += cr::String(i % 11 ? ' ' : '\n');
+    }
+
+    for (int i = 0; i < size; ++i)
+    {
+        accented += cr::String(cr::Uint32('a' + i % 26));
+        if (i % 3 == 0)
+            accented += cr::String(cr::Uint32(0x0300 + i % 16));
+        if (i % 7 == 6)
+            accented += cr::String(' ');
+
+        korean += cr::String(cr::Uint32(i % 5 == 4 ? ' ' : 0xAC00 + (i * 7) % 11172));
+    }
+
+    run("english ", english, rounds);
+    run("accented", accented, rounds);
+    run("korean  ", korean, rounds);
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <BinaryWriter.hpp>
+#include <BinaryReader.hpp>
+#include <String.hpp>
+#include <Clock.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    void report(const char* name, const cr::Clock& clock, std::size_t bytes, long long result)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " : " << static_cast<int>(seconds * 1000) << " ms, "
+                  << bytes << " bytes (" << result << ")" << std::endl;
+    }
+}
+
+/*
+ * Round trip of records (a String and a Time) : through text
+ * (UTF-8 line, decimal microseconds) against cr::BinaryWriter
+ * and cr::BinaryReader, decoding the strings or only viewing them
+ */
+int main()
+{
+    const std::size_t count = 1000000;
+
+    std::vector<cr::String> names;
+    std::vector<cr::Time> times;
+    const cr::Uint32 hangul[] = { 0xAC00, 0xB098, 0xB2E4, 0 };
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::ostringstream name;
+        name << "record-" << i << "-payload";
+        cr::String str(name.str());
+        if (i % 4 == 0)
+            str += cr::String(hangul);
+        names.push_back(str);
+        times.push_back(cr::microseconds(static_cast<cr::Int64>(i) * 37 - 5000000));
+    }
+
+    {
+        cr::Clock clock;
+        std::string text;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::basic_string<cr::Uint8> utf8 = names[i].toUtf8();
+            text.append(utf8.begin(), utf8.end());
+            text += '\n';
+            std::ostringstream number;
+            number << times[i].asMicroseconds() << '\n';
+            text += number.str();
+        }
+
+        std::istringstream input(text);
+        std::string line;
+        long long checksum = 0;
+        while (std::getline(input, line))
+        {
+            cr::String name = cr::String::fromUtf8(line.begin(), line.end());
+            std::getline(input, line);
+            cr::Time time = cr::microseconds(std::strtoll(line.c_str(), NULL, 10));
+            checksum += name.getSize() + time.asMicroseconds();
+        }
+        report("text round trip        ", clock, text.size(), checksum);
+    }
+
+    {
+        cr::Clock clock;
+        cr::BinaryWriter writer;
+        for (std::size_t i = 0; i < count; ++i)
+            writer.writeString(names[i]).writeTime(times[i]);
+
+        cr::BinaryReader reader(writer.getData(), writer.getSize());
+        cr::String name;
+        cr::Time time;
+        long long checksum = 0;
+        while (reader.readString(name) && reader.readTime(time))
+            checksum += name.getSize() + time.asMicroseconds();
+        report("binary, String         ", clock, writer.getSize(), checksum);
+    }
+
+    {
+        cr::Clock clock;
+        cr::BinaryWriter writer;
+        for (std::size_t i = 0; i < count; ++i)
+            writer.writeString(names[i]).writeTime(times[i]);
+
+        cr::BinaryReader reader(writer.getData(), writer.getSize());
+        cr::Utf8View name;
+        cr::Time time;
+        long long checksum = 0;
+        while (reader.readUtf8(name) && reader.readTime(time))
+            checksum += name.getSize() + time.asMicroseconds();
+        report("binary, Utf8View       ", clock, writer.getSize(), checksum);
+    }
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include <StringSort.hpp>
+#include <String.hpp>
+#include <Clock.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/*
+ * Compare cr::sortStrings against std::sort on strings
+ * sharing long prefixes (URL-like keys)
+ */
+int main()
+{
+    const std::size_t count = 1000000;
+
+    std::vector<cr::String> input;
+    input.reserve(count);
+    std::srand(21);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        cr::String s("https://www.example.com/api/v1/resources/");
+        for (int j = 0; j < 8; ++j)
+            s += cr::String(cr::Uint32('a' + std::rand() % 26));
+
+        input.push_back(s);
+    }
+
+    {
+        std::vector<cr::String> strings = input;
+        cr::Clock clock;
+        std::sort(strings.begin(), strings.end());
+        std::cout << "std::sort (String)          : " << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+    }
+    {
+        std::vector<cr::String> strings = input;
+        cr::Clock clock;
+        cr::sortStrings(strings);
+        std::cout << "cr::sortStrings (String)    : " << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+    }
+    {
+        std::vector<cr::String> strings = input;
+        cr::Clock clock;
+        cr::sortStrings(strings, 0);
+        std::cout << "cr::sortStrings (parallel)  : " << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+    }
+    {
+        std::vector<cr::StringView> views(input.begin(), input.end());
+        cr::Clock clock;
+        std::sort(views.begin(), views.end());
+        std::cout << "std::sort (StringView)      : " << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+    }
+    {
+        std::vector<cr::StringView> views(input.begin(), input.end());
+        cr::Clock clock;
+        cr::sortStrings(views);
+        std::cout << "cr::sortStrings (StringView): " << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+    }
+
+    return 0;
+}
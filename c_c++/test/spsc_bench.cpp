@@ -0,0 +1,202 @@
+#include <SpscQueue.hpp>
+#include <SpscRecordQueue.hpp>
+#include <MpmcQueue.hpp>
+#include <CpuTopology.hpp>
+#include <Thread.hpp>
+#include <ThreadAttributes.hpp>
+#include <Clock.hpp>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    const cr::Uint64 Messages = 20000000;
+    const std::size_t Capacity = 4096;
+    const std::size_t Batch = 64;
+
+    unsigned int producerCpu;
+    unsigned int consumerCpu;
+
+    /*
+     * Run the consumer on its CPU and the producer on another one
+     */
+    template <typename P, typename C>
+    double measure(P producer, C consumer)
+    {
+        cr::Thread consuming(consumer);
+        cr::Thread producing(producer);
+
+        cr::Clock clock;
+        consuming.launch(cr::ThreadAttributes().pinTo(consumerCpu));
+        producing.launch(cr::ThreadAttributes().pinTo(producerCpu));
+        producing.wait();
+        consuming.wait();
+
+        return Messages / clock.getElapsedTime().asSeconds() / 1e6;
+    }
+
+    double runMpmc()
+    {
+        cr::MpmcQueue<cr::Uint64> queue(Capacity);
+        cr::Uint64 sum = 0;
+
+        double rate = measure([&]()
+        {
+            for (cr::Uint64 i = 0; i < Messages; ++i)
+            {
+                while (!queue.tryPush(i))
+                    std::this_thread::yield();
+            }
+        },
+        [&]()
+        {
+            cr::Uint64 value;
+            for (cr::Uint64 i = 0; i < Messages; ++i)
+            {
+                while (!queue.tryPop(value))
+                    std::this_thread::yield();
+                sum += value;
+            }
+        });
+
+        return sum == Messages * (Messages - 1) / 2 ? rate : -1;
+    }
+
+    double runSingle()
+    {
+        cr::SpscQueue<cr::Uint64> queue(Capacity);
+        cr::Uint64 sum = 0;
+
+        double rate = measure([&]()
+        {
+            for (cr::Uint64 i = 0; i < Messages; ++i)
+            {
+                while (!queue.tryPush(i))
+                    std::this_thread::yield();
+            }
+        },
+        [&]()
+        {
+            cr::Uint64 value;
+            for (cr::Uint64 i = 0; i < Messages; ++i)
+            {
+                while (!queue.tryPop(value))
+                    std::this_thread::yield();
+                sum += value;
+            }
+        });
+
+        return sum == Messages * (Messages - 1) / 2 ? rate : -1;
+    }
+
+    double runBatch()
+    {
+        cr::SpscQueue<cr::Uint64> queue(Capacity);
+        cr::Uint64 sum = 0;
+
+        double rate = measure([&]()
+        {
+            cr::Uint64 values[Batch];
+            for (cr::Uint64 i = 0; i < Messages; )
+            {
+                std::size_t count = 0;
+                while (count < Batch && i + count < Messages)
+                {
+                    values[count] = i + count;
+                    ++count;
+                }
+
+                std::size_t pushed = queue.tryPushBatch(values, count);
+                if (pushed == 0)
+                    std::this_thread::yield();
+                i += pushed;
+            }
+        },
+        [&]()
+        {
+            cr::Uint64 values[Batch];
+            for (cr::Uint64 i = 0; i < Messages; )
+            {
+                std::size_t count = queue.tryPopBatch(values, Batch);
+                if (count == 0)
+                    std::this_thread::yield();
+                for (std::size_t j = 0; j < count; ++j)
+                    sum += values[j];
+                i += count;
+            }
+        });
+
+        return sum == Messages * (Messages - 1) / 2 ? rate : -1;
+    }
+
+    /*
+     * Records of 8 to 64 bytes, published and released by batches
+     */
+    double runRecords()
+    {
+        cr::SpscRecordQueue queue(Capacity * 16);
+        cr::Uint64 sum = 0;
+
+        double rate = measure([&]()
+        {
+            for (cr::Uint64 i = 0; i < Messages; )
+            {
+                void* record = queue.allocate(8 + (i & 7) * 8);
+                if (!record)
+                {
+                    queue.publish();
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                std::memcpy(record, &i, sizeof(i));
+                if (++i % Batch == 0)
+                    queue.publish();
+            }
+            queue.publish();
+        },
+        [&]()
+        {
+            for (cr::Uint64 i = 0; i < Messages; )
+            {
+                std::size_t size;
+                const void* record = queue.read(size);
+                if (!record)
+                {
+                    queue.release();
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                cr::Uint64 value;
+                std::memcpy(&value, record, sizeof(value));
+                sum += value;
+                if (++i % Batch == 0)
+                    queue.release();
+            }
+        });
+
+        return sum == Messages * (Messages - 1) / 2 ? rate : -1;
+    }
+}
+
+/*
+ * Messages per second, in millions, between two pinned
+ * threads (-1 : messages lost)
+ */
+int main()
+{
+    std::vector<cr::CpuInfo> cpus = cr::CpuTopology::getCpus();
+    producerCpu = cpus.front().id;
+    consumerCpu = cpus[1 % cpus.size()].id;
+
+    std::cout << "producer on CPU " << producerCpu << ", consumer on CPU " << consumerCpu << std::endl;
+    std::cout << "cr::MpmcQueue             " << runMpmc() << " M/s" << std::endl;
+    std::cout << "cr::SpscQueue             " << runSingle() << " M/s" << std::endl;
+    std::cout << "cr::SpscQueue (batch " << Batch << ")  " << runBatch() << " M/s" << std::endl;
+    std::cout << "cr::SpscRecordQueue       " << runRecords() << " M/s" << std::endl;
+
+    return 0;
+}
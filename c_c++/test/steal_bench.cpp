@@ -0,0 +1,96 @@
+#include <TaskScheduler.hpp>
+#include <ThreadPool.hpp>
+#include <Clock.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <unistd.h>
+
+namespace
+{
+    const int Cutoff = 12;
+
+    long serialFibonacci(int n)
+    {
+        return n < 2 ? n : serialFibonacci(n - 1) + serialFibonacci(n - 2);
+    }
+
+    long fibonacci(cr::TaskScheduler& scheduler, int n)
+    {
+        if (n < Cutoff)
+            return serialFibonacci(n);
+
+        long a = 0;
+        long b = 0;
+        cr::TaskGroup group(scheduler);
+        group.spawn([&]() { a = fibonacci(scheduler, n - 1); });
+        b = fibonacci(scheduler, n - 2);
+        group.sync();
+
+        return a + b;
+    }
+
+    void report(const char* name, std::size_t threads, const cr::Clock& clock, double serial, long result)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " " << threads << " threads : " << static_cast<int>(seconds * 1000) << " ms";
+        if (serial > 0)
+            std::cout << ", speed-up " << serial / seconds;
+        std::cout << " (" << result << ")" << std::endl;
+    }
+}
+
+/*
+ * Recursive Fibonacci with fine-grained tasks (serial below 12) :
+ * serial, then cr::TaskScheduler from 1 thread to all the cores.
+ * Also the same number of tiny tasks through the single queue
+ * of cr::ThreadPool
+ */
+int main(int argc, char** argv)
+{
+    const int n = argc > 1 ? std::atoi(argv[1]) : 38;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    double serial;
+    {
+        cr::Clock clock;
+        long result = serialFibonacci(n);
+        serial = clock.getElapsedTime().asSeconds();
+        report("serial          ", 1, clock, 0, result);
+    }
+
+    for (long threads = 1; threads <= cores; threads *= 2)
+    {
+        cr::TaskScheduler scheduler(threads);
+        cr::Clock clock;
+        long result = 0;
+        scheduler.run([&]() { result = fibonacci(scheduler, n); });
+        report("TaskScheduler   ", threads, clock, serial, result);
+
+        if (threads * 2 > cores && threads != cores)
+            threads = cores / 2;
+    }
+
+    /*
+     * Number of tasks spawned above : one per call with n >= Cutoff
+     */
+    long tasks = 0;
+    {
+        long counts[64] = { 0 };
+        for (int i = Cutoff; i <= n; ++i)
+            counts[i] = 1 + counts[i - 1] + counts[i - 2];
+        tasks = counts[n];
+    }
+
+    {
+        cr::ThreadPool pool(cores);
+        cr::Clock clock;
+        std::atomic<long> sum(0);
+        for (long i = 0; i < tasks; ++i)
+            pool.execute([&sum]() { sum += serialFibonacci(Cutoff - 1); });
+        pool.shutdown();
+        report("ThreadPool flat ", cores, clock, 0, tasks);
+    }
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include <String.hpp>
+#include <Clock.hpp>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/*
+ * Compare the String stream operators against the
+ * toAnsiString() route they replace
+ */
+int main()
+{
+    const int words = 200000;
+
+    cr::String word("benchmark_word_");
+    std::ostringstream text;
+    for (int i = 0; i < words; ++i)
+        text << "benchmark_word_" << i << ' ';
+
+    std::string input = text.str();
+    cr::String big(input);
+
+    /*
+     * Output : one big string
+     */
+    {
+        std::ostringstream os;
+        cr::Clock clock;
+        os << big;
+        std::cout << "write (operator <<)    : " << clock.getElapsedTime().asMicroseconds() << " us" << std::endl;
+    }
+    {
+        std::ostringstream os;
+        cr::Clock clock;
+        os << big.toAnsiString();
+        std::cout << "write (toAnsiString)   : " << clock.getElapsedTime().asMicroseconds() << " us" << std::endl;
+    }
+
+    /*
+     * Output : many small strings
+     */
+    {
+        std::ostringstream os;
+        cr::Clock clock;
+        for (int i = 0; i < words; ++i)
+            os << word;
+        std::cout << "write small (<<)       : " << clock.getElapsedTime().asMicroseconds() << " us" << std::endl;
+    }
+    {
+        std::ostringstream os;
+        cr::Clock clock;
+        for (int i = 0; i < words; ++i)
+            os << word.toAnsiString();
+        std::cout << "write small (toAnsi)   : " << clock.getElapsedTime().asMicroseconds() << " us" << std::endl;
+    }
+
+    /*
+     * Input : word by word
+     */
+    {
+        std::istringstream is(input);
+        cr::String s;
+        std::size_t total = 0;
+        cr::Clock clock;
+        while (is >> s)
+            total += s.getSize();
+        std::cout << "read (operator >>)     : " << clock.getElapsedTime().asMicroseconds() << " us"
+                  << " (" << total << " chars)" << std::endl;
+    }
+    {
+        std::istringstream is(input);
+        std::string tmp;
+        cr::String s;
+        std::size_t total = 0;
+        cr::Clock clock;
+        while (is >> tmp)
+        {
+            s = tmp;
+            total += s.getSize();
+        }
+        std::cout << "read (std::string)     : " << clock.getElapsedTime().asMicroseconds() << " us"
+                  << " (" << total << " chars)" << std::endl;
+    }
+
+    return 0;
+}
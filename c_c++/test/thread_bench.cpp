@@ -0,0 +1,107 @@
+#include <Thread.hpp>
+#include <Clock.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <pthread.h>
+
+namespace
+{
+    std::atomic<long> allocations(0);
+    std::atomic<long> total(0);
+
+    void work(int value)
+    {
+        total += value;
+    }
+
+    void* rawEntry(void* value)
+    {
+        total += static_cast<int>(reinterpret_cast<long>(value));
+        return NULL;
+    }
+
+    void report(const char* name, const cr::Clock& clock, std::size_t count, long allocated)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " : " << static_cast<int>(seconds * 1000) << " ms, "
+                  << seconds * 1e6 / count << " us/thread, "
+                  << static_cast<double>(allocated) / count << " allocations/thread" << std::endl;
+    }
+}
+
+/*
+ * Count the heap allocations
+ */
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    void* memory = std::malloc(size ? size : 1);
+    if (!memory)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+/*
+ * Launch latency : construct, launch and join a thread, compared
+ * to raw pthread_create/pthread_join ; then the construction alone
+ */
+int main()
+{
+    const std::size_t count = 20000;
+
+    {
+        long before = allocations.load();
+        cr::Clock clock;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            pthread_t thread;
+            pthread_create(&thread, NULL, &rawEntry, reinterpret_cast<void*>(static_cast<long>(i)));
+            pthread_join(thread, NULL);
+        }
+        report("pthread_create/join     ", clock, count, allocations.load() - before);
+    }
+
+    {
+        long before = allocations.load();
+        cr::Clock clock;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            cr::Thread thread(&work, static_cast<int>(i));
+            thread.launch();
+        }
+        report("cr::Thread (function)   ", clock, count, allocations.load() - before);
+    }
+
+    {
+        long before = allocations.load();
+        cr::Clock clock;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            int value = static_cast<int>(i);
+            cr::Thread thread([value]() { work(value); });
+            thread.launch();
+        }
+        report("cr::Thread (lambda)     ", clock, count, allocations.load() - before);
+    }
+
+    {
+        long before = allocations.load();
+        cr::Clock clock;
+        for (std::size_t i = 0; i < count * 100; ++i)
+        {
+            int value = static_cast<int>(i);
+            cr::Thread thread([value]() { work(value); });
+        }
+        report("cr::Thread construction ", clock, count * 100, allocations.load() - before);
+    }
+
+    std::cout << "(" << total.load() << ")" << std::endl;
+    return 0;
+}
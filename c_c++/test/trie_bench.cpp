@@ -0,0 +1,100 @@
+#include <PrefixTrie.hpp>
+#include <String.hpp>
+#include <Clock.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <vector>
+
+/*
+ * Compare cr::PrefixTrie against std::map<String, T> on
+ * route-like keys, for exact and longest-prefix lookups
+ */
+int main()
+{
+    const int count = 200000;
+
+    std::vector<cr::String> keys;
+    std::srand(21);
+
+    for (int i = 0; i < count; ++i)
+    {
+        cr::String k("/api/v1/");
+        for (int j = 0; j < 3; ++j)
+        {
+            for (int c = 0; c < 4; ++c)
+                k += cr::String(cr::Uint32('a' + std::rand() % 26));
+            k += cr::String('/');
+        }
+        keys.push_back(k);
+    }
+
+    cr::PrefixTrie<int> trie;
+    std::map<cr::String, int> map;
+
+    {
+        cr::Clock clock;
+        for (int i = 0; i < count; ++i)
+            trie.insert(keys[i], i);
+        std::cout << "insert (PrefixTrie)      : " << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+    }
+    {
+        cr::Clock clock;
+        for (int i = 0; i < count; ++i)
+            map[keys[i]] = i;
+        std::cout << "insert (std::map)        : " << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+    }
+
+    long sum = 0;
+    {
+        cr::Clock clock;
+        for (int i = 0; i < count; ++i)
+            sum += *trie.find(keys[i]);
+        std::cout << "find (PrefixTrie)        : " << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+    }
+    {
+        cr::Clock clock;
+        for (int i = 0; i < count; ++i)
+            sum += map.find(keys[i])->second;
+        std::cout << "find (std::map)          : " << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+    }
+
+    /*
+     * Longest prefix of "key + suffix" : the map has to try
+     * every candidate length
+     */
+    std::vector<cr::String> queries;
+    for (int i = 0; i < count; ++i)
+        queries.push_back(keys[i] + cr::String("resource/42"));
+
+    {
+        cr::Clock clock;
+        for (int i = 0; i < count; ++i)
+            sum += *trie.findLongestPrefix(queries[i]);
+        std::cout << "longest prefix (trie)    : " << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+    }
+    {
+        cr::Clock clock;
+        for (int i = 0; i < count; ++i)
+        {
+            for (std::size_t length = queries[i].getSize(); ; --length)
+            {
+                std::map<cr::String, int>::const_iterator it = map.find(queries[i].substring(0, length));
+                if (it != map.end())
+                {
+                    sum += it->second;
+                    break;
+                }
+            }
+        }
+        std::cout << "longest prefix (map)     : " << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+    }
+
+    cr::PrefixTrie<int>::Stats stats = trie.getStats();
+    std::cout << "trie memory              : " << stats.memoryUsage / 1024 << " KB ("
+              << stats.node4Count << " node4, " << stats.node16Count << " node16, "
+              << stats.node48Count << " node48, " << stats.node256Count << " node256)" << std::endl;
+    std::cout << "checksum                 : " << sum << std::endl;
+
+    return 0;
+}
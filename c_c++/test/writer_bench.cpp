@@ -0,0 +1,76 @@
+#include <TextWriter.hpp>
+#include <String.hpp>
+#include <Clock.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    void report(const char* name, const cr::Clock& clock, cr::Uint64 bytes)
+    {
+        double seconds = clock.getElapsedTime().asSeconds();
+        std::cout << name << " : " << static_cast<int>(seconds * 1000) << " ms, "
+                  << static_cast<int>(bytes / seconds / 1e6) << " MB/s (" << bytes << " bytes)" << std::endl;
+    }
+
+    void runWriter(const char* name, const char* filename, const std::vector<cr::String>& lines, std::size_t rounds,
+                   cr::TextEncoding encoding, cr::TextWriter::Mode mode)
+    {
+        cr::Clock clock;
+        cr::TextWriter writer(filename, encoding, mode);
+
+        for (std::size_t i = 0; i < rounds; ++i)
+            writer.writeLine(lines[i % lines.size()]);
+
+        writer.close();
+        report(name, clock, writer.getWrittenSize());
+    }
+}
+
+/*
+ * Writing 1 GB of text (or the size in MB given as argument) :
+ * toUtf8 and fwrite per line, against cr::TextWriter
+ */
+int main(int argc, char** argv)
+{
+    const char* filename = "/tmp/cr_writer_bench.txt";
+    const cr::Uint64 size = static_cast<cr::Uint64>(argc > 1 ? std::atoi(argv[1]) : 1024) << 20;
+
+    std::vector<cr::String> lines;
+    lines.push_back(cr::String("The quick brown fox jumps over the lazy dog"));
+    lines.push_back(cr::String("0123456789 abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+    const cr::Uint32 mixed[] = { 'c', 'a', 'f', 0xE9, ' ', 0xAC00, 0xB098, ' ', 0x1F600, 0 };
+    lines.push_back(cr::String(mixed));
+
+    std::size_t average = 0;
+    for (std::size_t i = 0; i < lines.size(); ++i)
+        average += lines[i].toUtf8().size() + 1;
+    std::size_t rounds = static_cast<std::size_t>(size / (average / lines.size()));
+
+    {
+        cr::Clock clock;
+        std::FILE* file = std::fopen(filename, "wb");
+        cr::Uint64 bytes = 0;
+
+        for (std::size_t i = 0; i < rounds; ++i)
+        {
+            std::basic_string<cr::Uint8> utf8 = lines[i % lines.size()].toUtf8();
+            utf8 += '\n';
+            bytes += std::fwrite(utf8.data(), 1, utf8.size(), file);
+        }
+
+        std::fclose(file);
+        report("toUtf8 + fwrite          ", clock, bytes);
+    }
+
+    runWriter("TextWriter UTF-8          ", filename, lines, rounds, cr::UTF8, cr::TextWriter::Buffered);
+    runWriter("TextWriter UTF-8 direct   ", filename, lines, rounds, cr::UTF8, cr::TextWriter::Direct);
+    runWriter("TextWriter UTF-16LE       ", filename, lines, rounds, cr::UTF16LE, cr::TextWriter::Buffered);
+
+    std::remove(filename);
+
+    return 0;
+}
@@ -0,0 +1,693 @@
+#!/usr/bin/env python3
+"""
+Generate the Unicode lookup tables of the library.
+
+Usage:
+    gen_unicode_tables.py [--ucd DIR]
+
+With --ucd, the tables are built from the files of the Unicode
+character database found in DIR (UnicodeData.txt, CaseFolding.txt,
+CompositionExclusions.txt, auxiliary/GraphemeBreakProperty.txt,
+auxiliary/WordBreakProperty.txt, emoji/emoji-data.txt, PropList.txt)
+and the collation table allkeys.txt of UTS #10 (DUCET).
+Without it, the unicodedata module of the running Python is used,
+and the Unicode version is the one of that module. Python doesn't
+expose the segmentation properties : they are then read from the
+Unicode::UCD module of perl, and the DUCET is the allkeys.txt
+shipped with perl's Unicode::Collate.
+
+All the tables come from a single version of the character
+database : the generation fails if the UCD files, or Python and
+perl, don't agree on it. The DUCET has its own version, recorded
+in the header of the collation table next to the UCD one ; the
+characters it doesn't know get implicit weights.
+
+The tables are written to ../src, next to this script.
+"""
+
+import os
+import re
+import subprocess
+import sys
+import unicodedata
+
+MAX_CODEPOINT = 0x110000
+SRC_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src')
+
+
+class Database(object):
+    """Character properties, from UCD files or from Python's unicodedata"""
+
+    def __init__(self, ucd_dir=None):
+        self.version = unicodedata.unidata_version
+        self.upper = {}
+        self.lower = {}
+        self.fold = {}
+        self.ccc = {}
+        self.decomposition = {}   # code point -> (is compatibility, [code points])
+        self.exclusions = set()   # script specific and post composition exclusions
+        self.segmentation_version = self.version
+        self.grapheme_break = {}  # code point -> Grapheme_Cluster_Break value
+        self.word_break = {}      # code point -> Word_Break value
+        self.pictographic = set() # Extended_Pictographic code points
+        self.ideographs = set()   # Unified_Ideograph code points
+        self.allkeys = None       # path of the DUCET
+
+        if ucd_dir:
+            self._load_ucd(ucd_dir)
+        else:
+            self._load_python()
+
+    def _load_ucd(self, ucd_dir):
+        # The versioned files start with "# <name>-<version>.txt"
+        versions = {}
+        for name in ('CaseFolding.txt', 'CompositionExclusions.txt', 'PropList.txt',
+                     'auxiliary/GraphemeBreakProperty.txt', 'auxiliary/WordBreakProperty.txt'):
+            with open(os.path.join(ucd_dir, name)) as f:
+                match = re.match(r'#\s*\S+-(\d+\.\d+\.\d+)\.txt', f.readline())
+            if not match:
+                raise ValueError('no version in the first line of %s' % name)
+            versions[name] = match.group(1)
+        if len(set(versions.values())) != 1:
+            raise ValueError('UCD files of several versions : %s' %
+                             ', '.join('%s %s' % item for item in sorted(versions.items())))
+        self.version = versions['CaseFolding.txt']
+        self.segmentation_version = self.version
+
+        with open(os.path.join(ucd_dir, 'UnicodeData.txt')) as f:
+            for line in f:
+                fields = line.strip().split(';')
+                cp = int(fields[0], 16)
+                if fields[12]:
+                    self.upper[cp] = int(fields[12], 16)
+                if fields[13]:
+                    self.lower[cp] = int(fields[13], 16)
+                if int(fields[3]):
+                    self.ccc[cp] = int(fields[3])
+                if fields[5]:
+                    self.decomposition[cp] = parse_decomposition(fields[5])
+
+        with open(os.path.join(ucd_dir, 'CompositionExclusions.txt')) as f:
+            for line in f:
+                line = line.split('#')[0].strip()
+                if line:
+                    self.exclusions.add(int(line, 16))
+
+        with open(os.path.join(ucd_dir, 'CaseFolding.txt')) as f:
+            for line in f:
+                line = line.split('#')[0].strip()
+                if not line:
+                    continue
+                code, status, mapping = [x.strip() for x in line.split(';')[:3]]
+                if status in ('C', 'S'):
+                    self.fold[int(code, 16)] = int(mapping, 16)
+
+        def load_property(name, table, values=None):
+            with open(os.path.join(ucd_dir, name)) as f:
+                for line in f:
+                    line = line.split('#')[0].strip()
+                    if not line:
+                        continue
+                    codes, value = [x.strip() for x in line.split(';')[:2]]
+                    if values is not None and value not in values:
+                        continue
+                    first, _, last = codes.partition('..')
+                    for cp in range(int(first, 16), int(last or first, 16) + 1):
+                        table(cp, value)
+
+        load_property('auxiliary/GraphemeBreakProperty.txt', self.grapheme_break.__setitem__)
+        load_property('auxiliary/WordBreakProperty.txt', self.word_break.__setitem__)
+        load_property('emoji/emoji-data.txt', lambda cp, value: self.pictographic.add(cp),
+                      ('Extended_Pictographic',))
+        load_property('PropList.txt', lambda cp, value: self.ideographs.add(cp),
+                      ('Unified_Ideograph',))
+        self.allkeys = os.path.join(ucd_dir, 'allkeys.txt')
+
+    def _load_python(self):
+        """
+        Python only exposes the full case mappings: a character whose
+        full mapping is a single character has that simple mapping,
+        other characters keep their simple lowercase mapping if any
+        (this matches the C and S entries of CaseFolding.txt, U+0130
+        aside : it only has a T entry, and folds to itself)
+        """
+        for cp in range(MAX_CODEPOINT):
+            c = chr(cp)
+
+            upper = c.upper()
+            if len(upper) == 1 and upper != c:
+                self.upper[cp] = ord(upper)
+
+            lower = c.lower()
+            if len(lower) == 1 and lower != c:
+                self.lower[cp] = ord(lower)
+            elif len(lower) > 1 and lower[0] != c:
+                # U+0130 : the simple mapping is the first character
+                self.lower[cp] = ord(lower[0])
+
+            fold = c.casefold()
+            if len(fold) == 1 and fold != c:
+                self.fold[cp] = ord(fold)
+            elif len(fold) > 1 and cp in self.lower and cp != 0x130:
+                self.fold[cp] = self.lower[cp]
+
+            if unicodedata.combining(c):
+                self.ccc[cp] = unicodedata.combining(c)
+
+            mapping = unicodedata.decomposition(c)
+            if mapping:
+                self.decomposition[cp] = parse_decomposition(mapping)
+
+        # Python doesn't expose CompositionExclusions.txt : a canonical
+        # pair which doesn't recompose under NFC is an exclusion
+        for cp, (compat, mapping) in self.decomposition.items():
+            if not compat and len(mapping) == 2 and \
+               unicodedata.normalize('NFC', chr(cp)) != chr(cp):
+                self.exclusions.add(cp)
+
+        self._load_perl()
+
+    def _load_perl(self):
+        """
+        Segmentation properties from perl's Unicode::UCD ; perl tailors
+        a few values, they are mapped back to the UAX #29 ones
+        """
+        script = ('use Unicode::UCD qw(prop_invmap prop_invlist);'
+                  'print Unicode::UCD::UnicodeVersion(), "\\n";'
+                  'for my $p ("GCB", "WB") {'
+                  '  my ($l, $m) = prop_invmap($p);'
+                  '  print "$p $l->[$_] $m->[$_]\\n" for 0 .. $#$l;'
+                  '}'
+                  'my @e = prop_invlist("Extended_Pictographic");'
+                  'print "ExtPict @e\\n";'
+                  'my @u = prop_invlist("Unified_Ideograph");'
+                  'print "Ideograph @u\\n";'
+                  'for (@INC) {'
+                  '  print "Allkeys $_/Unicode/Collate/allkeys.txt\\n"'
+                  '    if -e "$_/Unicode/Collate/allkeys.txt";'
+                  '}')
+        lines = subprocess.check_output(['perl', '-e', script]).decode().splitlines()
+        self.segmentation_version = lines[0]
+
+        ranges = {'GCB': [], 'WB': []}
+        for line in lines[1:]:
+            fields = line.split()
+            if fields[0] in ('ExtPict', 'Ideograph'):
+                table = self.pictographic if fields[0] == 'ExtPict' else self.ideographs
+                bounds = [int(x) for x in fields[1:]] + [MAX_CODEPOINT]
+                for i in range(0, len(bounds) - 1, 2):
+                    table.update(range(bounds[i], bounds[i + 1]))
+            elif fields[0] == 'Allkeys':
+                self.allkeys = self.allkeys or fields[1]
+            else:
+                ranges[fields[0]].append((int(fields[1]), fields[2]))
+
+        tailored = {'ExtPict_XX': 'Other', 'ExtPict_LE': 'ALetter',
+                    'Perl_Tailored_HSpace': 'Other'}
+        for name, table in (('GCB', self.grapheme_break), ('WB', self.word_break)):
+            bounds = ranges[name] + [(MAX_CODEPOINT, None)]
+            for (start, value), (end, _) in zip(bounds, bounds[1:]):
+                value = tailored.get(value, value)
+                if value != 'Other':
+                    for cp in range(start, end):
+                        table[cp] = value
+
+        # WSegSpace : spaces which are not no-break spaces
+        for cp in range(MAX_CODEPOINT):
+            if unicodedata.category(chr(cp)) == 'Zs' and cp not in (0x00A0, 0x2007, 0x202F):
+                self.word_break[cp] = 'WSegSpace'
+
+
+def parse_decomposition(field):
+    parts = field.split()
+    compat = parts[0].startswith('<')
+    if compat:
+        parts = parts[1:]
+    return compat, [int(x, 16) for x in parts]
+
+
+HANGUL_BASE = 0xAC00
+HANGUL_COUNT = 11172
+
+
+def is_hangul(cp):
+    return HANGUL_BASE <= cp < HANGUL_BASE + HANGUL_COUNT
+
+
+def split_blocks(values, shift):
+    """Two-level split : (stage1, blocks) with identical blocks shared"""
+    size = 1 << shift
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for start in range(0, len(values), size):
+        block = tuple(values[start:start + size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return stage1, stage2
+
+
+def format_array(values, per_line=16, width=0):
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        lines.append('        ' + ', '.join(str(v).rjust(width) for v in chunk))
+    return ',\n'.join(lines)
+
+
+def header(db, ducet=None):
+    if ducet:
+        source = 'the DUCET %s and the Unicode %s' % (ducet, db.version)
+    else:
+        source = 'the Unicode %s' % db.version
+    return ('/*\n'
+            ' * Generated by tools/gen_unicode_tables.py from %s\n'
+            ' * character database -- do not edit\n'
+            ' */\n' % source)
+
+
+def generate_case(db):
+    """Simple case mappings : lower, upper and fold deltas"""
+    limit = max(list(db.upper) + list(db.lower) + list(db.fold)) + 1
+    shift = 7
+    limit = (limit + (1 << shift) - 1) >> shift << shift
+
+    records = {(0, 0, 0): 0}
+    values = []
+    for cp in range(limit):
+        record = (db.lower.get(cp, cp) - cp,
+                  db.upper.get(cp, cp) - cp,
+                  db.fold.get(cp, cp) - cp)
+        values.append(records.setdefault(record, len(records)))
+
+    stage1, stage2 = split_blocks(values, shift)
+    assert len(records) <= 256 and max(stage1) < 256
+
+    ordered = sorted(records, key=records.get)
+
+    out = [header(db),
+           '#include <UnicodeTables.hpp>\n',
+           'namespace cr\n{\n',
+           'namespace priv\n{',
+           '    const Uint32 CaseTableLimit = 0x%X;\n' % limit,
+           '    const CaseRecord CaseRecords[%d] =\n    {' % len(ordered),
+           ',\n'.join('        { %d, %d, %d }' % r for r in ordered),
+           '    };\n',
+           '    const Uint8 CaseStage1[%d] =\n    {' % len(stage1),
+           format_array(stage1, 16, 3),
+           '    };\n',
+           '    const Uint8 CaseStage2[%d] =\n    {' % len(stage2),
+           format_array(stage2, 16, 3),
+           '    };\n',
+           '} // namespace priv\n',
+           '} // namespace cr']
+
+    write('CaseTables.cpp', '\n'.join(out) + '\n')
+
+
+def full_decomposition(db, cp, compat):
+    """Recursive decomposition of a code point, canonically ordered"""
+    entry = db.decomposition.get(cp)
+    if not entry or (entry[0] and not compat):
+        return [cp]
+    result = []
+    for part in entry[1]:
+        result.extend(full_decomposition(db, part, compat))
+    # canonical ordering (stable sort of the non-starters runs)
+    i = 0
+    while i < len(result):
+        if db.ccc.get(result[i], 0):
+            j = i
+            while j < len(result) and db.ccc.get(result[j], 0):
+                j += 1
+            result[i:j] = sorted(result[i:j], key=lambda x: db.ccc.get(x, 0))
+            i = j
+        else:
+            i += 1
+    return result
+
+
+def generate_normalization(db):
+    """Canonical combining classes, quick check flags, decompositions and compositions"""
+    canonical = {}
+    compat = {}
+    for cp in db.decomposition:
+        d = full_decomposition(db, cp, False)
+        if d != [cp]:
+            canonical[cp] = d
+        k = full_decomposition(db, cp, True)
+        if k != [cp] and k != d:
+            compat[cp] = k
+
+    # full composition exclusions : listed exclusions, singletons
+    # and decompositions starting with a non-starter
+    excluded = set(db.exclusions)
+    for cp, (is_compat, mapping) in db.decomposition.items():
+        if is_compat:
+            continue
+        if len(mapping) == 1 or db.ccc.get(cp, 0) or db.ccc.get(mapping[0], 0):
+            excluded.add(cp)
+
+    compositions = {}
+    for cp, (is_compat, mapping) in db.decomposition.items():
+        if not is_compat and len(mapping) == 2 and cp not in excluded:
+            compositions[(mapping[0], mapping[1])] = cp
+
+    # characters which may combine with a previous one (NFC_QC=Maybe),
+    # the Hangul vowels and trailing consonants included
+    maybe = set(second for (first, second) in compositions)
+    maybe.update(range(0x1161, 0x1176))
+    maybe.update(range(0x11A8, 0x11C3))
+
+    NFD_NO, NFKD_NO, NFC_NO, NFC_MAYBE, NFKC_NO, NFKC_MAYBE = 1, 2, 4, 8, 16, 32
+
+    limit = max(list(db.ccc) + list(db.decomposition) + list(maybe)) + 1
+    shift = 6
+    limit = (limit + (1 << shift) - 1) >> shift << shift
+
+    records = {(0, 0): 0}
+    values = []
+    for cp in range(limit):
+        flags = 0
+        if cp in canonical or is_hangul(cp):
+            flags |= NFD_NO
+        if cp in canonical or cp in compat or is_hangul(cp):
+            flags |= NFKD_NO
+        if cp in excluded:
+            flags |= NFC_NO
+        elif cp in maybe:
+            flags |= NFC_MAYBE
+        if cp in excluded or cp in compat or (cp in db.decomposition and db.decomposition[cp][0]):
+            flags |= NFKC_NO
+        elif cp in maybe:
+            flags |= NFKC_MAYBE
+        record = (db.ccc.get(cp, 0), flags)
+        values.append(records.setdefault(record, len(records)))
+
+    stage1, stage2 = split_blocks(values, shift)
+    assert len(records) <= 256 and max(stage1) < 256
+    ordered = sorted(records, key=records.get)
+
+    pool = []
+    def index(table):
+        codepoints = sorted(table)
+        entries = []
+        for cp in codepoints:
+            mapping = table[cp]
+            assert len(mapping) < 32
+            entries.append((len(pool) << 5) | len(mapping))
+            pool.extend(mapping)
+        return codepoints, entries
+
+    canonical_codepoints, canonical_index = index(canonical)
+    compat_codepoints, compat_index = index(compat)
+
+    pairs = sorted(compositions.items())
+
+    out = [header(db),
+           '#include <UnicodeTables.hpp>\n',
+           'namespace cr\n{\n',
+           'namespace priv\n{',
+           '    const Uint32 NormTableLimit = 0x%X;\n' % limit,
+           '    const NormRecord NormRecords[%d] =\n    {' % len(ordered),
+           ',\n'.join('        { %d, %d }' % r for r in ordered),
+           '    };\n',
+           '    const Uint8 NormStage1[%d] =\n    {' % len(stage1),
+           format_array(stage1, 16, 3),
+           '    };\n',
+           '    const Uint8 NormStage2[%d] =\n    {' % len(stage2),
+           format_array(stage2, 16, 3),
+           '    };\n',
+           '    const Uint32 DecompositionPool[%d] =\n    {' % len(pool),
+           format_array(['0x%04X' % x for x in pool], 10),
+           '    };\n',
+           '    const Uint32 CanonicalCount = %d;\n' % len(canonical_codepoints),
+           '    const Uint32 CanonicalCodepoints[%d] =\n    {' % len(canonical_codepoints),
+           format_array(['0x%04X' % x for x in canonical_codepoints], 10),
+           '    };\n',
+           '    const Uint32 CanonicalIndex[%d] =\n    {' % len(canonical_index),
+           format_array(canonical_index, 10),
+           '    };\n',
+           '    const Uint32 CompatCount = %d;\n' % len(compat_codepoints),
+           '    const Uint32 CompatCodepoints[%d] =\n    {' % len(compat_codepoints),
+           format_array(['0x%04X' % x for x in compat_codepoints], 10),
+           '    };\n',
+           '    const Uint32 CompatIndex[%d] =\n    {' % len(compat_index),
+           format_array(compat_index, 10),
+           '    };\n',
+           '    const Uint32 CompositionCount = %d;\n' % len(pairs),
+           '    const Uint64 CompositionKeys[%d] =\n    {' % len(pairs),
+           format_array(['0x%012XULL' % ((a << 32) | b) for (a, b), c in pairs], 4),
+           '    };\n',
+           '    const Uint32 CompositionValues[%d] =\n    {' % len(pairs),
+           format_array(['0x%04X' % c for (a, b), c in pairs], 10),
+           '    };\n',
+           '} // namespace priv\n',
+           '} // namespace cr']
+
+    write('NormalizationTables.cpp', '\n'.join(out) + '\n')
+
+
+GRAPHEME_CLASSES = ['Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator',
+                    'Prepend', 'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT']
+
+WORD_CLASSES = ['Other', 'CR', 'LF', 'Newline', 'Extend', 'ZWJ', 'Regional_Indicator',
+                'Format', 'Katakana', 'Hebrew_Letter', 'ALetter', 'Single_Quote',
+                'Double_Quote', 'MidNumLet', 'MidLetter', 'MidNum', 'Numeric',
+                'ExtendNumLet', 'WSegSpace']
+
+
+def grapheme_no_break(left, right):
+    """Rules GB3 to GB9b of UAX #29 (the contextual ones are done in C++)"""
+    if left == 'CR' and right == 'LF':
+        return True                                                     # GB3
+    if left in ('Control', 'CR', 'LF') or right in ('Control', 'CR', 'LF'):
+        return False                                                    # GB4, GB5
+    if left == 'L' and right in ('L', 'V', 'LV', 'LVT'):
+        return True                                                     # GB6
+    if left in ('LV', 'V') and right in ('V', 'T'):
+        return True                                                     # GB7
+    if left in ('LVT', 'T') and right == 'T':
+        return True                                                     # GB8
+    if right in ('Extend', 'ZWJ', 'SpacingMark'):
+        return True                                                     # GB9, GB9a
+    return left == 'Prepend'                                            # GB9b
+
+
+def generate_segmentation(db):
+    """Grapheme and word break properties, and the grapheme pair table"""
+    SEG_PICTOGRAPHIC, SEG_ALPHANUMERIC = 1, 2
+
+    limit = max(list(db.grapheme_break) + list(db.word_break) + list(db.pictographic)) + 1
+    shift = 7
+    limit = (limit + (1 << shift) - 1) >> shift << shift
+
+    records = {(0, 0, 0): 0}
+    values = []
+    for cp in range(limit):
+        flags = 0
+        if cp in db.pictographic:
+            flags |= SEG_PICTOGRAPHIC
+        if unicodedata.category(chr(cp))[0] in 'LN':
+            flags |= SEG_ALPHANUMERIC
+        record = (GRAPHEME_CLASSES.index(db.grapheme_break.get(cp, 'Other')),
+                  WORD_CLASSES.index(db.word_break.get(cp, 'Other')),
+                  flags)
+        values.append(records.setdefault(record, len(records)))
+
+    # past the limit (the variation selectors), everything is Other
+    assert all(unicodedata.category(chr(cp))[0] not in 'LN'
+               for cp in range(limit, MAX_CODEPOINT))
+
+    stage1, stage2 = split_blocks(values, shift)
+    assert len(records) <= 256 and max(stage1) < 256
+    ordered = sorted(records, key=records.get)
+
+    pairs = []
+    for left in GRAPHEME_CLASSES:
+        mask = 0
+        for bit, right in enumerate(GRAPHEME_CLASSES):
+            if grapheme_no_break(left, right):
+                mask |= 1 << bit
+        pairs.append('0x%04X' % mask)
+
+    out = [header(db),
+           '#include <UnicodeTables.hpp>\n',
+           'namespace cr\n{\n',
+           'namespace priv\n{',
+           '    const Uint32 SegmentTableLimit = 0x%X;\n' % limit,
+           '    const SegmentRecord SegmentRecords[%d] =\n    {' % len(ordered),
+           ',\n'.join('        { %d, %d, %d }' % r for r in ordered),
+           '    };\n',
+           '    const Uint8 SegmentStage1[%d] =\n    {' % len(stage1),
+           format_array(stage1, 16, 3),
+           '    };\n',
+           '    const Uint8 SegmentStage2[%d] =\n    {' % len(stage2),
+           format_array(stage2, 16, 3),
+           '    };\n',
+           '    const Uint16 GraphemeNoBreak[%d] =\n    {' % len(pairs),
+           format_array(pairs, 7),
+           '    };\n',
+           '} // namespace priv\n',
+           '} // namespace cr']
+
+    write('SegmentationTables.cpp', '\n'.join(out) + '\n')
+
+
+def load_allkeys(path):
+    """DUCET : version, implicit weight ranges and collation elements"""
+    version = None
+    implicit = []
+    table = {}
+    element = re.compile(r'\[([.*])([0-9A-F]{4})\.([0-9A-F]{4})\.([0-9A-F]{4})\]')
+    with open(path) as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if line.startswith('@version'):
+                version = line.split()[1]
+            elif line.startswith('@implicitweights'):
+                codes, base = line.split()[1:3]
+                first, last = codes.rstrip(';').split('..')
+                implicit.append((int(first, 16), int(last, 16), int(base, 16)))
+            elif line:
+                codes, elements = line.split(';')
+                key = tuple(int(x, 16) for x in codes.split())
+                table[key] = [(int(p, 16), int(s, 16), int(t, 16), v == '*')
+                              for v, p, s, t in element.findall(elements)]
+    return version, implicit, table
+
+
+def generate_collation(db):
+    """Collation elements of the DUCET, contractions and implicit weight ranges"""
+    version, implicit, table = load_allkeys(db.allkeys)
+    if version != db.version:
+        print('warning: DUCET %s with the Unicode %s character database' % (version, db.version))
+
+    # element : primary (16 bits), secondary (9 bits), tertiary (5 bits), variable (1 bit)
+    def pack(element):
+        primary, secondary, tertiary, variable = element
+        assert secondary < 512 and tertiary < 32
+        return (primary << 16) | (secondary << 7) | (tertiary << 2) | int(variable)
+
+    pool = []
+    sequences = {}
+    def mapping(elements, contraction=False):
+        packed = tuple(pack(e) for e in elements)
+        if packed not in sequences:
+            sequences[packed] = len(pool)
+            pool.extend(packed)
+        assert len(packed) < 32
+        return (sequences[packed] << 8) | (len(packed) << 1) | int(contraction)
+
+    starters = set(key[0] for key in table if len(key) > 1)
+    singles = dict((key[0], elements) for key, elements in table.items() if len(key) == 1)
+
+    limit = max(singles) + 1
+    shift = 7
+    limit = (limit + (1 << shift) - 1) >> shift << shift
+
+    # mapping 0 : no element, use the implicit weights
+    mappings = {0: 0}
+    values = []
+    for cp in range(limit):
+        value = 0
+        if cp in singles:
+            value = mapping(singles[cp], cp in starters)
+        elif cp in starters:
+            value = 1
+        values.append(mappings.setdefault(value, len(mappings)))
+
+    stage1, stage2 = split_blocks(values, shift)
+    assert len(mappings) < 65536 and max(stage1) < 65536
+    ordered = sorted(mappings, key=mappings.get)
+
+    contractions = sorted((key + (0,) * (3 - len(key)), mapping(elements))
+                          for key, elements in table.items() if len(key) > 1)
+
+    # siniform scripts : the second weight counts from the first
+    # range of the script (Tangut Supplement follows Tangut)
+    origins = {}
+    for first, last, base in sorted(implicit):
+        origins.setdefault(base, first)
+    ranges = [(first, last, base, origins[base]) for first, last, base in implicit]
+
+    # Unified_Ideograph : the core ones (CJK Unified Ideographs and CJK
+    # Compatibility Ideographs blocks) are before the others
+    ideographs = sorted(db.ideographs)
+    start = None
+    for i, cp in enumerate(ideographs):
+        if start is None:
+            start = cp
+        if i + 1 == len(ideographs) or ideographs[i + 1] != cp + 1:
+            core = 0x4E00 <= start <= 0x9FFF or 0xF900 <= start <= 0xFAFF
+            ranges.append((start, cp, 0xFB40 if core else 0xFB80, 0))
+            start = None
+    ranges.sort()
+
+    out = [header(db, version),
+           '#include <UnicodeTables.hpp>\n',
+           'namespace cr\n{\n',
+           'namespace priv\n{',
+           '    const Uint32 CollationTableLimit = 0x%X;\n' % limit,
+           '    const Uint32 CollationElements[%d] =\n    {' % len(pool),
+           format_array(['0x%08X' % x for x in pool], 8),
+           '    };\n',
+           '    const Uint32 CollationMappings[%d] =\n    {' % len(ordered),
+           format_array(['0x%08X' % x for x in ordered], 8),
+           '    };\n',
+           '    const Uint16 CollationStage1[%d] =\n    {' % len(stage1),
+           format_array(stage1, 12, 5),
+           '    };\n',
+           '    const Uint16 CollationStage2[%d] =\n    {' % len(stage2),
+           format_array(stage2, 12, 5),
+           '    };\n',
+           '    const Uint32 ContractionCount = %d;\n' % len(contractions),
+           '    const ContractionRecord Contractions[%d] =\n    {' % len(contractions),
+           ',\n'.join('        { { 0x%04X, 0x%04X, 0x%04X }, 0x%08X }' % (k + (m,)) for k, m in contractions),
+           '    };\n',
+           '    const Uint32 ImplicitRangeCount = %d;\n' % len(ranges),
+           '    const ImplicitRange ImplicitRanges[%d] =\n    {' % len(ranges),
+           ',\n'.join('        { 0x%04X, 0x%04X, 0x%04X, 0x%04X }' % r for r in ranges),
+           '    };\n',
+           '} // namespace priv\n',
+           '} // namespace cr']
+
+    write('CollationTables.cpp', '\n'.join(out) + '\n')
+
+
+def write(name, content):
+    path = os.path.normpath(os.path.join(SRC_DIR, name))
+    with open(path, 'w') as f:
+        f.write(content)
+    print('wrote %s' % path)
+
+
+def main(argv):
+    ucd_dir = None
+    if len(argv) == 3 and argv[1] == '--ucd':
+        ucd_dir = argv[2]
+    elif len(argv) != 1:
+        print(__doc__)
+        return 1
+
+    try:
+        db = Database(ucd_dir)
+    except (IOError, ValueError) as error:
+        sys.stderr.write('Failed to load the character database (%s)\n' % error)
+        return 1
+
+    if db.segmentation_version != db.version:
+        sys.stderr.write('Failed to load the character database (Unicode %s in Python, %s in perl) : '
+                         'use --ucd\n' % (db.version, db.segmentation_version))
+        return 1
+    generate_case(db)
+    generate_normalization(db)
+    generate_segmentation(db)
+    generate_collation(db)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
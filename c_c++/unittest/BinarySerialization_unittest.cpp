@@ -0,0 +1,166 @@
+#include <BinaryWriter.hpp>
+#include <BinaryReader.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+
+namespace
+{
+    std::string getBytes(const cr::BinaryWriter& writer)
+    {
+        return writer.getSize() > 0 ? std::string(writer.getData(), writer.getSize()) : std::string();
+    }
+}
+
+/**
+ * Varint encoding of unsigned integers
+ */
+TEST(BinarySerializationTest, varint)
+{
+    cr::BinaryWriter writer;
+    EXPECT_EQ(0u, writer.getSize());
+
+    writer.writeUint(0).writeUint(127).writeUint(128).writeUint(300);
+    EXPECT_EQ(std::string("\x00\x7F\x80\x01\xAC\x02", 6), getBytes(writer));
+
+    writer.clear();
+    writer.writeUint(~cr::Uint64(0));
+    EXPECT_EQ(10u, writer.getSize());
+
+    cr::BinaryReader reader(writer.getData(), writer.getSize());
+    cr::Uint64 value = 0;
+    EXPECT_TRUE(reader.readUint(value));
+    EXPECT_EQ(~cr::Uint64(0), value);
+    EXPECT_TRUE(reader.endOfData());
+
+    const cr::Uint64 values[] = { 0, 1, 127, 128, 16383, 16384, 1ull << 35, (1ull << 63) + 5 };
+    writer.clear();
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+        writer.writeUint(values[i]);
+
+    cr::BinaryReader all(writer.getData(), writer.getSize());
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+    {
+        EXPECT_TRUE(all.readUint(value));
+        EXPECT_EQ(values[i], value);
+    }
+    EXPECT_TRUE(all.endOfData());
+    EXPECT_TRUE(all.isValid());
+}
+
+/**
+ * Zig-zag encoding of signed integers and times
+ */
+TEST(BinarySerializationTest, signedAndTime)
+{
+    cr::BinaryWriter writer;
+    writer.writeInt(0).writeInt(-1).writeInt(1).writeInt(-64).writeInt(63).writeInt(64);
+    EXPECT_EQ(std::string("\x00\x01\x02\x7F\x7E\x80\x01", 7), getBytes(writer));
+
+    const cr::Int64 values[] = { -9223372036854775807ll - 1, -1000000, 9223372036854775807ll };
+    for (std::size_t i = 0; i < 3; ++i)
+        writer.writeInt(values[i]);
+    writer.writeTime(cr::microseconds(-1500)).writeTime(cr::seconds(2.5f));
+
+    cr::BinaryReader reader(writer.getData(), writer.getSize());
+    cr::Int64 value;
+    for (int i = 0; i < 6; ++i)
+        EXPECT_TRUE(reader.readInt(value));
+    EXPECT_EQ(64, value);
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(reader.readInt(value));
+        EXPECT_EQ(values[i], value);
+    }
+
+    cr::Time time;
+    EXPECT_TRUE(reader.readTime(time));
+    EXPECT_EQ(-1500, time.asMicroseconds());
+    EXPECT_TRUE(reader.readTime(time));
+    EXPECT_EQ(2500000, time.asMicroseconds());
+    EXPECT_TRUE(reader.endOfData());
+}
+
+/**
+ * Strings : UTF-8 payload, read back with or without copy
+ */
+TEST(BinarySerializationTest, strings)
+{
+    const cr::Uint32 chars[] = { 'c', 'a', 'f', 0xE9, ' ', 0xAC00, ' ', 0x1F600, 0 };
+    const cr::Uint32 invalid[] = { 'a', 0xD800, 0x110000, 0 };
+    cr::String text(chars);
+
+    cr::BinaryWriter writer;
+    writer.writeString(cr::String("ascii")).writeString(text).writeString(cr::String());
+    writer.writeString(cr::String(invalid)).writeUtf8(cr::Utf8View("raw"));
+
+    std::string bytes = getBytes(writer);
+    EXPECT_EQ(std::string("\x05" "ascii" "\x0E" "caf\xC3\xA9 \xEA\xB0\x80 \xF0\x9F\x98\x80" "\x00", 22), bytes.substr(0, 22));
+
+    cr::BinaryReader reader(writer.getData(), writer.getSize());
+
+    cr::Utf8View view;
+    EXPECT_TRUE(reader.readUtf8(view));
+    EXPECT_EQ(writer.getData() + 1, view.getData());
+    EXPECT_EQ(5u, view.getSize());
+
+    cr::String str;
+    EXPECT_TRUE(reader.readString(str));
+    EXPECT_TRUE(str == text);
+    EXPECT_TRUE(reader.readString(str));
+    EXPECT_TRUE(str.isEmpty());
+
+    const cr::Uint32 replaced[] = { 'a', 0xFFFD, 0xFFFD, 0 };
+    EXPECT_TRUE(reader.readString(str));
+    EXPECT_TRUE(str == cr::String(replaced));
+
+    EXPECT_TRUE(reader.readUtf8(view));
+    EXPECT_EQ(std::string("raw"), std::string(view.getData(), view.getSize()));
+    EXPECT_TRUE(reader.endOfData());
+    EXPECT_TRUE(reader.isValid());
+}
+
+/**
+ * Truncated or malformed input makes the reader invalid
+ */
+TEST(BinarySerializationTest, invalidInput)
+{
+    cr::Uint64 value;
+
+    cr::BinaryReader empty(NULL, 0);
+    EXPECT_FALSE(empty.readUint(value));
+    EXPECT_FALSE(empty.isValid());
+
+    cr::BinaryReader truncated("\x80\x80", 2);
+    EXPECT_FALSE(truncated.readUint(value));
+
+    cr::BinaryReader overflow("\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x02", 10);
+    EXPECT_FALSE(overflow.readUint(value));
+
+    /*
+     * The length exceeds the input ; the next reads fail too
+     */
+    cr::BinaryReader shortString("\x05" "abc" "\x01", 5);
+    cr::Utf8View view;
+    EXPECT_FALSE(shortString.readUtf8(view));
+    EXPECT_FALSE(shortString.isValid());
+    EXPECT_FALSE(shortString.readUint(value));
+    EXPECT_EQ(1u, shortString.getPosition());
+
+    /*
+     * Malformed UTF-8 payloads : one U+FFFD per bad sequence, the
+     * following characters are kept, a truncated tail is replaced
+     */
+    cr::BinaryReader malformed("\x04" "a\xE9" "bc" "\x02" "a\xE9", 8);
+    cr::String str;
+    const cr::Uint32 middle[] = { 'a', 0xFFFD, 'b', 'c', 0 };
+    const cr::Uint32 tail[] = { 'a', 0xFFFD, 0 };
+
+    EXPECT_TRUE(malformed.readString(str));
+    EXPECT_TRUE(str == cr::String(middle));
+    EXPECT_TRUE(malformed.readString(str));
+    EXPECT_TRUE(str == cr::String(tail));
+    EXPECT_TRUE(malformed.endOfData());
+}
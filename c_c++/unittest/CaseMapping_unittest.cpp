@@ -0,0 +1,95 @@
+#include <CaseMapping.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+#include <map>
+
+
+/**
+ * single character mappings
+ */
+TEST(CaseMappingTest, character)
+{
+    EXPECT_EQ( 'a', cr::toLower('A') );
+    EXPECT_EQ( 'a', cr::toLower('a') );
+    EXPECT_EQ( '@', cr::toLower('@') );
+    EXPECT_EQ( 'Z', cr::toUpper('z') );
+    EXPECT_EQ( '[', cr::toUpper('[') );
+
+    /* Latin-1, Greek, Cyrillic, Deseret */
+    EXPECT_EQ( 0x00E9,  cr::toLower(0x00C9) );
+    EXPECT_EQ( 0x00C9,  cr::toUpper(0x00E9) );
+    EXPECT_EQ( 0x03C3,  cr::toLower(0x03A3) );
+    EXPECT_EQ( 0x0416,  cr::toUpper(0x0436) );
+    EXPECT_EQ( 0x10428, cr::toLower(0x10400) );
+
+    /* micro sign : uppercase is capital mu, folds to small mu */
+    EXPECT_EQ( 0x039C, cr::toUpper(0x00B5) );
+    EXPECT_EQ( 0x03BC, cr::caseFold(0x00B5) );
+
+    /* final sigma folds to small sigma */
+    EXPECT_EQ( 0x03C3, cr::caseFold(0x03C2) );
+    EXPECT_EQ( 0x03C2, cr::toLower(0x03C2) );
+
+    /* capital I with dot : lowercases to i, only folds in Turkic (T) */
+    EXPECT_EQ( 0x0069, cr::toLower(0x0130) );
+    EXPECT_EQ( 0x0130, cr::caseFold(0x0130) );
+
+    /* no mapping */
+    EXPECT_EQ( 0xAC00,   cr::toLower(0xAC00) );
+    EXPECT_EQ( 0x10FFFF, cr::toUpper(0x10FFFF) );
+    EXPECT_EQ( 0xFFFFFFFF, cr::caseFold(0xFFFFFFFF) );
+}
+
+/**
+ * string conversions, ASCII and mixed
+ */
+TEST(CaseMappingTest, string)
+{
+    cr::String s("Hello World, THIS is a Test 0123456789 !@#[]{}");
+
+    EXPECT_STREQ( "hello world, this is a test 0123456789 !@#[]{}", cr::toLower(s).toAnsiString().c_str() );
+    EXPECT_STREQ( "HELLO WORLD, THIS IS A TEST 0123456789 !@#[]{}", cr::toUpper(s).toAnsiString().c_str() );
+    EXPECT_TRUE( cr::caseFold(s) == cr::toLower(s) );
+
+    cr::String m("abcD");
+    m += cr::String(cr::Uint32(0x00C9));
+    m += cr::String("fGhI");
+
+    cr::String lower = cr::toLower(m);
+    ASSERT_EQ( m.getSize(), lower.getSize() );
+    EXPECT_EQ( 'd',    lower[3] );
+    EXPECT_EQ( 0x00E9, lower[4] );
+    EXPECT_EQ( 'g',    lower[6] );
+    EXPECT_EQ( 'i',    lower[8] );
+
+    EXPECT_TRUE( cr::toLower(cr::String()).isEmpty() );
+}
+
+/**
+ * case-insensitive comparison and hash
+ */
+TEST(CaseMappingTest, caseInsensitive)
+{
+    cr::String a("Content-Type");
+    cr::String b("content-type");
+    cr::String c("Content-Length");
+
+    EXPECT_EQ( 0, cr::caseInsensitiveCompare(a, b) );
+    EXPECT_LT( 0, cr::caseInsensitiveCompare(a, c) );
+    EXPECT_GT( 0, cr::caseInsensitiveCompare(c, a) );
+    EXPECT_GT( 0, cr::caseInsensitiveCompare(cr::String("content"), a) );
+    EXPECT_EQ( cr::caseInsensitiveHash(a), cr::caseInsensitiveHash(b) );
+    EXPECT_NE( cr::caseInsensitiveHash(a), cr::caseInsensitiveHash(c) );
+
+    cr::String sigma1(cr::Uint32(0x03A3));
+    cr::String sigma2(cr::Uint32(0x03C2));
+    EXPECT_EQ( 0, cr::caseInsensitiveCompare(sigma1, sigma2) );
+    EXPECT_EQ( cr::caseInsensitiveHash(sigma1), cr::caseInsensitiveHash(sigma2) );
+
+    std::map<cr::String, int, cr::CaseInsensitiveLess> headers;
+    headers[a] = 1;
+    headers[b] = 2;
+
+    EXPECT_EQ( 1, headers.size() );
+    EXPECT_EQ( 2, headers[cr::String("CONTENT-TYPE")] );
+}
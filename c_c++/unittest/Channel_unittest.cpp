@@ -0,0 +1,305 @@
+#include <Channel.hpp>
+#include <Clock.hpp>
+#include <Thread.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+
+namespace
+{
+    const int Producers = 3;
+    const int Consumers = 3;
+    const int ItemsPerProducer = 5000;
+
+    /*
+     * Producers sending 1..ItemsPerProducer, consumers adding what
+     * they receive until the channel is closed
+     */
+    long exchange(cr::Channel<int>& channel)
+    {
+        std::atomic<long> total(0);
+
+        std::vector<cr::Thread*> consumers;
+        for (int i = 0; i < Consumers; ++i)
+        {
+            consumers.push_back(new cr::Thread([&]()
+            {
+                long sum = 0;
+                int value;
+                while (channel.receive(value))
+                    sum += value;
+                total += sum;
+            }));
+            consumers.back()->launch();
+        }
+
+        std::vector<cr::Thread*> producers;
+        for (int i = 0; i < Producers; ++i)
+        {
+            producers.push_back(new cr::Thread([&]()
+            {
+                for (int j = 1; j <= ItemsPerProducer; ++j)
+                    channel.send(j);
+            }));
+            producers.back()->launch();
+        }
+
+        for (int i = 0; i < Producers; ++i)
+            delete producers[i];
+        channel.close();
+        for (int i = 0; i < Consumers; ++i)
+            delete consumers[i];
+
+        return total.load();
+    }
+
+    const long ExpectedTotal = static_cast<long>(ItemsPerProducer) * (ItemsPerProducer + 1) / 2 * Producers;
+}
+
+/**
+ * A bounded channel holds its capacity, then the values are received in order
+ */
+TEST(ChannelTest, bounded)
+{
+    cr::Channel<std::string> channel(4);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        std::string value = std::to_string(i);
+        EXPECT_TRUE(channel.trySend(value));
+    }
+
+    std::string extra = "extra";
+    EXPECT_FALSE(channel.trySend(extra));
+    EXPECT_EQ("extra", extra);
+
+    cr::Clock clock;
+    EXPECT_FALSE(channel.sendFor(extra, cr::milliseconds(20)));
+    EXPECT_GE(clock.getElapsedTime(), cr::milliseconds(15));
+
+    std::string value;
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(channel.receive(value));
+        EXPECT_EQ(std::to_string(i), value);
+    }
+    EXPECT_FALSE(channel.tryReceive(value));
+    EXPECT_FALSE(channel.receiveFor(value, cr::milliseconds(10)));
+}
+
+/**
+ * After close, sends fail and the values left are still received
+ */
+TEST(ChannelTest, close)
+{
+    cr::Channel<int> channel(8);
+    EXPECT_TRUE(channel.send(1));
+    EXPECT_TRUE(channel.send(2));
+
+    EXPECT_TRUE(channel.close());
+    EXPECT_FALSE(channel.close());
+    EXPECT_TRUE(channel.isClosed());
+    EXPECT_FALSE(channel.send(3));
+
+    int value = 0;
+    EXPECT_TRUE(channel.receive(value));
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(channel.receive(value));
+    EXPECT_EQ(2, value);
+    EXPECT_FALSE(channel.receive(value));
+    EXPECT_FALSE(channel.receiveFor(value, cr::seconds(10)));
+}
+
+/**
+ * Blocked threads are woken up by close
+ */
+TEST(ChannelTest, closeWakesUp)
+{
+    cr::Channel<int> channel(0);
+    std::atomic<int> results(0);
+
+    cr::Thread receiver([&]()
+    {
+        int value;
+        if (!channel.receive(value))
+            ++results;
+    });
+    cr::Thread sender([&]()
+    {
+        int value = 5;
+        if (!channel.sendFor(value, cr::seconds(10)) && channel.isClosed())
+            ++results;
+    });
+
+    receiver.launch();
+    usleep(20000);
+    channel.close();
+    sender.launch();
+    receiver.wait();
+    sender.wait();
+
+    EXPECT_EQ(2, results.load());
+}
+
+/**
+ * An unbounded channel never blocks the sender, and keeps the order
+ */
+TEST(ChannelTest, unbounded)
+{
+    cr::Channel<int> channel(cr::Channel<int>::Unbounded);
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        EXPECT_TRUE(channel.trySend(i));
+        if (i % 1000 == 999)
+        {
+            int value;
+            EXPECT_TRUE(channel.receive(value));
+            EXPECT_EQ(i / 1000, value);
+        }
+    }
+
+    int value;
+    for (int i = 5; i < 5000; ++i)
+    {
+        ASSERT_TRUE(channel.tryReceive(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(channel.tryReceive(value));
+}
+
+/**
+ * A rendezvous send completes only with a receiver
+ */
+TEST(ChannelTest, rendezvous)
+{
+    cr::Channel<int> channel(0);
+
+    int value = 7;
+    EXPECT_FALSE(channel.trySend(value));
+    EXPECT_FALSE(channel.sendFor(value, cr::milliseconds(10)));
+    EXPECT_FALSE(channel.tryReceive(value));
+
+    std::atomic<bool> isReceived(false);
+    cr::Thread receiver([&]()
+    {
+        int received;
+        if (channel.receive(received) && received == 7)
+            isReceived = true;
+    });
+    receiver.launch();
+
+    EXPECT_TRUE(channel.send(7));
+    receiver.wait();
+    EXPECT_TRUE(isReceived.load());
+}
+
+/**
+ * Every value sent is received once, whatever the kind of channel
+ */
+TEST(ChannelTest, producersConsumers)
+{
+    cr::Channel<int> bounded(8);
+    EXPECT_EQ(ExpectedTotal, exchange(bounded));
+
+    cr::Channel<int> unbounded(cr::Channel<int>::Unbounded);
+    EXPECT_EQ(ExpectedTotal, exchange(unbounded));
+
+    cr::Channel<int> rendezvous(0);
+    EXPECT_EQ(ExpectedTotal, exchange(rendezvous));
+}
+
+/**
+ * A select completes the possible operation, or times out
+ */
+TEST(SelectTest, operations)
+{
+    cr::Channel<int> numbers(4);
+    cr::Channel<std::string> words(0);
+
+    int number = 0;
+    std::string word;
+    cr::Select select;
+    EXPECT_EQ(0u, select.addReceive(numbers, number));
+    EXPECT_EQ(1u, select.addReceive(words, word));
+
+    EXPECT_EQ(cr::Select::None, select.tryWait());
+    EXPECT_EQ(cr::Select::None, select.waitFor(cr::milliseconds(10)));
+
+    numbers.send(42);
+    EXPECT_EQ(0u, select.wait());
+    EXPECT_EQ(42, number);
+    EXPECT_FALSE(select.isClosed());
+
+    cr::Thread sender([&]() { words.send("hello"); });
+    sender.launch();
+    EXPECT_EQ(1u, select.wait());
+    EXPECT_EQ("hello", word);
+    sender.wait();
+
+    words.close();
+    EXPECT_EQ(1u, select.wait());
+    EXPECT_TRUE(select.isClosed());
+
+    /*
+     * A send, completed by a rendezvous receiver
+     */
+    cr::Channel<int> requests(0);
+    int request = 9;
+    cr::Select sending;
+    sending.addSend(requests, request);
+    EXPECT_EQ(cr::Select::None, sending.tryWait());
+
+    cr::Thread receiver([&]() { int value; requests.receive(value); number = value; });
+    receiver.launch();
+    EXPECT_EQ(0u, sending.wait());
+    receiver.wait();
+    EXPECT_EQ(9, number);
+}
+
+/**
+ * A select receiving from several rendezvous and bounded channels gets all the values
+ */
+TEST(SelectTest, fanIn)
+{
+    cr::Channel<int> first(0);
+    cr::Channel<int> second(2);
+    cr::Channel<int> quit(0);
+
+    std::vector<cr::Thread*> producers;
+    for (int i = 0; i < Producers; ++i)
+    {
+        cr::Channel<int>& channel = i % 2 == 0 ? first : second;
+        producers.push_back(new cr::Thread([&channel]()
+        {
+            for (int j = 1; j <= ItemsPerProducer; ++j)
+                channel.send(j);
+        }));
+        producers.back()->launch();
+    }
+
+    long total = 0;
+    int value = 0;
+    int signal = 0;
+    cr::Thread collector([&]()
+    {
+        cr::Select select;
+        select.addReceive(first, value);
+        select.addReceive(second, value);
+        select.addReceive(quit, signal);
+
+        while (select.wait() != 2)
+            total += value;
+    });
+    collector.launch();
+
+    for (int i = 0; i < Producers; ++i)
+        delete producers[i];
+    quit.send(1);
+    collector.wait();
+
+    EXPECT_EQ(ExpectedTotal, total);
+}
@@ -0,0 +1,203 @@
+#include <Collator.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    cr::String utf8(const std::string& text)
+    {
+        return cr::String::fromUtf8(text.begin(), text.end());
+    }
+
+    int sign(int value)
+    {
+        return (value > 0) - (value < 0);
+    }
+}
+
+/**
+ * letters first, then accents, then case
+ */
+TEST(CollatorTest, tertiaryOrder)
+{
+    cr::Collator collator;
+
+    EXPECT_EQ( -1, sign(collator.compare(utf8("a"), utf8("A"))) );
+    EXPECT_EQ( -1, sign(collator.compare(utf8("A"), utf8("á"))) );
+    EXPECT_EQ( -1, sign(collator.compare(utf8("á"), utf8("b"))) );
+    EXPECT_EQ( 1, sign(collator.compare(utf8("b"), utf8("a"))) );
+    EXPECT_EQ( 0, collator.compare(utf8("abc"), utf8("abc")) );
+    EXPECT_EQ( 0, collator.compare(cr::String(), cr::String()) );
+    EXPECT_EQ( -1, sign(collator.compare(cr::String(), utf8("a"))) );
+
+    /* numbers are not compared by value */
+    EXPECT_EQ( -1, sign(collator.compare(utf8("11"), utf8("2"))) );
+}
+
+/**
+ * canonically equivalent strings have the same key
+ */
+TEST(CollatorTest, canonicalEquivalence)
+{
+    cr::Collator collator;
+
+    EXPECT_EQ( collator.getSortKey(utf8("café")), collator.getSortKey(utf8("cafe\xCC\x81")) );
+    EXPECT_EQ( collator.getSortKey(utf8("\xE1\xBA\xA1\xCC\x82")),     /* ạ + circumflex */
+               collator.getSortKey(utf8("a\xCC\x82\xCC\xA3")) );    /* marks out of order */
+}
+
+/**
+ * the strength limits the differences taken into account
+ */
+TEST(CollatorTest, strength)
+{
+    cr::Collator primary(cr::Collator::Primary);
+    cr::Collator secondary(cr::Collator::Secondary);
+
+    EXPECT_EQ( cr::Collator::Primary, primary.getStrength() );
+    EXPECT_EQ( 0, primary.compare(utf8("a"), utf8("A")) );
+    EXPECT_EQ( 0, primary.compare(utf8("a"), utf8("á")) );
+    EXPECT_EQ( 0, secondary.compare(utf8("a"), utf8("A")) );
+    EXPECT_NE( 0, secondary.compare(utf8("a"), utf8("á")) );
+    EXPECT_NE( 0, primary.compare(utf8("a"), utf8("b")) );
+
+    /* weaker keys are shorter */
+    EXPECT_LT( primary.getSortKey(utf8("abc")).size(), secondary.getSortKey(utf8("abc")).size() );
+}
+
+/**
+ * spaces and punctuation are letters or shifted to the fourth level
+ */
+TEST(CollatorTest, alternate)
+{
+    cr::Collator nonIgnorable;
+    cr::Collator shifted(cr::Collator::Tertiary, cr::Collator::Shifted);
+    cr::Collator quaternary(cr::Collator::Quaternary, cr::Collator::Shifted);
+
+    EXPECT_EQ( cr::Collator::NonIgnorable, nonIgnorable.getAlternate() );
+    EXPECT_EQ( cr::Collator::Shifted, shifted.getAlternate() );
+
+    EXPECT_EQ( -1, sign(nonIgnorable.compare(utf8("de luge"), utf8("deluge"))) );
+    EXPECT_EQ( -1, sign(nonIgnorable.compare(utf8("co-op"), utf8("coop"))) );
+    EXPECT_EQ( 0, shifted.compare(utf8("de luge"), utf8("deluge")) );
+    EXPECT_EQ( 0, shifted.compare(utf8("co-op"), utf8("coop")) );
+    EXPECT_EQ( -1, sign(quaternary.compare(utf8("de luge"), utf8("deluge"))) );
+
+    /* the punctuation only decides between otherwise equal strings */
+    EXPECT_EQ( -1, sign(quaternary.compare(utf8("co-op"), utf8("coop"))) );
+    EXPECT_EQ( -1, sign(quaternary.compare(utf8("co-op"), utf8("Coop"))) );
+}
+
+/**
+ * sequences with their own weights, contiguous or not
+ */
+TEST(CollatorTest, contractions)
+{
+    cr::Collator collator;
+    cr::Collator primary(cr::Collator::Primary);
+
+    /* l· is a letter of its own (Catalan) */
+    EXPECT_EQ( -1, sign(collator.compare(utf8("l\xC2\xB7"), utf8("lz"))) );
+    EXPECT_EQ( 1, sign(collator.compare(utf8("l\xC2\xB7"), utf8("l"))) );
+
+    /* Й is И + breve, which still contracts across a dot below */
+    EXPECT_EQ( 0, primary.compare(utf8("\xD0\x99\xCC\xA3"), utf8("\xD0\x99")) );
+    EXPECT_NE( 0, primary.compare(utf8("\xD0\x99\xCC\xA3"), utf8("\xD0\x98\xCC\xA3")) );
+}
+
+/**
+ * ideographs are ordered by block, then by code point
+ */
+TEST(CollatorTest, implicitWeights)
+{
+    cr::Collator collator;
+
+    EXPECT_EQ( -1, sign(collator.compare(utf8("z"), utf8("\xE4\xB8\x80"))) );                /* U+4E00 */
+    EXPECT_EQ( -1, sign(collator.compare(utf8("\xE4\xB8\x80"), utf8("\xE4\xB8\x81"))) );    /* U+4E01 */
+    EXPECT_EQ( -1, sign(collator.compare(utf8("\xE4\xB8\x81"), utf8("\xE3\x90\x80"))) );    /* U+3400 */
+    EXPECT_EQ( -1, sign(collator.compare(utf8("\xE3\x90\x80"), utf8("\xF0\xA0\x80\x80"))) );/* U+20000 */
+
+    /* keys compare like the strings */
+    cr::SortKey first = collator.getSortKey(utf8("\xE4\xB8\x80"));
+    cr::SortKey second = collator.getSortKey(utf8("\xE4\xB8\x81"));
+    EXPECT_TRUE( first < second );
+}
+
+/**
+ * sort with and without cached keys
+ */
+TEST(CollatorTest, sort)
+{
+    const char* input[] = { "péché", "peach", "Péche", "11", "coop", "péche",
+                            "Péché", "co-op", "peche", "2", "Peach", "Coop" };
+    const char* expected[] = { "11", "2", "co-op", "coop", "Coop", "peach",
+                               "Peach", "peche", "péche", "Péche", "péché", "Péché" };
+
+    std::vector<cr::String> strings;
+    for (std::size_t i = 0; i < sizeof(input) / sizeof(input[0]); ++i)
+        strings.push_back(utf8(input[i]));
+
+    std::vector<cr::String> sorted;
+    for (std::size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i)
+        sorted.push_back(utf8(expected[i]));
+
+    cr::Collator collator;
+    std::vector<cr::String> copy = strings;
+    collator.sort(copy);
+    EXPECT_TRUE( copy == sorted );
+
+    cr::CollationKeyCache cache;
+    copy = strings;
+    collator.sort(copy, cache);
+    EXPECT_TRUE( copy == sorted );
+    EXPECT_EQ( strings.size(), cache.getSize() );
+
+    copy = strings;
+    collator.sort(copy, cache);
+    EXPECT_TRUE( copy == sorted );
+    EXPECT_EQ( strings.size(), cache.getSize() );
+
+    /* equal keys are ordered by code point */
+    cr::Collator shifted(cr::Collator::Tertiary, cr::Collator::Shifted);
+    std::vector<cr::String> equal;
+    equal.push_back(utf8("coop"));
+    equal.push_back(utf8("co-op"));
+    shifted.sort(equal);
+    EXPECT_TRUE( equal[0] == utf8("co-op") );
+}
+
+/**
+ * the cache is bounded and bound to the collator settings
+ */
+TEST(CollatorTest, keyCache)
+{
+    cr::Collator collator;
+    cr::CollationKeyCache cache(2);
+
+    EXPECT_TRUE( cache.findSortKey(collator, utf8("a")) == NULL );
+
+    const cr::SortKey& key = cache.getSortKey(collator, utf8("a"));
+    EXPECT_EQ( collator.getSortKey(utf8("a")), key );
+    EXPECT_EQ( 1u, cache.getSize() );
+    EXPECT_TRUE( cache.findSortKey(collator, utf8("a")) != NULL );
+
+    cache.getSortKey(collator, utf8("b"));
+    EXPECT_EQ( 2u, cache.getSize() );
+
+    /* full : emptied before adding */
+    cache.getSortKey(collator, utf8("c"));
+    EXPECT_EQ( 1u, cache.getSize() );
+    EXPECT_TRUE( cache.findSortKey(collator, utf8("a")) == NULL );
+
+    /* other settings : emptied */
+    cr::Collator primary(cr::Collator::Primary);
+    EXPECT_TRUE( cache.findSortKey(primary, utf8("c")) == NULL );
+    EXPECT_EQ( 0u, cache.getSize() );
+    EXPECT_EQ( primary.getSortKey(utf8("C")), cache.getSortKey(primary, utf8("C")) );
+
+    cache.clear();
+    EXPECT_EQ( 0u, cache.getSize() );
+}
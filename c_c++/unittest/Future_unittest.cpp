@@ -0,0 +1,138 @@
+#include <Future.hpp>
+#include <Thread.hpp>
+#include <ThreadPool.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+/**
+ * Value given before or after the wait
+ */
+TEST(FutureTest, promise)
+{
+    cr::Promise<std::string> promise;
+    cr::Future<std::string> future = promise.getFuture();
+    EXPECT_TRUE(future.isValid());
+    EXPECT_FALSE(future.isReady());
+    EXPECT_FALSE(future.waitFor(cr::milliseconds(5)));
+    EXPECT_THROW(promise.getFuture(), std::future_error);
+
+    promise.setValue("value");
+    EXPECT_TRUE(future.isReady());
+    EXPECT_THROW(promise.setValue("again"), std::future_error);
+    EXPECT_EQ("value", future.get());
+    EXPECT_FALSE(future.isValid());
+
+    cr::Promise<std::unique_ptr<int> > other;
+    cr::Future<std::unique_ptr<int> > pointer = other.getFuture();
+    cr::Thread thread([&]() { other.setValue(new int(42)); });
+    thread.launch();
+    EXPECT_EQ(42, *pointer.get());
+}
+
+/**
+ * Exceptions and broken promises
+ */
+TEST(FutureTest, failure)
+{
+    cr::Future<int> future;
+    {
+        cr::Promise<int> promise;
+        future = promise.getFuture();
+    }
+    EXPECT_THROW(future.get(), std::future_error);
+
+    cr::Promise<void> promise;
+    cr::Future<void> failed = promise.getFuture();
+    promise.setException(std::make_exception_ptr(std::runtime_error("failed")));
+    EXPECT_THROW(failed.get(), std::runtime_error);
+}
+
+/**
+ * Continuations, attached before and after the value
+ */
+TEST(FutureTest, then)
+{
+    cr::Promise<int> promise;
+    cr::Future<std::string> future = promise.getFuture()
+        .then([](int value) { return value * 2; })
+        .then([](int value) { return std::to_string(value); });
+    promise.setValue(21);
+    EXPECT_EQ("42", future.get());
+
+    cr::Promise<void> ready;
+    ready.setValue();
+    int calls = 0;
+    ready.getFuture().then([&]() { ++calls; }).get();
+    EXPECT_EQ(1, calls);
+
+    /*
+     * A failure skips the continuations
+     */
+    cr::Promise<int> failing;
+    cr::Future<int> skipped = failing.getFuture()
+        .then([&](int value) { ++calls; if (value > 0) throw std::logic_error("thrown"); return value; })
+        .then([&](int value) { ++calls; return value; });
+    failing.setValue(1);
+    EXPECT_THROW(skipped.get(), std::logic_error);
+    EXPECT_EQ(2, calls);
+}
+
+/**
+ * Continuations and tasks run by a pool
+ */
+TEST(FutureTest, executor)
+{
+    cr::ThreadPool pool(2);
+
+    cr::Future<long> sum = cr::async(pool, []() { return 10L; });
+    for (int i = 0; i < 100; ++i)
+        sum = sum.then(pool, [i](long value) { return value + i; });
+    EXPECT_EQ(10 + 4950, sum.get());
+
+    cr::Promise<int> promise;
+    cr::Future<int> refused = promise.getFuture().then(pool, [](int value) { return value; });
+    pool.shutdown();
+    promise.setValue(1);
+    EXPECT_THROW(refused.get(), std::future_error);
+}
+
+/**
+ * Combinators
+ */
+TEST(FutureTest, combinators)
+{
+    cr::ThreadPool pool(4);
+
+    std::vector<cr::Future<int> > squares;
+    for (int i = 0; i < 50; ++i)
+        squares.push_back(cr::async(pool, [i]() { return i * i; }));
+    std::vector<int> values = cr::whenAll(std::move(squares)).get();
+    ASSERT_EQ(50u, values.size());
+    for (int i = 0; i < 50; ++i)
+        EXPECT_EQ(i * i, values[i]);
+
+    EXPECT_TRUE(cr::whenAll(std::vector<cr::Future<int> >()).get().empty());
+
+    std::vector<cr::Future<void> > failures;
+    failures.push_back(cr::async(pool, []() {}));
+    failures.push_back(cr::async(pool, []() { throw std::runtime_error("second"); }));
+    EXPECT_THROW(cr::whenAll(std::move(failures)).get(), std::runtime_error);
+
+    cr::Promise<std::string> slow;
+    cr::Promise<std::string> fast;
+    std::vector<cr::Future<std::string> > race;
+    race.push_back(slow.getFuture());
+    race.push_back(fast.getFuture());
+    cr::Future<std::pair<std::size_t, std::string> > first = cr::whenAny(std::move(race));
+    fast.setValue("fast");
+    slow.setValue("slow");
+    std::pair<std::size_t, std::string> winner = first.get();
+    EXPECT_EQ(1u, winner.first);
+    EXPECT_EQ("fast", winner.second);
+
+    EXPECT_THROW(cr::whenAny(std::vector<cr::Future<void> >()).get(), std::invalid_argument);
+}
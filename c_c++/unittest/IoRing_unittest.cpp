@@ -0,0 +1,384 @@
+#include <IoRing.hpp>
+#include <AsyncFile.hpp>
+#include <Thread.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cerrno>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace
+{
+    std::string getTemporaryName()
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "/tmp/cr_io_ring_%d.bin", static_cast<int>(getpid()));
+        return name;
+    }
+
+    /*
+     * Backends to test : io_uring is skipped where the system lacks it
+     */
+    std::vector<cr::IoRing::Backend> getBackends()
+    {
+        std::vector<cr::IoRing::Backend> backends(1, cr::IoRing::Threads);
+
+        cr::IoRing ring(8, cr::IoRing::Uring);
+        if (ring.isValid())
+            backends.push_back(cr::IoRing::Uring);
+
+        return backends;
+    }
+
+    /*
+     * Wait for \a count completions
+     */
+    std::vector<cr::IoCompletion> waitAll(cr::IoRing& ring, std::size_t count)
+    {
+        std::vector<cr::IoCompletion> completions(count);
+        std::size_t done = 0;
+
+        while (done < count)
+        {
+            std::size_t received = ring.waitCompletions(&completions[done], count - done);
+            if (received == 0)
+                break;
+            done += received;
+        }
+
+        completions.resize(done);
+        return completions;
+    }
+
+    /*
+     * Worker consuming completions until the ring is shut down
+     */
+    struct Consumer
+    {
+        cr::IoRing*  ring;
+        unsigned int count;
+        cr::Int64    bytes;
+
+        void run()
+        {
+            cr::IoCompletion completion;
+            while (ring->waitCompletions(&completion, 1) == 1)
+            {
+                ++count;
+                bytes += completion.result;
+            }
+        }
+    };
+}
+
+/**
+ * The requested backend is used ; Auto always gives a valid ring
+ */
+TEST(IoRingTest, backends)
+{
+    cr::IoRing automatic;
+    EXPECT_TRUE(automatic.isValid());
+    EXPECT_NE(cr::IoRing::Auto, automatic.getBackend());
+
+    cr::IoRing threads(16, cr::IoRing::Threads);
+    EXPECT_TRUE(threads.isValid());
+    EXPECT_EQ(cr::IoRing::Threads, threads.getBackend());
+    EXPECT_EQ(0u, threads.getPendingCount());
+}
+
+/**
+ * Nops complete with their user data, once submitted
+ */
+TEST(IoRingTest, nop)
+{
+    std::vector<cr::IoRing::Backend> backends = getBackends();
+
+    for (std::size_t b = 0; b < backends.size(); ++b)
+    {
+        cr::IoRing ring(16, backends[b]);
+
+        EXPECT_TRUE(ring.prepareNop(7));
+        EXPECT_TRUE(ring.prepareNop(8));
+        EXPECT_EQ(2u, ring.getPendingCount());
+
+        /*
+         * Nothing completes before the submission
+         */
+        cr::IoCompletion completion;
+        EXPECT_EQ(0u, ring.pollCompletions(&completion, 1));
+        EXPECT_EQ(2u, ring.submit());
+
+        std::vector<cr::IoCompletion> completions = waitAll(ring, 2);
+        ASSERT_EQ(2u, completions.size());
+
+        std::set<cr::Uint64> users;
+        for (std::size_t i = 0; i < completions.size(); ++i)
+        {
+            users.insert(completions[i].userData);
+            EXPECT_EQ(0, completions[i].result);
+        }
+        EXPECT_EQ(1u, users.count(7));
+        EXPECT_EQ(1u, users.count(8));
+        EXPECT_EQ(0u, ring.getPendingCount());
+        EXPECT_EQ(0u, ring.pollCompletions(&completion, 1));
+    }
+}
+
+/**
+ * On an idle ring, waiting lasts until a submission or the shutdown
+ */
+TEST(IoRingTest, idle)
+{
+    std::vector<cr::IoRing::Backend> backends = getBackends();
+
+    for (std::size_t b = 0; b < backends.size(); ++b)
+    {
+        cr::IoRing ring(16, backends[b]);
+
+        Consumer consumer;
+        consumer.ring = &ring;
+        consumer.count = 0;
+        consumer.bytes = 0;
+        cr::Thread thread(&Consumer::run, &consumer);
+        thread.launch();
+
+        /*
+         * The consumer sleeps meanwhile, then gets the nops
+         */
+        usleep(20000);
+        EXPECT_TRUE(ring.prepareNop(1));
+        EXPECT_TRUE(ring.prepareNop(2));
+        EXPECT_EQ(2u, ring.submit());
+
+        while (ring.getPendingCount() > 0)
+            usleep(1000);
+        usleep(20000);
+
+        ring.shutdown();
+        thread.wait();
+        EXPECT_EQ(2u, consumer.count);
+
+        /*
+         * After the shutdown, waiting on the idle ring returns at once
+         */
+        cr::IoCompletion completion;
+        EXPECT_EQ(0u, ring.waitCompletions(&completion, 1));
+    }
+}
+
+/**
+ * The ring refuses operations beyond its depth
+ */
+TEST(IoRingTest, full)
+{
+    std::vector<cr::IoRing::Backend> backends = getBackends();
+
+    for (std::size_t b = 0; b < backends.size(); ++b)
+    {
+        cr::IoRing ring(4, backends[b]);
+
+        std::size_t prepared = 0;
+        while (prepared < 100 && ring.prepareNop(prepared + 1))
+            ++prepared;
+
+        EXPECT_GE(prepared, 4u);
+        EXPECT_LT(prepared, 100u);
+
+        ring.submit();
+        EXPECT_EQ(prepared, waitAll(ring, prepared).size());
+        EXPECT_TRUE(ring.prepareNop(1));
+        ring.submit();
+        EXPECT_EQ(1u, waitAll(ring, 1).size());
+    }
+}
+
+/**
+ * Writes then reads of a file, in batches
+ */
+TEST(IoRingTest, readWrite)
+{
+    std::string name = getTemporaryName();
+    std::vector<cr::IoRing::Backend> backends = getBackends();
+
+    const std::size_t BlockSize = 4096;
+    const std::size_t BlockCount = 32;
+
+    std::vector<char> data(BlockSize * BlockCount);
+    for (std::size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<char>(i * 31 + i / BlockSize);
+
+    for (std::size_t b = 0; b < backends.size(); ++b)
+    {
+        cr::IoRing ring(BlockCount, backends[b]);
+
+        int file = ::open(name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        ASSERT_GE(file, 0);
+
+        for (std::size_t i = 0; i < BlockCount; ++i)
+            ASSERT_TRUE(ring.prepareWrite(file, &data[i * BlockSize], BlockSize, i * BlockSize, i));
+        EXPECT_EQ(BlockCount, ring.submit());
+
+        std::vector<cr::IoCompletion> written = waitAll(ring, BlockCount);
+        ASSERT_EQ(BlockCount, written.size());
+        for (std::size_t i = 0; i < written.size(); ++i)
+            EXPECT_EQ(static_cast<cr::Int64>(BlockSize), written[i].result);
+
+        /*
+         * Read backwards, checking each block by its user data
+         */
+        std::vector<char> read(data.size());
+        for (std::size_t i = 0; i < BlockCount; ++i)
+        {
+            std::size_t block = BlockCount - 1 - i;
+            ASSERT_TRUE(ring.prepareRead(file, &read[block * BlockSize], BlockSize, block * BlockSize, block + 100));
+        }
+        ring.submit();
+
+        std::vector<cr::IoCompletion> completions = waitAll(ring, BlockCount);
+        ASSERT_EQ(BlockCount, completions.size());
+        for (std::size_t i = 0; i < completions.size(); ++i)
+        {
+            std::size_t block = completions[i].userData - 100;
+            ASSERT_LT(block, BlockCount);
+            EXPECT_EQ(static_cast<cr::Int64>(BlockSize), completions[i].result);
+            EXPECT_EQ(0, std::memcmp(&read[block * BlockSize], &data[block * BlockSize], BlockSize));
+        }
+
+        /*
+         * Short read at the end of the file, error on a bad descriptor
+         */
+        char tail[100];
+        ring.prepareRead(file, tail, sizeof(tail), data.size() - 10, 1);
+        ring.prepareRead(-1, tail, sizeof(tail), 0, 2);
+        ring.submit();
+
+        completions = waitAll(ring, 2);
+        ASSERT_EQ(2u, completions.size());
+        for (std::size_t i = 0; i < completions.size(); ++i)
+        {
+            if (completions[i].userData == 1)
+                EXPECT_EQ(10, completions[i].result);
+            else
+                EXPECT_EQ(-EBADF, completions[i].result);
+        }
+
+        ::close(file);
+    }
+
+    std::remove(name.c_str());
+}
+
+/**
+ * Completions consumed by several worker threads
+ */
+TEST(IoRingTest, workers)
+{
+    std::string name = getTemporaryName();
+    std::vector<cr::IoRing::Backend> backends = getBackends();
+
+    std::vector<char> data(1 << 20, 'x');
+    {
+        int file = ::open(name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        ASSERT_GE(file, 0);
+        ASSERT_EQ(static_cast<ssize_t>(data.size()), ::write(file, &data[0], data.size()));
+        ::close(file);
+    }
+
+    for (std::size_t b = 0; b < backends.size(); ++b)
+    {
+        cr::IoRing ring(64, backends[b]);
+        cr::AsyncFile file(ring);
+        ASSERT_TRUE(file.open(name));
+
+        Consumer consumers[3];
+        std::vector<cr::Thread*> threads;
+        for (int i = 0; i < 3; ++i)
+        {
+            consumers[i].ring = &ring;
+            consumers[i].count = 0;
+            consumers[i].bytes = 0;
+            threads.push_back(new cr::Thread(&Consumer::run, &consumers[i]));
+            threads.back()->launch();
+        }
+
+        /*
+         * 256 reads of 4 KiB, in batches limited by the depth
+         */
+        std::vector<char> buffer(data.size());
+        std::size_t issued = 0;
+        while (issued < 256)
+        {
+            while (issued < 256 && file.read(&buffer[issued * 4096], 4096, issued * 4096, issued + 1))
+                ++issued;
+            ring.submit();
+            usleep(1000);
+        }
+
+        while (ring.getPendingCount() > 0)
+            usleep(1000);
+
+        /*
+         * The workers sleep on the idle ring until the shutdown
+         */
+        ring.shutdown();
+
+        unsigned int count = 0;
+        cr::Int64 bytes = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            threads[i]->wait();
+            delete threads[i];
+            count += consumers[i].count;
+            bytes += consumers[i].bytes;
+        }
+
+        EXPECT_EQ(256u, count);
+        EXPECT_EQ(static_cast<cr::Int64>(data.size()), bytes);
+        EXPECT_TRUE(buffer == data);
+    }
+
+    std::remove(name.c_str());
+}
+
+/**
+ * AsyncFile opening modes and size
+ */
+TEST(AsyncFileTest, file)
+{
+    std::string name = getTemporaryName();
+    cr::IoRing ring;
+    cr::AsyncFile file(ring);
+
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_EQ(-1, file.getDescriptor());
+    EXPECT_FALSE(file.read(NULL, 0, 0, 0));
+
+    ASSERT_TRUE(file.open(name, cr::AsyncFile::Write));
+    const char text[] = "asynchronous";
+    ASSERT_TRUE(file.write(text, 12, 0, 1));
+    ASSERT_TRUE(file.write(text, 12, 12, 2));
+    ring.submit();
+    EXPECT_EQ(2u, waitAll(ring, 2).size());
+    EXPECT_EQ(24u, file.getSize());
+    file.close();
+    EXPECT_FALSE(file.isOpen());
+
+    ASSERT_TRUE(file.open(name, cr::AsyncFile::Read));
+    char buffer[24];
+    ASSERT_TRUE(file.read(buffer, sizeof(buffer), 0, 3));
+    ring.submit();
+    std::vector<cr::IoCompletion> completions = waitAll(ring, 1);
+    ASSERT_EQ(1u, completions.size());
+    EXPECT_EQ(3u, completions[0].userData);
+    EXPECT_EQ(24, completions[0].result);
+    EXPECT_EQ(0, std::memcmp(buffer + 12, text, 12));
+    file.close();
+
+    std::remove(name.c_str());
+    EXPECT_FALSE(file.open(name, cr::AsyncFile::Read));
+}
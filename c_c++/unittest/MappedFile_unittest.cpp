@@ -0,0 +1,138 @@
+#include <MappedFile.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+
+namespace
+{
+    /*
+     * Temporary file, removed at the end of the test
+     */
+    class TemporaryFile
+    {
+    public:
+        explicit TemporaryFile(const std::string& content)
+        {
+            char name[64];
+            std::snprintf(name, sizeof(name), "/tmp/cr_mapped_file_%d.txt", static_cast<int>(getpid()));
+            m_name = name;
+
+            std::ofstream file(m_name.c_str(), std::ios::binary);
+            file.write(content.data(), content.size());
+        }
+
+        ~TemporaryFile()
+        {
+            std::remove(m_name.c_str());
+        }
+
+        const std::string& getName() const
+        {
+            return m_name;
+        }
+
+    private:
+        std::string m_name;
+    };
+}
+
+/**
+ * Map a file and read its content in place
+ */
+TEST(MappedFileTest, open)
+{
+    std::string content("first line\nsecond line\n");
+    TemporaryFile temporary(content);
+
+    cr::MappedFile file(temporary.getName());
+    ASSERT_TRUE( file.isOpen() );
+    ASSERT_EQ( content.size(), file.getSize() );
+    EXPECT_EQ( content, std::string(file.getData(), file.getSize()) );
+
+    cr::Utf8View view = file.getView();
+    EXPECT_EQ( file.getData(), view.getData() );
+    EXPECT_EQ( content.size(), view.getSize() );
+
+    file.advise(cr::MappedFile::Random);
+    file.prefetch(5, 1000);
+    EXPECT_EQ( content, std::string(file.getData(), file.getSize()) );
+
+    file.close();
+    EXPECT_FALSE( file.isOpen() );
+    EXPECT_EQ( 0u, file.getSize() );
+    EXPECT_TRUE( file.getData() == NULL );
+}
+
+/**
+ * Decode the content, without its byte order mark
+ */
+TEST(MappedFileTest, toString)
+{
+    TemporaryFile temporary("\xEF\xBB\xBF" "caf\xC3\xA9");
+
+    cr::MappedFile file(temporary.getName());
+    ASSERT_TRUE( file.isOpen() );
+
+    cr::String text = file.toString();
+    ASSERT_EQ( 4u, text.getSize() );
+    EXPECT_EQ( cr::Uint32('c'), text[0] );
+    EXPECT_EQ( 0xE9u, text[3] );
+
+    TemporaryFile malformed("caf\xE9\nnext");
+    cr::MappedFile latin1(malformed.getName());
+    ASSERT_TRUE( latin1.isOpen() );
+
+    text = latin1.toString();
+    ASSERT_EQ( 9u, text.getSize() );
+    EXPECT_EQ( 0xFFFDu, text[3] );
+    EXPECT_EQ( cr::Uint32('\n'), text[4] );
+    EXPECT_EQ( cr::Uint32('n'), text[5] );
+}
+
+/**
+ * Empty and missing files
+ */
+TEST(MappedFileTest, errors)
+{
+    {
+        TemporaryFile temporary("");
+        cr::MappedFile file(temporary.getName());
+
+        EXPECT_TRUE( file.isOpen() );
+        EXPECT_EQ( 0u, file.getSize() );
+        EXPECT_TRUE( file.getView().isEmpty() );
+        EXPECT_TRUE( file.toString().isEmpty() );
+    }
+
+    cr::MappedFile missing;
+    EXPECT_FALSE( missing.open("/nonexistent/cr_mapped_file.txt") );
+    EXPECT_FALSE( missing.isOpen() );
+
+    EXPECT_FALSE( missing.open("/tmp") );
+}
+
+/**
+ * Ownership of the mapping moves
+ */
+TEST(MappedFileTest, move)
+{
+    TemporaryFile temporary("content");
+
+    cr::MappedFile first(temporary.getName());
+    const char* data = first.getData();
+
+    cr::MappedFile second(std::move(first));
+    EXPECT_FALSE( first.isOpen() );
+    EXPECT_TRUE( second.isOpen() );
+    EXPECT_EQ( data, second.getData() );
+
+    cr::MappedFile third;
+    third = std::move(second);
+    EXPECT_FALSE( second.isOpen() );
+    EXPECT_EQ( data, third.getData() );
+    EXPECT_EQ( 7u, third.getSize() );
+}
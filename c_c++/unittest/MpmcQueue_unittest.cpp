@@ -0,0 +1,254 @@
+#include <MpmcQueue.hpp>
+#include <Thread.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include <unistd.h>
+
+
+namespace
+{
+    const int Producers = 4;
+    const int Consumers = 4;
+    const int ItemsPerProducer = 20000;
+
+    /*
+     * Producer in the high bits, its counter in the low ones
+     */
+    long makeItem(int producer, int counter)
+    {
+        return (static_cast<long>(producer) << 32) | counter;
+    }
+}
+
+/**
+ * Elements come out in order, and the capacity is respected
+ */
+TEST(MpmcQueueTest, tryPushPop)
+{
+    cr::MpmcQueue<int> queue(3);
+    EXPECT_EQ(4u, queue.getCapacity());
+
+    int value = 0;
+    EXPECT_FALSE(queue.tryPop(value));
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.tryPush(i));
+    EXPECT_FALSE(queue.tryPush(4));
+    EXPECT_EQ(4u, queue.getSize());
+
+    for (int lap = 0; lap < 3; ++lap)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.tryPop(value));
+            EXPECT_EQ(lap * 4 + i, value);
+            EXPECT_TRUE(queue.tryPush(lap * 4 + i + 4));
+        }
+    }
+    EXPECT_EQ(4u, queue.getSize());
+}
+
+/**
+ * Batches take what fits, in order
+ */
+TEST(MpmcQueueTest, batch)
+{
+    cr::MpmcQueue<int> queue(8);
+
+    int values[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    EXPECT_EQ(8u, queue.tryPushBatch(values, 10));
+    EXPECT_EQ(0u, queue.tryPushBatch(values + 8, 2));
+
+    int popped[10];
+    EXPECT_EQ(3u, queue.tryPopBatch(popped, 3));
+    EXPECT_EQ(2u, queue.tryPushBatch(values + 8, 2));
+    EXPECT_EQ(7u, queue.tryPopBatch(popped + 3, 10));
+    EXPECT_EQ(0u, queue.tryPopBatch(popped, 10));
+
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(i, popped[i]);
+}
+
+/**
+ * The elements left are destroyed with the queue, the others are moved out
+ */
+TEST(MpmcQueueTest, ownership)
+{
+    std::shared_ptr<int> value = std::make_shared<int>(42);
+    {
+        cr::MpmcQueue<std::shared_ptr<int> > queue(4);
+        queue.push(value);
+        queue.push(value);
+        queue.push(value);
+        EXPECT_EQ(4, value.use_count());
+
+        std::shared_ptr<int> popped;
+        queue.pop(popped);
+        EXPECT_EQ(4, value.use_count());
+        popped.reset();
+        EXPECT_EQ(3, value.use_count());
+    }
+    EXPECT_EQ(1, value.use_count());
+}
+
+/**
+ * Every element is popped once, in the order of its producer
+ */
+TEST(MpmcQueueTest, producersConsumers)
+{
+    cr::MpmcQueue<long> queue(64);
+    std::atomic<long> total(0);
+    std::atomic<int> outOfOrder(0);
+
+    std::vector<cr::Thread*> threads;
+    for (int i = 0; i < Consumers; ++i)
+    {
+        threads.push_back(new cr::Thread([&]()
+        {
+            std::vector<int> last(Producers, -1);
+            long sum = 0;
+            long values[8];
+
+            int markers = 0;
+            while (markers == 0)
+            {
+                std::size_t count = queue.popBatch(values, 8);
+                for (std::size_t j = 0; j < count; ++j)
+                {
+                    if (values[j] < 0)
+                    {
+                        ++markers;
+                        continue;
+                    }
+
+                    int producer = static_cast<int>(values[j] >> 32);
+                    int counter = static_cast<int>(values[j] & 0xffffffff);
+                    if (counter <= last[producer])
+                        ++outOfOrder;
+                    last[producer] = counter;
+                    sum += counter;
+                }
+            }
+
+            /*
+             * Give back the markers of the other consumers
+             */
+            for (int j = 1; j < markers; ++j)
+                queue.push(-1);
+            total += sum;
+        }));
+        threads.back()->launch();
+    }
+
+    std::vector<cr::Thread*> producers;
+    for (int i = 0; i < Producers; ++i)
+    {
+        producers.push_back(new cr::Thread([&queue, i]()
+        {
+            for (int j = 0; j < ItemsPerProducer; j += 4)
+            {
+                if (j % 8 == 0)
+                {
+                    long values[4] = { makeItem(i, j), makeItem(i, j + 1), makeItem(i, j + 2), makeItem(i, j + 3) };
+                    queue.pushBatch(values, 4);
+                }
+                else
+                {
+                    for (int k = 0; k < 4; ++k)
+                        queue.push(makeItem(i, j + k));
+                }
+            }
+        }));
+        producers.back()->launch();
+    }
+    for (int i = 0; i < Producers; ++i)
+        delete producers[i];
+
+    /*
+     * One end marker per consumer
+     */
+    for (int i = 0; i < Consumers; ++i)
+        queue.push(-1);
+    for (int i = 0; i < Consumers; ++i)
+        delete threads[i];
+
+    long expected = static_cast<long>(ItemsPerProducer) * (ItemsPerProducer - 1) / 2 * Producers;
+    EXPECT_EQ(expected, total.load());
+    EXPECT_EQ(0, outOfOrder.load());
+    EXPECT_EQ(0u, queue.getSize());
+}
+
+/**
+ * Many consumers blocked in pop() while producers push in small
+ * bursts : the queue keeps emptying, so the consumers go to sleep
+ * and are woken up over and over. A lost wakeup leaves elements
+ * in the queue with every consumer asleep
+ */
+TEST(MpmcQueueTest, blockingWakeups)
+{
+    const int Sleepers = 8;
+    const int Rounds = 3000;
+    const int Burst = 3;
+
+    cr::MpmcQueue<long> queue(4);
+    std::atomic<long> popped(0);
+
+    std::vector<cr::Thread*> consumers;
+    for (int i = 0; i < Sleepers; ++i)
+    {
+        consumers.push_back(new cr::Thread([&]()
+        {
+            long value;
+            for (;;)
+            {
+                queue.pop(value);
+                if (value < 0)
+                    break;
+                ++popped;
+            }
+        }));
+        consumers.back()->launch();
+    }
+
+    std::vector<cr::Thread*> producers;
+    for (int i = 0; i < 2; ++i)
+    {
+        producers.push_back(new cr::Thread([&queue]()
+        {
+            for (int round = 0; round < Rounds; ++round)
+            {
+                for (int j = 0; j < Burst; ++j)
+                    queue.push(round);
+                if (round % 16 == 0)
+                    usleep(50);
+            }
+        }));
+        producers.back()->launch();
+    }
+    for (std::size_t i = 0; i < producers.size(); ++i)
+        delete producers[i];
+
+    /*
+     * The consumers can't be stopped if one of them missed a
+     * wakeup : report it and stop instead of hanging
+     */
+    const long expected = 2L * Rounds * Burst;
+    for (int i = 0; i < 3000 && popped.load() != expected; ++i)
+        usleep(10000);
+    if (popped.load() != expected)
+    {
+        ADD_FAILURE() << "consumers asleep with " << queue.getSize() << " elements queued";
+        std::abort();
+    }
+
+    for (int i = 0; i < Sleepers; ++i)
+        queue.push(-1);
+    for (int i = 0; i < Sleepers; ++i)
+        delete consumers[i];
+
+    EXPECT_EQ(expected, popped.load());
+    EXPECT_EQ(0u, queue.getSize());
+}
@@ -0,0 +1,266 @@
+#include <Clock.hpp>
+#include <ConditionVariable.hpp>
+#include <Lock.hpp>
+#include <Mutex.hpp>
+#include <Semaphore.hpp>
+#include <Thread.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <deque>
+#include <vector>
+
+
+namespace
+{
+    const int ThreadCount = 4;
+    const int Iterations = 20000;
+
+    struct Counter
+    {
+        Counter() : value(0) {}
+
+        void increment()
+        {
+            for (int i = 0; i < Iterations; ++i)
+            {
+                cr::Lock lock(mutex);
+                ++value;
+            }
+        }
+
+        cr::Mutex mutex;
+        long      value;
+    };
+}
+
+/**
+ * Mutual exclusion between threads
+ */
+TEST(MutexTest, exclusion)
+{
+    Counter counter;
+    std::vector<cr::Thread*> threads;
+    for (int i = 0; i < ThreadCount; ++i)
+    {
+        threads.push_back(new cr::Thread(&Counter::increment, &counter));
+        threads.back()->launch();
+    }
+    for (int i = 0; i < ThreadCount; ++i)
+        delete threads[i];
+
+    EXPECT_EQ(static_cast<long>(ThreadCount) * Iterations, counter.value);
+
+    cr::Mutex mutex;
+    EXPECT_TRUE(mutex.tryLock());
+    EXPECT_FALSE(mutex.tryLock());
+    {
+        cr::Lock lock(counter.mutex);
+        EXPECT_TRUE(lock.isLocked());
+        lock.unlock();
+        EXPECT_FALSE(lock.isLocked());
+        EXPECT_TRUE(counter.mutex.tryLock());
+        counter.mutex.unlock();
+        lock.lock();
+    }
+    mutex.unlock();
+    EXPECT_TRUE(counter.mutex.tryLock());
+    counter.mutex.unlock();
+}
+
+/**
+ * Producers and consumers on a queue
+ */
+TEST(MutexTest, conditionVariable)
+{
+    cr::Mutex mutex;
+    cr::ConditionVariable notEmpty;
+    std::deque<int> queue;
+    std::atomic<long> sum(0);
+
+    std::vector<cr::Thread*> consumers;
+    for (int i = 0; i < ThreadCount; ++i)
+    {
+        consumers.push_back(new cr::Thread([&]()
+        {
+            for (;;)
+            {
+                cr::Lock lock(mutex);
+                notEmpty.wait(lock, [&]() { return !queue.empty(); });
+                int value = queue.front();
+                queue.pop_front();
+                if (value < 0)
+                    return;
+                sum += value;
+            }
+        }));
+        consumers.back()->launch();
+    }
+
+    for (int i = 1; i <= Iterations; ++i)
+    {
+        cr::Lock lock(mutex);
+        queue.push_back(i);
+        notEmpty.notifyOne();
+    }
+    {
+        cr::Lock lock(mutex);
+        for (int i = 0; i < ThreadCount; ++i)
+            queue.push_back(-1);
+    }
+    notEmpty.notifyAll();
+
+    for (int i = 0; i < ThreadCount; ++i)
+        delete consumers[i];
+
+    EXPECT_EQ(static_cast<long>(Iterations) * (Iterations + 1) / 2, sum.load());
+
+    cr::Lock lock(mutex);
+    EXPECT_FALSE(notEmpty.waitFor(lock, cr::milliseconds(5), []() { return false; }));
+    EXPECT_TRUE(lock.isLocked());
+}
+
+/**
+ * All the waiters are woken by notifyAll(), one at a time
+ */
+TEST(MutexTest, notifyAll)
+{
+    cr::Mutex mutex;
+    cr::ConditionVariable condition;
+    bool isOpen = false;
+    int inside = 0;
+
+    std::vector<cr::Thread*> threads;
+    for (int i = 0; i < 8; ++i)
+    {
+        threads.push_back(new cr::Thread([&]()
+        {
+            cr::Lock lock(mutex);
+            condition.wait(lock, [&]() { return isOpen; });
+            ++inside;
+        }));
+        threads.back()->launch();
+    }
+
+    cr::StopToken().sleep(cr::milliseconds(20));
+    {
+        cr::Lock lock(mutex);
+        isOpen = true;
+    }
+    condition.notifyAll();
+
+    for (std::size_t i = 0; i < threads.size(); ++i)
+        delete threads[i];
+    EXPECT_EQ(8, inside);
+}
+
+/**
+ * Waits interrupted by a stop request
+ */
+TEST(MutexTest, stopToken)
+{
+    cr::Mutex mutex;
+    cr::ConditionVariable condition;
+    bool isInterrupted = false;
+
+    cr::Thread thread([&](cr::StopToken token)
+    {
+        cr::Lock lock(mutex);
+        isInterrupted = !condition.wait(lock, token, []() { return false; });
+    });
+    thread.launch();
+    cr::StopToken().sleep(cr::milliseconds(10));
+    thread.terminate();
+
+    EXPECT_TRUE(isInterrupted);
+}
+
+/**
+ * Timed waits ended by the predicate, the timeout or a stop request
+ */
+TEST(MutexTest, stopTokenTimeout)
+{
+    cr::Mutex mutex;
+    cr::ConditionVariable condition;
+    cr::StopSource source;
+    bool isReady = false;
+
+    {
+        cr::Lock lock(mutex);
+        cr::Clock clock;
+        EXPECT_FALSE(condition.waitFor(lock, source.getToken(), cr::milliseconds(20), [&]() { return isReady; }));
+        EXPECT_GE(clock.getElapsedTime(), cr::milliseconds(20));
+    }
+
+    cr::Thread notifier([&]()
+    {
+        cr::StopToken().sleep(cr::milliseconds(10));
+        {
+            cr::Lock lock(mutex);
+            isReady = true;
+        }
+        condition.notifyAll();
+    });
+    notifier.launch();
+    {
+        cr::Lock lock(mutex);
+        EXPECT_TRUE(condition.waitFor(lock, source.getToken(), cr::seconds(10), [&]() { return isReady; }));
+    }
+    notifier.wait();
+
+    /*
+     * The stop request ends a long wait early
+     */
+    bool isInterrupted = false;
+    cr::Time elapsed;
+    cr::Thread thread([&](cr::StopToken token)
+    {
+        cr::Lock lock(mutex);
+        cr::Clock clock;
+        isInterrupted = !condition.waitFor(lock, token, cr::seconds(10), []() { return false; });
+        elapsed = clock.getElapsedTime();
+    });
+    thread.launch();
+    cr::StopToken().sleep(cr::milliseconds(10));
+    thread.terminate();
+
+    EXPECT_TRUE(isInterrupted);
+    EXPECT_LT(elapsed, cr::seconds(5));
+}
+
+/**
+ * Counting semaphore
+ */
+TEST(MutexTest, semaphore)
+{
+    cr::Semaphore semaphore(2);
+    EXPECT_EQ(2u, semaphore.getCount());
+    EXPECT_TRUE(semaphore.tryWait());
+    EXPECT_TRUE(semaphore.waitFor(cr::milliseconds(1)));
+    EXPECT_FALSE(semaphore.tryWait());
+    EXPECT_FALSE(semaphore.waitFor(cr::milliseconds(5)));
+
+    cr::Semaphore items;
+    std::atomic<int> taken(0);
+    std::vector<cr::Thread*> threads;
+    for (int i = 0; i < ThreadCount; ++i)
+    {
+        threads.push_back(new cr::Thread([&]()
+        {
+            for (int j = 0; j < 1000; ++j)
+            {
+                items.wait();
+                ++taken;
+            }
+        }));
+        threads.back()->launch();
+    }
+
+    for (int i = 0; i < ThreadCount * 1000; i += 10)
+        items.post(10);
+
+    for (int i = 0; i < ThreadCount; ++i)
+        delete threads[i];
+
+    EXPECT_EQ(ThreadCount * 1000, taken.load());
+    EXPECT_EQ(0u, items.getCount());
+}
@@ -0,0 +1,173 @@
+#include <Normalization.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+    cr::String make(const cr::Uint32* chars)
+    {
+        return cr::String(chars);
+    }
+}
+
+/**
+ * already normalized strings are returned as is
+ */
+TEST(NormalizationTest, quickCheck)
+{
+    cr::String ascii("The quick brown fox jumps over the lazy dog");
+
+    EXPECT_TRUE( cr::isNormalized(ascii, cr::NFC) );
+    EXPECT_TRUE( cr::isNormalized(ascii, cr::NFD) );
+    EXPECT_TRUE( cr::isNormalized(ascii, cr::NFKC) );
+    EXPECT_TRUE( cr::isNormalized(ascii, cr::NFKD) );
+    EXPECT_TRUE( cr::isNormalized(cr::String(), cr::NFC) );
+
+    const cr::Uint32 composed[] = { 'c', 'a', 'f', 0x00E9, 0 };    /* café */
+    const cr::Uint32 decomposed[] = { 'c', 'a', 'f', 'e', 0x0301, 0 };
+
+    EXPECT_TRUE( cr::isNormalized(make(composed), cr::NFC) );
+    EXPECT_FALSE( cr::isNormalized(make(composed), cr::NFD) );
+    EXPECT_TRUE( cr::isNormalized(make(decomposed), cr::NFD) );
+    EXPECT_FALSE( cr::isNormalized(make(decomposed), cr::NFC) );
+
+    /* a combining mark which doesn't compose is a "maybe" but still NFC */
+    const cr::Uint32 lonely[] = { 'x', 0x0301, 0 };
+    EXPECT_TRUE( cr::isNormalized(make(lonely), cr::NFC) );
+
+    /* marks out of canonical order */
+    const cr::Uint32 unordered[] = { 'a', 0x0301, 0x0323, 0 };
+    EXPECT_FALSE( cr::isNormalized(make(unordered), cr::NFD) );
+
+    /* compatibility characters */
+    const cr::Uint32 ligature[] = { 0xFB01, 0 };    /* fi */
+    EXPECT_TRUE( cr::isNormalized(make(ligature), cr::NFC) );
+    EXPECT_FALSE( cr::isNormalized(make(ligature), cr::NFKC) );
+}
+
+/**
+ * canonical forms
+ */
+TEST(NormalizationTest, canonical)
+{
+    const cr::Uint32 composed[] = { 'c', 'a', 'f', 0x00E9, 0 };
+    const cr::Uint32 decomposed[] = { 'c', 'a', 'f', 'e', 0x0301, 0 };
+
+    EXPECT_EQ( make(decomposed), cr::normalize(make(composed), cr::NFD) );
+    EXPECT_EQ( make(composed), cr::normalize(make(decomposed), cr::NFC) );
+
+    /* reordering : dot below (220) goes before acute (230) */
+    const cr::Uint32 unordered[] = { 'a', 0x0301, 0x0323, 0 };
+    const cr::Uint32 ordered[] = { 'a', 0x0323, 0x0301, 0 };
+    const cr::Uint32 recomposed[] = { 0x1EA1, 0x0301, 0 };
+
+    EXPECT_EQ( make(ordered), cr::normalize(make(unordered), cr::NFD) );
+    EXPECT_EQ( make(recomposed), cr::normalize(make(unordered), cr::NFC) );
+
+    /* singleton decomposition : the ohm sign becomes omega */
+    const cr::Uint32 ohm[] = { 0x2126, 0 };
+    const cr::Uint32 omega[] = { 0x03A9, 0 };
+    EXPECT_EQ( make(omega), cr::normalize(make(ohm), cr::NFC) );
+
+    /* composition exclusion : stays decomposed in NFC */
+    const cr::Uint32 excluded[] = { 0x0958, 0 };
+    const cr::Uint32 excludedNfd[] = { 0x0915, 0x093C, 0 };
+    EXPECT_EQ( make(excludedNfd), cr::normalize(make(excluded), cr::NFC) );
+
+    /* a blocked mark doesn't compose */
+    const cr::Uint32 blocked[] = { 'a', 0x0301, 0x0301, 0 };
+    const cr::Uint32 blockedNfc[] = { 0x00E1, 0x0301, 0 };
+    EXPECT_EQ( make(blockedNfc), cr::normalize(make(blocked), cr::NFC) );
+}
+
+/**
+ * Hangul syllables are composed algorithmically
+ */
+TEST(NormalizationTest, hangul)
+{
+    const cr::Uint32 syllables[] = { 0xD55C, 0xAE00, 0 };    /* 한글 */
+    const cr::Uint32 jamos[] = { 0x1112, 0x1161, 0x11AB, 0x1100, 0x1173, 0x11AF, 0 };
+
+    EXPECT_EQ( make(jamos), cr::normalize(make(syllables), cr::NFD) );
+    EXPECT_EQ( make(syllables), cr::normalize(make(jamos), cr::NFC) );
+
+    /* LV syllable followed by a trailing consonant */
+    const cr::Uint32 lvt[] = { 0xAC00, 0x11A8, 0 };
+    const cr::Uint32 composed[] = { 0xAC01, 0 };
+    EXPECT_EQ( make(composed), cr::normalize(make(lvt), cr::NFC) );
+}
+
+/**
+ * compatibility forms
+ */
+TEST(NormalizationTest, compatibility)
+{
+    const cr::Uint32 ligature[] = { 0xFB01, 'n', 'e', 0 };
+    EXPECT_EQ( cr::String("fine"), cr::normalize(make(ligature), cr::NFKC) );
+
+    /* superscript, full width, circled digits */
+    const cr::Uint32 mixed[] = { 0x00B2, 0xFF21, 0x2460, 0 };
+    EXPECT_EQ( cr::String("2A1"), cr::normalize(make(mixed), cr::NFKD) );
+
+    /* compatibility decomposition followed by composition */
+    const cr::Uint32 angstrom[] = { 0x212B, 0 };
+    const cr::Uint32 ring[] = { 0x00C5, 0 };
+    const cr::Uint32 ringNfkd[] = { 'A', 0x030A, 0 };
+    EXPECT_EQ( make(ring), cr::normalize(make(angstrom), cr::NFKC) );
+    EXPECT_EQ( make(ringNfkd), cr::normalize(make(angstrom), cr::NFKD) );
+
+    /* long decomposition */
+    const cr::Uint32 arabic[] = { 0xFDFA, 0 };
+    EXPECT_EQ( 18u, cr::normalize(make(arabic), cr::NFKD).getSize() );
+}
+
+/**
+ * in place normalization only touches the strings which change
+ */
+TEST(NormalizationTest, inPlace)
+{
+    cr::String ascii("plain text");
+    EXPECT_FALSE( cr::normalizeInPlace(ascii, cr::NFC) );
+    EXPECT_EQ( cr::String("plain text"), ascii );
+
+    const cr::Uint32 lonely[] = { 'x', 0x0301, 0 };
+    cr::String maybe = make(lonely);
+    EXPECT_FALSE( cr::normalizeInPlace(maybe, cr::NFC) );
+    EXPECT_EQ( make(lonely), maybe );
+
+    const cr::Uint32 decomposed[] = { 'n', 'o', 0x00EB, 'l', ' ', 'e', 0x0301, 't', 'e', 0x0301, 0 };
+    const cr::Uint32 composed[] = { 'n', 'o', 0x00EB, 'l', ' ', 0x00E9, 't', 0x00E9, 0 };
+    cr::String text = make(decomposed);
+    EXPECT_TRUE( cr::normalizeInPlace(text, cr::NFC) );
+    EXPECT_EQ( make(composed), text );
+}
+
+/**
+ * normalization forms are stable
+ */
+TEST(NormalizationTest, idempotent)
+{
+    const cr::Uint32 text[] = { 0x1E9B, 0x0323, ' ', 0xD55C, 0x0958, 0xFB01, 0x2126, 'a', 0x0308, 0x0301, 0 };
+    const cr::NormalizationForm forms[] = { cr::NFC, cr::NFD, cr::NFKC, cr::NFKD };
+
+    for (int i = 0; i < 4; ++i)
+    {
+        cr::String once = cr::normalize(make(text), forms[i]);
+
+        EXPECT_TRUE( cr::isNormalized(once, forms[i]) );
+        EXPECT_EQ( once, cr::normalize(once, forms[i]) );
+    }
+
+    /* U+1E9B U+0323 : the reference example of UAX #15 */
+    const cr::Uint32 example[] = { 0x1E9B, 0x0323, 0 };
+    const cr::Uint32 nfc[] = { 0x1E9B, 0x0323, 0 };
+    const cr::Uint32 nfd[] = { 0x017F, 0x0323, 0x0307, 0 };
+    const cr::Uint32 nfkc[] = { 0x1E69, 0 };
+    const cr::Uint32 nfkd[] = { 's', 0x0323, 0x0307, 0 };
+
+    EXPECT_EQ( make(nfc),  cr::normalize(make(example), cr::NFC) );
+    EXPECT_EQ( make(nfd),  cr::normalize(make(example), cr::NFD) );
+    EXPECT_EQ( make(nfkc), cr::normalize(make(example), cr::NFKC) );
+    EXPECT_EQ( make(nfkd), cr::normalize(make(example), cr::NFKD) );
+}
@@ -0,0 +1,188 @@
+#include <Parallel.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    std::vector<int> makeRandom(std::size_t count, int range)
+    {
+        std::vector<int> values(count);
+        std::srand(static_cast<unsigned int>(count));
+        for (std::size_t i = 0; i < count; ++i)
+            values[i] = std::rand() % range;
+        return values;
+    }
+}
+
+/**
+ * Each index is visited exactly once, for integers and iterators
+ */
+TEST(ParallelTest, forEachIndex)
+{
+    cr::TaskScheduler scheduler(4);
+
+    const std::size_t sizes[] = { 0, 1, 7, 1000, 100000 };
+    for (std::size_t size : sizes)
+    {
+        std::vector<int> visits(size, 0);
+        cr::parallelFor(scheduler, std::size_t(0), size, [&](std::size_t i) { ++visits[i]; });
+        EXPECT_EQ(size, static_cast<std::size_t>(std::count(visits.begin(), visits.end(), 1)));
+
+        cr::parallelFor(scheduler, visits.begin(), visits.end(), [](std::vector<int>::iterator i) { *i += 1; });
+        EXPECT_EQ(size, static_cast<std::size_t>(std::count(visits.begin(), visits.end(), 2)));
+    }
+
+    /*
+     * Signed indices, not starting at 0, and an empty reversed range
+     */
+    std::atomic<long> sum(0);
+    cr::parallelFor(scheduler, -500, 1500, [&](int i) { sum += i; });
+    EXPECT_EQ(999000, sum.load());
+    cr::parallelFor(scheduler, 10, 5, [&](int) { sum = 0; });
+    EXPECT_EQ(999000, sum.load());
+}
+
+/**
+ * Parallel algorithms called from a parallel loop, and the default scheduler
+ */
+TEST(ParallelTest, nested)
+{
+    cr::TaskScheduler scheduler(4);
+
+    std::vector<long> rows(64, 0);
+    cr::parallelFor(scheduler, std::size_t(0), rows.size(), [&](std::size_t row) {
+        rows[row] = cr::parallelReduce(scheduler, 0L, 1000L, 0L, std::plus<long>(), [row](long column) { return static_cast<long>(row) * column; });
+    });
+    for (std::size_t row = 0; row < rows.size(); ++row)
+        EXPECT_EQ(static_cast<long>(row) * 499500, rows[row]);
+
+    std::vector<int> values(50000, 1);
+    cr::parallelFor(values.begin(), values.end(), [](std::vector<int>::iterator i) { *i *= 3; });
+    EXPECT_EQ(150000, cr::parallelReduce(values.begin(), values.end(), 0, std::plus<int>()));
+}
+
+/**
+ * The first exception thrown by the function reaches the caller
+ */
+TEST(ParallelTest, exception)
+{
+    cr::TaskScheduler scheduler(4);
+
+    EXPECT_THROW(cr::parallelFor(scheduler, 0, 100000, [](int i) {
+        if (i == 77777)
+            throw std::runtime_error("failed");
+    }), std::runtime_error);
+
+    /*
+     * The scheduler is still usable
+     */
+    std::atomic<int> count(0);
+    cr::parallelFor(scheduler, 0, 100000, [&](int) { ++count; });
+    EXPECT_EQ(100000, count.load());
+}
+
+/**
+ * Reductions keep the order of the elements
+ */
+TEST(ParallelTest, reduce)
+{
+    cr::TaskScheduler scheduler(4);
+
+    std::vector<int> values = makeRandom(200000, 1000);
+    long expected = std::accumulate(values.begin(), values.end(), 0L);
+    EXPECT_EQ(expected, cr::parallelReduce(scheduler, values.begin(), values.end(), 0L, std::plus<long>()));
+    EXPECT_EQ(*std::max_element(values.begin(), values.end()),
+              cr::parallelReduce(scheduler, values.begin(), values.end(), -1, [](int a, int b) { return std::max(a, b); }));
+
+    EXPECT_EQ(42, cr::parallelReduce(scheduler, values.begin(), values.begin(), 42, std::plus<int>()));
+
+    /*
+     * Concatenation is associative but not commutative
+     */
+    std::string letters;
+    for (int i = 0; i < 5000; ++i)
+        letters += static_cast<char>('a' + i % 26);
+    std::string joined = cr::parallelReduce(scheduler, 0, 5000, std::string(), std::plus<std::string>(),
+                                            [](int i) { return std::string(1, static_cast<char>('a' + i % 26)); });
+    EXPECT_EQ(letters, joined);
+}
+
+/**
+ * Inclusive scans, in place and to another range
+ */
+TEST(ParallelTest, scan)
+{
+    cr::TaskScheduler scheduler(4);
+
+    const std::size_t sizes[] = { 0, 1, 31, 1000, 123457 };
+    for (std::size_t size : sizes)
+    {
+        std::vector<int> values = makeRandom(size, 100);
+        std::vector<long> expected(size);
+        std::partial_sum(values.begin(), values.end(), expected.begin(), std::plus<long>());
+
+        std::vector<long> result(size, -1);
+        cr::parallelScan(scheduler, values.begin(), values.end(), result.begin(), 0L, std::plus<long>());
+        EXPECT_EQ(expected, result);
+
+        std::vector<long> inPlace(values.begin(), values.end());
+        cr::parallelScan(scheduler, inPlace.begin(), inPlace.end(), inPlace.begin(), 0L, std::plus<long>());
+        EXPECT_EQ(expected, inPlace);
+    }
+
+    std::vector<std::string> words(3000, "x");
+    std::vector<std::string> prefixes(words.size());
+    cr::parallelScan(scheduler, words.begin(), words.end(), prefixes.begin(), std::string(), std::plus<std::string>());
+    for (std::size_t i = 0; i < prefixes.size(); i += 499)
+        EXPECT_EQ(i + 1, prefixes[i].size());
+}
+
+/**
+ * Sorts give the same result as std::sort
+ */
+TEST(ParallelTest, sort)
+{
+    cr::TaskScheduler scheduler(4);
+
+    const std::size_t sizes[] = { 0, 1, 2, 5000, 100000, 300001 };
+    for (std::size_t size : sizes)
+    {
+        std::vector<int> values = makeRandom(size, 1000);
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        cr::parallelSort(scheduler, values.begin(), values.end());
+        EXPECT_EQ(expected, values);
+
+        /*
+         * Already sorted, then reversed
+         */
+        cr::parallelSort(scheduler, values.begin(), values.end(), std::greater<int>());
+        std::reverse(expected.begin(), expected.end());
+        EXPECT_EQ(expected, values);
+    }
+
+    std::vector<std::string> strings(50000);
+    std::vector<int> numbers = makeRandom(strings.size(), 1 << 30);
+    for (std::size_t i = 0; i < strings.size(); ++i)
+        strings[i] = std::to_string(numbers[i]);
+    std::vector<std::string> expected = strings;
+    std::sort(expected.begin(), expected.end());
+
+    cr::parallelSort(scheduler, strings.begin(), strings.end());
+    EXPECT_EQ(expected, strings);
+
+    std::vector<double> doubles(100000);
+    for (std::size_t i = 0; i < doubles.size(); ++i)
+        doubles[i] = static_cast<double>(numbers[i % numbers.size()]) / 7;
+    cr::parallelSort(&doubles[0], &doubles[0] + doubles.size());
+    EXPECT_TRUE(std::is_sorted(doubles.begin(), doubles.end()));
+}
@@ -0,0 +1,222 @@
+#include <PrefixTrie.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+
+/**
+ * Collect the keys visited by forEachWithPrefix
+ */
+struct KeyCollector
+{
+    KeyCollector(std::vector<cr::String>* keys) : m_keys(keys) {}
+
+    void operator()(cr::StringView key, int)
+    {
+        m_keys->push_back(key.toString());
+    }
+
+    std::vector<cr::String>* m_keys;
+};
+
+/**
+ * Default constructor
+ */
+TEST(PrefixTrieTest, ConstructorDefault)
+{
+    cr::PrefixTrie<int> t;
+
+    EXPECT_TRUE( t.isEmpty() );
+    EXPECT_EQ( 0, t.getSize() );
+    EXPECT_TRUE( t.find(cr::String("a")) == NULL );
+    EXPECT_TRUE( t.findLongestPrefix(cr::String("a")) == NULL );
+}
+
+/**
+ * insert, find and replace
+ */
+TEST(PrefixTrieTest, insertAndFind)
+{
+    cr::PrefixTrie<int> t;
+
+    EXPECT_TRUE( t.insert(cr::String("romane"), 1) );
+    EXPECT_TRUE( t.insert(cr::String("romanus"), 2) );
+    EXPECT_TRUE( t.insert(cr::String("romulus"), 3) );
+    EXPECT_TRUE( t.insert(cr::String("rom"), 4) );
+    EXPECT_TRUE( t.insert(cr::String(""), 5) );
+    EXPECT_FALSE( t.insert(cr::String("romane"), 6) );
+
+    EXPECT_EQ( 5, t.getSize() );
+    EXPECT_EQ( 6, *t.find(cr::String("romane")) );
+    EXPECT_EQ( 2, *t.find(cr::String("romanus")) );
+    EXPECT_EQ( 3, *t.find(cr::String("romulus")) );
+    EXPECT_EQ( 4, *t.find(cr::String("rom")) );
+    EXPECT_EQ( 5, *t.find(cr::String("")) );
+    EXPECT_TRUE( t.find(cr::String("roman")) == NULL );
+    EXPECT_TRUE( t.find(cr::String("romanes")) == NULL );
+    EXPECT_TRUE( t.find(cr::String("ro")) == NULL );
+}
+
+/**
+ * longest prefix lookup
+ */
+TEST(PrefixTrieTest, findLongestPrefix)
+{
+    cr::PrefixTrie<int> t;
+    t.insert(cr::String("/api/"), 1);
+    t.insert(cr::String("/api/users/"), 2);
+    t.insert(cr::String("/static/"), 3);
+
+    std::size_t length = 0;
+    const int * v = t.findLongestPrefix(cr::String("/api/users/42"), &length);
+
+    ASSERT_TRUE( v != NULL );
+    EXPECT_EQ( 2, *v );
+    EXPECT_EQ( 11, length );
+
+    v = t.findLongestPrefix(cr::String("/api/groups"), &length);
+    ASSERT_TRUE( v != NULL );
+    EXPECT_EQ( 1, *v );
+    EXPECT_EQ( 5, length );
+
+    EXPECT_TRUE( t.findLongestPrefix(cr::String("/ap")) == NULL );
+    EXPECT_TRUE( t.findLongestPrefix(cr::String("/images/")) == NULL );
+
+    /*
+     * non-ASCII keys, length is counted in characters
+     */
+    cr::String k(cr::Uint32(0xAC00));
+    k += cr::String(cr::Uint32(0x1F600));
+    t.insert(k, 4);
+
+    cr::String q = k;
+    q += cr::String("abc");
+    v = t.findLongestPrefix(q, &length);
+
+    ASSERT_TRUE( v != NULL );
+    EXPECT_EQ( 4, *v );
+    EXPECT_EQ( 2, length );
+}
+
+/**
+ * enumeration of the keys starting with a prefix, in order
+ */
+TEST(PrefixTrieTest, forEachWithPrefix)
+{
+    cr::PrefixTrie<int> t;
+    t.insert(cr::String("banana"), 1);
+    t.insert(cr::String("band"), 2);
+    t.insert(cr::String("ban"), 3);
+    t.insert(cr::String("apple"), 4);
+    t.insert(cr::String("bandana"), 5);
+
+    std::vector<cr::String> keys;
+    EXPECT_EQ( 4, t.forEachWithPrefix(cr::String("ba"), KeyCollector(&keys)) );
+
+    ASSERT_EQ( 4, keys.size() );
+    EXPECT_STREQ( "ban",     keys[0].toAnsiString().c_str() );
+    EXPECT_STREQ( "banana",  keys[1].toAnsiString().c_str() );
+    EXPECT_STREQ( "band",    keys[2].toAnsiString().c_str() );
+    EXPECT_STREQ( "bandana", keys[3].toAnsiString().c_str() );
+
+    keys.clear();
+    EXPECT_EQ( 5, t.forEachWithPrefix(cr::StringView(), KeyCollector(&keys)) );
+    EXPECT_STREQ( "apple", keys[0].toAnsiString().c_str() );
+
+    keys.clear();
+    EXPECT_EQ( 0, t.forEachWithPrefix(cr::String("c"), KeyCollector(&keys)) );
+    EXPECT_EQ( 0, t.forEachWithPrefix(cr::String("bandanas"), KeyCollector(&keys)) );
+}
+
+/**
+ * nodes grow and shrink through all the layouts
+ */
+TEST(PrefixTrieTest, adaptiveNodes)
+{
+    cr::PrefixTrie<int> t;
+
+    for(int i=0; i<256; ++i)
+    {
+        cr::String k("k");
+        k += cr::String(cr::Uint32(i + 1));
+        t.insert(k, i);
+    }
+
+    cr::PrefixTrie<int>::Stats stats = t.getStats();
+    EXPECT_EQ( 256, stats.keyCount );
+    EXPECT_LE( 1, stats.node256Count );
+
+    for(int i=0; i<256; ++i)
+    {
+        cr::String k("k");
+        k += cr::String(cr::Uint32(i + 1));
+        ASSERT_TRUE( t.find(k) != NULL );
+        EXPECT_EQ( i, *t.find(k) );
+    }
+
+    for(int i=0; i<250; ++i)
+    {
+        cr::String k("k");
+        k += cr::String(cr::Uint32(i + 1));
+        EXPECT_TRUE( t.erase(k) );
+    }
+
+    stats = t.getStats();
+    EXPECT_EQ( 6, t.getSize() );
+    EXPECT_EQ( 0, stats.node256Count );
+    EXPECT_EQ( 0, stats.node48Count );
+    EXPECT_EQ( 1, stats.node16Count );
+    EXPECT_LT( 0, stats.memoryUsage );
+}
+
+/**
+ * random operations give the same result as std::map
+ */
+TEST(PrefixTrieTest, randomAgainstMap)
+{
+    cr::PrefixTrie<int> t;
+    std::map<cr::String, int> m;
+    std::srand(21);
+
+    for(int i=0; i<20000; ++i)
+    {
+        cr::String k;
+        int length = std::rand() % 6;
+        for(int j=0; j<length; ++j)
+            k += cr::String(cr::Uint32('a' + std::rand() % 4));
+
+        if(std::rand() % 3 == 0)
+        {
+            EXPECT_EQ( m.erase(k) == 1, t.erase(k) );
+        }
+        else
+        {
+            bool inserted = m.find(k) == m.end();
+            m[k] = i;
+            EXPECT_EQ( inserted, t.insert(k, i) );
+        }
+
+        ASSERT_EQ( m.size(), t.getSize() );
+    }
+
+    for(std::map<cr::String, int>::iterator it = m.begin(); it != m.end(); ++it)
+    {
+        ASSERT_TRUE( t.find(it->first) != NULL );
+        EXPECT_EQ( it->second, *t.find(it->first) );
+    }
+
+    std::vector<cr::String> keys;
+    t.forEachWithPrefix(cr::StringView(), KeyCollector(&keys));
+
+    ASSERT_EQ( m.size(), keys.size() );
+
+    std::size_t i = 0;
+    for(std::map<cr::String, int>::iterator it = m.begin(); it != m.end(); ++it, ++i)
+        EXPECT_TRUE( it->first == keys[i] );
+
+    t.clear();
+    EXPECT_TRUE( t.isEmpty() );
+    EXPECT_EQ( 0, t.getStats().node4Count );
+}
@@ -0,0 +1,155 @@
+#include <ReadWriteLock.hpp>
+#include <SeqLock.hpp>
+#include <Thread.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+
+
+namespace
+{
+    /*
+     * Written as a whole : the fields must always match
+     */
+    struct Snapshot
+    {
+        cr::Int64 first;
+        cr::Int64 second;
+        cr::Int32 third;
+    };
+
+    const int ReaderCount = 4;
+    const int Writes = 2000;
+}
+
+/**
+ * Readers never see a write in progress
+ */
+TEST(ReadWriteLockTest, exclusion)
+{
+    cr::ReadWriteLock lock;
+    cr::Int64 values[2] = { 0, 0 };
+    std::atomic<bool> isDone(false);
+    std::atomic<int> mismatches(0);
+    std::atomic<long> reads(0);
+
+    std::vector<cr::Thread*> readers;
+    for (int i = 0; i < ReaderCount; ++i)
+    {
+        readers.push_back(new cr::Thread([&]()
+        {
+            while (!isDone.load())
+            {
+                cr::ReadLock read(lock);
+                if (values[0] != values[1])
+                    ++mismatches;
+                ++reads;
+            }
+        }));
+        readers.back()->launch();
+    }
+
+    for (int i = 1; i <= Writes; ++i)
+    {
+        cr::WriteLock write(lock);
+        values[0] = i;
+        values[1] = i;
+    }
+    isDone = true;
+
+    for (int i = 0; i < ReaderCount; ++i)
+        delete readers[i];
+
+    EXPECT_EQ(0, mismatches.load());
+    EXPECT_EQ(Writes, values[0]);
+}
+
+/**
+ * Try-locks and writer priority
+ */
+TEST(ReadWriteLockTest, tryLock)
+{
+    cr::ReadWriteLock lock;
+
+    EXPECT_TRUE(lock.tryLockShared());
+    EXPECT_TRUE(lock.tryLockShared());
+    lock.unlockShared();
+    lock.unlockShared();
+
+    std::atomic<bool> isWriting(false);
+    lock.lockShared();
+    cr::Thread writer([&]()
+    {
+        cr::WriteLock write(lock);
+        isWriting = true;
+    });
+    writer.launch();
+
+    /*
+     * The waiting writer stops the new readers
+     */
+    while (lock.tryLockShared())
+    {
+        lock.unlockShared();
+        cr::StopToken().sleep(cr::milliseconds(1));
+    }
+    EXPECT_FALSE(isWriting.load());
+
+    lock.unlockShared();
+    writer.wait();
+    EXPECT_TRUE(isWriting.load());
+    EXPECT_TRUE(lock.tryLockShared());
+    lock.unlockShared();
+}
+
+/**
+ * Snapshots are never torn
+ */
+TEST(ReadWriteLockTest, seqLock)
+{
+    Snapshot initial = { 0, 0, 0 };
+    cr::SeqLock<Snapshot> snapshot(initial);
+    EXPECT_EQ(0, snapshot.load().first);
+    cr::Uint64 sequence = snapshot.getSequence();
+
+    std::atomic<bool> isDone(false);
+    std::atomic<int> mismatches(0);
+
+    std::vector<cr::Thread*> readers;
+    for (int i = 0; i < ReaderCount; ++i)
+    {
+        readers.push_back(new cr::Thread([&]()
+        {
+            while (!isDone.load())
+            {
+                Snapshot value = snapshot.load();
+                if (value.first != value.second || value.second != value.third)
+                    ++mismatches;
+            }
+        }));
+        readers.back()->launch();
+    }
+
+    cr::Thread updater([&]()
+    {
+        for (int i = 0; i < Writes; ++i)
+            snapshot.update([](Snapshot& value) { ++value.first; ++value.second; ++value.third; });
+    });
+    updater.launch();
+
+    for (int i = 0; i < Writes; ++i)
+        snapshot.update([](Snapshot& value) { ++value.first; ++value.second; ++value.third; });
+    updater.wait();
+    isDone = true;
+
+    for (int i = 0; i < ReaderCount; ++i)
+        delete readers[i];
+
+    EXPECT_EQ(0, mismatches.load());
+    EXPECT_EQ(2 * Writes, snapshot.load().third);
+    EXPECT_EQ(sequence + 4 * Writes, snapshot.getSequence());
+
+    Snapshot last = { 7, 7, 7 };
+    snapshot.store(last);
+    EXPECT_EQ(7, snapshot.load().second);
+}
@@ -0,0 +1,233 @@
+#include <SpscQueue.hpp>
+#include <SpscRecordQueue.hpp>
+#include <Thread.hpp>
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+
+namespace
+{
+    const int Items = 200000;
+
+    /*
+     * Record of a variable size : its bytes all hold the low byte of its number
+     */
+    std::size_t getRecordSize(int number)
+    {
+        return number % 61;
+    }
+}
+
+/**
+ * Elements come out in order, and the capacity is respected
+ */
+TEST(SpscQueueTest, tryPushPop)
+{
+    cr::SpscQueue<std::string> queue(3);
+    EXPECT_EQ(4u, queue.getCapacity());
+
+    std::string value;
+    EXPECT_FALSE(queue.tryPop(value));
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.tryPush(std::to_string(i)));
+    EXPECT_FALSE(queue.tryPush("4"));
+    EXPECT_EQ(4u, queue.getSize());
+
+    for (int i = 0; i < 12; ++i)
+    {
+        EXPECT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(std::to_string(i), value);
+        EXPECT_TRUE(queue.tryPush(std::to_string(i + 4)));
+    }
+
+    std::string values[6];
+    EXPECT_EQ(4u, queue.tryPopBatch(values, 6));
+    EXPECT_EQ("15", values[3]);
+    EXPECT_EQ(0u, queue.getSize());
+
+    std::string more[6] = { "a", "b", "c", "d", "e", "f" };
+    EXPECT_EQ(4u, queue.tryPushBatch(more, 6));
+    EXPECT_EQ(0u, queue.tryPushBatch(more + 4, 2));
+    EXPECT_EQ(2u, queue.tryPopBatch(values, 2));
+    EXPECT_EQ("b", values[1]);
+}
+
+/**
+ * The elements left are destroyed with the queue
+ */
+TEST(SpscQueueTest, ownership)
+{
+    std::shared_ptr<int> value = std::make_shared<int>(7);
+    {
+        cr::SpscQueue<std::shared_ptr<int> > queue(8);
+        queue.tryPush(value);
+        queue.tryPush(value);
+        EXPECT_EQ(3, value.use_count());
+    }
+    EXPECT_EQ(1, value.use_count());
+}
+
+/**
+ * Everything pushed by one thread is popped by the other, in order
+ */
+TEST(SpscQueueTest, threads)
+{
+    cr::SpscQueue<int> queue(64);
+    int errors = 0;
+
+    cr::Thread consumer([&]()
+    {
+        int expected = 0;
+        int values[16];
+        while (expected < Items)
+        {
+            std::size_t count = queue.tryPopBatch(values, 16);
+            if (count == 0)
+                std::this_thread::yield();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (values[i] != expected)
+                    ++errors;
+                ++expected;
+            }
+        }
+    });
+    consumer.launch();
+
+    for (int i = 0; i < Items; )
+    {
+        if (i % 3 == 0)
+        {
+            int values[5] = { i, i + 1, i + 2, i + 3, i + 4 };
+            i += static_cast<int>(queue.tryPushBatch(values, Items - i < 5 ? Items - i : 5));
+        }
+        else if (queue.tryPush(i))
+        {
+            ++i;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    consumer.wait();
+
+    EXPECT_EQ(0, errors);
+}
+
+/**
+ * Records are read in place, and wrap around the ring
+ */
+TEST(SpscRecordQueueTest, records)
+{
+    cr::SpscRecordQueue queue(100);
+    EXPECT_EQ(56u, queue.getMaximumSize());
+    EXPECT_TRUE(queue.allocate(57) == NULL);
+
+    std::size_t size;
+    EXPECT_TRUE(queue.read(size) == NULL);
+
+    for (int lap = 0; lap < 10; ++lap)
+    {
+        char* record = static_cast<char*>(queue.allocate(20));
+        ASSERT_TRUE(record != NULL);
+        std::memset(record, 'a' + lap, 20);
+        EXPECT_TRUE(queue.write("xyz", 3));
+
+        /*
+         * Published together with the second one
+         */
+        const char* read = static_cast<const char*>(queue.read(size));
+        ASSERT_TRUE(read != NULL);
+        EXPECT_EQ(20u, size);
+        EXPECT_EQ('a' + lap, read[19]);
+        EXPECT_EQ(0u, reinterpret_cast<std::size_t>(read) % 8);
+
+        read = static_cast<const char*>(queue.read(size));
+        ASSERT_TRUE(read != NULL);
+        EXPECT_EQ(3u, size);
+        EXPECT_EQ(0, std::memcmp(read, "xyz", 3));
+
+        EXPECT_TRUE(queue.read(size) == NULL);
+        queue.release();
+    }
+
+    /*
+     * Not published : not visible
+     */
+    EXPECT_TRUE(queue.allocate(8) != NULL);
+    EXPECT_TRUE(queue.read(size) == NULL);
+    queue.publish();
+    EXPECT_TRUE(queue.read(size) != NULL);
+
+    /*
+     * Not released : no room
+     */
+    queue.release();
+    int count = 0;
+    while (queue.allocate(56) != NULL)
+        ++count;
+    EXPECT_TRUE(count == 1 || count == 2);
+
+    queue.publish();
+    while (queue.read(size) != NULL)
+        EXPECT_EQ(56u, size);
+    EXPECT_TRUE(queue.allocate(56) == NULL);
+    queue.release();
+    EXPECT_TRUE(queue.allocate(56) != NULL);
+}
+
+/**
+ * Records of all sizes go through intact
+ */
+TEST(SpscRecordQueueTest, threads)
+{
+    cr::SpscRecordQueue queue(1024);
+    int errors = 0;
+
+    cr::Thread consumer([&]()
+    {
+        int number = 0;
+        while (number < Items)
+        {
+            std::size_t size;
+            while (const void* record = queue.read(size))
+            {
+                const unsigned char* bytes = static_cast<const unsigned char*>(record);
+                if (size != getRecordSize(number))
+                    ++errors;
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    if (bytes[i] != static_cast<unsigned char>(number))
+                        ++errors;
+                }
+                ++number;
+            }
+            queue.release();
+            std::this_thread::yield();
+        }
+    });
+    consumer.launch();
+
+    for (int number = 0; number < Items; )
+    {
+        void* record = queue.allocate(getRecordSize(number));
+        if (record)
+        {
+            std::memset(record, static_cast<unsigned char>(number), getRecordSize(number));
+            ++number;
+        }
+        if (!record || number % 8 == 0)
+            queue.publish();
+        if (!record)
+            std::this_thread::yield();
+    }
+    queue.publish();
+    consumer.wait();
+
+    EXPECT_EQ(0, errors);
+}
@@ -0,0 +1,172 @@
+#include <StopToken.hpp>
+#include <Thread.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+
+namespace
+{
+    void spin(cr::StopToken token, std::atomic<int>* iterations)
+    {
+        while (!token.isStopRequested())
+            ++*iterations;
+    }
+
+    struct Server
+    {
+        Server() : served(0), isStopped(false) {}
+
+        void serve(cr::StopToken token, int limit)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (served < limit && token.wait(lock, notEmpty, [this]() { return !queue.empty(); }))
+            {
+                queue.pop_back();
+                ++served;
+            }
+            isStopped = token.isStopRequested();
+        }
+
+        std::mutex              mutex;
+        std::condition_variable notEmpty;
+        std::vector<int>        queue;
+        int                     served;
+        bool                    isStopped;
+    };
+}
+
+/**
+ * Sources, tokens and their copies share the request
+ */
+TEST(StopTokenTest, request)
+{
+    cr::StopToken none;
+    EXPECT_FALSE(none.isStopPossible());
+    EXPECT_FALSE(none.isStopRequested());
+
+    cr::StopSource empty((cr::NoStopState()));
+    EXPECT_FALSE(empty.isStopPossible());
+    EXPECT_FALSE(empty.requestStop());
+
+    cr::StopSource source;
+    cr::StopToken token = source.getToken();
+    cr::StopToken copy = token;
+    EXPECT_TRUE(copy.isStopPossible());
+    EXPECT_FALSE(copy.isStopRequested());
+
+    EXPECT_TRUE(source.requestStop());
+    EXPECT_FALSE(source.requestStop());
+    EXPECT_TRUE(token.isStopRequested());
+    EXPECT_TRUE(copy.isStopRequested());
+    EXPECT_TRUE(cr::StopSource(source).isStopRequested());
+}
+
+/**
+ * Callbacks run once, at the request or at registration
+ */
+TEST(StopTokenTest, callback)
+{
+    cr::StopSource source;
+    int first = 0;
+    int second = 0;
+    {
+        cr::StopCallback<std::function<void()> > removed(source.getToken(), [&]() { ++second; });
+    }
+    {
+        auto increment = [&]() { ++first; };
+        cr::StopCallback<decltype(increment)> callback(source.getToken(), increment);
+        EXPECT_EQ(0, first);
+
+        source.requestStop();
+        EXPECT_EQ(1, first);
+
+        cr::StopCallback<decltype(increment)> late(source.getToken(), increment);
+        EXPECT_EQ(2, first);
+    }
+    EXPECT_EQ(0, second);
+}
+
+/**
+ * Sleeps and waits end at the request
+ */
+TEST(StopTokenTest, interruptedWaits)
+{
+    cr::StopSource source;
+    cr::StopToken token = source.getToken();
+
+    EXPECT_TRUE(token.sleep(cr::milliseconds(1)));
+
+    cr::Thread stopper([&]() { cr::StopToken().sleep(cr::milliseconds(20)); source.requestStop(); });
+    stopper.launch();
+    EXPECT_FALSE(token.sleep(cr::seconds(60)));
+    stopper.wait();
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::unique_lock<std::mutex> lock(mutex);
+    EXPECT_FALSE(token.wait(lock, condition, []() { return false; }));
+    EXPECT_TRUE(token.wait(lock, condition, []() { return true; }));
+    EXPECT_TRUE(lock.owns_lock());
+
+    cr::StopSource other;
+    EXPECT_FALSE(other.getToken().waitFor(lock, condition, cr::milliseconds(10), []() { return false; }));
+}
+
+/**
+ * Threads get the token, and terminate() joins them
+ */
+TEST(StopTokenTest, thread)
+{
+    std::atomic<int> iterations(0);
+    cr::Thread thread(&spin, &iterations);
+    EXPECT_TRUE(thread.getStopToken().isStopPossible());
+
+    thread.launch();
+    while (iterations.load() == 0)
+        cr::StopToken().sleep(cr::milliseconds(1));
+    EXPECT_TRUE(thread.terminate(cr::seconds(10)));
+    EXPECT_TRUE(thread.getStopToken().isStopRequested());
+
+    /*
+     * Relaunched with a fresh token
+     */
+    thread.launch();
+    EXPECT_FALSE(thread.getStopToken().isStopRequested());
+    thread.terminate();
+
+    Server server;
+    cr::Thread worker(&Server::serve, &server, 2);
+    worker.launch();
+    {
+        std::lock_guard<std::mutex> lock(server.mutex);
+        server.queue.push_back(1);
+        server.notEmpty.notify_one();
+    }
+    worker.terminate();
+    EXPECT_TRUE(server.isStopped || server.served == 1);
+    EXPECT_TRUE(server.queue.empty());
+
+    cr::Thread plain([]() {});
+    EXPECT_FALSE(plain.getStopToken().isStopPossible());
+    EXPECT_FALSE(plain.requestStop());
+}
+
+/**
+ * A function ignoring its token is not killed
+ */
+TEST(StopTokenTest, deadline)
+{
+    std::atomic<bool> release(false);
+    cr::Thread stubborn([&](cr::StopToken) { while (!release.load()) cr::StopToken().sleep(cr::milliseconds(1)); });
+    stubborn.launch();
+
+    EXPECT_FALSE(stubborn.terminate(cr::milliseconds(20)));
+
+    release = true;
+    EXPECT_TRUE(stubborn.terminate(cr::seconds(10)));
+    EXPECT_TRUE(stubborn.terminate(cr::Time::Zero));
+}
@@ -0,0 +1,216 @@
+#include <StringBuilder.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+
+/**
+ * Default constructor
+ */
+TEST(StringBuilderTest, ConstructorDefault)
+{
+    cr::StringBuilder b;
+
+    EXPECT_TRUE( b.isEmpty() );
+    EXPECT_EQ( 0, b.getSize() );
+    EXPECT_TRUE( b.build().isEmpty() );
+}
+
+/**
+ * Construct with a reserved capacity
+ */
+TEST(StringBuilderTest, ConstructorCapacity)
+{
+    cr::StringBuilder b(1000);
+
+    EXPECT_TRUE( b.isEmpty() );
+    EXPECT_LE( 1000, b.getCapacity() );
+}
+
+/**
+ * Append characters of every kind
+ */
+TEST(StringBuilderTest, appendCharacters)
+{
+    cr::StringBuilder b;
+
+    b.append('a').append(L'b').append(cr::Uint32('c'));
+
+    EXPECT_EQ( 3, b.getSize() );
+    EXPECT_STREQ( "abc", b.toString().toAnsiString().c_str() );
+}
+
+/**
+ * Append strings of every kind
+ */
+TEST(StringBuilderTest, appendStrings)
+{
+    cr::StringBuilder b;
+    cr::String s("string ");
+
+    b.append("This is a ").append(std::string("test ")).append(s);
+    b.append(static_cast<const char*>(NULL));
+
+    EXPECT_STREQ( "This is a test string ", b.toString().toAnsiString().c_str() );
+}
+
+/**
+ * Append UTF-8 and UTF-16 spans
+ */
+TEST(StringBuilderTest, appendUtf)
+{
+    /* "a", U+00E9, U+AC00, U+1F600 */
+    const char utf8[] = "a\xC3\xA9\xEA\xB0\x80\xF0\x9F\x98\x80";
+    const cr::Uint16 utf16[] = { 0x0061, 0x00E9, 0xAC00, 0xD83D, 0xDE00 };
+
+    cr::StringBuilder b;
+    b.appendUtf8(utf8, std::strlen(utf8));
+
+    ASSERT_EQ( 4, b.getSize() );
+    EXPECT_EQ( 0x61,    b.getData()[0] );
+    EXPECT_EQ( 0xE9,    b.getData()[1] );
+    EXPECT_EQ( 0xAC00,  b.getData()[2] );
+    EXPECT_EQ( 0x1F600, b.getData()[3] );
+
+    cr::StringBuilder b1;
+    b1.appendUtf16(utf16, utf16 + 5);
+
+    EXPECT_TRUE( b.toString() == b1.toString() );
+
+    /*
+     * incomplete trailing sequence is replaced
+     */
+    cr::StringBuilder b2;
+    b2.appendUtf8(utf8, 4);
+
+    ASSERT_EQ( 3, b2.getSize() );
+    EXPECT_EQ( 0xFFFD, b2.getData()[2] );
+}
+
+/**
+ * Append long UTF-8 spans, ASCII runs mixed with other characters
+ */
+TEST(StringBuilderTest, appendUtf8Bulk)
+{
+    std::string utf8;
+    std::basic_string<cr::Uint32> expected;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        std::size_t run = i % 37;
+        for (std::size_t j = 0; j < run; ++j)
+        {
+            utf8 += static_cast<char>('a' + j % 26);
+            expected += static_cast<cr::Uint32>('a' + j % 26);
+        }
+
+        utf8 += "\xEA\xB0\x80";
+        expected += 0xAC00;
+    }
+
+    cr::StringBuilder b;
+    b.append('>');
+    b.appendUtf8(utf8.data(), utf8.size());
+
+    ASSERT_EQ( expected.size() + 1, b.getSize() );
+    EXPECT_EQ( '>', b.getData()[0] );
+    EXPECT_TRUE( std::equal(expected.begin(), expected.end(), b.getData() + 1) );
+
+    /*
+     * Malformed and truncated sequences are replaced, the next byte is kept
+     */
+    std::string malformed("0123456789abcdef" "a\xE9" "bc\xE9");
+    cr::StringBuilder m;
+    m.appendUtf8(malformed.data(), malformed.size());
+
+    ASSERT_EQ( 21u, m.getSize() );
+    EXPECT_EQ( cr::Uint32('a'), m.getData()[16] );
+    EXPECT_EQ( 0xFFFDu, m.getData()[17] );
+    EXPECT_EQ( cr::Uint32('b'), m.getData()[18] );
+    EXPECT_EQ( cr::Uint32('c'), m.getData()[19] );
+    EXPECT_EQ( 0xFFFDu, m.getData()[20] );
+}
+
+/**
+ * Append numbers
+ */
+TEST(StringBuilderTest, appendNumber)
+{
+    cr::StringBuilder b;
+
+    b.appendNumber(0).append(' ');
+    b.appendNumber(-123).append(' ');
+    b.appendNumber(cr::Uint32(4000000000u)).append(' ');
+    b.appendNumber(static_cast<cr::Int64>(-9223372036854775807LL - 1)).append(' ');
+    b.appendNumber(static_cast<cr::Uint64>(18446744073709551615ULL)).append(' ');
+    b.appendNumber(std::size_t(42)).append(' ');
+    b.appendNumber(0.5);
+
+    EXPECT_STREQ( "0 -123 4000000000 -9223372036854775808 18446744073709551615 42 0.5",
+                  b.toString().toAnsiString().c_str() );
+}
+
+/**
+ * Fill with a repeated character
+ */
+TEST(StringBuilderTest, appendFill)
+{
+    cr::StringBuilder b;
+    b.appendFill(3, '-').append('>');
+
+    EXPECT_STREQ( "--->", b.toString().toAnsiString().c_str() );
+}
+
+/**
+ * Capacity control
+ */
+TEST(StringBuilderTest, capacity)
+{
+    cr::StringBuilder b;
+
+    b.reserve(100);
+    EXPECT_LE( 100, b.getCapacity() );
+
+    b.reserve(10);
+    EXPECT_LE( 100, b.getCapacity() );
+
+    b.append("abc");
+    b.shrinkToFit();
+    EXPECT_GE( 100, b.getCapacity() );
+    EXPECT_STREQ( "abc", b.toString().toAnsiString().c_str() );
+
+    /*
+     * capacity grows geometrically
+     */
+    std::size_t capacity = b.getCapacity();
+    b.appendFill(capacity - b.getSize() + 1, 'x');
+    EXPECT_LE( capacity * 2, b.getCapacity() );
+
+    b.clear();
+    EXPECT_TRUE( b.isEmpty() );
+    EXPECT_LE( capacity * 2, b.getCapacity() );
+}
+
+/**
+ * Move the content out
+ */
+TEST(StringBuilderTest, build)
+{
+    cr::StringBuilder b;
+
+    for(int i=0; i<1000; ++i)
+        b.append('a');
+
+    const cr::Uint32 * data = b.getData();
+    cr::String s = b.build();
+
+    EXPECT_EQ( 1000, s.getSize() );
+    EXPECT_EQ( data, s.getData() );
+    EXPECT_TRUE( b.isEmpty() );
+    EXPECT_EQ( 0, b.getSize() );
+
+    b.append("reuse");
+    EXPECT_STREQ( "reuse", b.build().toAnsiString().c_str() );
+}
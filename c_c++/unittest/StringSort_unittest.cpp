@@ -0,0 +1,119 @@
+#include <StringSort.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+
+/**
+ * Generate strings sharing prefixes, with duplicates
+ * and non-ASCII characters
+ */
+static std::vector<cr::String> makeStrings(std::size_t count)
+{
+    std::vector<cr::String> strings;
+    std::srand(21);
+
+    for(std::size_t i=0; i<count; ++i)
+    {
+        cr::String s("/usr/share/");
+        int length = std::rand() % 12;
+
+        for(int j=0; j<length; ++j)
+        {
+            int r = std::rand() % 6;
+            s += cr::String(r == 0 ? cr::Uint32(0xAC00 + std::rand() % 3)
+                                   : cr::Uint32('a' + r));
+        }
+
+        strings.push_back(s);
+    }
+
+    return strings;
+}
+
+/**
+ * Empty and single element vectors
+ */
+TEST(StringSortTest, trivial)
+{
+    std::vector<cr::String> strings;
+    cr::sortStrings(strings);
+
+    EXPECT_TRUE( strings.empty() );
+
+    strings.push_back("a");
+    cr::sortStrings(strings);
+
+    EXPECT_EQ( 1, strings.size() );
+}
+
+/**
+ * Same order as std::sort with operator <
+ */
+TEST(StringSortTest, sameOrderAsStdSort)
+{
+    std::vector<cr::String> strings = makeStrings(5000);
+    std::vector<cr::String> expected = strings;
+
+    std::sort(expected.begin(), expected.end());
+    cr::sortStrings(strings);
+
+    ASSERT_EQ( expected.size(), strings.size() );
+    EXPECT_TRUE( expected == strings );
+}
+
+/**
+ * Prefixes and empty strings are ordered first
+ */
+TEST(StringSortTest, prefixes)
+{
+    std::vector<cr::String> strings;
+    strings.push_back("abc");
+    strings.push_back("ab");
+    strings.push_back("");
+    strings.push_back("abcd");
+    strings.push_back("a");
+
+    cr::sortStrings(strings);
+
+    EXPECT_TRUE( strings[0].isEmpty() );
+    EXPECT_STREQ( "a",    strings[1].toAnsiString().c_str() );
+    EXPECT_STREQ( "ab",   strings[2].toAnsiString().c_str() );
+    EXPECT_STREQ( "abc",  strings[3].toAnsiString().c_str() );
+    EXPECT_STREQ( "abcd", strings[4].toAnsiString().c_str() );
+}
+
+/**
+ * Sort views without touching the strings
+ */
+TEST(StringSortTest, views)
+{
+    std::vector<cr::String> strings = makeStrings(3000);
+    std::vector<cr::StringView> views(strings.begin(), strings.end());
+
+    cr::sortStrings(views);
+
+    EXPECT_TRUE( std::is_sorted(views.begin(), views.end()) );
+}
+
+/**
+ * Parallel mode gives the same result
+ */
+TEST(StringSortTest, parallel)
+{
+    std::vector<cr::String> strings = makeStrings(200000);
+    std::vector<cr::String> expected = strings;
+
+    std::sort(expected.begin(), expected.end());
+    cr::sortStrings(strings, 4);
+
+    EXPECT_TRUE( expected == strings );
+
+    std::vector<cr::StringView> views(expected.begin(), expected.end());
+    std::random_shuffle(views.begin(), views.end());
+    cr::sortStrings(views, 0);
+
+    EXPECT_TRUE( std::is_sorted(views.begin(), views.end()) );
+}
@@ -0,0 +1,71 @@
+#include <StringView.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+
+
+/**
+ * Default constructor
+ */
+TEST(StringViewTest, ConstructorDefault)
+{
+    cr::StringView v;
+
+    EXPECT_TRUE( v.isEmpty() );
+    EXPECT_EQ( 0, v.getSize() );
+}
+
+/**
+ * Construct from a String and from raw characters
+ */
+TEST(StringViewTest, ConstructorFromString)
+{
+    cr::String s("This is a test string");
+    cr::StringView v(s);
+
+    EXPECT_EQ( s.getSize(), v.getSize() );
+    EXPECT_EQ( s.getData(), v.getData() );
+    EXPECT_TRUE( v.toString() == s );
+
+    cr::StringView v1(s.getData());
+    EXPECT_TRUE( v1 == v );
+
+    cr::StringView v2(s.getData(), 4);
+    EXPECT_STREQ( "This", v2.toString().toAnsiString().c_str() );
+}
+
+/**
+ * substring, startsWith and find
+ */
+TEST(StringViewTest, substringAndFind)
+{
+    cr::String s("hello world");
+    cr::String w("world");
+    cr::StringView v(s);
+
+    EXPECT_TRUE( v.substring(6) == cr::StringView(w) );
+    EXPECT_TRUE( v.substring(6, 100) == cr::StringView(w) );
+    EXPECT_TRUE( v.substring(100).isEmpty() );
+
+    EXPECT_TRUE( v.startsWith(v.substring(0, 5)) );
+    EXPECT_FALSE( v.startsWith(cr::StringView(w)) );
+
+    EXPECT_EQ( 6, v.find(cr::StringView(w)) );
+    EXPECT_EQ( cr::StringView::InvalidPos, v.find(cr::StringView(w), 7) );
+}
+
+/**
+ * comparison operators give the same order as String
+ */
+TEST(StringViewTest, comparison)
+{
+    cr::String a("abc");
+    cr::String b("abd");
+    cr::String c("ab");
+
+    EXPECT_TRUE( cr::StringView(a) < cr::StringView(b) );
+    EXPECT_TRUE( cr::StringView(c) < cr::StringView(a) );
+    EXPECT_TRUE( cr::StringView(a) > cr::StringView(c) );
+    EXPECT_TRUE( cr::StringView(a) <= cr::StringView(a) );
+    EXPECT_TRUE( cr::StringView(a) != cr::StringView(b) );
+    EXPECT_EQ( a < b, cr::StringView(a) < cr::StringView(b) );
+}
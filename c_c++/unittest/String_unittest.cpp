@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 #include <cstring>
 #include <cwchar>
+#include <sstream>
 
 #include <iostream>
 
@@ -810,3 +811,123 @@ TEST(StringTest, onePlus)
     s3 = s1 + ss;
     EXPECT_STREQ( s.toAnsiString().c_str(), s3.toAnsiString().c_str() );
 }
+
+/**
+ * output stream operator
+ */
+TEST(StringTest, outputStream)
+{
+    /* "a", U+00E9, U+AC00, U+1F600 */
+    const char * utf8 = "a\xC3\xA9\xEA\xB0\x80\xF0\x9F\x98\x80";
+    cr::String s = cr::String::fromUtf8(utf8, utf8 + strlen(utf8));
+
+    std::ostringstream os;
+    os << s;
+
+    EXPECT_STREQ( utf8, os.str().c_str() );
+
+    std::ostringstream os1;
+    os1.width(6);
+    os1 << cr::String("abc") << "|";
+    os1.width(6);
+    os1 << std::left << cr::String("abc") << "|";
+
+    EXPECT_STREQ( "   abc|abc   |", os1.str().c_str() );
+
+    /*
+     * longer than the internal chunk
+     */
+    std::string big(5000, 'x');
+    big += utf8;
+
+    std::ostringstream os2;
+    os2 << cr::String::fromUtf8(big.begin(), big.end());
+
+    EXPECT_TRUE( big == os2.str() );
+}
+
+/**
+ * input stream operator
+ */
+TEST(StringTest, inputStream)
+{
+    std::istringstream is("  hello \xC3\xA9t\xC3\xA9\t\xF0\x9F\x98\x80");
+    cr::String s1, s2, s3, s4;
+
+    is >> s1 >> s2 >> s3;
+
+    EXPECT_STREQ( "hello", s1.toAnsiString().c_str() );
+    ASSERT_EQ( 3, s2.getSize() );
+    EXPECT_EQ( 0xE9, s2[0] );
+    EXPECT_EQ( 't',  s2[1] );
+    EXPECT_EQ( 0xE9, s2[2] );
+    ASSERT_EQ( 1, s3.getSize() );
+    EXPECT_EQ( 0x1F600, s3[0] );
+    EXPECT_TRUE( is.eof() );
+
+    is >> s4;
+    EXPECT_TRUE( is.fail() );
+
+    /*
+     * width bounds the number of characters
+     */
+    std::istringstream is1("abcdef");
+    is1.width(4);
+    is1 >> s1;
+
+    EXPECT_STREQ( "abcd", s1.toAnsiString().c_str() );
+
+    /*
+     * round trip of a word longer than the internal chunk
+     */
+    cr::String big;
+    for(int i=0; i<1000; ++i)
+        big += cr::String(cr::Uint32(0xAC00 + i));
+
+    std::stringstream ss;
+    ss << big;
+    ss >> s1;
+
+    EXPECT_TRUE( big == s1 );
+
+    /*
+     * each malformed sequence gives one U+FFFD, counted by width
+     */
+    std::istringstream is2("\xff\xfe rest a\xC3 \xE2\x82x");
+    is2 >> s1 >> s2 >> s3 >> s4;
+
+    ASSERT_EQ( 2, s1.getSize() );
+    EXPECT_EQ( 0xFFFD, s1[0] );
+    EXPECT_EQ( 0xFFFD, s1[1] );
+    EXPECT_STREQ( "rest", s2.toAnsiString().c_str() );
+    ASSERT_EQ( 2, s3.getSize() );
+    EXPECT_EQ( 'a',    s3[0] );
+    EXPECT_EQ( 0xFFFD, s3[1] );
+    ASSERT_EQ( 2, s4.getSize() );
+    EXPECT_EQ( 0xFFFD, s4[0] );
+    EXPECT_EQ( 'x',    s4[1] );
+    EXPECT_FALSE( is2.fail() );
+
+    /*
+     * overlong form, surrogate, past U+10FFFF : rejected
+     */
+    std::istringstream is4("\xC0\xAFx \xED\xA0\x80 \xF4\x90\x80\x80");
+    is4 >> s1 >> s2 >> s3;
+
+    ASSERT_EQ( 3, s1.getSize() );
+    EXPECT_EQ( 0xFFFD, s1[0] );
+    EXPECT_EQ( 0xFFFD, s1[1] );
+    EXPECT_EQ( 'x',    s1[2] );
+    ASSERT_EQ( 3, s2.getSize() );
+    EXPECT_EQ( 0xFFFD, s2[0] );
+    ASSERT_EQ( 4, s3.getSize() );
+    EXPECT_EQ( 0xFFFD, s3[3] );
+
+    std::istringstream is3("\xff\xfe\xfd" "abc");
+    is3.width(2);
+    is3 >> s1;
+
+    ASSERT_EQ( 2, s1.getSize() );
+    EXPECT_EQ( 0xFFFD, s1[0] );
+    EXPECT_EQ( 0xFFFD, s1[1] );
+}
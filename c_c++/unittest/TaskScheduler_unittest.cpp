@@ -0,0 +1,214 @@
+#include <TaskScheduler.hpp>
+#include <WorkStealingDeque.hpp>
+#include <Thread.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+
+namespace
+{
+    long fibonacci(cr::TaskScheduler& scheduler, int n)
+    {
+        if (n < 12)
+            return n < 2 ? n : fibonacci(scheduler, n - 1) + fibonacci(scheduler, n - 2);
+
+        long a = 0;
+        long b = 0;
+        cr::TaskGroup group(scheduler);
+        group.spawn([&]() { a = fibonacci(scheduler, n - 1); });
+        b = fibonacci(scheduler, n - 2);
+        group.sync();
+
+        return a + b;
+    }
+
+    /*
+     * Thief taking elements until told to stop
+     */
+    struct Thief
+    {
+        cr::WorkStealingDeque<int*>* deque;
+        std::atomic<bool>*           isDone;
+        std::vector<int*>            stolen;
+
+        void run()
+        {
+            int* value;
+            while (!isDone->load())
+            {
+                if (deque->steal(value))
+                    stolen.push_back(value);
+            }
+            while (deque->steal(value))
+                stolen.push_back(value);
+        }
+    };
+}
+
+/**
+ * Owner operations : LIFO at the bottom, growth, FIFO steals
+ */
+TEST(WorkStealingDequeTest, singleThread)
+{
+    cr::WorkStealingDeque<int*> deque(2);
+    int values[100];
+
+    int* value;
+    EXPECT_TRUE(deque.isEmpty());
+    EXPECT_FALSE(deque.pop(value));
+    EXPECT_FALSE(deque.steal(value));
+
+    for (int i = 0; i < 100; ++i)
+        deque.push(&values[i]);
+    EXPECT_EQ(100u, deque.getSize());
+
+    EXPECT_TRUE(deque.pop(value));
+    EXPECT_EQ(&values[99], value);
+    EXPECT_TRUE(deque.steal(value));
+    EXPECT_EQ(&values[0], value);
+
+    for (int i = 98; i >= 1; --i)
+    {
+        EXPECT_TRUE(deque.pop(value));
+        EXPECT_EQ(&values[i], value);
+    }
+    EXPECT_FALSE(deque.pop(value));
+    EXPECT_TRUE(deque.isEmpty());
+}
+
+/**
+ * Every element is taken exactly once, by the owner or a thief
+ */
+TEST(WorkStealingDequeTest, concurrentSteals)
+{
+    const int Count = 200000;
+    std::vector<int> values(Count);
+
+    cr::WorkStealingDeque<int*> deque(16);
+    std::atomic<bool> isDone(false);
+
+    Thief thieves[3];
+    std::vector<cr::Thread*> threads;
+    for (int i = 0; i < 3; ++i)
+    {
+        thieves[i].deque = &deque;
+        thieves[i].isDone = &isDone;
+        threads.push_back(new cr::Thread(&Thief::run, &thieves[i]));
+        threads.back()->launch();
+    }
+
+    std::vector<int*> popped;
+    for (int i = 0; i < Count; ++i)
+    {
+        deque.push(&values[i]);
+
+        int* value;
+        if (i % 3 == 0 && deque.pop(value))
+            popped.push_back(value);
+    }
+
+    int* value;
+    while (deque.pop(value))
+        popped.push_back(value);
+
+    isDone = true;
+    std::set<int*> all(popped.begin(), popped.end());
+    std::size_t total = popped.size();
+    for (int i = 0; i < 3; ++i)
+    {
+        delete threads[i];
+        all.insert(thieves[i].stolen.begin(), thieves[i].stolen.end());
+        total += thieves[i].stolen.size();
+    }
+
+    EXPECT_EQ(static_cast<std::size_t>(Count), total);
+    EXPECT_EQ(static_cast<std::size_t>(Count), all.size());
+}
+
+/**
+ * Recursive fork/join
+ */
+TEST(TaskSchedulerTest, fibonacci)
+{
+    cr::TaskScheduler scheduler(4);
+    EXPECT_EQ(4u, scheduler.getThreadCount());
+    long result = 0;
+    scheduler.run([&]() { result = fibonacci(scheduler, 25); });
+    EXPECT_EQ(75025, result);
+
+    /*
+     * Also from a thread which is not a worker
+     */
+    cr::TaskScheduler single(1);
+    EXPECT_EQ(6765, fibonacci(single, 20));
+    EXPECT_THROW(single.run([]() { throw std::runtime_error("root"); }), std::runtime_error);
+}
+
+/**
+ * Many tasks spawned from an outside thread, and a group reused
+ */
+TEST(TaskSchedulerTest, flatGroup)
+{
+    cr::TaskScheduler scheduler(3);
+    std::atomic<int> count(0);
+
+    cr::TaskGroup group(scheduler);
+    for (int round = 1; round <= 3; ++round)
+    {
+        for (int i = 0; i < 10000; ++i)
+            group.spawn([&count]() { ++count; });
+        group.sync();
+        EXPECT_EQ(round * 10000, count.load());
+    }
+}
+
+/**
+ * Tasks spawning into their own group
+ */
+TEST(TaskSchedulerTest, nestedSpawn)
+{
+    cr::TaskScheduler scheduler(2);
+    std::atomic<int> count(0);
+
+    cr::TaskGroup group(scheduler);
+    for (int i = 0; i < 100; ++i)
+    {
+        group.spawn([&]()
+        {
+            for (int j = 0; j < 10; ++j)
+                group.spawn([&count]() { ++count; });
+        });
+    }
+    group.sync();
+
+    EXPECT_EQ(1000, count.load());
+}
+
+/**
+ * The first exception is rethrown by sync
+ */
+TEST(TaskSchedulerTest, exception)
+{
+    cr::TaskScheduler scheduler(2);
+    std::atomic<int> count(0);
+
+    cr::TaskGroup group(scheduler);
+    for (int i = 0; i < 100; ++i)
+    {
+        group.spawn([i, &count]()
+        {
+            ++count;
+            if (i == 50)
+                throw std::runtime_error("task");
+        });
+    }
+
+    EXPECT_THROW(group.sync(), std::runtime_error);
+    EXPECT_EQ(100, count.load());
+
+    group.spawn([&count]() { ++count; });
+    EXPECT_NO_THROW(group.sync());
+}
@@ -0,0 +1,252 @@
+#include <TextReader.hpp>
+#include <String.hpp>
+#include <Utf.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+
+namespace
+{
+    /*
+     * Encode UTF-32 characters in a given encoding
+     */
+    std::string encode(const std::basic_string<cr::Uint32>& chars, cr::TextEncoding encoding)
+    {
+        std::string bytes;
+
+        for (std::size_t i = 0; i < chars.size(); ++i)
+        {
+            cr::Uint32 c = chars[i];
+
+            if (encoding == cr::UTF8)
+            {
+                cr::Utf8::encode(c, std::back_inserter(bytes));
+            }
+            else if (encoding == cr::UTF16LE || encoding == cr::UTF16BE)
+            {
+                cr::Uint16 units[2];
+                std::size_t count = cr::Utf16::encode(c, units) - units;
+                for (std::size_t j = 0; j < count; ++j)
+                {
+                    char low = static_cast<char>(units[j] & 0xFF);
+                    char high = static_cast<char>(units[j] >> 8);
+                    bytes += encoding == cr::UTF16LE ? low : high;
+                    bytes += encoding == cr::UTF16LE ? high : low;
+                }
+            }
+            else
+            {
+                for (int j = 0; j < 4; ++j)
+                {
+                    int shift = encoding == cr::UTF32LE ? 8 * j : 24 - 8 * j;
+                    bytes += static_cast<char>((c >> shift) & 0xFF);
+                }
+            }
+        }
+
+        return bytes;
+    }
+
+    std::basic_string<cr::Uint32> utf32(const char* ascii)
+    {
+        return std::basic_string<cr::Uint32>(ascii, ascii + std::char_traits<char>::length(ascii));
+    }
+
+    /*
+     * Temporary file, removed at the end of the test
+     */
+    class TemporaryFile
+    {
+    public:
+        explicit TemporaryFile(const std::string& content)
+        {
+            char name[64];
+            std::snprintf(name, sizeof(name), "/tmp/cr_text_reader_%d.txt", static_cast<int>(getpid()));
+            m_name = name;
+
+            std::ofstream file(m_name.c_str(), std::ios::binary);
+            file.write(content.data(), content.size());
+        }
+
+        ~TemporaryFile()
+        {
+            std::remove(m_name.c_str());
+        }
+
+        const std::string& getName() const
+        {
+            return m_name;
+        }
+
+    private:
+        std::string m_name;
+    };
+
+    std::vector<cr::String> readLines(const std::string& content, cr::TextEncoding fallback = cr::UTF8)
+    {
+        TemporaryFile file(content);
+        cr::TextReader reader(file.getName(), fallback);
+
+        std::vector<cr::String> lines;
+        cr::StringView line;
+        while (reader.readLine(line))
+            lines.push_back(line.toString());
+
+        return lines;
+    }
+}
+
+/**
+ * Lines end with LF or CR LF, the last one may have no end of line
+ */
+TEST(TextReaderTest, lines)
+{
+    std::vector<cr::String> lines = readLines("first\nsecond\r\n\nlast");
+
+    ASSERT_EQ( 4u, lines.size() );
+    EXPECT_TRUE( lines[0] == cr::String("first") );
+    EXPECT_TRUE( lines[1] == cr::String("second") );
+    EXPECT_TRUE( lines[2].isEmpty() );
+    EXPECT_TRUE( lines[3] == cr::String("last") );
+
+    EXPECT_EQ( 2u, readLines("a\nb\n").size() );
+    EXPECT_EQ( 0u, readLines("").size() );
+    EXPECT_EQ( 1u, readLines("\n").size() );
+}
+
+/**
+ * The encoding comes from the byte order mark
+ */
+TEST(TextReaderTest, bom)
+{
+    const cr::TextEncoding encodings[] = { cr::UTF8, cr::UTF16LE, cr::UTF16BE, cr::UTF32LE, cr::UTF32BE };
+
+    std::basic_string<cr::Uint32> text = utf32("caf?\nline ?\n");
+    text[3] = 0xE9;
+    text[10] = 0x1F600;
+
+    for (std::size_t i = 0; i < sizeof(encodings) / sizeof(encodings[0]); ++i)
+    {
+        std::basic_string<cr::Uint32> marked(1, 0xFEFF);
+        marked += text;
+
+        TemporaryFile file(encode(marked, encodings[i]));
+        cr::TextReader reader(file.getName());
+        ASSERT_TRUE( reader.isOpen() );
+
+        cr::StringView line;
+        ASSERT_TRUE( reader.readLine(line) );
+        EXPECT_EQ( encodings[i], reader.getEncoding() );
+        EXPECT_TRUE( reader.hasBom() );
+        ASSERT_EQ( 4u, line.getSize() );
+        EXPECT_EQ( 0xE9u, line[3] );
+
+        ASSERT_TRUE( reader.readLine(line) );
+        ASSERT_EQ( 6u, line.getSize() );
+        EXPECT_EQ( 0x1F600u, line[5] );
+
+        EXPECT_FALSE( reader.readLine(line) );
+        EXPECT_EQ( 2u, reader.getLineCount() );
+    }
+
+    /* no byte order mark : the fallback is used */
+    TemporaryFile file(encode(utf32("abc\n"), cr::UTF16BE));
+    cr::TextReader reader(file.getName(), cr::UTF16BE);
+
+    cr::StringView line;
+    ASSERT_TRUE( reader.readLine(line) );
+    EXPECT_FALSE( reader.hasBom() );
+    EXPECT_EQ( cr::UTF16BE, reader.getEncoding() );
+    EXPECT_TRUE( line.toString() == cr::String("abc") );
+}
+
+/**
+ * Characters and lines split across blocks
+ */
+TEST(TextReaderTest, blocks)
+{
+    const cr::TextEncoding encodings[] = { cr::UTF8, cr::UTF16LE, cr::UTF32BE };
+
+    std::basic_string<cr::Uint32> text;
+    std::vector<std::size_t> sizes;
+    for (std::size_t i = 0; text.size() < 1500000; ++i)
+    {
+        std::size_t size = i % 1000;
+        for (std::size_t j = 0; j < size; ++j)
+        {
+            static const cr::Uint32 chars[] = { 'a', 0xE9, 0xAC00, 0x1F600, 'z' };
+            text += chars[(i + j) % 5];
+        }
+        text += '\n';
+        sizes.push_back(size);
+    }
+
+    for (std::size_t i = 0; i < sizeof(encodings) / sizeof(encodings[0]); ++i)
+    {
+        std::vector<cr::String> lines = readLines(encode(text, encodings[i]), encodings[i]);
+
+        ASSERT_EQ( sizes.size(), lines.size() );
+
+        std::size_t position = 0;
+        for (std::size_t j = 0; j < lines.size(); ++j)
+        {
+            ASSERT_EQ( sizes[j], lines[j].getSize() );
+            ASSERT_TRUE( std::equal(lines[j].begin(), lines[j].end(), text.begin() + position) );
+            position += sizes[j] + 1;
+        }
+    }
+}
+
+/**
+ * Truncated characters at the end of the file, missing file
+ */
+TEST(TextReaderTest, errors)
+{
+    std::vector<cr::String> lines = readLines("ab\xEA\xB0");
+    ASSERT_EQ( 1u, lines.size() );
+    ASSERT_EQ( 3u, lines[0].getSize() );
+    EXPECT_EQ( 0xFFFDu, lines[0][2] );
+
+    lines = readLines(std::string("a\0b", 3), cr::UTF16LE);
+    ASSERT_EQ( 1u, lines.size() );
+    ASSERT_EQ( 2u, lines[0].getSize() );
+    EXPECT_EQ( 0xFFFDu, lines[0][1] );
+
+    /*
+     * Malformed sequences : one U+FFFD each, no line lost
+     */
+    lines = readLines("caf\xE9\nnext\n\xED\xA0\x80\xC3\nlast\n");
+    ASSERT_EQ( 4u, lines.size() );
+    ASSERT_EQ( 4u, lines[0].getSize() );
+    EXPECT_EQ( 0xFFFDu, lines[0][3] );
+    EXPECT_TRUE( lines[1] == cr::String("next") );
+    ASSERT_EQ( 4u, lines[2].getSize() );
+    EXPECT_EQ( 0xFFFDu, lines[2][0] );
+    EXPECT_EQ( 0xFFFDu, lines[2][3] );
+    EXPECT_TRUE( lines[3] == cr::String("last") );
+
+    /* unpaired surrogates before a line end, then a lone low surrogate */
+    lines = readLines(std::string("a\0\x3D\xD8\n\0\0\xDC\x0A\0", 10), cr::UTF16LE);
+    ASSERT_EQ( 2u, lines.size() );
+    ASSERT_EQ( 2u, lines[0].getSize() );
+    EXPECT_EQ( 0xFFFDu, lines[0][1] );
+    ASSERT_EQ( 1u, lines[1].getSize() );
+    EXPECT_EQ( 0xFFFDu, lines[1][0] );
+
+    lines = readLines(std::string("\0\x11\0\0\0\0\0\x0A", 8), cr::UTF32BE);
+    ASSERT_EQ( 1u, lines.size() );
+    ASSERT_EQ( 1u, lines[0].getSize() );
+    EXPECT_EQ( 0xFFFDu, lines[0][0] );
+
+    cr::TextReader reader;
+    cr::StringView line;
+    EXPECT_FALSE( reader.open("/nonexistent/cr_text_reader.txt") );
+    EXPECT_FALSE( reader.isOpen() );
+    EXPECT_FALSE( reader.readLine(line) );
+}
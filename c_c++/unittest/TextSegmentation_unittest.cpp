@@ -0,0 +1,153 @@
+#include <TextSegmentation.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    std::vector<std::size_t> graphemes(const cr::String& text)
+    {
+        std::vector<std::size_t> ends;
+        cr::GraphemeIterator it(text);
+        while (it.next())
+            ends.push_back(it.getEnd());
+        return ends;
+    }
+
+    std::vector<std::size_t> graphemes(const std::string& utf8)
+    {
+        std::vector<std::size_t> ends;
+        cr::GraphemeIterator it(utf8.data(), utf8.size());
+        while (it.next())
+            ends.push_back(it.getEnd());
+        return ends;
+    }
+
+    std::vector<std::string> words(const std::string& utf8)
+    {
+        std::vector<std::string> result;
+        cr::WordIterator it(utf8.data(), utf8.size());
+        while (it.next())
+        {
+            if (it.isWord())
+                result.push_back(utf8.substr(it.getBegin(), it.getEnd() - it.getBegin()));
+        }
+        return result;
+    }
+
+    std::vector<std::size_t> segments(const cr::String& text)
+    {
+        std::vector<std::size_t> ends;
+        cr::WordIterator it(text);
+        while (it.next())
+            ends.push_back(it.getEnd());
+        return ends;
+    }
+}
+
+/**
+ * grapheme clusters
+ */
+TEST(TextSegmentationTest, grapheme)
+{
+    EXPECT_TRUE( graphemes(cr::String()).empty() );
+    EXPECT_EQ( 3u, graphemes(cr::String("abc")).size() );
+
+    /* CR LF is a single cluster */
+    EXPECT_EQ( (std::vector<std::size_t>{ 1, 3, 4 }), graphemes(cr::String("a\r\nb")) );
+
+    /* letter and combining marks */
+    const cr::Uint32 accents[] = { 'e', 0x0301, 0x0323, 'x', 0 };
+    EXPECT_EQ( (std::vector<std::size_t>{ 3, 4 }), graphemes(cr::String(accents)) );
+
+    /* Hangul jamos : L V T, then L V */
+    const cr::Uint32 jamos[] = { 0x1112, 0x1161, 0x11AB, 0x1100, 0x1173, 0 };
+    EXPECT_EQ( (std::vector<std::size_t>{ 3, 5 }), graphemes(cr::String(jamos)) );
+
+    /* flags : regional indicators pair up */
+    const cr::Uint32 flags[] = { 0x1F1EB, 0x1F1F7, 0x1F1F0, 0x1F1F7, 0x1F1E6, 0 };
+    EXPECT_EQ( (std::vector<std::size_t>{ 2, 4, 5 }), graphemes(cr::String(flags)) );
+
+    /* emoji ZWJ sequence (family) and skin tone modifier */
+    const cr::Uint32 family[] = { 0x1F468, 0x200D, 0x1F469, 0x200D, 0x1F467, 0x1F44D, 0x1F3FD, 0 };
+    EXPECT_EQ( (std::vector<std::size_t>{ 5, 7 }), graphemes(cr::String(family)) );
+
+    /* ZWJ not preceded by a pictograph doesn't join */
+    const cr::Uint32 joiner[] = { 'a', 0x200D, 0x1F469, 0 };
+    EXPECT_EQ( (std::vector<std::size_t>{ 2, 3 }), graphemes(cr::String(joiner)) );
+
+    /* prepend and spacing marks (Devanagari) */
+    const cr::Uint32 devanagari[] = { 0x0915, 0x093F, 0x0937, 0 };
+    EXPECT_EQ( (std::vector<std::size_t>{ 2, 3 }), graphemes(cr::String(devanagari)) );
+
+    /* controls are always alone */
+    const cr::Uint32 control[] = { 0x0001, 0x0301, 0 };
+    EXPECT_EQ( (std::vector<std::size_t>{ 1, 2 }), graphemes(cr::String(control)) );
+}
+
+/**
+ * UTF-8 input : positions are in bytes
+ */
+TEST(TextSegmentationTest, utf8)
+{
+    /* "e" + U+0301, U+D55C, U+1F44D U+1F3FD */
+    std::string text("e\xCC\x81\xED\x95\x9C\xF0\x9F\x91\x8D\xF0\x9F\x8F\xBD");
+    EXPECT_EQ( (std::vector<std::size_t>{ 3, 6, 14 }), graphemes(text) );
+    EXPECT_EQ( 3u, cr::countGraphemes(text.data(), text.size()) );
+
+    /* invalid sequences are single characters */
+    std::string invalid("a\xC3(\xE2\x82\xF0\x9F\x91");
+    EXPECT_EQ( (std::vector<std::size_t>{ 1, 2, 3, 4, 5, 6, 7, 8 }), graphemes(invalid) );
+
+    std::string overlong("\xC0\xAF\xED\xA0\x80");
+    EXPECT_EQ( 5u, cr::countGraphemes(overlong.data(), overlong.size()) );
+}
+
+/**
+ * counting and truncation
+ */
+TEST(TextSegmentationTest, truncate)
+{
+    const cr::Uint32 text[] = { 'a', 0x0301, 'b', 0x1F1EB, 0x1F1F7, 'c', 0 };
+    cr::String s(text);
+
+    EXPECT_EQ( 4u, cr::countGraphemes(s) );
+    EXPECT_EQ( 0u, cr::graphemePrefixSize(s, 0) );
+    EXPECT_EQ( 2u, cr::graphemePrefixSize(s, 1) );
+    EXPECT_EQ( 5u, cr::graphemePrefixSize(s, 3) );
+    EXPECT_EQ( 6u, cr::graphemePrefixSize(s, 100) );
+
+    std::string utf8("na\xC3\xAFve");
+    EXPECT_EQ( 5u, cr::graphemePrefixSize(utf8.data(), utf8.size(), 4) );
+    EXPECT_EQ( 0u, cr::countGraphemes(NULL, 0) );
+}
+
+/**
+ * word boundaries
+ */
+TEST(TextSegmentationTest, word)
+{
+    EXPECT_EQ( (std::vector<std::string>{ "The", "quick", "brown", "fox" }),
+               words("The quick (\"brown\") fox.") );
+
+    /* apostrophes and periods inside words, numbers with separators */
+    EXPECT_EQ( (std::vector<std::string>{ "can't", "e.g", "3.14", "1,000", "v2" }),
+               words("can't e.g. 3.14 1,000 v2") );
+
+    /* connector punctuation */
+    EXPECT_EQ( (std::vector<std::string>{ "snake_case", "__init__" }),
+               words("snake_case + __init__") );
+
+    /* Katakana runs, ideographs are one per segment */
+    EXPECT_EQ( (std::vector<std::string>{ "\xE3\x82\xAB\xE3\x82\xBF\xE3\x82\xAB\xE3\x83\x8A",
+                                          "\xE6\xBC\xA2", "\xE5\xAD\x97" }),
+               words("\xE3\x82\xAB\xE3\x82\xBF\xE3\x82\xAB\xE3\x83\x8A\xE6\xBC\xA2\xE5\xAD\x97") );
+
+    /* combining marks stay in their word */
+    EXPECT_EQ( (std::vector<std::string>{ "cafe\xCC\x81", "ok" }), words("cafe\xCC\x81 ok") );
+
+    /* spaces stay together, CR LF too */
+    EXPECT_EQ( (std::vector<std::size_t>{ 5, 7, 9, 11, 12, 13 }), segments(cr::String("hello  ab\r\n\n!")) );
+}
@@ -0,0 +1,171 @@
+#include <TextWriter.hpp>
+#include <TextReader.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace
+{
+    std::string getTemporaryName()
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "/tmp/cr_text_writer_%d.txt", static_cast<int>(getpid()));
+        return name;
+    }
+
+    std::string readFile(const std::string& name)
+    {
+        std::ifstream file(name.c_str(), std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    cr::String makeText()
+    {
+        const cr::Uint32 chars[] = { 'c', 'a', 'f', 0xE9, ' ', 0xAC00, ' ', 0x1F600, 0 };
+        return cr::String(chars);
+    }
+}
+
+/**
+ * Encoding of the characters
+ */
+TEST(TextWriterTest, encodings)
+{
+    std::string name = getTemporaryName();
+    cr::String text = makeText();
+
+    {
+        cr::TextWriter writer(name);
+        ASSERT_TRUE( writer.isOpen() );
+        EXPECT_EQ( cr::UTF8, writer.getEncoding() );
+
+        writer.write(text).write(cr::Uint32('!'));
+        EXPECT_TRUE( writer.close() );
+        EXPECT_FALSE( writer.isOpen() );
+    }
+    EXPECT_EQ( "caf\xC3\xA9 \xEA\xB0\x80 \xF0\x9F\x98\x80!", readFile(name) );
+
+    {
+        cr::TextWriter writer(name, cr::UTF16BE);
+        writer.write(cr::Uint32(0x1F600)).write(cr::Uint32('a'));
+    }
+    EXPECT_EQ( std::string("\xD8\x3D\xDE\x00\x00\x61", 6), readFile(name) );
+
+    {
+        cr::TextWriter writer(name, cr::UTF32LE);
+        writer.write(cr::Uint32(0x1F600));
+    }
+    EXPECT_EQ( std::string("\x00\xF6\x01\x00", 4), readFile(name) );
+
+    /* read back by cr::TextReader, thanks to the byte order mark */
+    const cr::TextEncoding encodings[] = { cr::UTF8, cr::UTF16LE, cr::UTF16BE, cr::UTF32LE, cr::UTF32BE };
+    for (std::size_t i = 0; i < sizeof(encodings) / sizeof(encodings[0]); ++i)
+    {
+        {
+            cr::TextWriter writer(name, encodings[i]);
+            writer.writeBom().writeLine(text).writeLine(text);
+        }
+
+        cr::TextReader reader(name);
+        cr::StringView line;
+        ASSERT_TRUE( reader.readLine(line) );
+        EXPECT_EQ( encodings[i], reader.getEncoding() );
+        EXPECT_TRUE( line.toString() == text );
+        ASSERT_TRUE( reader.readLine(line) );
+        EXPECT_TRUE( line.toString() == text );
+        EXPECT_FALSE( reader.readLine(line) );
+    }
+
+    std::remove(name.c_str());
+}
+
+/**
+ * Output larger than the buffer, in both modes
+ */
+TEST(TextWriterTest, modes)
+{
+    std::string name = getTemporaryName();
+    cr::String text = makeText();
+
+    const cr::TextWriter::Mode modes[] = { cr::TextWriter::Buffered, cr::TextWriter::Direct };
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        std::string expected;
+        {
+            cr::TextWriter writer(name, cr::UTF8, modes[i], 1000);
+
+            for (int j = 0; j < 5000; ++j)
+            {
+                writer.writeLine(text);
+                expected += "caf\xC3\xA9 \xEA\xB0\x80 \xF0\x9F\x98\x80\n";
+            }
+
+            writer.flush();
+            EXPECT_LT( 0u, writer.getWrittenSize() );
+            EXPECT_TRUE( writer.close() );
+            EXPECT_EQ( expected.size(), writer.getWrittenSize() );
+        }
+
+        EXPECT_EQ( expected, readFile(name) );
+    }
+
+    std::remove(name.c_str());
+}
+
+/**
+ * UTF-8 given as is, small and large
+ */
+TEST(TextWriterTest, utf8)
+{
+    std::string name = getTemporaryName();
+    std::string large(100000, 'x');
+
+    {
+        cr::TextWriter writer(name, cr::UTF8, cr::TextWriter::Buffered, 8192);
+        writer.write(cr::Utf8View(std::string("head ")));
+        writer.write(cr::Utf8View(large));
+        writer.write(cr::Utf8View(std::string(" tail")));
+    }
+    EXPECT_EQ( "head " + large + " tail", readFile(name) );
+
+    {
+        cr::TextWriter writer(name, cr::UTF16LE);
+        writer.write(cr::Utf8View(std::string("\xC3\xA9")));
+    }
+    EXPECT_EQ( std::string("\xE9\x00", 2), readFile(name) );
+
+    std::remove(name.c_str());
+}
+
+/**
+ * Attached descriptor, closed writer
+ */
+TEST(TextWriterTest, descriptor)
+{
+    std::string name = getTemporaryName();
+    int file = ::open(name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ASSERT_LE( 0, file );
+
+    cr::TextWriter writer;
+    EXPECT_FALSE( writer.isOpen() );
+    writer.write(makeText());
+
+    writer.attach(file);
+    writer.write(cr::String("attached"));
+    EXPECT_TRUE( writer.close() );
+
+    /* the descriptor stays open */
+    EXPECT_EQ( 1, ::write(file, "!", 1) );
+    ::close(file);
+
+    EXPECT_EQ( "attached!", readFile(name) );
+    std::remove(name.c_str());
+
+    EXPECT_FALSE( writer.open("/nonexistent/cr_text_writer.txt") );
+}
@@ -0,0 +1,134 @@
+#include <Thread.hpp>
+#include <ThreadAttributes.hpp>
+#include <CpuTopology.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <pthread.h>
+#include <unistd.h>
+
+
+namespace
+{
+    /*
+     * What a thread sees of its own attributes
+     */
+    struct Observed
+    {
+        Observed() : stackSize(0), guardSize(0), cpu(-1), policy(-1) {}
+
+        std::size_t stackSize;
+        std::size_t guardSize;
+        int         cpu;
+        int         policy;
+        std::string name;
+    };
+
+    void observe(Observed* observed)
+    {
+        /*
+         * The name is set just after the creation
+         */
+        usleep(10000);
+
+        pthread_attr_t attr;
+        pthread_getattr_np(pthread_self(), &attr);
+        pthread_attr_getstacksize(&attr, &observed->stackSize);
+        pthread_attr_getguardsize(&attr, &observed->guardSize);
+        pthread_attr_destroy(&attr);
+
+        char name[16] = "";
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        observed->name = name;
+
+        sched_param param;
+        pthread_getschedparam(pthread_self(), &observed->policy, &param);
+        observed->cpu = sched_getcpu();
+    }
+}
+
+/**
+ * Default attributes
+ */
+TEST(ThreadAttributesTest, defaults)
+{
+    cr::ThreadAttributes attributes;
+    EXPECT_EQ(0u, attributes.stackSize);
+    EXPECT_EQ(cr::ThreadAttributes::DefaultGuardSize, attributes.guardSize);
+    EXPECT_TRUE(attributes.affinity.empty());
+    EXPECT_EQ(cr::ThreadAttributes::Inherit, attributes.policy);
+    EXPECT_TRUE(attributes.name.empty());
+
+    Observed observed;
+    cr::Thread thread(&observe, &observed);
+    EXPECT_TRUE(thread.launch(attributes));
+    thread.wait();
+    EXPECT_EQ(SCHED_OTHER, observed.policy);
+}
+
+/**
+ * Stack, guard, name, affinity and policy reach the thread
+ */
+TEST(ThreadAttributesTest, applied)
+{
+    std::vector<cr::CpuInfo> cpus = cr::CpuTopology::getCpus();
+    ASSERT_FALSE(cpus.empty());
+
+    cr::ThreadAttributes attributes(100 * 1000, "a rather long thread name");
+    attributes.guardSize = 2 * 4096;
+    attributes.pinTo(cpus.back().id);
+    attributes.policy = cr::ThreadAttributes::Batch;
+
+    Observed observed;
+    cr::Thread thread(&observe, &observed);
+    EXPECT_TRUE(thread.launch(attributes));
+    thread.wait();
+
+    EXPECT_EQ(102400u, observed.stackSize);
+    EXPECT_EQ(8192u, observed.guardSize);
+    EXPECT_EQ("a rather long t", observed.name);
+    EXPECT_EQ(static_cast<int>(cpus.back().id), observed.cpu);
+    EXPECT_EQ(SCHED_BATCH, observed.policy);
+}
+
+/**
+ * Refused attributes : the thread doesn't start
+ */
+TEST(ThreadAttributesTest, refused)
+{
+    cr::ThreadAttributes attributes;
+    attributes.pinTo(100000);
+
+    Observed observed;
+    cr::Thread thread(&observe, &observed);
+    EXPECT_FALSE(thread.launch(attributes));
+    thread.wait();
+    EXPECT_EQ(-1, observed.cpu);
+
+    EXPECT_TRUE(thread.launch());
+}
+
+/**
+ * CPU lists and topology
+ */
+TEST(CpuTopologyTest, topology)
+{
+    std::vector<unsigned int> list = cr::CpuTopology::parseList("0-3,8,10-11\n");
+    const unsigned int expected[] = { 0, 1, 2, 3, 8, 10, 11 };
+    EXPECT_EQ(std::vector<unsigned int>(expected, expected + 7), list);
+
+    EXPECT_TRUE(cr::CpuTopology::parseList("").empty());
+    EXPECT_TRUE(cr::CpuTopology::parseList("3-1").empty());
+    EXPECT_TRUE(cr::CpuTopology::parseList("1,x").empty());
+    EXPECT_EQ(1u, cr::CpuTopology::parseList("5,5").size());
+
+    std::vector<cr::CpuInfo> cpus = cr::CpuTopology::getCpus();
+    EXPECT_EQ(static_cast<std::size_t>(sysconf(_SC_NPROCESSORS_ONLN)), cpus.size());
+    for (std::size_t i = 1; i < cpus.size(); ++i)
+        EXPECT_LT(cpus[i - 1].id, cpus[i].id);
+
+    std::size_t cores = cr::CpuTopology::getCoreCount();
+    EXPECT_GE(cores, 1u);
+    EXPECT_LE(cores, cpus.size());
+    EXPECT_LE(cr::CpuTopology::getIsolatedCpus().size(), cpus.size());
+}
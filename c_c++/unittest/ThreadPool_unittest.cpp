@@ -0,0 +1,139 @@
+#include <ThreadPool.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+
+namespace
+{
+    int square(int value)
+    {
+        return value * value;
+    }
+}
+
+/**
+ * Results and exceptions come back through the handles
+ */
+TEST(ThreadPoolTest, submit)
+{
+    cr::ThreadPool pool(4);
+    EXPECT_EQ(4u, pool.getThreadCount());
+    EXPECT_TRUE(pool.isRunning());
+
+    std::vector<std::future<int> > results;
+    for (int i = 0; i < 100; ++i)
+        results.push_back(pool.submit([i]() { return square(i); }));
+
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(i * i, results[i].get());
+
+    std::future<std::string> text = pool.submit([]() { return std::string("pool"); });
+    EXPECT_EQ("pool", text.get());
+
+    std::future<void> failure = pool.submit([]() { throw std::runtime_error("task"); });
+    EXPECT_THROW(failure.get(), std::runtime_error);
+}
+
+/**
+ * All the tasks run, on several workers
+ */
+TEST(ThreadPoolTest, execute)
+{
+    std::atomic<int> count(0);
+    {
+        cr::ThreadPool pool(3);
+        for (int i = 0; i < 1000; ++i)
+            EXPECT_TRUE(pool.execute([&count]() { ++count; }));
+
+        /*
+         * An exception doesn't kill the worker
+         */
+        pool.execute([]() { throw std::runtime_error("ignored"); });
+    }
+    EXPECT_EQ(1000, count.load());
+}
+
+/**
+ * Shutdown runs the queued tasks, then refuses new ones
+ */
+TEST(ThreadPoolTest, shutdown)
+{
+    std::atomic<int> count(0);
+    cr::ThreadPool pool(1);
+
+    for (int i = 0; i < 50; ++i)
+        pool.execute([&count]() { usleep(100); ++count; });
+
+    pool.shutdown();
+    EXPECT_EQ(50, count.load());
+    EXPECT_FALSE(pool.isRunning());
+    EXPECT_EQ(0u, pool.getThreadCount());
+
+    EXPECT_FALSE(pool.execute([&count]() { ++count; }));
+    std::future<int> refused = pool.submit([]() { return 1; });
+    EXPECT_THROW(refused.get(), std::future_error);
+    EXPECT_EQ(50, count.load());
+
+    pool.shutdown();
+}
+
+/**
+ * A bounded queue blocks the producer until a worker takes a task
+ */
+TEST(ThreadPoolTest, queueCapacity)
+{
+    cr::ThreadPool pool(1, 2);
+    EXPECT_EQ(2u, pool.getQueueCapacity());
+
+    std::atomic<bool> release(false);
+    std::atomic<int> count(0);
+
+    /*
+     * The worker is busy with the first task, two more fill the queue
+     */
+    for (int i = 0; i < 3; ++i)
+        pool.execute([&]() { while (!release) usleep(100); ++count; });
+
+    while (pool.getQueueSize() != 2)
+        usleep(100);
+
+    std::atomic<bool> submitted(false);
+    cr::Thread producer([&]() { pool.execute([&count]() { ++count; }); submitted = true; });
+    producer.launch();
+
+    usleep(20000);
+    EXPECT_FALSE(submitted.load());
+    EXPECT_LE(pool.getQueueSize(), 2u);
+
+    release = true;
+    producer.wait();
+    EXPECT_TRUE(submitted.load());
+
+    pool.shutdown();
+    EXPECT_EQ(4, count.load());
+}
+
+/**
+ * Move-only callables and results
+ */
+TEST(ThreadPoolTest, moveOnly)
+{
+    cr::ThreadPool pool(2);
+
+    std::unique_ptr<int> value(new int(21));
+    struct Doubler
+    {
+        std::unique_ptr<int> value;
+        std::unique_ptr<int> operator()() { return std::unique_ptr<int>(new int(*value * 2)); }
+    };
+
+    Doubler doubler;
+    doubler.value = std::move(value);
+    std::future<std::unique_ptr<int> > result = pool.submit(std::move(doubler));
+    EXPECT_EQ(42, *result.get());
+}
@@ -0,0 +1,136 @@
+#include <Thread.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <string>
+
+
+namespace
+{
+    std::atomic<int> result(0);
+
+    void add(int a, int b)
+    {
+        result += a + b;
+    }
+
+    void appendText(std::string* output, const std::string& text, char suffix)
+    {
+        *output = text + suffix;
+    }
+
+    void consume(std::unique_ptr<int> value)
+    {
+        result += *value;
+    }
+
+    struct Counter
+    {
+        Counter() : count(0) {}
+
+        void increment() { ++count; }
+        void add(int value) { count += value; }
+        int get(int* output) const { *output = count; return count; }
+
+        int count;
+    };
+
+    /*
+     * Callable larger than the inline storage
+     */
+    struct Large
+    {
+        char               padding[cr::Thread::InlineSize * 2];
+        std::atomic<int>*  target;
+
+        void operator()() const { *target += sizeof(padding); }
+    };
+}
+
+/**
+ * Free functions with several arguments
+ */
+TEST(ThreadTest, freeFunction)
+{
+    result = 0;
+    {
+        cr::Thread thread(&add, 2, 3);
+        thread.launch();
+        thread.wait();
+        EXPECT_EQ(5, result.load());
+    }
+
+    std::string output;
+    cr::Thread thread(appendText, &output, std::string("text"), '!');
+    thread.launch();
+    thread.wait();
+    EXPECT_EQ("text!", output);
+}
+
+/**
+ * Member functions, with and without arguments
+ */
+TEST(ThreadTest, memberFunction)
+{
+    Counter counter;
+    {
+        cr::Thread first(&Counter::increment, &counter);
+        cr::Thread second(&Counter::add, &counter, 10);
+        first.launch();
+        first.wait();
+        second.launch();
+    }
+    EXPECT_EQ(11, counter.count);
+
+    int output = 0;
+    const Counter* constant = &counter;
+    cr::Thread third(&Counter::get, constant, &output);
+    third.launch();
+    third.wait();
+    EXPECT_EQ(11, output);
+}
+
+/**
+ * Lambdas, small and large callables, move-only arguments
+ */
+TEST(ThreadTest, callables)
+{
+    std::atomic<int> count(0);
+    {
+        cr::Thread thread([&count]() { ++count; });
+        thread.launch();
+    }
+    EXPECT_EQ(1, count.load());
+
+    Large large;
+    large.target = &count;
+    {
+        cr::Thread thread(large);
+        thread.launch();
+    }
+    EXPECT_EQ(1 + static_cast<int>(sizeof(large.padding)), count.load());
+
+    result = 0;
+    std::unique_ptr<int> value(new int(42));
+    cr::Thread thread(&consume, std::move(value));
+    EXPECT_FALSE(value);
+    thread.launch();
+    thread.wait();
+    EXPECT_EQ(42, result.load());
+}
+
+/**
+ * A thread can be launched again once finished
+ */
+TEST(ThreadTest, relaunch)
+{
+    std::atomic<int> count(0);
+    cr::Thread thread([&count]() { ++count; });
+
+    for (int i = 0; i < 10; ++i)
+        thread.launch();
+    thread.wait();
+    thread.wait();
+
+    EXPECT_EQ(10, count.load());
+}
@@ -0,0 +1,121 @@
+#include <Utf8View.hpp>
+#include <String.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+
+/**
+ * Construction and access
+ */
+TEST(Utf8ViewTest, access)
+{
+    cr::Utf8View empty;
+    EXPECT_TRUE( empty.isEmpty() );
+    EXPECT_EQ( 0u, empty.getSize() );
+    EXPECT_TRUE( empty.isValid() );
+    EXPECT_TRUE( empty.toString().isEmpty() );
+
+    std::string text("hello world");
+    cr::Utf8View view(text);
+    EXPECT_EQ( text.size(), view.getSize() );
+    EXPECT_EQ( text.data(), view.getData() );
+    EXPECT_EQ( text.data() + text.size(), view.end() );
+
+    cr::Utf8View world = view.substring(6);
+    EXPECT_EQ( "world", std::string(world.begin(), world.end()) );
+    EXPECT_EQ( 2u, view.substring(3, 2).getSize() );
+    EXPECT_EQ( 5u, view.substring(6, 100).getSize() );
+    EXPECT_EQ( 0u, view.substring(11).getSize() );
+    EXPECT_EQ( 0u, view.substring(20, 3).getSize() );
+    EXPECT_EQ( view.end(), view.substring(20).begin() );
+}
+
+/**
+ * Byte order mark
+ */
+TEST(Utf8ViewTest, bom)
+{
+    std::string text("\xEF\xBB\xBF" "abc");
+    cr::Utf8View view(text);
+
+    EXPECT_TRUE( view.hasBom() );
+    EXPECT_EQ( 3u, view.skipBom().getSize() );
+    EXPECT_FALSE( view.skipBom().hasBom() );
+    EXPECT_EQ( 3u, view.skipBom().skipBom().getSize() );
+    EXPECT_FALSE( cr::Utf8View("\xEF\xBB", 2).hasBom() );
+}
+
+/**
+ * Validation of the byte sequences
+ */
+TEST(Utf8ViewTest, isValid)
+{
+    EXPECT_TRUE( cr::Utf8View(std::string("plain ASCII text, longer than sixteen bytes")).isValid() );
+    EXPECT_TRUE( cr::Utf8View(std::string("caf\xC3\xA9 \xEA\xB0\x80 \xF0\x9F\x98\x80 \xF4\x8F\xBF\xBF")).isValid() );
+
+    EXPECT_FALSE( cr::Utf8View(std::string("\xC0\xAF")).isValid() );             /* overlong */
+    EXPECT_FALSE( cr::Utf8View(std::string("\xE0\x80\xAF")).isValid() );         /* overlong */
+    EXPECT_FALSE( cr::Utf8View(std::string("\xED\xA0\x80")).isValid() );         /* surrogate */
+    EXPECT_FALSE( cr::Utf8View(std::string("\xF4\x90\x80\x80")).isValid() );     /* past U+10FFFF */
+    EXPECT_FALSE( cr::Utf8View(std::string("abc\xE2\x82")).isValid() );          /* truncated */
+    EXPECT_FALSE( cr::Utf8View(std::string("\x80")).isValid() );                 /* lone continuation */
+    EXPECT_FALSE( cr::Utf8View(std::string("0123456789abcdef0123\xFF")).isValid() );
+}
+
+/**
+ * Decoding
+ */
+TEST(Utf8ViewTest, toString)
+{
+    std::string text("a\xC3\xA9\xEA\xB0\x80\xF0\x9F\x98\x80");
+    cr::String str = cr::Utf8View(text).toString();
+
+    ASSERT_EQ( 4u, str.getSize() );
+    EXPECT_EQ( 0x61u,    str[0] );
+    EXPECT_EQ( 0xE9u,    str[1] );
+    EXPECT_EQ( 0xAC00u,  str[2] );
+    EXPECT_EQ( 0x1F600u, str[3] );
+}
+
+/**
+ * Decoding of malformed sequences : one U+FFFD each, the next byte kept
+ */
+TEST(Utf8ViewTest, toStringMalformed)
+{
+    std::string text("caf\xE9\nnext\n");
+    cr::String str = cr::Utf8View(text).toString();
+
+    ASSERT_EQ( 10u, str.getSize() );
+    EXPECT_EQ( 0xFFFDu, str[3] );
+    EXPECT_EQ( cr::Uint32('\n'), str[4] );
+    EXPECT_EQ( cr::Uint32('n'), str[5] );
+
+    const char* cases[] =
+    {
+        "\xC0\xAF" "x",          /* overlong : two bytes replaced */
+        "\xE0\x80\xAF" "x",      /* overlong */
+        "\xED\xA0\x80" "x",      /* surrogate */
+        "\xF4\x90\x80\x80" "x",  /* past U+10FFFF */
+        "\xFF" "x"               /* invalid byte */
+    };
+    const std::size_t sizes[] = { 3, 4, 4, 5, 2 };
+
+    for (std::size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+    {
+        str = cr::Utf8View(std::string(cases[i])).toString();
+        ASSERT_EQ( sizes[i], str.getSize() ) << i;
+        for (std::size_t j = 0; j + 1 < sizes[i]; ++j)
+            EXPECT_EQ( 0xFFFDu, str[j] ) << i;
+        EXPECT_EQ( cr::Uint32('x'), str[sizes[i] - 1] ) << i;
+    }
+
+    /*
+     * Truncated sequences : the valid beginning is one U+FFFD
+     */
+    str = cr::Utf8View(std::string("a\xE2\x82" "b\xF0\x9F\x98")).toString();
+    ASSERT_EQ( 4u, str.getSize() );
+    EXPECT_EQ( cr::Uint32('a'), str[0] );
+    EXPECT_EQ( 0xFFFDu, str[1] );
+    EXPECT_EQ( cr::Uint32('b'), str[2] );
+    EXPECT_EQ( 0xFFFDu, str[3] );
+}